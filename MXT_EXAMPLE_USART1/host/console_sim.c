@@ -0,0 +1,80 @@
+/*
+ * console_sim.c
+ *
+ * Created: 18/10/2026
+ *
+ * console.h no build de host. O que o firmware escreve na console (inclusive
+ * o trace binario) vai para o arquivo de captura (-c), que pode ser lido
+ * com tools/trace_decode.py; printf continua indo para a saida padrao.
+ * console_getc() e o ponto em que o main loop devolve o controle ao
+ * simulador (sim_step).
+ */
+
+#include "console.h"
+#include "sim.h"
+
+static FILE *gs_capture;
+static console_stats_t gs_stats;
+
+void sim_console_capture(FILE *f)
+{
+	gs_capture = f;
+}
+
+void console_init(void)
+{
+}
+
+int console_write(const char *data, size_t len)
+{
+	if (len == 0) {
+		return 0;
+	}
+	if (gs_capture != NULL) {
+		fwrite(data, 1, len, gs_capture);
+	}
+	gs_stats.written += len;
+	return (int)len;
+}
+
+void console_set_overflow(int policy)
+{
+	(void)policy;
+}
+
+void console_flush(void)
+{
+	if (gs_capture != NULL) {
+		fflush(gs_capture);
+	}
+}
+
+bool console_tx_busy(void)
+{
+	return false;
+}
+
+void console_set_mck(uint32_t mck)
+{
+	(void)mck;
+}
+
+void console_get_stats(console_stats_t *stats)
+{
+	*stats = gs_stats;
+}
+
+int console_getc(void)
+{
+	return sim_step();
+}
+
+bool console_rx_pending(void)
+{
+	return false;
+}
+
+uint32_t console_rx_count(void)
+{
+	return 0;
+}
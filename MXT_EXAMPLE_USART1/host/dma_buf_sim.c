@@ -0,0 +1,55 @@
+/*
+ * dma_buf_sim.c
+ *
+ * Created: 18/10/2026
+ *
+ * dma_buf.h no build de host: sem cache nem MPU, todo buffer e coerente e
+ * as operacoes de cache nao fazem nada.
+ */
+
+#include <stdlib.h>
+#include "dma_buf.h"
+
+void dma_buf_init(void)
+{
+}
+
+void *dma_buf_alloc(size_t size)
+{
+	void *p;
+
+	if (posix_memalign(&p, DMA_BUF_LINE, DMA_BUF_ROUND(size)) != 0) {
+		return NULL;
+	}
+	return p;
+}
+
+size_t dma_buf_available(void)
+{
+	return SIZE_MAX;
+}
+
+bool dma_buf_is_coherent(const void *addr, size_t size)
+{
+	(void)addr;
+	(void)size;
+	return true;
+}
+
+void dma_buf_clean(const void *addr, size_t size)
+{
+	(void)addr;
+	(void)size;
+}
+
+void dma_buf_invalidate(void *addr, size_t size)
+{
+	(void)addr;
+	(void)size;
+}
+
+void dma_buf_clean_invalidate(void *addr, size_t size)
+{
+	(void)addr;
+	(void)size;
+}
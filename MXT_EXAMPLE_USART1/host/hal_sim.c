@@ -0,0 +1,242 @@
+/*
+ * hal_sim.c
+ *
+ * Created: 18/10/2026
+ *
+ * Perifericos simulados para o build de host: a base de tempo (timebase.h)
+ * e o relogio virtual e o alarme dela chama timer_run() como a interrupcao
+ * do firmware; o maXTouch le os toques de uma fila preenchida pelo roteiro
+ * e o botao da porta gera uma borda no PIOA simulado (pio_sim.c), que o
+ * pio_handler.c do ASF despacha para o callback registrado.
+ */
+
+#include <stdio.h>
+#include "sim.h"
+#include "timebase.h"
+#include "timer.h"
+
+struct sim_periph {
+	int unused;
+};
+
+Gpbr sim_gpbr;
+Usart sim_usart1;
+Twihs sim_twihs0;
+Spi sim_spi0;
+
+/* ---- diversos ---- */
+
+void delay_ms(uint32_t ms)
+{
+	sim_advance_ns((uint64_t)ms * 1000000u);
+}
+
+void delay_us(uint32_t us)
+{
+	sim_advance_ns((uint64_t)us * 1000u);
+}
+
+void pmc_enable_periph_clk(uint32_t id)
+{
+	(void)id;
+}
+
+/* ---- base de tempo (timebase.h): o relogio virtual em us ---- */
+
+static uint64_t gs_tb_zero;                 // ns em timebase_init()
+static uint64_t gs_tb_alarm = UINT64_MAX;   // us
+
+void timebase_init(void)
+{
+	gs_tb_zero = sim_now_ns();
+}
+
+uint64_t now_us(void)
+{
+	return (sim_now_ns() - gs_tb_zero) / 1000;
+}
+
+void timebase_arm(uint64_t at_us)
+{
+	gs_tb_alarm = at_us;
+}
+
+void timebase_disarm(void)
+{
+	gs_tb_alarm = UINT64_MAX;
+}
+
+/* O simulador nao dorme: nada a acertar */
+void timebase_adjust(uint64_t us)
+{
+	(void)us;
+}
+
+/* ---- timers ---- */
+
+uint64_t sim_timers_next(void)
+{
+	if (gs_tb_alarm == UINT64_MAX) {
+		return UINT64_MAX;
+	}
+	return gs_tb_zero + gs_tb_alarm * 1000;
+}
+
+void sim_timers_run(void)
+{
+	if (gs_tb_alarm == UINT64_MAX || now_us() < gs_tb_alarm) {
+		return;
+	}
+	gs_tb_alarm = UINT64_MAX;
+	timer_run();
+}
+
+/* ---- PIO: LED, botao da porta e D/C do LCD ---- */
+
+/* As interrupcoes do PIO passam pelo pio_handler.c do ASF, sobre os
+ * registradores de pio_sim.c */
+
+uint32_t pio_configure(Pio *p_pio, int type, uint32_t mask, uint32_t attr)
+{
+	(void)p_pio; (void)type; (void)mask; (void)attr;
+	return 1;
+}
+
+void pio_set(Pio *p_pio, uint32_t mask)
+{
+	(void)p_pio;
+	(void)mask;
+}
+
+void pio_clear(Pio *p_pio, uint32_t mask)
+{
+	(void)p_pio;
+	(void)mask;
+}
+
+/* Entradas em nivel alto: os pull-ups com nada apertado */
+uint32_t pio_get(Pio *p_pio, int type, uint32_t mask)
+{
+	(void)p_pio;
+	(void)type;
+	return mask;
+}
+
+void pio_set_pin_high(uint32_t ul_pin)
+{
+	if (ul_pin == LCD_SPI_CDS_PIO) {
+		sim_spi_set_dc(true);
+	}
+}
+
+void pio_set_pin_low(uint32_t ul_pin)
+{
+	if (ul_pin == LCD_SPI_CDS_PIO) {
+		sim_spi_set_dc(false);
+	}
+}
+
+/* Botao da porta: PIOA11, borda de subida */
+void sim_button_press(void)
+{
+	sim_pio_edge(PIOA, 1u << 11);
+}
+
+/* ---- maXTouch ---- */
+
+#define TOUCH_QUEUE 32
+
+static struct mxt_touch_event gs_touch[TOUCH_QUEUE];
+static unsigned gs_touch_head, gs_touch_tail;
+
+enum status_code mxt_init_device(struct mxt_device *device, Twihs *interface,
+		uint8_t address, uint32_t chg_pin)
+{
+	device->interface = interface;
+	device->address = address;
+	device->chg_pin = chg_pin;
+	return STATUS_OK;
+}
+
+uint16_t mxt_get_object_address(struct mxt_device *device, uint8_t type,
+		uint8_t instance)
+{
+	(void)device;
+	return (uint16_t)(type * 64 + instance);
+}
+
+enum status_code mxt_write_config_reg(struct mxt_device *device,
+		uint16_t address, uint8_t value)
+{
+	(void)device; (void)address; (void)value;
+	return STATUS_OK;
+}
+
+enum status_code mxt_write_config_object_sim(struct mxt_device *device,
+		uint16_t address, const void *object, size_t size)
+{
+	(void)device; (void)address; (void)object; (void)size;
+	return STATUS_OK;
+}
+
+bool mxt_is_message_pending(struct mxt_device *device)
+{
+	(void)device;
+	return gs_touch_head != gs_touch_tail;
+}
+
+enum status_code mxt_read_touch_event(struct mxt_device *device,
+		struct mxt_touch_event *touch_event)
+{
+	(void)device;
+	if (gs_touch_head == gs_touch_tail) {
+		return ERR_IO_ERROR;
+	}
+	*touch_event = gs_touch[gs_touch_tail++ % TOUCH_QUEUE];
+	return STATUS_OK;
+}
+
+/* Desalinhamento do painel em pixels (comando panel do roteiro) */
+static int gs_panel_dx, gs_panel_dy;
+
+void sim_touch_panel(int dx, int dy)
+{
+	gs_panel_dx = dx;
+	gs_panel_dy = dy;
+}
+
+/* Pixel para 0..4095, arredondado */
+static uint16_t touch_raw(int v, int size)
+{
+	int raw = (v * 4096 + size / 2) / size;
+
+	return (uint16_t)Min(Max(raw, 0), 4095);
+}
+
+/**
+ * \brief Enfileira um toque do dedo \a id em coordenadas da tela.
+ *
+ * O maXTouch reporta 0..4095 com os eixos trocados em relacao ao LCD; o
+ * ponto e convertido de volta para que a calibracao nominal (touch_cal.h)
+ * devolva exatamente (x, y). Com o painel desalinhado o toque sai deslocado
+ * de (dx, dy), ate a calibracao corrigir.
+ */
+void sim_touch_push(uint8_t id, uint8_t status, int x, int y)
+{
+	struct mxt_touch_event *e;
+
+	x += gs_panel_dx;
+	y += gs_panel_dy;
+
+	if (gs_touch_head - gs_touch_tail >= TOUCH_QUEUE) {
+		fprintf(stderr, "sim: fila de toques cheia\n");
+		return;
+	}
+	e = &gs_touch[gs_touch_head++ % TOUCH_QUEUE];
+	memset(e, 0, sizeof(*e));
+	e->id = id;
+	e->status = status;
+	e->y = touch_raw(ILI9488_LCD_WIDTH - x, ILI9488_LCD_WIDTH);
+	e->x = touch_raw(y, ILI9488_LCD_HEIGHT);
+	e->size = 8;
+}
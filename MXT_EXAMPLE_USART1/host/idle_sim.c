@@ -0,0 +1,43 @@
+/*
+ * idle_sim.c
+ *
+ * Created: 18/10/2026
+ *
+ * idle.h no build de host: o main loop nunca dorme (o tempo do simulador so
+ * anda em console_getc()).
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "idle.h"
+
+void idle_init(void)
+{
+}
+
+void idle_enter(void)
+{
+}
+
+void idle_wake(int source)
+{
+	(void)source;
+}
+
+void idle_touch_processed(void)
+{
+}
+
+void idle_get_stats(idle_stats_t *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+}
+
+void idle_reset(void)
+{
+}
+
+void idle_dump(void)
+{
+	printf("\n\ridle: sem sono no build de host\n\r");
+}
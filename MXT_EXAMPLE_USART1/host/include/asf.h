@@ -0,0 +1,117 @@
+/*
+ * asf.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: substitui o asf.h do Atmel Studio com so a parte do ASF
+ * que a aplicacao usa (maXTouch, PIO, SPI, USART). As funcoes sao
+ * implementadas em cima do simulador (hal_sim.c, spi_sim.c); os nomes e
+ * assinaturas seguem os do ASF para main.c compilar sem mudancas. O driver
+ * do ILI9488 e o proprio do ASF, compilado sobre o SPI simulado.
+ */
+
+
+#ifndef ASF_H
+#define ASF_H
+
+#include "compiler.h"
+#include "pio.h"
+#include "pio_handler.h"
+#include "spi_master.h"
+#include "ili9488.h"
+
+enum status_code {
+	STATUS_OK = 0,
+	ERR_IO_ERROR = -1,
+};
+
+typedef uint32_t irqflags_t;
+
+static inline irqflags_t cpu_irq_save(void)
+{
+	return 0;
+}
+
+static inline void cpu_irq_restore(irqflags_t flags)
+{
+	(void)flags;
+}
+
+#define cpu_irq_disable()       do { } while (0)
+#define cpu_irq_enable()        do { } while (0)
+
+/* ---- clock, board, delay ---- */
+
+#define sysclk_init()           do { } while (0)
+#define board_init()            do { } while (0)
+#define sysclk_get_cpu_hz()     300000000u
+#define sysclk_get_peripheral_hz()  150000000u
+#define FREQ_SLOW_CLOCK_EXT     32768u
+
+#include "delay.h"
+
+/* ---- USART / stdio ---- */
+
+typedef struct {
+	uint32_t baudrate;
+	uint32_t charlength;
+	uint32_t paritytype;
+	uint32_t stopbits;
+} usart_serial_options_t;
+
+#define stdio_serial_init(usart, opt)   do { (void)(usart); (void)(opt); } while (0)
+
+/* ---- TWIHS + maXTouch ---- */
+
+typedef struct {
+	uint32_t speed;
+	uint8_t chip;
+} twihs_master_options_t;
+
+#define twihs_master_setup(twihs, opt)  ((void)(twihs), (void)(opt), STATUS_OK)
+
+#define MXT_TWI_SPEED                       400000
+#define MXT_RESET_TIME                      65
+#define MAXTOUCH_XPRO_TWIHS                 TWIHS0
+#define MAXTOUCH_XPRO_CHG_PIO               PIO_PA2_IDX
+
+#define MXT_GEN_COMMANDPROCESSOR_T6         6
+#define MXT_GEN_POWERCONFIG_T7              7
+#define MXT_GEN_ACQUISITIONCONFIG_T8        8
+#define MXT_TOUCH_MULTITOUCHSCREEN_T9       9
+#define MXT_SPT_CTE_CONFIGURATION_T46       46
+#define MXT_PROCI_SHIELDLESS_T56            56
+#define MXT_GEN_COMMANDPROCESSOR_RESET      0
+#define MXT_GEN_COMMANDPROCESSOR_CALIBRATE  2
+
+struct mxt_touch_event {
+	uint8_t id;
+	uint8_t status;
+	uint16_t x;
+	uint16_t y;
+	uint8_t size;
+	int8_t deltax;
+	int8_t deltay;
+};
+
+struct mxt_device {
+	Twihs *interface;
+	uint8_t address;
+	uint32_t chg_pin;
+};
+
+enum status_code mxt_init_device(struct mxt_device *device, Twihs *interface,
+		uint8_t address, uint32_t chg_pin);
+uint16_t mxt_get_object_address(struct mxt_device *device, uint8_t type,
+		uint8_t instance);
+enum status_code mxt_write_config_reg(struct mxt_device *device,
+		uint16_t address, uint8_t value);
+#define mxt_write_config_object(device, address, object) \
+	mxt_write_config_object_sim((device), (address), (object), sizeof(*(object)))
+enum status_code mxt_write_config_object_sim(struct mxt_device *device,
+		uint16_t address, const void *object, size_t size);
+bool mxt_is_message_pending(struct mxt_device *device);
+enum status_code mxt_read_touch_event(struct mxt_device *device,
+		struct mxt_touch_event *touch_event);
+
+#endif /* ASF_H */
@@ -0,0 +1,21 @@
+/*
+ * board.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: as definicoes de same70_xplained.h que o driver do ILI9488
+ * usa em modo SPI.
+ */
+
+
+#ifndef BOARD_H_
+#define BOARD_H_
+
+#include "pio.h"
+
+#define BOARD_ILI9488_SPI         SPI0
+#define BOARD_ILI9488_SPI_NPCS    3
+#define BOARD_ILI9488_ADDR        0x63000000
+#define LCD_SPI_CDS_PIO           PIO_PA6_IDX
+
+#endif /* BOARD_H_ */
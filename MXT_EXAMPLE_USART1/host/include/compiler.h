@@ -0,0 +1,26 @@
+/*
+ * compiler.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: o pedaco de utils/compiler.h do ASF usado pela aplicacao e
+ * pelo driver do ILI9488.
+ */
+
+
+#ifndef UTILS_COMPILER_H
+#define UTILS_COMPILER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "sam.h"
+
+#define Min(a, b)           (((a) < (b)) ? (a) : (b))
+#define Max(a, b)           (((a) > (b)) ? (a) : (b))
+#define UNUSED(v)           (void)(v)
+#define ctz(u)              ((u) ? __builtin_ctz(u) : 32)
+#define Assert(expr)        ((void)0)
+
+#endif /* UTILS_COMPILER_H */
@@ -0,0 +1,12 @@
+/*
+ * conf_board.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: sem TCM nem cache (tcm.h deixa TCM_CODE/TCM_BSS vazios).
+ */
+
+#ifndef CONF_BOARD_H_INCLUDED
+#define CONF_BOARD_H_INCLUDED
+
+#endif /* CONF_BOARD_H_INCLUDED */
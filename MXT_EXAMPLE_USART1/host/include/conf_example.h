@@ -0,0 +1,15 @@
+/*
+ * conf_example.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: mesmos valores de src/config/conf_example.h.
+ */
+
+#ifndef CONF_EXAMPLE_H
+#define CONF_EXAMPLE_H
+
+#define MAXTOUCH_TWI_INTERFACE           MAXTOUCH_XPRO_TWIHS
+#define MAXTOUCH_TWI_ADDRESS             0x4A
+
+#endif /* CONF_EXAMPLE_H */
@@ -0,0 +1,18 @@
+/*
+ * conf_uart_serial.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: mesmos valores de src/config/conf_uart_serial.h.
+ */
+
+#ifndef CONF_USART_SERIAL_H
+#define CONF_USART_SERIAL_H
+
+#define USART_SERIAL_EXAMPLE              USART1
+#define USART_SERIAL_EXAMPLE_BAUDRATE     (115200UL)
+#define USART_SERIAL_CHAR_LENGTH          8
+#define USART_SERIAL_PARITY               0
+#define USART_SERIAL_STOP_BIT             1
+
+#endif /* CONF_USART_SERIAL_H */
@@ -0,0 +1,18 @@
+/*
+ * delay.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: delays do ASF, que avancam o relogio virtual (hal_sim.c).
+ */
+
+
+#ifndef DELAY_H_INCLUDED
+#define DELAY_H_INCLUDED
+
+#include <stdint.h>
+
+void delay_ms(uint32_t ms);
+void delay_us(uint32_t us);
+
+#endif /* DELAY_H_INCLUDED */
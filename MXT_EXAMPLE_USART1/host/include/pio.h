@@ -0,0 +1,47 @@
+/*
+ * pio.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: PIO do ASF (hal_sim.c, pio_sim.c). O pino D/C do LCD
+ * (LCD_SPI_CDS_PIO) vai para o barramento simulado em spi_sim.c; as
+ * interrupcoes passam pelo pio_handler.c do proprio ASF.
+ */
+
+
+#ifndef PIO_H_INCLUDED
+#define PIO_H_INCLUDED
+
+#include "compiler.h"
+
+#define PIO_INPUT           0
+#define PIO_OUTPUT_0        1
+#define PIO_OUTPUT_1        2
+#define PIO_DEFAULT         0
+#define PIO_PULLUP          (1u << 0)
+#define PIO_DEBOUNCE        (1u << 3)
+#define PIO_IT_RISE_EDGE    (1u << 5)
+#define PIO_IT_FALL_EDGE    (1u << 6)
+#define PIO_PA2_IDX         2
+#define PIO_PA6_IDX         6
+
+uint32_t pio_configure(Pio *p_pio, int type, uint32_t mask, uint32_t attr);
+void pio_set(Pio *p_pio, uint32_t mask);
+void pio_clear(Pio *p_pio, uint32_t mask);
+uint32_t pio_get(Pio *p_pio, int type, uint32_t mask);
+void pio_set_pin_high(uint32_t ul_pin);
+void pio_set_pin_low(uint32_t ul_pin);
+void pio_enable_interrupt(Pio *p_pio, uint32_t mask);
+void pio_disable_interrupt(Pio *p_pio, uint32_t mask);
+void pio_configure_interrupt(Pio *p_pio, const uint32_t ul_mask,
+		const uint32_t ul_attr);
+uint32_t pio_get_interrupt_status(const Pio *p_pio);
+uint32_t pio_get_interrupt_mask(const Pio *p_pio);
+Pio *pio_get_pin_group(uint32_t ul_pin);
+uint32_t pio_get_pin_group_id(uint32_t ul_pin);
+uint32_t pio_get_pin_group_mask(uint32_t ul_pin);
+
+/* Borda nos pinos de mask (pio_sim.c) */
+void sim_pio_edge(Pio *p_pio, uint32_t mask);
+
+#endif /* PIO_H_INCLUDED */
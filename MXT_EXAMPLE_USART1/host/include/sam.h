@@ -0,0 +1,62 @@
+/*
+ * sam.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: instancias dos perifericos (so ponteiros para identificar
+ * qual e qual, definidos em hal_sim.c; o PIO tem os registradores de
+ * interrupcao, em pio_sim.c), ids do PMC e NVIC vazio.
+ */
+
+
+#ifndef SAM_H_
+#define SAM_H_
+
+#include <stdint.h>
+
+/* ---- perifericos: ponteiros so para identificar a instancia ---- */
+
+typedef struct {
+	volatile uint32_t PIO_IMR;
+	volatile uint32_t PIO_ISR;
+} Pio;
+
+/* Registradores de backup: zerados a cada execucao, como depois de faltar
+ * energia no backup */
+typedef struct {
+	volatile uint32_t SYS_GPBR[8];
+} Gpbr;
+
+typedef struct sim_periph Usart;
+typedef struct sim_periph Twihs;
+typedef struct sim_periph Spi;
+
+extern Pio sim_pioa;
+extern Pio sim_pioc;
+extern Gpbr sim_gpbr;
+extern Usart sim_usart1;
+extern Twihs sim_twihs0;
+extern Spi sim_spi0;
+
+#define PIOA        (&sim_pioa)
+#define PIOC        (&sim_pioc)
+#define GPBR        (&sim_gpbr)
+#define USART1      (&sim_usart1)
+#define TWIHS0      (&sim_twihs0)
+#define SPI0        (&sim_spi0)
+
+typedef int IRQn_Type;
+
+#define ID_PIOA     10
+#define ID_PIOC     12
+#define ID_USART1   14
+#define ID_SPI0     21
+
+#define NVIC_EnableIRQ(irq)             do { (void)(irq); } while (0)
+#define NVIC_DisableIRQ(irq)            do { (void)(irq); } while (0)
+#define NVIC_ClearPendingIRQ(irq)       do { (void)(irq); } while (0)
+#define NVIC_SetPriority(irq, prio)     do { (void)(irq); (void)(prio); } while (0)
+
+void pmc_enable_periph_clk(uint32_t id);
+
+#endif /* SAM_H_ */
@@ -0,0 +1,45 @@
+/*
+ * spi_master.h
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host: SPI master do ASF sobre o barramento simulado do LCD
+ * (spi_sim.c). As escritas vao para o modelo do ILI9488 e, se ligado, para
+ * o registro do barramento; as leituras sao respondidas pelo modelo.
+ */
+
+
+#ifndef SPI_MASTER_H_INCLUDED
+#define SPI_MASTER_H_INCLUDED
+
+#include "compiler.h"
+
+#define SPI_MODE_3          3
+#define SPI_CS_RISE_NO_TX   1
+#define SPI_IER_RDRF        (1u << 0)
+
+struct spi_device {
+	uint32_t id;
+};
+
+void spi_master_init(Spi *p_spi);
+void spi_master_setup_device(Spi *p_spi, struct spi_device *device,
+		uint32_t flags, uint32_t baud_rate, uint32_t sel_id);
+void spi_select_device(Spi *p_spi, struct spi_device *device);
+void spi_deselect_device(Spi *p_spi, struct spi_device *device);
+void spi_configure_cs_behavior(Spi *p_spi, uint32_t ul_pcs_ch, uint32_t ul_cs_behavior);
+void spi_enable(Spi *p_spi);
+void spi_disable(Spi *p_spi);
+void spi_enable_interrupt(Spi *p_spi, uint32_t ul_sources);
+
+uint32_t spi_write(Spi *p_spi, uint16_t us_data, uint8_t uc_pcs, uint8_t uc_last);
+uint32_t spi_write_packet(Spi *p_spi, const uint8_t *data, size_t len);
+
+#define SPI_REPEAT_PATTERN_MAX  4
+
+void spi_write_stream(Spi *p_spi, uint32_t ul_pcs_ch, const uint8_t *data, size_t len);
+void spi_write_repeat(Spi *p_spi, uint32_t ul_pcs_ch, const uint8_t *pattern,
+		size_t pattern_len, size_t count);
+uint32_t spi_read_packet(Spi *p_spi, uint8_t *data, size_t len);
+
+#endif /* SPI_MASTER_H_INCLUDED */
@@ -0,0 +1,318 @@
+/*
+ * lcd_sim.c
+ *
+ * Created: 18/10/2026
+ *
+ * Modelo do ILI9488 em modo SPI: decodifica os comandos que chegam pelo
+ * barramento (spi_sim.c) e escreve num framebuffer RGB888 do tamanho da
+ * tela. Cobre o que o driver do ASF usa: janela (CASET/PASET), escrita de
+ * memoria (RAMWR e RAMWR continue) em 18 ou 16 bits por pixel (COLMOD) e a
+ * leitura do id. MADCTL so descreve a montagem do vidro, entao a imagem fica
+ * nas coordenadas logicas. tools/spi_replay.py implementa o mesmo modelo em
+ * cima do registro do barramento.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+#define W   ILI9488_LCD_WIDTH
+#define H   ILI9488_LCD_HEIGHT
+
+/* Parametros de READ_ID4 (o primeiro e o byte de folga) */
+static const uint8_t gs_id4[4] = { 0x00, 0x00, 0x94, 0x88 };
+
+static uint8_t gs_fb[H][W][3];
+
+static uint8_t gs_cmd;
+static uint32_t gs_nparam;
+static uint8_t gs_param[4];
+
+/* Janela (CASET/PASET) e posicao de escrita dentro dela */
+static uint16_t gs_sc, gs_ec, gs_sp, gs_ep;
+static uint32_t gs_x0, gs_y0, gs_x1, gs_y1;
+static uint32_t gs_cx, gs_cy;
+
+static uint32_t gs_bpp = 3;     // bytes por pixel (COLMOD)
+static uint32_t gs_phase;       // byte do pixel corrente
+static uint8_t gs_pixel[3];
+static uint8_t gs_read_index;   // parametro de leitura (SPI_READ_SETTINGS)
+
+static sim_lcd_stats_t gs_stats;
+
+static uint32_t clamp(uint32_t v, uint32_t max)
+{
+	return v > max ? max : v;
+}
+
+/* RAMWR: volta ao inicio da janela, recortada como
+ * ili9488_check_box_coordinates */
+static void open_window(void)
+{
+	uint32_t t;
+
+	gs_x0 = clamp(gs_sc, W - 1);
+	gs_x1 = clamp(gs_ec, W - 1);
+	gs_y0 = clamp(gs_sp, H - 1);
+	gs_y1 = clamp(gs_ep, H - 1);
+	if (gs_x0 > gs_x1) { t = gs_x0; gs_x0 = gs_x1; gs_x1 = t; }
+	if (gs_y0 > gs_y1) { t = gs_y0; gs_y0 = gs_y1; gs_y1 = t; }
+	gs_cx = gs_x0;
+	gs_cy = gs_y0;
+	gs_phase = 0;
+	gs_stats.windows++;
+}
+
+/* Um pixel na posicao corrente; a janela da a volta como a GRAM */
+static void put_pixel(void)
+{
+	uint8_t *p = gs_fb[gs_cy][gs_cx];
+
+	if (gs_bpp == 3) {
+		p[0] = gs_pixel[0] & 0xFC;
+		p[1] = gs_pixel[1] & 0xFC;
+		p[2] = gs_pixel[2] & 0xFC;
+	} else {
+		/* RGB565: o painel estende vermelho e azul para 6 bits */
+		uint16_t c = (gs_pixel[0] << 8) | gs_pixel[1];
+		uint8_t r = c >> 11, g = (c >> 5) & 0x3f, b = c & 0x1f;
+		p[0] = ((r << 1) | (r >> 4)) << 2;
+		p[1] = g << 2;
+		p[2] = ((b << 1) | (b >> 4)) << 2;
+	}
+	gs_stats.pixels++;
+	if (++gs_cx > gs_x1) {
+		gs_cx = gs_x0;
+		if (++gs_cy > gs_y1) {
+			gs_cy = gs_y0;
+		}
+	}
+}
+
+void sim_lcd_command(uint8_t cmd)
+{
+	gs_stats.bytes++;
+	gs_stats.commands++;
+	gs_cmd = cmd;
+	gs_nparam = 0;
+
+	switch (cmd) {
+	case ILI9488_CMD_SOFTWARE_RESET:
+		gs_bpp = 3;
+		gs_sc = gs_sp = 0;
+		gs_ec = W - 1;
+		gs_ep = H - 1;
+		break;
+	case ILI9488_CMD_MEMORY_WRITE:
+		open_window();
+		break;
+	case ILI9488_CMD_WRITE_MEMORY_CONTINUE:
+		gs_phase = 0;
+		break;
+	default:
+		break;
+	}
+}
+
+void sim_lcd_data(uint8_t data)
+{
+	uint32_t i = gs_nparam++;
+
+	gs_stats.bytes++;
+
+	switch (gs_cmd) {
+	case ILI9488_CMD_COLUMN_ADDRESS_SET:
+	case ILI9488_CMD_PAGE_ADDRESS_SET:
+		if (i < 4) {
+			gs_param[i] = data;
+		}
+		if (i == 3) {
+			uint16_t s = (gs_param[0] << 8) | gs_param[1];
+			uint16_t e = (gs_param[2] << 8) | gs_param[3];
+			if (gs_cmd == ILI9488_CMD_COLUMN_ADDRESS_SET) {
+				gs_sc = s;
+				gs_ec = e;
+			} else {
+				gs_sp = s;
+				gs_ep = e;
+			}
+		}
+		break;
+
+	case ILI9488_CMD_MEMORY_WRITE:
+	case ILI9488_CMD_WRITE_MEMORY_CONTINUE:
+		gs_pixel[gs_phase++] = data;
+		if (gs_phase == gs_bpp) {
+			gs_phase = 0;
+			put_pixel();
+		}
+		break;
+
+	case ILI9488_CMD_COLMOD_PIXEL_FORMAT_SET:
+		gs_bpp = (data & 0x07) == 0x05 ? 2 : 3;
+		break;
+
+	case ILI9488_CMD_SPI_READ_SETTINGS:
+		gs_read_index = data;
+		break;
+
+	default:
+		break;
+	}
+}
+
+uint8_t sim_lcd_read(void)
+{
+	gs_stats.bytes++;
+	if (gs_cmd == ILI9488_CMD_READ_ID4 && (gs_read_index & 0x80)) {
+		return gs_id4[gs_read_index & 0x03];
+	}
+	return 0;
+}
+
+const uint8_t *sim_lcd_framebuffer(void)
+{
+	return &gs_fb[0][0][0];
+}
+
+void sim_lcd_get_stats(sim_lcd_stats_t *stats)
+{
+	*stats = gs_stats;
+}
+
+/* FNV-1a do framebuffer, para comparar quadros entre execucoes */
+uint32_t sim_lcd_hash(void)
+{
+	const uint8_t *p = &gs_fb[0][0][0];
+	uint32_t h = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < sizeof(gs_fb); i++) {
+		h = (h ^ p[i]) * 16777619u;
+	}
+	return h;
+}
+
+static bool save_ppm(FILE *f)
+{
+	fprintf(f, "P6\n%d %d\n255\n", W, H);
+	return fwrite(gs_fb, sizeof(gs_fb), 1, f) == 1;
+}
+
+/* ---- PNG sem compressao (blocos "stored" do deflate) ---- */
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *p, size_t n)
+{
+	static uint32_t table[256];
+	size_t i;
+	int k;
+
+	if (table[1] == 0) {
+		for (i = 0; i < 256; i++) {
+			uint32_t c = i;
+			for (k = 0; k < 8; k++) {
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			}
+			table[i] = c;
+		}
+	}
+	crc = ~crc;
+	for (i = 0; i < n; i++) {
+		crc = table[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+	p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static bool write_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len)
+{
+	uint8_t hdr[8], crc[4];
+	uint32_t c;
+
+	put_be32(hdr, len);
+	memcpy(hdr + 4, type, 4);
+	c = crc32_update(crc32_update(0, hdr + 4, 4), data, len);
+	put_be32(crc, c);
+	return fwrite(hdr, 8, 1, f) == 1 && (len == 0 || fwrite(data, len, 1, f) == 1) &&
+			fwrite(crc, 4, 1, f) == 1;
+}
+
+static bool save_png(FILE *f)
+{
+	static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	const size_t row = 1 + W * 3;
+	const size_t raw_len = row * H;
+	size_t blocks = (raw_len + 65534) / 65535;
+	uint8_t *raw = malloc(raw_len);
+	uint8_t *z = malloc(2 + raw_len + blocks * 5 + 4);
+	uint8_t ihdr[13];
+	uint32_t a = 1, b = 0;
+	size_t i, pos, zlen;
+	bool ok;
+
+	if (raw == NULL || z == NULL) {
+		free(raw);
+		free(z);
+		return false;
+	}
+
+	for (i = 0; i < H; i++) {
+		raw[i * row] = 0;       // filtro "none"
+		memcpy(raw + i * row + 1, gs_fb[i], W * 3);
+	}
+	for (i = 0; i < raw_len; i++) {
+		a = (a + raw[i]) % 65521;
+		b = (b + a) % 65521;
+	}
+
+	zlen = 0;
+	z[zlen++] = 0x78;
+	z[zlen++] = 0x01;
+	for (pos = 0; pos < raw_len; pos += 65535) {
+		uint16_t n = (uint16_t)Min(raw_len - pos, (size_t)65535);
+		z[zlen++] = pos + n == raw_len;
+		z[zlen++] = n & 0xff;
+		z[zlen++] = n >> 8;
+		z[zlen++] = ~n & 0xff;
+		z[zlen++] = (~n >> 8) & 0xff;
+		memcpy(z + zlen, raw + pos, n);
+		zlen += n;
+	}
+	put_be32(z + zlen, (b << 16) | a);
+	zlen += 4;
+
+	put_be32(ihdr, W);
+	put_be32(ihdr + 4, H);
+	ihdr[8] = 8;            // bits por canal
+	ihdr[9] = 2;            // RGB
+	ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+	ok = fwrite(sig, sizeof(sig), 1, f) == 1 &&
+			write_chunk(f, "IHDR", ihdr, sizeof(ihdr)) &&
+			write_chunk(f, "IDAT", z, (uint32_t)zlen) &&
+			write_chunk(f, "IEND", NULL, 0);
+	free(raw);
+	free(z);
+	return ok;
+}
+
+/**
+ * \brief Grava a tela em PNG (extensao .png) ou PPM (qualquer outra).
+ */
+bool sim_lcd_save(const char *path)
+{
+	const char *ext = strrchr(path, '.');
+	FILE *f = fopen(path, "wb");
+	bool ok;
+
+	if (f == NULL) {
+		return false;
+	}
+	ok = (ext != NULL && strcmp(ext, ".png") == 0) ? save_png(f) : save_ppm(f);
+	return fclose(f) == 0 && ok;
+}
@@ -0,0 +1,234 @@
+/*
+ * mem_bench.c
+ *
+ * Created: 18/10/2026
+ *
+ * Pools e arenas do mem.c no host: primeiro um teste de carga, depois o
+ * tempo contra o malloc.
+ *
+ *     make mem-bench
+ *
+ * Carga: sequencias pseudo-aleatorias de alocar e liberar, com cada bloco
+ * vivo preenchido com a sua marca e conferido ao ser liberado (dois blocos
+ * sobrepostos se corrompem), uso e pico conferidos com a contagem do teste
+ * e o pool cheio tem que recusar. Na arena, tamanhos variados, alinhamento,
+ * textos que nao cabem e reset. Qualquer divergencia sai com status 1.
+ *
+ * Tempo: pares alocar/liberar no pool e no malloc da libc do host, com o
+ * mesmo tamanho, e alocacoes de um quadro na arena contra malloc/free. O
+ * malloc do firmware seria o do newlib; os tempos so valem comparados
+ * entre si.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mem.h"
+
+#define BLOCK_SIZE      24
+#define BLOCKS          64
+#define STRESS_OPS      2000000u
+#define BENCH_ROUNDS    2000000u
+#define FRAME_ALLOCS    8
+
+MEM_POOL_DEFINE(gs_pool, "teste", BLOCK_SIZE, BLOCKS);
+MEM_ARENA_DEFINE(gs_arena, "teste", 1024);
+
+static uint32_t gs_seed = 12345;
+static int gs_errors;
+
+static uint32_t rnd(void)
+{
+	gs_seed = gs_seed * 1664525u + 1013904223u;
+	return gs_seed >> 8;
+}
+
+static void fail(const char *what, unsigned long i)
+{
+	if (gs_errors++ < 10) {
+		printf("mem-bench: %s (passo %lu)\n", what, i);
+	}
+}
+
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* ---- carga ---- */
+
+static void stress_pool(void)
+{
+	uint8_t *live[BLOCKS];
+	uint8_t mark[BLOCKS];
+	uint32_t n = 0, high = 0, i;
+	mem_stats_t st;
+
+	for (i = 0; i < STRESS_OPS; i++) {
+		/* tendencia muda a cada 4096 passos: enche e esvazia o pool */
+		bool grow = (i >> 12) & 1 ? rnd() % 4 != 0 : rnd() % 4 == 0;
+
+		if (grow || n == 0) {
+			uint8_t *b = mem_pool_alloc(&gs_pool);
+
+			if (n == BLOCKS) {
+				if (b != NULL) {
+					fail("pool cheio entregou um bloco", i);
+				}
+				continue;
+			}
+			if (b == NULL) {
+				fail("pool recusou com blocos livres", i);
+				continue;
+			}
+			if (!mem_pool_owns(&gs_pool, b) || ((uintptr_t)b % MEM_ALIGN) != 0) {
+				fail("bloco fora do pool ou desalinhado", i);
+			}
+			mark[n] = (uint8_t)rnd();
+			memset(b, mark[n], BLOCK_SIZE);
+			live[n++] = b;
+			high = n > high ? n : high;
+		} else {
+			uint32_t k = rnd() % n, j;
+
+			for (j = 0; j < BLOCK_SIZE; j++) {
+				if (live[k][j] != mark[k]) {
+					fail("bloco vivo sobrescrito", i);
+					break;
+				}
+			}
+			mem_pool_free(&gs_pool, live[k]);
+			live[k] = live[--n];
+			mark[k] = mark[n];
+		}
+		if (gs_pool.used != n) {
+			fail("uso do pool diferente do teste", i);
+		}
+	}
+	mem_pool_get_stats(&gs_pool, &st);
+	if (st.high != high || st.high != BLOCKS || st.fails == 0) {
+		fail("pico ou falhas do pool", i);
+	}
+	while (n > 0) {
+		mem_pool_free(&gs_pool, live[--n]);
+	}
+	printf("pool: %u operacoes, pico %lu de %u, %lu recusas com o pool cheio\n",
+			STRESS_OPS, (unsigned long)st.high, BLOCKS, (unsigned long)st.fails);
+}
+
+static void stress_arena(void)
+{
+	uint32_t frame, allocs = 0;
+	mem_stats_t st;
+
+	for (frame = 0; frame < STRESS_OPS / 16; frame++) {
+		uint8_t *p[16];
+		size_t size[16];
+		uint32_t k, n = 1 + rnd() % 16, j;
+
+		for (k = 0; k < n; k++) {
+			size[k] = 1 + rnd() % 96;
+			p[k] = mem_arena_alloc(&gs_arena, size[k]);
+			if (p[k] == NULL) {
+				if (gs_arena.used + MEM_ROUND(size[k]) <= gs_arena.size) {
+					fail("arena recusou com espaco", frame);
+				}
+				size[k] = 0;
+				continue;
+			}
+			if (((uintptr_t)p[k] % MEM_ALIGN) != 0) {
+				fail("arena desalinhada", frame);
+			}
+			memset(p[k], (int)k, size[k]);
+			allocs++;
+		}
+		for (k = 0; k < n; k++) {
+			for (j = 0; j < size[k]; j++) {
+				if (p[k][j] != k) {
+					fail("alocacoes da arena sobrepostas", frame);
+					break;
+				}
+			}
+		}
+		mem_arena_reset(&gs_arena);
+	}
+
+	/* texto que nao cabe: "" e uma falha */
+	mem_arena_alloc(&gs_arena, gs_arena.size - 8);
+	if (strcmp(mem_arena_printf(&gs_arena, "%s", "mais de oito"), "") != 0 ||
+	    strcmp(mem_arena_printf(&gs_arena, "%d", 1234567), "1234567") != 0) {
+		fail("texto na arena", 0);
+	}
+	mem_arena_reset(&gs_arena);
+
+	mem_arena_get_stats(&gs_arena, &st);
+	printf("arena: %lu quadros, %lu alocacoes, pico %lu de %lu B, %lu falhas\n",
+			(unsigned long)frame, (unsigned long)allocs, (unsigned long)st.high,
+			(unsigned long)st.size, (unsigned long)st.fails);
+}
+
+/* ---- tempo ---- */
+
+static void *volatile gs_sink;
+
+static void bench(void)
+{
+	void *keep[FRAME_ALLOCS];
+	double t0, pool_ns, malloc_ns, arena_ns, frame_ns;
+	uint32_t i, k;
+
+	t0 = now_ns();
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		gs_sink = mem_pool_alloc(&gs_pool);
+		mem_pool_free(&gs_pool, gs_sink);
+	}
+	pool_ns = (now_ns() - t0) / BENCH_ROUNDS;
+
+	t0 = now_ns();
+	for (i = 0; i < BENCH_ROUNDS; i++) {
+		gs_sink = malloc(BLOCK_SIZE);
+		free(gs_sink);
+	}
+	malloc_ns = (now_ns() - t0) / BENCH_ROUNDS;
+
+	t0 = now_ns();
+	for (i = 0; i < BENCH_ROUNDS / FRAME_ALLOCS; i++) {
+		for (k = 0; k < FRAME_ALLOCS; k++) {
+			gs_sink = mem_arena_alloc(&gs_arena, 16 + k * 8);
+		}
+		mem_arena_reset(&gs_arena);
+	}
+	arena_ns = (now_ns() - t0) / BENCH_ROUNDS;
+
+	t0 = now_ns();
+	for (i = 0; i < BENCH_ROUNDS / FRAME_ALLOCS; i++) {
+		for (k = 0; k < FRAME_ALLOCS; k++) {
+			keep[k] = malloc(16 + k * 8);
+		}
+		for (k = 0; k < FRAME_ALLOCS; k++) {
+			free(keep[k]);
+		}
+	}
+	frame_ns = (now_ns() - t0) / BENCH_ROUNDS;
+
+	printf("\n                    mem.c ns   malloc ns\n");
+	printf("pool %2u B            %7.1f   %9.1f\n", BLOCK_SIZE, pool_ns, malloc_ns);
+	printf("quadro de %u          %7.1f   %9.1f   (por alocacao)\n", FRAME_ALLOCS,
+			arena_ns, frame_ns);
+}
+
+int main(void)
+{
+	stress_pool();
+	stress_arena();
+	if (gs_errors) {
+		printf("mem-bench: %d erros\n", gs_errors);
+		return 1;
+	}
+	bench();
+	return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * pio_bench.c
+ *
+ * Created: 18/10/2026
+ *
+ * Latencia do despacho de interrupcao do PIO no host: uma borda num pino,
+ * pio_handler_process() ate o callback. Compara a tabela por pino do
+ * pio_handler.c com uma copia da busca linear que o ASF fazia, para N
+ * fontes de um pino cada e o pino disparado no comeco e no fim da lista.
+ *
+ *     make pio-bench
+ *
+ * Os registradores do PIO sao os de pio_sim.c; os tempos sao do host e so
+ * valem comparados entre si.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "pio.h"
+#include "pio_handler.h"
+
+#define ROUNDS      2000000u
+#define LEGACY_MAX  32
+
+static volatile uint32_t gs_hits;
+
+static void on_pin(uint32_t id, uint32_t mask)
+{
+	(void)id; (void)mask;
+	gs_hits++;
+}
+
+/* ---- despacho antigo do ASF: varre a lista ate achar a fonte ---- */
+
+static struct {
+	uint32_t id;
+	uint32_t mask;
+	void (*handler)(uint32_t, uint32_t);
+} gs_legacy[LEGACY_MAX];
+
+static void legacy_process(Pio *p_pio, uint32_t ul_id)
+{
+	uint32_t status = pio_get_interrupt_status(p_pio);
+	uint32_t i = 0;
+
+	status &= pio_get_interrupt_mask(p_pio);
+	while (status != 0) {
+		if (gs_legacy[i].id == ul_id && (status & gs_legacy[i].mask) != 0) {
+			gs_legacy[i].handler(gs_legacy[i].id, gs_legacy[i].mask);
+			status &= ~gs_legacy[i].mask;
+		}
+		if (++i >= LEGACY_MAX) {
+			break;
+		}
+	}
+}
+
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double measure(void (*process)(Pio *, uint32_t), uint32_t mask)
+{
+	double t0;
+	uint32_t i;
+
+	gs_hits = 0;
+	t0 = now_ns();
+	for (i = 0; i < ROUNDS; i++) {
+		PIOA->PIO_ISR = mask;
+		process(PIOA, ID_PIOA);
+	}
+	if (gs_hits != ROUNDS) {
+		printf("pio-bench: %lu de %lu callbacks\n", (unsigned long)gs_hits,
+				(unsigned long)ROUNDS);
+	}
+	return (now_ns() - t0) / ROUNDS;
+}
+
+int main(void)
+{
+	static const uint32_t counts[] = { 1, 4, 16, 32 };
+	uint32_t registered = 0;
+	unsigned c;
+
+	printf("fontes  pino   tabela ns   linear ns\n");
+	for (c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+		uint32_t n = counts[c];
+		uint32_t pins[2] = { 0, n - 1 };
+		int p;
+
+		/* as fontes so crescem: registra os pinos que faltam */
+		for (; registered < n; registered++) {
+			uint32_t mask = 1u << registered;
+
+			pio_handler_set(PIOA, ID_PIOA, mask, 0, on_pin);
+			gs_legacy[registered].id = ID_PIOA;
+			gs_legacy[registered].mask = mask;
+			gs_legacy[registered].handler = on_pin;
+		}
+		PIOA->PIO_IMR = n < 32 ? (1u << n) - 1 : UINT32_MAX;
+
+		for (p = 0; p < (n > 1 ? 2 : 1); p++) {
+			uint32_t mask = 1u << pins[p];
+
+			printf("%6lu  %4lu  %10.1f  %10.1f\n", (unsigned long)n,
+					(unsigned long)pins[p], measure(pio_handler_process, mask),
+					measure(legacy_process, mask));
+		}
+	}
+	return 0;
+}
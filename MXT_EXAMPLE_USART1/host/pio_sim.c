@@ -0,0 +1,82 @@
+/*
+ * pio_sim.c
+ *
+ * Created: 18/10/2026
+ *
+ * Registradores de interrupcao do PIO no build de host (ISR e IMR), o
+ * bastante para o pio_handler.c do ASF rodar sem mudancas: uma borda marca
+ * o pino no ISR e, se ele estiver habilitado no IMR, chama o handler do
+ * controlador como o NVIC faria. O ISR zera na leitura, como no chip. Usado
+ * pelo simulador e pelo pio_bench.
+ */
+
+#include "pio.h"
+#include "pio_handler.h"
+
+Pio sim_pioa;
+Pio sim_pioc;
+
+void PIOA_Handler(void);
+void PIOC_Handler(void);
+
+uint32_t pio_get_interrupt_status(const Pio *p_pio)
+{
+	Pio *p = (Pio *)p_pio;
+	uint32_t isr = p->PIO_ISR;
+
+	p->PIO_ISR = 0;
+	return isr;
+}
+
+uint32_t pio_get_interrupt_mask(const Pio *p_pio)
+{
+	return p_pio->PIO_IMR;
+}
+
+void pio_enable_interrupt(Pio *p_pio, uint32_t mask)
+{
+	p_pio->PIO_IMR |= mask;
+}
+
+void pio_disable_interrupt(Pio *p_pio, uint32_t mask)
+{
+	p_pio->PIO_IMR &= ~mask;
+}
+
+void pio_configure_interrupt(Pio *p_pio, const uint32_t ul_mask,
+		const uint32_t ul_attr)
+{
+	(void)p_pio; (void)ul_mask; (void)ul_attr;
+}
+
+/* Pinos numerados como no ASF: 32 por controlador, PIOA primeiro */
+Pio *pio_get_pin_group(uint32_t ul_pin)
+{
+	return ul_pin < 32 ? PIOA : PIOC;
+}
+
+uint32_t pio_get_pin_group_id(uint32_t ul_pin)
+{
+	return ul_pin < 32 ? ID_PIOA : ID_PIOC;
+}
+
+uint32_t pio_get_pin_group_mask(uint32_t ul_pin)
+{
+	return 1u << (ul_pin & 0x1F);
+}
+
+/**
+ * \brief Borda nos pinos de \a mask: interrupcao se algum estiver no IMR.
+ */
+void sim_pio_edge(Pio *p_pio, uint32_t mask)
+{
+	p_pio->PIO_ISR |= mask;
+	if (!(p_pio->PIO_ISR & p_pio->PIO_IMR)) {
+		return;
+	}
+	if (p_pio == PIOA) {
+		PIOA_Handler();
+	} else {
+		PIOC_Handler();
+	}
+}
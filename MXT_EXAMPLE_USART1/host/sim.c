@@ -0,0 +1,329 @@
+/*
+ * sim.c
+ *
+ * Created: 18/10/2026
+ *
+ * Build de host da aplicacao: roda o main() do firmware (renomeado para
+ * app_main) sobre perifericos simulados, dirigido por um roteiro de eventos
+ * num relogio virtual.
+ *
+ *     sim [-o DIR] [-c console.bin] [-s spi.log] roteiro.txt
+ *
+ * Cada linha do roteiro e "<espera em ms> <comando> [argumentos]", com a
+ * espera contada a partir do comando anterior:
+ *
+ *     0     dump menu.png      # grava a tela (.png ou .ppm) e imprime o hash
+ *     200   tap 160 288        # toque (press + release) em coordenadas do LCD
+ *     100   press 40 438       # so press, ou release / move
+ *     0     tap 160 368 2      # o terceiro numero e o id do dedo (1 sem ele)
+ *     3500  release 40 438
+ *     0     panel 0 30         # painel desalinhado: toques saem (dx, dy) px fora
+ *     0     button             # botao da porta (PIOA11)
+ *     0     key p              # byte recebido pela console (console_getc)
+ *     0     replay ciclo.touch # repete uma sessao gravada (touch_replay.h),
+ *                              # caminho relativo ao roteiro
+ *     0     stats              # tempo virtual e trafego no SPI do LCD
+ *     0     quit
+ *
+ * O relogio so anda por eventos: a cada volta do main loop (console_getc)
+ * ele pula para o proximo timer ou linha do roteiro, e desenhar
+ * no LCD consome o tempo de fio do SPI. A execucao e deterministica, entao
+ * o hash de um quadro so muda quando o desenho muda.
+ *
+ * Com -s todo o trafego do SPI do LCD e gravado (formato em sim.h), com uma
+ * marca a cada dump e no fim; tools/spi_replay.py refaz as telas a partir
+ * dele.
+ */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "console.h"
+#include "touch_replay.h"
+
+#define TOUCH_PRESS     192
+#define TOUCH_MOVE      144
+#define TOUCH_RELEASE   32
+
+#define MAX_COMMANDS    1024
+#define MAX_REPLAY      1024
+
+/* Voltas do main loop entre dois eventos: na primeira o mxt_handler le o
+ * toque e levanta as flags, na seguinte o desenho ja terminou */
+#define SETTLE_LOOPS    2
+
+int app_main(void);
+
+typedef struct {
+	uint64_t at_ns;
+	int line;
+	char name[16];
+	char arg[256];
+	int x, y, id;
+} sim_cmd_t;
+
+static uint64_t gs_now_ns;
+static sim_cmd_t gs_cmds[MAX_COMMANDS];
+static int gs_ncmds;
+static int gs_pc;
+static int gs_settle;
+static const char *gs_outdir = ".";
+static const char *gs_script_name;
+
+uint64_t sim_now_ns(void)
+{
+	return gs_now_ns;
+}
+
+void sim_advance_ns(uint64_t ns)
+{
+	gs_now_ns += ns;
+}
+
+uint32_t sim_cycles(void)
+{
+	return (uint32_t)(gs_now_ns * 3 / 10);
+}
+
+static void print_stats(void)
+{
+	sim_lcd_stats_t lcd;
+	console_stats_t con;
+
+	sim_lcd_get_stats(&lcd);
+	console_get_stats(&con);
+	printf("sim: t=%.3f ms  lcd %llu bytes, %llu comandos, %llu janelas, %llu pixels"
+			" (%.1f ms de SPI)  console %lu bytes\n",
+			gs_now_ns / 1e6, (unsigned long long)lcd.bytes,
+			(unsigned long long)lcd.commands, (unsigned long long)lcd.windows,
+			(unsigned long long)lcd.pixels, lcd.bytes * 8e3 / ILI9488_SPI_BAUDRATE,
+			(unsigned long)con.written);
+}
+
+static void finish(int code)
+{
+	uint32_t hash = sim_lcd_hash();
+
+	print_stats();
+	printf("sim: tela final %08x\n", hash);
+	sim_spi_mark("final", hash);
+	sim_spi_close();
+	console_flush();
+	exit(code);
+}
+
+static void dump(const sim_cmd_t *c)
+{
+	char path[512];
+	uint32_t hash = sim_lcd_hash();
+
+	snprintf(path, sizeof(path), "%s/%s", gs_outdir, c->arg);
+	if (!sim_lcd_save(path)) {
+		fprintf(stderr, "sim: nao foi possivel gravar %s\n", path);
+		finish(1);
+	}
+	printf("sim: t=%.3f ms  %s %08x\n", gs_now_ns / 1e6, c->arg, hash);
+	sim_spi_mark(c->arg, hash);
+}
+
+/* Sessao "t_us id status x y" (tools/touch_session.py) para touch_replay */
+static void replay(const sim_cmd_t *c)
+{
+	static touch_rec_t recs[MAX_REPLAY];
+	char path[512], line[128];
+	const char *slash = strrchr(gs_script_name, '/');
+	uint32_t n = 0;
+	FILE *f;
+
+	snprintf(path, sizeof(path), "%.*s%s",
+			slash ? (int)(slash - gs_script_name + 1) : 0, gs_script_name, c->arg);
+	f = fopen(path, "r");
+	if (f == NULL) {
+		perror(path);
+		finish(1);
+	}
+	while (n < MAX_REPLAY && fgets(line, sizeof(line), f) != NULL) {
+		unsigned long t;
+		unsigned id, status, x, y;
+
+		if (sscanf(line, "%lu %u %u %u %u", &t, &id, &status, &x, &y) == 5) {
+			recs[n].t_us = (uint32_t)t;
+			recs[n].id = (uint8_t)id;
+			recs[n].status = (uint8_t)status;
+			recs[n].x = (uint16_t)x;
+			recs[n].y = (uint16_t)y;
+			n++;
+		}
+	}
+	fclose(f);
+	touch_replay_start(recs, n);
+}
+
+/* Executa um comando; retorna um byte para a console ou -1 */
+static int run_command(const sim_cmd_t *c)
+{
+	if (strcmp(c->name, "press") == 0) {
+		sim_touch_push(c->id, TOUCH_PRESS, c->x, c->y);
+	} else if (strcmp(c->name, "release") == 0) {
+		sim_touch_push(c->id, TOUCH_RELEASE, c->x, c->y);
+	} else if (strcmp(c->name, "move") == 0) {
+		sim_touch_push(c->id, TOUCH_MOVE, c->x, c->y);
+	} else if (strcmp(c->name, "tap") == 0) {
+		sim_touch_push(c->id, TOUCH_PRESS, c->x, c->y);
+		sim_touch_push(c->id, TOUCH_RELEASE, c->x, c->y);
+	} else if (strcmp(c->name, "panel") == 0) {
+		sim_touch_panel(c->x, c->y);
+	} else if (strcmp(c->name, "button") == 0) {
+		sim_button_press();
+	} else if (strcmp(c->name, "key") == 0) {
+		return (unsigned char)c->arg[0];
+	} else if (strcmp(c->name, "replay") == 0) {
+		replay(c);
+	} else if (strcmp(c->name, "dump") == 0) {
+		dump(c);
+	} else if (strcmp(c->name, "stats") == 0) {
+		print_stats();
+	} else if (strcmp(c->name, "quit") == 0) {
+		finish(0);
+	}
+	return -1;
+}
+
+/**
+ * \brief Uma volta do main loop do firmware.
+ *
+ * Avanca o relogio ate o que vier primeiro, um timer ou a proxima linha do
+ * roteiro, e entrega so esse evento; as voltas seguintes do main loop
+ * tratam as flags que ele levantou antes do proximo. Com o roteiro no fim a
+ * simulacao termina.
+ */
+int sim_step(void)
+{
+	uint64_t t_timer, t_script;
+
+	if (gs_settle > 0) {
+		gs_settle--;
+		return -1;
+	}
+	gs_settle = SETTLE_LOOPS;
+
+	if (gs_pc >= gs_ncmds) {
+		finish(0);
+	}
+
+	t_timer = sim_timers_next();
+	t_script = gs_cmds[gs_pc].at_ns;
+
+	if (t_timer < t_script) {
+		gs_now_ns = Max(gs_now_ns, t_timer);
+		sim_timers_run();
+		return -1;
+	}
+
+	gs_now_ns = Max(gs_now_ns, t_script);
+	sim_timers_run();
+	return run_command(&gs_cmds[gs_pc++]);
+}
+
+static void load_script(FILE *f)
+{
+	static const char *const names[] = {
+		"press", "release", "move", "tap", "panel", "button", "key", "replay", "dump", "stats", "quit"
+	};
+	char line[512];
+	uint64_t at = 0;
+	int lineno = 0;
+
+	while (fgets(line, sizeof(line), f) != NULL) {
+		sim_cmd_t *c = &gs_cmds[gs_ncmds];
+		char *hash = strchr(line, '#');
+		unsigned long delay;
+		int n = 0;
+		size_t i;
+
+		lineno++;
+		if (hash != NULL) {
+			*hash = '\0';
+		}
+		memset(c, 0, sizeof(*c));
+		if (sscanf(line, "%lu %15s %n", &delay, c->name, &n) < 2) {
+			continue;
+		}
+		for (i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+			if (strcmp(c->name, names[i]) == 0) {
+				break;
+			}
+		}
+		if (i == sizeof(names) / sizeof(names[0])) {
+			fprintf(stderr, "%s:%d: comando desconhecido %s\n", gs_script_name, lineno, c->name);
+			exit(2);
+		}
+		if (gs_ncmds == MAX_COMMANDS) {
+			fprintf(stderr, "%s:%d: roteiro longo demais\n", gs_script_name, lineno);
+			exit(2);
+		}
+		sscanf(line + n, "%255s", c->arg);
+		c->id = 1;
+		sscanf(line + n, "%d %d %d", &c->x, &c->y, &c->id);
+		at += (uint64_t)delay * 1000000u;
+		c->at_ns = at;
+		c->line = lineno;
+		gs_ncmds++;
+	}
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "uso: %s [-o DIR] [-c console.bin] [-s spi.log] roteiro.txt\n", prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	FILE *f;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "o:c:s:h")) != -1) {
+		switch (opt) {
+		case 'o':
+			gs_outdir = optarg;
+			break;
+		case 'c':
+			f = fopen(optarg, "wb");
+			if (f == NULL) {
+				perror(optarg);
+				return 2;
+			}
+			sim_console_capture(f);
+			break;
+		case 's':
+			if (!sim_spi_record(optarg)) {
+				perror(optarg);
+				return 2;
+			}
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1) {
+		usage(argv[0]);
+	}
+
+	gs_script_name = argv[optind];
+	f = strcmp(gs_script_name, "-") == 0 ? stdin : fopen(gs_script_name, "r");
+	if (f == NULL) {
+		perror(gs_script_name);
+		return 2;
+	}
+	load_script(f);
+	if (f != stdin) {
+		fclose(f);
+	}
+
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	app_main();
+	return 0;
+}
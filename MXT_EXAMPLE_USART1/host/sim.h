@@ -0,0 +1,92 @@
+/*
+ * sim.h
+ *
+ * Created: 18/10/2026
+ *
+ * Simulador de host: relogio virtual, roteiro de eventos, barramento SPI e
+ * modelo do LCD. Usado pelos substitutos do ASF (hal_sim.c, spi_sim.c) e
+ * pela console (console_sim.c).
+ */
+
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <asf.h>
+
+/* ---- relogio virtual (sim.c) ---- */
+
+uint64_t sim_now_ns(void);
+void sim_advance_ns(uint64_t ns);
+uint32_t sim_cycles(void);
+
+/* Uma volta do main loop: avanca o relogio ate o proximo evento (timer ou
+ * linha do roteiro) e o entrega. Retorna um byte recebido pela console ou
+ * -1. Chamado por console_getc(). */
+int sim_step(void);
+
+/* ---- perifericos (hal_sim.c) ---- */
+
+/* Proximo instante (ns) do alarme da base de tempo, ou UINT64_MAX */
+uint64_t sim_timers_next(void);
+/* Dispara o alarme da base de tempo (timer_run()) se venceu */
+void sim_timers_run(void);
+void sim_touch_push(uint8_t id, uint8_t status, int x, int y);
+void sim_touch_panel(int dx, int dy);
+void sim_button_press(void);
+
+/* ---- barramento SPI do LCD (spi_sim.c) ---- */
+
+/* Registro do barramento (tools/spi_replay.py), little-endian:
+ *
+ *     cabecalho   "SPIL", versao u16, 0 u16, baud u32 (ILI9488_SPI_BAUDRATE)
+ *     registros   tipo u8 e conteudo:
+ *       0 comando     varint n, n bytes enviados com D/C baixo
+ *       1 dado        varint n, n bytes enviados com D/C alto
+ *       2 leitura     varint n, n bytes recebidos do LCD
+ *       3 marca       hash u32 da tela, n u8, nome (n bytes)
+ *
+ * Registros seguidos do mesmo tipo continuam a mesma transferencia. A marca
+ * e gravada a cada dump e no fim, com o hash do modelo naquele instante. */
+#define SIM_SPI_LOG_MAGIC       "SPIL"
+#define SIM_SPI_LOG_VERSION     1
+
+enum {
+	SIM_SPI_REC_CMD = 0,
+	SIM_SPI_REC_DATA = 1,
+	SIM_SPI_REC_READ = 2,
+	SIM_SPI_REC_MARK = 3,
+};
+
+void sim_spi_set_dc(bool data);
+bool sim_spi_record(const char *path);
+void sim_spi_mark(const char *name, uint32_t hash);
+void sim_spi_close(void);
+
+/* ---- LCD (lcd_sim.c) ---- */
+
+typedef struct {
+	uint64_t bytes;         // bytes no barramento (comandos, parametros, pixels, leituras)
+	uint64_t commands;      // bytes com D/C baixo
+	uint64_t windows;       // escritas de memoria (RAMWR)
+	uint64_t pixels;        // pixels escritos
+} sim_lcd_stats_t;
+
+/* Modelo do ILI9488: recebe o que passa no SPI */
+void sim_lcd_command(uint8_t cmd);
+void sim_lcd_data(uint8_t data);
+uint8_t sim_lcd_read(void);
+
+const uint8_t *sim_lcd_framebuffer(void);
+bool sim_lcd_save(const char *path);
+uint32_t sim_lcd_hash(void);
+void sim_lcd_get_stats(sim_lcd_stats_t *stats);
+
+/* ---- console (console_sim.c) ---- */
+
+void sim_console_capture(FILE *f);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,235 @@
+/*
+ * spi_sim.c
+ *
+ * Created: 18/10/2026
+ *
+ * SPI master do ASF para o build de host. O driver do ILI9488 roda sem
+ * mudancas: cada byte de spi_write()/spi_write_packet() (e dos quadros de
+ * 16 bits de spi_write_stream()/spi_write_repeat()) vai para o modelo
+ * do LCD como comando ou dado conforme o pino D/C (LCD_SPI_CDS_PIO), avanca
+ * o relogio virtual pelo tempo de fio em ILI9488_SPI_BAUDRATE e, com
+ * sim_spi_record(), e gravado no registro do barramento (formato em sim.h).
+ */
+
+#include <stdio.h>
+#include "sim.h"
+
+/* Bytes acumulados antes de gravar um registro */
+#define REC_RUN_MAX     4096
+
+static bool gs_dc;
+
+static FILE *gs_rec;
+static uint8_t gs_run[REC_RUN_MAX];
+static size_t gs_run_len;
+static int gs_run_type;
+
+static void wire_bytes(uint64_t n)
+{
+	sim_advance_ns(n * 8 * 1000000000ull / ILI9488_SPI_BAUDRATE);
+}
+
+static void put_varint(uint32_t v)
+{
+	while (v >= 0x80) {
+		fputc((v & 0x7f) | 0x80, gs_rec);
+		v >>= 7;
+	}
+	fputc(v, gs_rec);
+}
+
+static void rec_flush(void)
+{
+	if (gs_run_len == 0) {
+		return;
+	}
+	fputc(gs_run_type, gs_rec);
+	put_varint(gs_run_len);
+	fwrite(gs_run, 1, gs_run_len, gs_rec);
+	gs_run_len = 0;
+}
+
+static inline void rec_byte(int type, uint8_t b)
+{
+	if (gs_rec == NULL) {
+		return;
+	}
+	if (type != gs_run_type || gs_run_len == REC_RUN_MAX) {
+		rec_flush();
+		gs_run_type = type;
+	}
+	gs_run[gs_run_len++] = b;
+}
+
+static void bus_write(uint8_t b)
+{
+	if (gs_dc) {
+		rec_byte(SIM_SPI_REC_DATA, b);
+		sim_lcd_data(b);
+	} else {
+		rec_byte(SIM_SPI_REC_CMD, b);
+		sim_lcd_command(b);
+	}
+}
+
+void sim_spi_set_dc(bool data)
+{
+	gs_dc = data;
+}
+
+/**
+ * \brief Passa a gravar o barramento em path.
+ */
+bool sim_spi_record(const char *path)
+{
+	uint8_t hdr[12] = SIM_SPI_LOG_MAGIC;
+	uint32_t baud = ILI9488_SPI_BAUDRATE;
+
+	gs_rec = fopen(path, "wb");
+	if (gs_rec == NULL) {
+		return false;
+	}
+	hdr[4] = SIM_SPI_LOG_VERSION & 0xff;
+	hdr[5] = SIM_SPI_LOG_VERSION >> 8;
+	hdr[8] = baud;
+	hdr[9] = baud >> 8;
+	hdr[10] = baud >> 16;
+	hdr[11] = baud >> 24;
+	gs_run_len = 0;
+	gs_run_type = -1;
+	return fwrite(hdr, sizeof(hdr), 1, gs_rec) == 1;
+}
+
+/**
+ * \brief Grava uma marca com o nome e o hash da tela neste ponto.
+ */
+void sim_spi_mark(const char *name, uint32_t hash)
+{
+	size_t n = strlen(name);
+	int i;
+
+	if (gs_rec == NULL) {
+		return;
+	}
+	rec_flush();
+	gs_run_type = -1;
+	if (n > 255) {
+		n = 255;
+	}
+	fputc(SIM_SPI_REC_MARK, gs_rec);
+	for (i = 0; i < 4; i++) {
+		fputc((hash >> (8 * i)) & 0xff, gs_rec);
+	}
+	fputc((int)n, gs_rec);
+	fwrite(name, 1, n, gs_rec);
+}
+
+void sim_spi_close(void)
+{
+	if (gs_rec != NULL) {
+		rec_flush();
+		fclose(gs_rec);
+		gs_rec = NULL;
+	}
+}
+
+/* ---- spi_master.h ---- */
+
+void spi_master_init(Spi *p_spi)
+{
+	(void)p_spi;
+}
+
+void spi_master_setup_device(Spi *p_spi, struct spi_device *device,
+		uint32_t flags, uint32_t baud_rate, uint32_t sel_id)
+{
+	(void)p_spi; (void)device; (void)flags; (void)baud_rate; (void)sel_id;
+}
+
+void spi_select_device(Spi *p_spi, struct spi_device *device)
+{
+	(void)p_spi;
+	(void)device;
+}
+
+void spi_deselect_device(Spi *p_spi, struct spi_device *device)
+{
+	(void)p_spi;
+	(void)device;
+}
+
+void spi_configure_cs_behavior(Spi *p_spi, uint32_t ul_pcs_ch, uint32_t ul_cs_behavior)
+{
+	(void)p_spi; (void)ul_pcs_ch; (void)ul_cs_behavior;
+}
+
+void spi_enable(Spi *p_spi)
+{
+	(void)p_spi;
+}
+
+void spi_disable(Spi *p_spi)
+{
+	(void)p_spi;
+}
+
+void spi_enable_interrupt(Spi *p_spi, uint32_t ul_sources)
+{
+	(void)p_spi;
+	(void)ul_sources;
+}
+
+/* Transferencias de 8 bits (CONFIG_SPI_MASTER_BITS_PER_TRANSFER) */
+uint32_t spi_write(Spi *p_spi, uint16_t us_data, uint8_t uc_pcs, uint8_t uc_last)
+{
+	(void)p_spi; (void)uc_pcs; (void)uc_last;
+	bus_write((uint8_t)us_data);
+	wire_bytes(1);
+	return 0;
+}
+
+uint32_t spi_write_packet(Spi *p_spi, const uint8_t *data, size_t len)
+{
+	size_t i;
+
+	(void)p_spi;
+	for (i = 0; i < len; i++) {
+		bus_write(data[i]);
+	}
+	wire_bytes(len);
+	return 0;
+}
+
+uint32_t spi_read_packet(Spi *p_spi, uint8_t *data, size_t len)
+{
+	size_t i;
+
+	(void)p_spi;
+	for (i = 0; i < len; i++) {
+		data[i] = sim_lcd_read();
+		rec_byte(SIM_SPI_REC_READ, data[i]);
+	}
+	wire_bytes(len);
+	return 0;
+}
+
+/* No fio, os quadros de 16 bits sao os mesmos bytes na mesma ordem */
+void spi_write_stream(Spi *p_spi, uint32_t ul_pcs_ch, const uint8_t *data, size_t len)
+{
+	(void)ul_pcs_ch;
+	spi_write_packet(p_spi, data, len);
+}
+
+void spi_write_repeat(Spi *p_spi, uint32_t ul_pcs_ch, const uint8_t *pattern,
+		size_t pattern_len, size_t count)
+{
+	size_t i, j;
+
+	(void)p_spi; (void)ul_pcs_ch;
+	for (i = 0; i < count; i++) {
+		for (j = 0; j < pattern_len; j++) {
+			bus_write(pattern[j]);
+		}
+	}
+	wire_bytes((uint64_t)pattern_len * count);
+}
@@ -0,0 +1,303 @@
+/*
+ * timer_bench.c
+ *
+ * Created: 18/10/2026
+ *
+ * Roda de timers (timer.c) no host, sobre um relogio virtual proprio: a
+ * base de tempo daqui so guarda o alarme e o laco pula direto para ele e
+ * chama timer_run(), como a interrupcao do firmware.
+ *
+ *     make timer-bench
+ *
+ * Volta do tick: o relogio comeca pouco antes de 2^32 ms (~49,7 dias, onde
+ * o tick de 32 bits da a volta) com periodicos e avulsos de perto e de
+ * longe; cada disparo tem que cair no tick pedido e, depois de cada
+ * timer_run(), o alarme e timer_next() tem que estar no futuro (um alarme
+ * no passado vira uma interrupcao atras da outra).
+ *
+ * Modelo: MODEL_OPS passos aleatorios de armar (perto, na roda, e longe,
+ * na fila ordenada), parar e avancar o relogio sobre MODEL_TIMERS timers,
+ * passando pela volta do tick, conferidos contra um modelo que so guarda o
+ * vencimento de cada timer: nenhum disparo antes da hora nem mais de um
+ * tick depois, periodicos exatos, nenhum vencido esquecido e
+ * timer_active() igual ao modelo. As callbacks tambem param timers.
+ *
+ * Qualquer divergencia sai com status 1.
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <asf.h>
+#include "timebase.h"
+#include "timer.h"
+
+#define NONE            UINT64_MAX
+#define WRAP_US         (((uint64_t)1 << 32) * TIMER_TICK_US)
+#define WRAP_START_US   (WRAP_US - 3000000u)
+#define WRAP_RUN_US     10000000u
+#define MODEL_TIMERS    16
+#define MODEL_OPS       2000000u
+
+typedef struct {
+	sw_timer_t t;
+	const char *name;
+	uint64_t due;           // proximo disparo esperado (us)
+	uint32_t period;        // us
+	uint32_t fired;
+} probe_t;
+
+/* Timer do modelo: armado ou nao e a janela do proximo disparo */
+typedef struct {
+	sw_timer_t t;
+	bool active;
+	uint64_t earliest;      // us
+	uint64_t latest;        // us
+	uint32_t period;        // us, ja arredondado a ticks
+} model_t;
+
+static uint64_t gs_now;
+static uint64_t gs_alarm = NONE;
+static int gs_errors;
+
+/* ---- base de tempo (timebase.h) ---- */
+
+void timebase_init(void)
+{
+}
+
+uint64_t now_us(void)
+{
+	return gs_now;
+}
+
+void timebase_arm(uint64_t at_us)
+{
+	gs_alarm = at_us;
+}
+
+void timebase_disarm(void)
+{
+	gs_alarm = NONE;
+}
+
+void timebase_adjust(uint64_t us)
+{
+	gs_now += us;
+}
+
+static void fail(const char *what, const char *name, uint64_t at)
+{
+	if (gs_errors++ < 10) {
+		printf("timer-bench: %s %s (t=%llu us)\n", what, name, (unsigned long long)at);
+	}
+}
+
+/* Dispara os alarmes ate \a end e para o relogio em \a end; false se o
+ * alarme nao avanca */
+static bool advance_to(uint64_t end, uint32_t *runs)
+{
+	uint64_t at;
+	uint32_t n = 0, max = (uint32_t)((end - gs_now) / TIMER_TICK_US) + TIMER_SLOTS + 1;
+	bool ok = true;
+
+	while (gs_alarm != NONE && gs_alarm <= end) {
+		if (gs_alarm > gs_now) {
+			gs_now = gs_alarm;
+		}
+		gs_alarm = NONE;
+		timer_run();
+		if (gs_alarm != NONE && gs_alarm <= gs_now) {
+			fail("alarme no passado", "", gs_now);
+		}
+		if (timer_next(&at) && at <= gs_now) {
+			fail("timer_next no passado", "", gs_now);
+		}
+		if (++n > max) {
+			fail("alarme nao avanca", "", gs_now);
+			ok = false;
+			break;
+		}
+	}
+	gs_now = Max(gs_now, end);
+	if (runs != NULL) {
+		*runs += n;
+	}
+	return ok;
+}
+
+/* ---- volta do tick ---- */
+
+static void on_probe(sw_timer_t *t)
+{
+	probe_t *p = (probe_t *)((char *)t - offsetof(probe_t, t));
+
+	if (gs_now < p->due || gs_now >= p->due + TIMER_TICK_US) {
+		fail("disparo fora do tick", p->name, gs_now);
+	}
+	p->fired++;
+	p->due = p->period ? p->due + p->period : NONE;
+}
+
+static void wrap(void)
+{
+	static probe_t probes[] = {
+		{ TIMER_INIT(on_probe), "10ms", 0, 10000, 0 },
+		{ TIMER_INIT(on_probe), "7ms", 0, 7000, 0 },
+		{ TIMER_INIT(on_probe), "1s", 0, 1000000, 0 },
+		{ TIMER_INIT(on_probe), "avulso 1,5s", 0, 0, 0 },
+		{ TIMER_INIT(on_probe), "avulso 5s", 0, 0, 0 },
+	};
+	static const uint32_t delays[] = { 10000, 3000, 1000000, 1500000, 5000000 };
+	const int n = sizeof(probes) / sizeof(probes[0]);
+	uint64_t end;
+	uint32_t runs = 0, fired = 0;
+	int i;
+
+	gs_now = WRAP_START_US;
+	gs_alarm = NONE;
+	timer_init();
+	for (i = 0; i < n; i++) {
+		probes[i].due = gs_now + delays[i];
+		timer_start(&probes[i].t, delays[i], probes[i].period);
+	}
+
+	end = gs_now + WRAP_RUN_US;
+	advance_to(end, &runs);
+
+	for (i = 0; i < n; i++) {
+		uint32_t expected = probes[i].period ?
+				(uint32_t)((WRAP_RUN_US - delays[i]) / probes[i].period + 1) :
+				delays[i] <= WRAP_RUN_US;
+
+		if (probes[i].fired != expected) {
+			fail("quantidade de disparos", probes[i].name, gs_now);
+		}
+		fired += probes[i].fired;
+		timer_stop(&probes[i].t);
+	}
+	printf("volta do tick: %lu disparos em %lu alarmes, de %lu ms a %lu ms\n",
+			(unsigned long)fired, (unsigned long)runs,
+			(unsigned long)(WRAP_START_US / TIMER_TICK_US),
+			(unsigned long)(end / TIMER_TICK_US));
+}
+
+/* ---- modelo ---- */
+
+static model_t gs_model[MODEL_TIMERS];
+static uint32_t gs_seed = 12345;
+static uint32_t gs_fired;
+
+static uint32_t rnd(void)
+{
+	gs_seed = gs_seed * 1664525u + 1013904223u;
+	return gs_seed >> 8;
+}
+
+static void model_stop(model_t *m)
+{
+	timer_stop(&m->t);
+	m->active = false;
+}
+
+static void on_model(sw_timer_t *t)
+{
+	model_t *m = (model_t *)((char *)t - offsetof(model_t, t));
+
+	if (!m->active) {
+		fail("disparo de timer parado", "", gs_now);
+	} else if (gs_now < m->earliest || gs_now > m->latest) {
+		fail("disparo fora da janela", "", gs_now);
+	}
+	gs_fired++;
+	if (m->period) {
+		m->earliest = m->latest = gs_now + m->period;
+	} else {
+		m->active = false;
+	}
+	if (timer_active(t) != m->active) {
+		fail("rearme do periodico", "", gs_now);
+	}
+	/* de vez em quando a callback para um timer, as vezes ela mesma */
+	if (rnd() % 8 == 0) {
+		model_stop(&gs_model[rnd() % MODEL_TIMERS]);
+	}
+}
+
+static void model(void)
+{
+	uint32_t op, i, starts = 0, far = 0;
+	uint64_t start = WRAP_US - 100000000u;
+	bool any;
+
+	gs_now = start;
+	gs_alarm = NONE;
+	timer_init();
+	for (i = 0; i < MODEL_TIMERS; i++) {
+		gs_model[i].t = (sw_timer_t)TIMER_INIT(on_model);
+		gs_model[i].active = false;
+	}
+
+	for (op = 0; op < MODEL_OPS; op++) {
+		model_t *m = &gs_model[rnd() % MODEL_TIMERS];
+		uint32_t r = rnd() % 16;
+
+		if (r < 7) {
+			/* metade na roda, metade na fila */
+			uint32_t delay = rnd() % 2 ? rnd() % (TIMER_SLOTS * TIMER_TICK_US) :
+					rnd() % 5000000u;
+			uint32_t period = rnd() % 3 ? 0 : 1 + rnd() % 2000000u;
+
+			timer_start(&m->t, delay, period);
+			m->active = true;
+			m->earliest = gs_now + delay;
+			m->latest = m->earliest + TIMER_TICK_US;
+			m->period = period ? Max((period + TIMER_TICK_US / 2) / TIMER_TICK_US, 1u) *
+					TIMER_TICK_US : 0;
+			starts++;
+			far += delay >= TIMER_SLOTS * TIMER_TICK_US;
+		} else if (r < 9) {
+			model_stop(m);
+		} else if (!advance_to(gs_now + rnd() % (r < 15 ? 3000u : 700000u), NULL)) {
+			break;
+		}
+
+		any = false;
+		for (i = 0; i < MODEL_TIMERS; i++) {
+			m = &gs_model[i];
+			if (timer_active(&m->t) != m->active) {
+				fail("timer_active diferente do modelo", "", gs_now);
+			}
+			if (m->active && m->latest < gs_now) {
+				fail("vencido sem disparo", "", gs_now);
+				m->active = false;
+				timer_stop(&m->t);
+			}
+			any |= m->active;
+		}
+		{
+			uint64_t at;
+
+			if (timer_next(&at) != any) {
+				fail("timer_next diferente do modelo", "", gs_now);
+			}
+		}
+	}
+	for (i = 0; i < MODEL_TIMERS; i++) {
+		model_stop(&gs_model[i]);
+	}
+	printf("modelo: %lu passos, %lu armados (%lu na fila), %lu disparos, %lu s de relogio\n",
+			(unsigned long)op, (unsigned long)starts, (unsigned long)far,
+			(unsigned long)gs_fired, (unsigned long)((gs_now - start) / 1000000u));
+}
+
+int main(void)
+{
+	wrap();
+	model();
+	if (gs_errors) {
+		printf("timer-bench: %d erros\n", gs_errors);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,228 @@
+/*
+ * ui_bench.c
+ *
+ * Created: 18/10/2026
+ *
+ * A tabela da interface (ui_table.h) despachada pelo hsm.c no host, par a
+ * par: para cada estado em que uma regiao pode estar, cada evento e as duas
+ * respostas da guarda (porta aberta e fechada), o resultado do
+ * hsm_dispatch() e comparado com um interpretador direto da semantica
+ * descrita em hsm.h, que procura a linha subindo pelos pais a cada evento
+ * em vez de usar o indice.
+ *
+ *     make ui-bench
+ *
+ * Confere se o evento foi tratado, o estado final e a sequencia de saidas,
+ * acao e entradas (as acoes daqui so anotam o proprio nome). Cobre as
+ * linhas herdadas, as guardas que recusam e deixam o evento subir e os
+ * eventos ignorados. No fim toda linha da tabela tem que ter sido tomada
+ * por algum par. Qualquer divergencia sai com status 1.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "hsm.h"
+#include "ui.h"
+
+#define LOG_SIZE        256
+
+static char gs_log[LOG_SIZE];
+static bool gs_door_open;
+static int gs_errors;
+
+static void note(const char *what)
+{
+	strncat(gs_log, what, LOG_SIZE - strlen(gs_log) - 1);
+	strncat(gs_log, " ", LOG_SIZE - strlen(gs_log) - 1);
+}
+
+/* O trace do hsm.c nao interessa aqui */
+void trace_emit(uint8_t id, const int32_t *args)
+{
+	(void)id;
+	(void)args;
+}
+
+/* ---- acoes e guardas com os nomes do main.c ---- */
+
+#define ACTION(fn) \
+	static void fn(uint32_t arg) { (void)arg; note("/" #fn); }
+
+ACTION(menu_entry)
+ACTION(door_open_entry)
+ACTION(config_entry)
+ACTION(running_entry)
+ACTION(running_exit)
+ACTION(unlocked_entry)
+ACTION(lock_idle_entry)
+ACTION(lock_hold_entry)
+ACTION(lock_hold_exit)
+ACTION(lock_ready_entry)
+ACTION(next_mode)
+ACTION(config_option)
+ACTION(config_save)
+ACTION(unlock)
+
+static bool door_closed(uint32_t arg)
+{
+	(void)arg;
+	return !gs_door_open;
+}
+
+#include "ui_table.h"
+
+/* ---- interpretador de referencia ---- */
+
+/* \a s e os ancestrais dele, de baixo para cima; devolve quantos */
+static int ancestors(uint8_t s, uint8_t *out)
+{
+	int n = 0;
+
+	for (; s != HSM_NONE; s = gs_ui_states[s].parent) {
+		out[n++] = s;
+	}
+	return n;
+}
+
+static bool is_ancestor(uint8_t a, uint8_t s)
+{
+	uint8_t up[HSM_DEPTH_MAX];
+	int i, n = ancestors(s, up);
+
+	for (i = 0; i < n; i++) {
+		if (up[i] == a) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void call(hsm_action_t fn, uint32_t arg)
+{
+	if (fn != NULL) {
+		fn(arg);
+	}
+}
+
+/* Como hsm_dispatch(), sem o indice: a primeira linha cuja guarda passa,
+ * procurada no estado e depois nos pais */
+static bool ref_dispatch(uint8_t *state, uint8_t event, uint32_t arg)
+{
+	uint8_t up[HSM_DEPTH_MAX], down[HSM_DEPTH_MAX];
+	uint8_t s, dom;
+	int i, r, n;
+
+	for (s = *state; s != HSM_NONE; s = gs_ui_states[s].parent) {
+		for (r = 0; r < (int)(sizeof(gs_ui_rows) / sizeof(gs_ui_rows[0])); r++) {
+			const hsm_row_t *row = &gs_ui_rows[r];
+
+			if (row->from != s || row->event != event ||
+			    (row->guard != NULL && !row->guard(arg))) {
+				continue;
+			}
+			if (row->to == HSM_NONE) {
+				call(row->action, arg);
+				return true;
+			}
+			/* dominio: o proprio pai numa auto-transicao, senao o
+			 * ancestral mais baixo da origem que contem o alvo */
+			dom = gs_ui_states[row->from].parent;
+			if (row->from != row->to) {
+				n = ancestors(row->from, up);
+				for (i = 0, dom = HSM_NONE; i < n && dom == HSM_NONE; i++) {
+					if (is_ancestor(up[i], row->to)) {
+						dom = up[i];
+					}
+				}
+			}
+			n = ancestors(*state, up);
+			for (i = 0; i < n && up[i] != dom; i++) {
+				call(gs_ui_states[up[i]].exit, arg);
+			}
+			call(row->action, arg);
+			n = ancestors(row->to, down);
+			for (i = 0; i < n && down[i] != dom; i++) {
+			}
+			while (i-- > 0) {
+				call(gs_ui_states[down[i]].entry, arg);
+			}
+			for (s = row->to; gs_ui_states[s].initial != HSM_NONE; ) {
+				s = gs_ui_states[s].initial;
+				call(gs_ui_states[s].entry, arg);
+			}
+			*state = s;
+			return true;
+		}
+	}
+	return false;
+}
+
+/* ---- todos os pares ---- */
+
+int main(void)
+{
+	char expected[LOG_SIZE];
+	uint32_t pairs = 0, taken = 0, r;
+	uint8_t s, e, ref;
+	int door;
+
+	if (!hsm_build(&gs_ui)) {
+		printf("ui-bench: tabela mal formada\n");
+		return 1;
+	}
+
+	for (s = 0; s < UI_STATE_COUNT; s++) {
+		/* regioes so param em estados sem filho inicial */
+		if (gs_ui_states[s].initial != HSM_NONE) {
+			continue;
+		}
+		for (e = 0; e < UI_EV_COUNT; e++) {
+			for (door = 0; door < 2; door++) {
+				hsm_t m;
+				bool handled, ref_handled;
+
+				gs_door_open = door;
+				gs_log[0] = '\0';
+				ref = s;
+				ref_handled = ref_dispatch(&ref, e, 0);
+				strcpy(expected, gs_log);
+
+				gs_log[0] = '\0';
+				hsm_init(&m, &gs_ui, s);
+				handled = hsm_dispatch(&m, e, 0);
+
+				pairs++;
+				taken += handled;
+				if (handled != ref_handled || hsm_state(&m) != ref ||
+				    strcmp(gs_log, expected) != 0) {
+					if (gs_errors++ < 10) {
+						printf("ui-bench: %s + %s (porta %s): %s -> %s [%s], esperado %s -> %s [%s]\n",
+								gs_ui_states[s].name, gs_ui_events[e],
+								door ? "aberta" : "fechada",
+								handled ? "tratado" : "ignorado",
+								gs_ui_states[hsm_state(&m)].name, gs_log,
+								ref_handled ? "tratado" : "ignorado",
+								gs_ui_states[ref].name, expected);
+					}
+				}
+			}
+		}
+	}
+
+	for (r = 0; r < gs_ui.nrows; r++) {
+		if (gs_ui_hits[r] == 0) {
+			gs_errors++;
+			printf("ui-bench: linha %lu (%s + %s) nunca tomada\n", (unsigned long)r,
+					gs_ui_states[gs_ui_rows[r].from].name,
+					gs_ui_events[gs_ui_rows[r].event]);
+		}
+	}
+
+	printf("ui: %lu pares estado/evento/porta, %lu tratados, %lu linhas\n",
+			(unsigned long)pairs, (unsigned long)taken, (unsigned long)gs_ui.nrows);
+	if (gs_errors) {
+		printf("ui-bench: %d erros\n", gs_errors);
+		return 1;
+	}
+	return 0;
+}
@@ -201,6 +201,95 @@ status_code_t spi_write_packet(Spi *p_spi, const uint8_t *data,
 	return STATUS_OK;
 }
 
+/** Frames written per pass of the spi_write_stream() loop */
+#define SPI_STREAM_UNROLL 4
+
+static inline void spi_stream_put(Spi *p_spi, uint32_t data)
+{
+	while (!(p_spi->SPI_SR & SPI_SR_TDRE)) {
+	}
+	p_spi->SPI_TDR = data;
+}
+
+/* Frames of 16 bits from here on; the CSR only changes with the bus idle */
+static void spi_stream_begin(Spi *p_spi, uint32_t ul_pcs_ch)
+{
+	while (!spi_is_tx_empty(p_spi)) {
+	}
+	spi_set_bits_per_transfer(p_spi, ul_pcs_ch, SPI_CSR_BITS_16_BIT);
+}
+
+/* Back to 8 bits, sending the odd byte (if any) in a frame of its own */
+static void spi_stream_end(Spi *p_spi, uint32_t ul_pcs_ch, int tail)
+{
+	while (!spi_is_tx_empty(p_spi)) {
+	}
+	spi_set_bits_per_transfer(p_spi, ul_pcs_ch, SPI_CSR_BITS_8_BIT);
+	if (tail >= 0) {
+		spi_stream_put(p_spi, (uint32_t)tail);
+		while (!spi_is_tx_empty(p_spi)) {
+		}
+	}
+	/* received frames are discarded */
+	(void)p_spi->SPI_RDR;
+}
+
+void spi_write_stream(Spi *p_spi, uint32_t ul_pcs_ch, const uint8_t *data,
+		size_t len)
+{
+	size_t words = len / 2;
+
+	spi_stream_begin(p_spi, ul_pcs_ch);
+
+	while (words >= SPI_STREAM_UNROLL) {
+		spi_stream_put(p_spi, (data[0] << 8) | data[1]);
+		spi_stream_put(p_spi, (data[2] << 8) | data[3]);
+		spi_stream_put(p_spi, (data[4] << 8) | data[5]);
+		spi_stream_put(p_spi, (data[6] << 8) | data[7]);
+		data += 2 * SPI_STREAM_UNROLL;
+		words -= SPI_STREAM_UNROLL;
+	}
+	while (words--) {
+		spi_stream_put(p_spi, (data[0] << 8) | data[1]);
+		data += 2;
+	}
+
+	spi_stream_end(p_spi, ul_pcs_ch, (len & 1) ? *data : -1);
+}
+
+void spi_write_repeat(Spi *p_spi, uint32_t ul_pcs_ch, const uint8_t *pattern,
+		size_t pattern_len, size_t count)
+{
+	uint32_t frames[SPI_REPEAT_PATTERN_MAX];
+	size_t period, words, len, i;
+
+	Assert(pattern_len > 0 && pattern_len <= SPI_REPEAT_PATTERN_MAX);
+
+	/* An odd pattern lines up with the 16-bit frames every two copies */
+	period = (pattern_len & 1) ? pattern_len : pattern_len / 2;
+	for (i = 0; i < period; i++) {
+		frames[i] = (pattern[(2 * i) % pattern_len] << 8)
+				| pattern[(2 * i + 1) % pattern_len];
+	}
+
+	len = pattern_len * count;
+	words = len / 2;
+
+	spi_stream_begin(p_spi, ul_pcs_ch);
+
+	while (words >= period) {
+		for (i = 0; i < period; i++) {
+			spi_stream_put(p_spi, frames[i]);
+		}
+		words -= period;
+	}
+	for (i = 0; i < words; i++) {
+		spi_stream_put(p_spi, frames[i]);
+	}
+
+	spi_stream_end(p_spi, ul_pcs_ch, (len & 1) ? pattern[pattern_len - 1] : -1);
+}
+
 /**
  * \brief Receive a sequence of bytes from an SPI device.
  *
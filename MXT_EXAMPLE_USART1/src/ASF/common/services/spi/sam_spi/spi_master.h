@@ -195,6 +195,45 @@ static inline void spi_write_single(Spi *p_spi, uint8_t data)
 extern status_code_t spi_write_packet(Spi *p_spi,
 		const uint8_t *data, size_t len);
 
+/** Longest pattern accepted by spi_write_repeat() */
+#define SPI_REPEAT_PATTERN_MAX  4
+
+/**
+ * \brief Send a sequence of bytes at the full bus rate.
+ *
+ * The bytes go out two at a time in 16-bit frames, first byte in the high
+ * half so the order on the wire is the same as spi_write_packet(). The
+ * transmit register is fed from an unrolled loop that only polls TDRE, with
+ * no timeout per byte. Returns once the last bit has left the shift
+ * register, so the caller may switch a D/C line or the chip select at once.
+ *
+ * \param p_spi     Base address of the SPI instance.
+ * \param ul_pcs_ch Chip select of the device (its CSR is switched to 16 bits
+ *                  and back).
+ * \param data      Data buffer to write.
+ * \param len       Length of data to be written.
+ *
+ * \pre SPI device must be selected with spi_select_device() first, in fixed
+ * peripheral select mode with 8-bit transfers.
+ */
+extern void spi_write_stream(Spi *p_spi, uint32_t ul_pcs_ch,
+		const uint8_t *data, size_t len);
+
+/**
+ * \brief Send a short pattern \a count times, as spi_write_stream() would
+ * send a buffer holding the copies back to back (e.g. one pixel for a fill).
+ *
+ * \param p_spi       Base address of the SPI instance.
+ * \param ul_pcs_ch   Chip select of the device.
+ * \param pattern     Bytes to repeat.
+ * \param pattern_len 1 to SPI_REPEAT_PATTERN_MAX bytes.
+ * \param count       Number of copies.
+ *
+ * \pre Same as spi_write_stream().
+ */
+extern void spi_write_repeat(Spi *p_spi, uint32_t ul_pcs_ch,
+		const uint8_t *pattern, size_t pattern_len, size_t count);
+
 /** \brief Receive one byte from an SPI device.
  *
  * \param p_spi     Base address of the SPI instance.
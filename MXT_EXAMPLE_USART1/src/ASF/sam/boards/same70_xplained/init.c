@@ -328,8 +328,27 @@ static void _setup_memory_region( void )
 #ifdef CONF_BOARD_ENABLE_TCM_AT_INIT
 #if defined(__GNUC__)
 extern char _itcm_lma, _sitcm, _eitcm;
+extern char _sdtcm, _edtcm;
 #endif
 
+/** GPNVM bits 8:7 select the TCM size: 01 = 32 KB ITCM + 32 KB DTCM */
+#define TCM_GPNVM_MASK     ((1u << 8) | (1u << 7))
+#define TCM_GPNVM_32K      (1u << 7)
+
+static void efc_command(uint32_t cmd, uint32_t arg)
+{
+	EFC->EEFC_FCR = EEFC_FCR_FKEY_PASSWD | cmd | EEFC_FCR_FARG(arg);
+	while (!(EFC->EEFC_FSR & EEFC_FSR_FRDY)) {
+	}
+}
+
+/** \brief Current TCM configuration bits (GPNVM 8:7) */
+static uint32_t tcm_gpnvm_config(void)
+{
+	efc_command(EEFC_FCR_FCMD_GGPB, 0);
+	return EFC->EEFC_FRR & TCM_GPNVM_MASK;
+}
+
 /** \brief  TCM memory enable
 * The function enables TCM memories
 */
@@ -380,11 +399,14 @@ void board_init(void)
 #endif
 
 #ifdef CONF_BOARD_ENABLE_TCM_AT_INIT
-	/* TCM Configuration */
-	EFC->EEFC_FCR = (EEFC_FCR_FKEY_PASSWD | EEFC_FCR_FCMD_CGPB 
-					| EEFC_FCR_FARG(8));
-	EFC->EEFC_FCR = (EEFC_FCR_FKEY_PASSWD | EEFC_FCR_FCMD_SGPB
-					| EEFC_FCR_FARG(7));
+	/* TCM Configuration. The GPNVM bits are only written when they differ
+	 * (they are flash bits) and only take effect after a reset, so the
+	 * first boot with a new configuration restarts here. */
+	if (tcm_gpnvm_config() != TCM_GPNVM_32K) {
+		efc_command(EEFC_FCR_FCMD_CGPB, 8);
+		efc_command(EEFC_FCR_FCMD_SGPB, 7);
+		NVIC_SystemReset();
+	}
 	tcm_enable();
 #if defined(__GNUC__)
 	volatile char *dst = &_sitcm;
@@ -393,6 +415,12 @@ void board_init(void)
 	while(dst < &_eitcm){
 		*dst++ = *src++;
 	}
+	/* clear the DTCM buffers */
+	for (dst = &_sdtcm; dst < &_edtcm; dst++) {
+		*dst = 0;
+	}
+	__DSB();
+	__ISB();
 #endif
 #else
 	/* TCM Configuration */
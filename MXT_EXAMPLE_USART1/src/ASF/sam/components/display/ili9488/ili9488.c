@@ -49,6 +49,7 @@
 #include <assert.h>
 #include <stdlib.h>
 #include "pio.h"
+#include "delay.h"
 #ifdef ILI9488_EBIMODE
 #  include "smc.h"
 #  include "pmc.h"
@@ -418,10 +419,21 @@ static void ili9488_write_ram(ili9488_color_t ul_color)
  */
 static void ili9488_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t ul_size)
 {
-	volatile uint32_t i;
 	pio_set_pin_high(LCD_SPI_CDS_PIO);
-	spi_write_packet(BOARD_ILI9488_SPI, p_ul_buf, ul_size);
-	for(i = 0; i < 0xFF; i++);
+	spi_write_stream(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, p_ul_buf, ul_size);
+}
+
+/**
+ * \brief Write the same pixel to LCD GRAM multiple times.
+ *
+ * \param p_pixel one pixel, LCD_DATA_COLOR_UNIT bytes.
+ * \param ul_count number of pixels.
+ */
+static void ili9488_write_ram_repeat(const ili9488_color_t *p_pixel, uint32_t ul_count)
+{
+	pio_set_pin_high(LCD_SPI_CDS_PIO);
+	spi_write_repeat(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, p_pixel,
+			LCD_DATA_COLOR_UNIT, ul_count);
 }
 
 /**
@@ -443,8 +455,7 @@ static void ili9488_write_register(uint8_t uc_reg, const ili9488_color_t *us_dat
 	if(size > 0) {
 		/* Transfer data */
 		pio_set_pin_high(LCD_SPI_CDS_PIO);
-		spi_write_packet(BOARD_ILI9488_SPI, us_data, size);
-		for(i = 0; i < 0x5F; i++);
+		spi_write_stream(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, us_data, size);
 	}
 }
 
@@ -618,96 +629,124 @@ void ili9488_set_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height
  * \return 0 if initialization succeeds, otherwise fails.
  */
 uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
+{
+	uint32_t step = 0;
+	uint32_t wait;
+
+	while ((wait = ili9488_init_step(p_opt, &step)) < ILI9488_INIT_FAIL) {
+		delay_us(wait);
+	}
+
+	return wait == ILI9488_INIT_FAIL;
+}
+
+/**
+ * \brief Run one step of the ILI9488 initialization.
+ *
+ * Same sequence as ili9488_init(), split where the controller needs time
+ * after a command. Instead of waiting, each call returns how long the
+ * caller must wait before the next one, so other devices can be brought up
+ * in the meantime.
+ *
+ * \param p_opt pointer to ILI9488 option structure.
+ * \param p_step step counter, 0 on the first call.
+ *
+ * \return wait in microseconds before the next call, ILI9488_INIT_DONE when
+ * the panel is ready or ILI9488_INIT_FAIL if the chip ID does not match.
+ */
+uint32_t ili9488_init_step(struct ili9488_opt_t *p_opt, uint32_t *p_step)
 {
 	ili9488_color_t param;
 	uint32_t chipid;
+
+	switch ((*p_step)++) {
+	case 0:
+	{
 #ifdef ILI9488_EBIMODE
-	/* Enable peripheral clock */
-	pmc_enable_periph_clk(ID_SMC);
-
-	/* Configure SMC, NCS3 is assigned to LCD */
-	smc_set_setup_timing(SMC, BOARD_ILI9488_EBI_NPCS, SMC_SETUP_NWE_SETUP(0)
-			| SMC_SETUP_NCS_WR_SETUP(0)
-			| SMC_SETUP_NRD_SETUP(0)
-			| SMC_SETUP_NCS_RD_SETUP(0));
-	smc_set_pulse_timing(SMC, BOARD_ILI9488_EBI_NPCS , SMC_PULSE_NWE_PULSE(3)
-			| SMC_PULSE_NCS_WR_PULSE(0x4)
-			| SMC_PULSE_NRD_PULSE(0xA)
-			| SMC_PULSE_NCS_RD_PULSE(0xA));
-	smc_set_cycle_timing(SMC, BOARD_ILI9488_EBI_NPCS, SMC_CYCLE_NWE_CYCLE(0x4)
-			| SMC_CYCLE_NRD_CYCLE(0xA));
-
-
-	smc_set_mode(SMC, BOARD_ILI9488_EBI_NPCS, SMC_MODE_READ_MODE
-			| SMC_MODE_WRITE_MODE
-			| SMC_MODE_DBW_16_BIT
-			| SMC_MODE_EXNW_MODE_DISABLED
-			| SMC_MODE_TDF_CYCLES(0xF));
+		/* Enable peripheral clock */
+		pmc_enable_periph_clk(ID_SMC);
+
+		/* Configure SMC, NCS3 is assigned to LCD */
+		smc_set_setup_timing(SMC, BOARD_ILI9488_EBI_NPCS, SMC_SETUP_NWE_SETUP(0)
+				| SMC_SETUP_NCS_WR_SETUP(0)
+				| SMC_SETUP_NRD_SETUP(0)
+				| SMC_SETUP_NCS_RD_SETUP(0));
+		smc_set_pulse_timing(SMC, BOARD_ILI9488_EBI_NPCS , SMC_PULSE_NWE_PULSE(3)
+				| SMC_PULSE_NCS_WR_PULSE(0x4)
+				| SMC_PULSE_NRD_PULSE(0xA)
+				| SMC_PULSE_NCS_RD_PULSE(0xA));
+		smc_set_cycle_timing(SMC, BOARD_ILI9488_EBI_NPCS, SMC_CYCLE_NWE_CYCLE(0x4)
+				| SMC_CYCLE_NRD_CYCLE(0xA));
+
+
+		smc_set_mode(SMC, BOARD_ILI9488_EBI_NPCS, SMC_MODE_READ_MODE
+				| SMC_MODE_WRITE_MODE
+				| SMC_MODE_DBW_16_BIT
+				| SMC_MODE_EXNW_MODE_DISABLED
+				| SMC_MODE_TDF_CYCLES(0xF));
 #endif
 #ifdef ILI9488_SPIMODE
-	struct spi_device ILI9488_SPI_DEVICE = {
-		// Board specific chip select configuration
-		.id = BOARD_ILI9488_SPI_NPCS
-	};
-
-	/* Init, select and configure the chip */
-	spi_master_init(BOARD_ILI9488_SPI);
-	spi_master_setup_device(BOARD_ILI9488_SPI, &ILI9488_SPI_DEVICE, SPI_MODE_3, ILI9488_SPI_BAUDRATE, 0);
-	spi_configure_cs_behavior(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, SPI_CS_RISE_NO_TX);
-	spi_select_device(BOARD_ILI9488_SPI, &ILI9488_SPI_DEVICE);
-
-	/* Enable the SPI peripheral */
-	spi_enable(BOARD_ILI9488_SPI);
-	spi_enable_interrupt(BOARD_ILI9488_SPI, SPI_IER_RDRF);
+		struct spi_device ILI9488_SPI_DEVICE = {
+			// Board specific chip select configuration
+			.id = BOARD_ILI9488_SPI_NPCS
+		};
+
+		/* Init, select and configure the chip */
+		spi_master_init(BOARD_ILI9488_SPI);
+		spi_master_setup_device(BOARD_ILI9488_SPI, &ILI9488_SPI_DEVICE, SPI_MODE_3, ILI9488_SPI_BAUDRATE, 0);
+		spi_configure_cs_behavior(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, SPI_CS_RISE_NO_TX);
+		spi_select_device(BOARD_ILI9488_SPI, &ILI9488_SPI_DEVICE);
+
+		/* Enable the SPI peripheral */
+		spi_enable(BOARD_ILI9488_SPI);
+		spi_enable_interrupt(BOARD_ILI9488_SPI, SPI_IER_RDRF);
 #endif
 
-	ili9488_write_register(ILI9488_CMD_SOFTWARE_RESET, 0x0000, 0);
-	ili9488_delay(200);
+		ili9488_write_register(ILI9488_CMD_SOFTWARE_RESET, 0x0000, 0);
+		return ILI9488_RESET_WAIT_US;
+	}
 
-	ili9488_write_register(ILI9488_CMD_SLEEP_OUT, 0x0000, 0);
-	ili9488_delay(200);
+	case 1:
+		ili9488_write_register(ILI9488_CMD_SLEEP_OUT, 0x0000, 0);
+		return ILI9488_SLEEP_OUT_WAIT_US;
+
+	default:
+		break;
+	}
 
 	/** read chipid */
 	chipid = ili9488_read_chipid();
 	if (chipid != ILI9488_DEVICE_CODE) {
-		return 1;
+		return ILI9488_INIT_FAIL;
 	}
 
 	/** make it tRGB and reverse the column order */
 	param = 0x48;
 	ili9488_write_register(ILI9488_CMD_MEMORY_ACCESS_CONTROL, &param, 1);
-	ili9488_delay(100);
 
 	param = 0x04;
 	ili9488_write_register(ILI9488_CMD_CABC_CONTROL_9, &param, 1);
-	ili9488_delay(100);
 #ifdef ILI9488_EBIMODE
 	/** Set ILI9488 Pixel Format in SMC mode.*/
 	param = 0x05;
 	ili9488_write_register(ILI9488_CMD_COLMOD_PIXEL_FORMAT_SET, &param, 1);
-	ili9488_delay(100);
 	ili9488_write_register(ILI9488_CMD_PARTIAL_MODE_ON, 0, 0);
-	ili9488_delay(100);
 #endif
 #ifdef ILI9488_SPIMODE
 	param = 0x06;
 	ili9488_write_register(ILI9488_CMD_COLMOD_PIXEL_FORMAT_SET, &param, 1);
-	ili9488_delay(100);
 	ili9488_write_register(ILI9488_CMD_NORMAL_DISP_MODE_ON, 0, 0);
-	ili9488_delay(100);
 #endif
 
 	ili9488_display_on();
-	ili9488_delay(100);
 
 	ili9488_set_display_direction(LANDSCAPE);
-	ili9488_delay(100);
 
 	ili9488_set_window(0, 0,p_opt->ul_width,p_opt->ul_height);
 	ili9488_set_foreground_color(p_opt->foreground_color);
 	ili9488_set_cursor_position(0, 0);
 
-	return 0;
+	return ILI9488_INIT_DONE;
 }
 
 /**
@@ -996,7 +1035,10 @@ void ili9488_draw_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 void ili9488_draw_filled_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 		uint32_t ul_x2, uint32_t ul_y2)
 {
-	uint32_t size, blocks;
+	uint32_t size;
+#ifndef ILI9488_SPIMODE
+	uint32_t blocks;
+#endif
 
 	/* Swap coordinates if necessary */
 	ili9488_check_box_coordinates(&ul_x1, &ul_y1, &ul_x2, &ul_y2);
@@ -1008,6 +1050,10 @@ void ili9488_draw_filled_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 	ili9488_write_ram_prepare();
 
 	size = (ul_x2 - ul_x1 + 1) * (ul_y2 - ul_y1 + 1);
+#ifdef ILI9488_SPIMODE
+	/* The first pixel of the cache, repeated by the SPI */
+	ili9488_write_ram_repeat(g_ul_pixel_cache, size);
+#else
 	/* Send pixels blocks => one SPI IT / block */
 	blocks = size / LCD_DATA_CACHE_SIZE;
 	while (blocks--) {
@@ -1016,6 +1062,7 @@ void ili9488_draw_filled_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 
 	/* Send remaining pixels */
 	ili9488_write_ram_buffer(g_ul_pixel_cache, (size % LCD_DATA_CACHE_SIZE) * LCD_DATA_COLOR_UNIT);
+#endif
 
 	/* Reset the refresh window area */
 	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
@@ -1229,6 +1276,57 @@ void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
 }
 
+/**
+ * \brief Open a drawing window for a streamed blit.
+ *
+ * Sets the refresh window and issues a single memory write command. The pixel
+ * data is then sent with one or more calls to ili9488_blit_write(), which keep
+ * the controller in the same memory write, so a composed image goes over the
+ * bus as one transfer regardless of how many buffers it is produced in.
+ *
+ * \param ul_x X coordinate of upper-left corner on LCD.
+ * \param ul_y Y coordinate of upper-left corner on LCD.
+ * \param ul_width width of the window.
+ * \param ul_height height of the window.
+ */
+void ili9488_blit_begin(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
+		uint32_t ul_height)
+{
+	uint32_t dwX1, dwY1, dwX2, dwY2;
+	dwX1 = ul_x;
+	dwY1 = ul_y;
+	dwX2 = ul_x + ul_width - 1;
+	dwY2 = ul_y + ul_height - 1;
+
+	/* Swap coordinates if necessary */
+	ili9488_check_box_coordinates(&dwX1, &dwY1, &dwX2, &dwY2);
+
+	/* Determine the refresh window area */
+	ili9488_set_window(dwX1, dwY1, (dwX2 - dwX1 + 1), (dwY2 - dwY1 + 1));
+
+	/* Prepare to write in GRAM */
+	ili9488_write_ram_prepare();
+}
+
+/**
+ * \brief Stream pixel data into the window opened by ili9488_blit_begin().
+ *
+ * \param p_buf pixel data, LCD_DATA_COLOR_UNIT units per pixel.
+ * \param ul_size number of units in the buffer.
+ */
+void ili9488_blit_write(const ili9488_color_t *p_buf, uint32_t ul_size)
+{
+	ili9488_write_ram_buffer(p_buf, ul_size);
+}
+
+/**
+ * \brief Close a streamed blit and restore the full-screen window.
+ */
+void ili9488_blit_end(void)
+{
+	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
+}
+
 /**
  * \brief Set display brightness
  *
@@ -1434,11 +1532,10 @@ void ili9488_duplicate_pixel(const uint16_t color, uint32_t count)
 #endif
 #ifdef ILI9488_SPIMODE
 	uint32_t color_666 = RGB_16_TO_18BIT(color);
-	while (count--) {
-		ili9488_write_ram(color_666 >> 16);
-		ili9488_write_ram(color_666 >> 8);
-		ili9488_write_ram(color_666 & 0xFF);
-	}
+	const ili9488_color_t pixel[3] = {
+		color_666 >> 16, color_666 >> 8, color_666 & 0xFF
+	};
+	ili9488_write_ram_repeat(pixel, count);
 #endif
 }
 
@@ -99,6 +99,17 @@ typedef union _union_type
 /* ILI9488 ID code */
 #define ILI9488_DEVICE_CODE (0x9488u)
 
+/** Wait after a software reset before Sleep Out (120 ms if the panel was
+ * awake, e.g. after a warm reset of the MCU) */
+#define ILI9488_RESET_WAIT_US       120000u
+
+/** Wait after Sleep Out before the next command */
+#define ILI9488_SLEEP_OUT_WAIT_US   5000u
+
+/** ili9488_init_step() return values besides a wait in microseconds */
+#define ILI9488_INIT_DONE           0xFFFFFFFFu
+#define ILI9488_INIT_FAIL           0xFFFFFFFEu
+
 /* Level 1 Commands (from the display Datasheet) */
 #define ILI9488_CMD_NOP                             0x00
 #define ILI9488_CMD_SOFTWARE_RESET                  0x01
@@ -325,6 +336,7 @@ enum ili9488_display_direction{
 
 
 uint32_t ili9488_init(struct ili9488_opt_t *p_opt);
+uint32_t ili9488_init_step(struct ili9488_opt_t *p_opt, uint32_t *p_step);
 void ili9488_set_display_direction(enum ili9488_display_direction direction);
 void ili9488_set_window( uint16_t dwX, uint16_t dwY, uint16_t dwWidth, uint16_t dwHeight );
 void ili9488_display_on(void);
@@ -349,6 +361,10 @@ void ili9488_draw_prepare(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 void ili9488_draw_string(uint32_t ul_x, uint32_t ul_y, const uint8_t *p_str);
 void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 		uint32_t ul_height, const ili9488_color_t *p_ul_pixmap);
+void ili9488_blit_begin(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
+		uint32_t ul_height);
+void ili9488_blit_write(const ili9488_color_t *p_buf, uint32_t ul_size);
+void ili9488_blit_end(void);
 void ili9488_delay(uint32_t ul_ms);
 void ili9488_write_brightness(uint16_t us_value);
 uint16_t ili9488_read_gram(void);
@@ -38,11 +38,18 @@
 #include "pio_handler.h"
 
 /**
- * Maximum number of interrupt sources that can be defined. This
- * constant can be increased, but the current value is the smallest possible one
- * that will be compatible with all existing projects.
+ * Maximum number of interrupt sources that can be defined. Dispatch time does
+ * not depend on it: pins hold an index into the source list.
  */
-#define MAX_INTERRUPT_SOURCES       7
+#ifndef MAX_INTERRUPT_SOURCES
+#define MAX_INTERRUPT_SOURCES       32
+#endif
+
+/**
+ * PIO controllers with a dispatch table, indexed by peripheral ID from ID_PIOA
+ * (on SAM E70 PIOD and PIOE come after a gap in the IDs).
+ */
+#define PIO_HANDLER_PORTS           8
 
 /**
  * Describes a PIO interrupt source, including the PIO instance triggering the
@@ -53,8 +60,10 @@ struct s_interrupt_source {
 	uint32_t mask;
 	uint32_t attr;
 
-	/* Interrupt handler. */
+	/* Interrupt handler, called with ctx if handler_ctx is set. */
 	void (*handler) (const uint32_t, const uint32_t);
+	void (*handler_ctx) (void *, const uint32_t, const uint32_t);
+	void *ctx;
 };
 
 
@@ -64,6 +73,10 @@ static struct s_interrupt_source gs_interrupt_sources[MAX_INTERRUPT_SOURCES];
 /* Number of currently defined interrupt sources. */
 static uint32_t gs_ul_nb_sources = 0;
 
+/* Source of each pin of each controller: index in gs_interrupt_sources plus
+ * one, 0 for none. */
+static uint8_t gs_pin_sources[PIO_HANDLER_PORTS][32];
+
 #if (SAM3S || SAM4S || SAM4E)
 /* PIO Capture handler */
 static void (*pio_capture_handler)(Pio *) = NULL;
@@ -73,35 +86,38 @@ extern uint32_t pio_capture_enable_flag;
 /**
  * \brief Process an interrupt request on the given PIO controller.
  *
+ * Each pending pin is looked up in the table of its controller, lowest pin
+ * first; a source is called once even if several of its pins are pending.
+ *
  * \param p_pio PIO controller base address.
  * \param ul_id PIO controller ID.
  */
 void pio_handler_process(Pio *p_pio, uint32_t ul_id)
 {
 	uint32_t status;
-	uint32_t i;
+	uint32_t port = ul_id - ID_PIOA;
+	const struct s_interrupt_source *p_source;
+	uint8_t source;
 
 	/* Read PIO controller status */
 	status = pio_get_interrupt_status(p_pio);
 	status &= pio_get_interrupt_mask(p_pio);
 
-	/* Check pending events */
-	if (status != 0) {
-		/* Find triggering source */
-		i = 0;
+	/* Dispatch pending events */
+	if (port < PIO_HANDLER_PORTS) {
 		while (status != 0) {
-			/* Source is configured on the same controller */
-			if (gs_interrupt_sources[i].id == ul_id) {
-				/* Source has PIOs whose statuses have changed */
-				if ((status & gs_interrupt_sources[i].mask) != 0) {
-					gs_interrupt_sources[i].handler(gs_interrupt_sources[i].id,
-							gs_interrupt_sources[i].mask);
-					status &= ~(gs_interrupt_sources[i].mask);
-				}
+			source = gs_pin_sources[port][ctz(status)];
+			if (source == 0) {
+				/* No handler for this pin */
+				status &= status - 1;
+				continue;
 			}
-			i++;
-			if (i >= MAX_INTERRUPT_SOURCES) {
-				break;
+			p_source = &gs_interrupt_sources[source - 1];
+			status &= ~(p_source->mask);
+			if (p_source->handler_ctx) {
+				p_source->handler_ctx(p_source->ctx, p_source->id, p_source->mask);
+			} else {
+				p_source->handler(p_source->id, p_source->mask);
 			}
 		}
 	}
@@ -116,43 +132,46 @@ void pio_handler_process(Pio *p_pio, uint32_t ul_id)
 #endif
 }
 
-/**
- * \brief Set an interrupt handler for the provided pins.
- * The provided handler will be called with the triggering pin as its parameter
- * as soon as an interrupt is detected.
- *
- * \param p_pio PIO controller base address.
- * \param ul_id PIO ID.
- * \param ul_mask Pins (bit mask) to configure.
- * \param ul_attr Pins attribute to configure.
- * \param p_handler Interrupt handler function pointer.
- *
- * \return 0 if successful, 1 if the maximum number of sources has been defined.
- */
-uint32_t pio_handler_set(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
-		uint32_t ul_attr, void (*p_handler) (uint32_t, uint32_t))
+/* Defines (or redefines, same ID and mask) a source and points its pins at
+ * it; a pin keeps only the last source set on it. */
+static uint32_t pio_handler_add(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
+		uint32_t ul_attr, void (*p_handler) (uint32_t, uint32_t),
+		void (*p_handler_ctx) (void *, uint32_t, uint32_t), void *p_ctx)
 {
-    uint8_t i;
+	uint32_t i;
+	uint32_t port = ul_id - ID_PIOA;
+	uint32_t pins;
 	struct s_interrupt_source *pSource;
 
-	if (gs_ul_nb_sources >= MAX_INTERRUPT_SOURCES)
+	if (port >= PIO_HANDLER_PORTS) {
 		return 1;
+	}
 
-    /* Check interrupt for this pin, if already defined, redefine it. */
-	for (i = 0; i <= gs_ul_nb_sources; i++) {
+	/* Check interrupt for this pin, if already defined, redefine it. */
+	for (i = 0; i < gs_ul_nb_sources; i++) {
 		pSource = &(gs_interrupt_sources[i]);
 		if (pSource->id == ul_id && pSource->mask == ul_mask) {
 			break;
 		}
 	}
+	if (i == gs_ul_nb_sources) {
+		if (gs_ul_nb_sources >= MAX_INTERRUPT_SOURCES) {
+			return 1;
+		}
+		gs_ul_nb_sources++;
+	}
 
 	/* Define new source */
+	pSource = &(gs_interrupt_sources[i]);
 	pSource->id = ul_id;
 	pSource->mask = ul_mask;
 	pSource->attr = ul_attr;
 	pSource->handler = p_handler;
-	if (i == gs_ul_nb_sources + 1) {
-		gs_ul_nb_sources++;
+	pSource->handler_ctx = p_handler_ctx;
+	pSource->ctx = p_ctx;
+
+	for (pins = ul_mask; pins != 0; pins &= pins - 1) {
+		gs_pin_sources[port][ctz(pins)] = (uint8_t)(i + 1);
 	}
 
 	/* Configure interrupt mode */
@@ -161,6 +180,48 @@ uint32_t pio_handler_set(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
 	return 0;
 }
 
+/**
+ * \brief Set an interrupt handler for the provided pins.
+ * The provided handler will be called with the triggering pin as its parameter
+ * as soon as an interrupt is detected.
+ *
+ * \param p_pio PIO controller base address.
+ * \param ul_id PIO ID.
+ * \param ul_mask Pins (bit mask) to configure.
+ * \param ul_attr Pins attribute to configure.
+ * \param p_handler Interrupt handler function pointer.
+ *
+ * \return 0 if successful, 1 if the maximum number of sources has been defined.
+ */
+uint32_t pio_handler_set(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
+		uint32_t ul_attr, void (*p_handler) (uint32_t, uint32_t))
+{
+	return pio_handler_add(p_pio, ul_id, ul_mask, ul_attr, p_handler, NULL, NULL);
+}
+
+/**
+ * \brief Set an interrupt handler with a context pointer for the provided
+ * pins.
+ *
+ * Same as pio_handler_set(), but the handler also gets \a p_ctx, so one
+ * function can serve several sources (e.g. a set of buttons).
+ *
+ * \param p_pio PIO controller base address.
+ * \param ul_id PIO ID.
+ * \param ul_mask Pins (bit mask) to configure.
+ * \param ul_attr Pins attribute to configure.
+ * \param p_handler Interrupt handler function pointer.
+ * \param p_ctx Pointer passed to the handler.
+ *
+ * \return 0 if successful, 1 if the maximum number of sources has been defined.
+ */
+uint32_t pio_handler_set_ctx(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
+		uint32_t ul_attr, void (*p_handler) (void *, uint32_t, uint32_t),
+		void *p_ctx)
+{
+	return pio_handler_add(p_pio, ul_id, ul_mask, ul_attr, NULL, p_handler, p_ctx);
+}
+
 #if (SAM3S || SAM4S || SAM4E)
 /**
  * \brief Set a capture interrupt handler for all PIO.
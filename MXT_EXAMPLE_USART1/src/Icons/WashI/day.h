@@ -0,0 +1,537 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: day
+* size: 128x128, 4 bits per pixel, 16 cores
+*******************************************************************************/
+
+#ifndef IDX_DAY_H_
+#define IDX_DAY_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_day[48] = {
+    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xa3, 0xa3, 0xa3, 0x93, 0x93, 0x93, 0x72, 0x72, 0x72, 0x03,
+    0x01, 0x04, 0x0f, 0x0d, 0x11, 0xfa, 0xfa, 0xfa, 0xab, 0xab, 0xab, 0xcc, 0xcc, 0xcc, 0x55, 0x55,
+    0x56, 0x67, 0x67, 0x67, 0x20, 0x1f, 0x22, 0x32, 0x30, 0x33, 0xdb, 0xdb, 0xdb, 0xf3, 0xf3, 0xf3
+};
+
+static const uint8_t image_data_day[8192] = {
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8d, 0x55,
+    0x55, 0x55, 0x5d, 0x30, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x10, 0x13, 0xd5, 0x55, 0x55,
+    0x55, 0xd2, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x5a, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xa5, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xe5, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x5e, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x10, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x1f, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x71, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0x0e, 0x9e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe0, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x17, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf1, 0x11, 0x11,
+    0x11, 0x17, 0x4c, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xc4, 0x71, 0x11,
+    0x11, 0x7a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6f, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa7, 0x11,
+    0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x11,
+    0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x01, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x95, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x21, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x12, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x59, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0xe5, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x81, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x5e, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x11, 0x1b, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x5a, 0x71, 0x11, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x17, 0xa5, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0xb1, 0x11, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0x10, 0x10, 0x3d, 0x66,
+    0x66, 0x66, 0x6d, 0x4f, 0x11, 0x01, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11, 0xf4, 0xd6, 0x66, 0x66,
+    0x66, 0xd3, 0x01, 0x01, 0x1e, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x90, 0x11, 0x10, 0x10, 0xff,
+    0xff, 0xff, 0xf7, 0x11, 0x11, 0x11, 0xe6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6f, 0x11, 0x11, 0x11, 0x0f, 0xff, 0xff,
+    0xff, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x81, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x18, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa1, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x1a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x10, 0x10, 0x11,
+    0x11, 0x11, 0x11, 0x01, 0x11, 0x1f, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x96, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0xf1, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x1f, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xde, 0x01, 0x10, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x1f, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xf1, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0xea, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x3f, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x17, 0x8d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd8, 0x71, 0x11, 0x11, 0x11,
+    0x10, 0x11, 0xf3, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xa3, 0x22,
+    0x22, 0x22, 0x23, 0xbc, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcb, 0x32, 0x22, 0x22,
+    0x22, 0x3a, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0xc3, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x3c, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x31, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x03, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x11, 0x10, 0x11, 0x11, 0x17, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x8c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce, 0x11, 0x11, 0x11, 0x11, 0x14, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xca, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x10, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x11, 0x11, 0x10, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x01, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x10, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x10, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x01, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x11, 0x11, 0x11, 0x10, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0x11, 0x11, 0x11, 0x11, 0x12, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb3, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x11, 0x11,
+    0x01, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x28, 0x71, 0x11, 0x11, 0x11, 0x11, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x91, 0x11, 0x11,
+    0x11, 0x11, 0xe2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2f, 0x11, 0x11, 0x01, 0x11, 0x18, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x56, 0xf0, 0x11, 0x11, 0x11, 0x11, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5e, 0x11, 0x11, 0x11, 0x11, 0x1d, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x10, 0x11, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x10, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x11, 0x10, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x10, 0x11, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x11, 0x10, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x01, 0x11, 0x11, 0x01, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x10, 0x11, 0x11, 0x1d, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x10, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x5c, 0xf1, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xb1, 0x11, 0x11,
+    0x11, 0x11, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0x11, 0x10, 0x11, 0x11, 0x1a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9e, 0x01, 0x11, 0x11, 0x11, 0x11, 0xe9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xe1, 0x11, 0x11,
+    0x11, 0x11, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xe7, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x9e, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x93, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x11, 0x11,
+    0x11, 0x11, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3e, 0x11, 0x11, 0x11, 0x11, 0x19, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x18, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0xb5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6f, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x01, 0x11, 0x11, 0x10, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x91, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x01, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x10, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x01,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x03, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x10, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x10,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11, 0x11, 0x11, 0x11, 0x13, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x19, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x91, 0x10, 0x11, 0x11, 0x11, 0x46, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xcf, 0x11, 0x11,
+    0x11, 0x11, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x01, 0x11, 0x11, 0x11, 0x13, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x6c, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x17, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0x71, 0x11, 0x11, 0x11, 0x11, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe1, 0x11, 0x10,
+    0x11, 0x11, 0x7e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0x11, 0x11, 0x01, 0x11, 0x1f, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x01, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0xaf, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xfa, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x5c, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xc5, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x1f, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0xf1,
+    0x17, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x71,
+    0x11, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x11,
+    0x11, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0x11,
+    0x11, 0x1a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa1, 0x11,
+    0x10, 0x11, 0x2d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd2, 0x11, 0x11
+};
+
+const tIndexedImage day = { image_data_day, 128, 128,
+    4, palette_day };
+
+#endif /* IDX_DAY_H_ */
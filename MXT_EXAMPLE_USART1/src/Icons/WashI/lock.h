@@ -0,0 +1,397 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: lock
+* size: 60x60, 8 bits per pixel, 256 cores
+*******************************************************************************/
+
+#ifndef IDX_LOCK_H_
+#define IDX_LOCK_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_lock[768] = {
+    0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0xc0, 0xc0, 0xc0, 0xc1, 0xc1,
+    0xc1, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc3, 0xc3, 0xc3, 0x94, 0x94, 0x94,
+    0x83, 0x83, 0x83, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
+    0x7f, 0x7f, 0xc2, 0xc2, 0xc2, 0x87, 0x87, 0x87, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+    0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x5c, 0x5c, 0x5c, 0xc3, 0xc3, 0xc3, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x61, 0x61, 0x61, 0x13, 0x13, 0x13, 0xc4, 0xc4, 0xc4, 0xc3, 0xc3, 0xc3, 0x7e,
+    0x7e, 0x7e, 0xc0, 0xc0, 0xc0, 0xc2, 0xc2, 0xc2, 0x7d, 0x7d, 0x7d, 0xc5, 0xc5, 0xc5, 0x57, 0x57,
+    0x57, 0x7e, 0x7e, 0x7e, 0x81, 0x81, 0x81, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
+    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0xc2, 0xc2, 0xc2, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x7e,
+    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x7f, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f,
+    0x7f, 0xc3, 0xc3, 0xc3, 0x7c, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0xc2, 0xc2, 0xc2, 0xc0, 0xc0, 0xc0,
+    0x7e, 0x7e, 0x7e, 0xc1, 0xc1, 0xc1, 0x91, 0x91, 0x91, 0x81, 0x81, 0x81, 0xbd, 0xbd, 0xbd, 0x80,
+    0x80, 0x80, 0xc3, 0xc3, 0xc3, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x89, 0x89,
+    0x89, 0x7e, 0x7e, 0x7e, 0x54, 0x54, 0x54, 0x77, 0x77, 0x77, 0x31, 0x31, 0x31, 0x7e, 0x7e, 0x7e,
+    0x7b, 0x7b, 0x7b, 0x58, 0x58, 0x58, 0x84, 0x84, 0x84, 0x81, 0x81, 0x81, 0x9d, 0x9d, 0x9d, 0x8e,
+    0x8e, 0x8e, 0x97, 0x97, 0x97, 0x83, 0x83, 0x83, 0xc9, 0xc9, 0xc9, 0x79, 0x79, 0x79, 0x7d, 0x7d,
+    0x7d, 0x00, 0x00, 0x00, 0x75, 0x75, 0x75, 0x47, 0x47, 0x47, 0x66, 0x66, 0x66, 0x81, 0x81, 0x81,
+    0xc3, 0xc3, 0xc3, 0xc5, 0xc5, 0xc5, 0x5e, 0x5e, 0x5e, 0x03, 0x03, 0x03, 0x7f, 0x7f, 0x7f, 0xc3,
+    0xc3, 0xc3, 0x97, 0x97, 0x97, 0xc2, 0xc2, 0xc2, 0xb8, 0xb8, 0xb8, 0xc1, 0xc1, 0xc1, 0x97, 0x97,
+    0x97, 0xc7, 0xc7, 0xc7, 0x49, 0x49, 0x49, 0x09, 0x09, 0x09, 0x04, 0x04, 0x04, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0xc2, 0xc2, 0xc2, 0x95, 0x95, 0x95, 0x83, 0x83, 0x83, 0x9b, 0x9b, 0x9b, 0xc3,
+    0xc3, 0xc3, 0x1b, 0x1b, 0x1b, 0x56, 0x56, 0x56, 0x7d, 0x7d, 0x7d, 0x04, 0x04, 0x04, 0x94, 0x94,
+    0x94, 0x38, 0x38, 0x38, 0x32, 0x32, 0x32, 0x80, 0x80, 0x80, 0xc1, 0xc1, 0xc1, 0xc2, 0xc2, 0xc2,
+    0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x1f, 0x1f, 0x1f, 0x25, 0x25, 0x25, 0x8d, 0x8d, 0x8d, 0xc3,
+    0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0xb5, 0xb5, 0xb5, 0x92, 0x92, 0x92, 0xac, 0xac, 0xac, 0xb2, 0xb2,
+    0xb2, 0x86, 0x86, 0x86, 0xc6, 0xc6, 0xc6, 0x05, 0x05, 0x05, 0xc0, 0xc0, 0xc0, 0x7c, 0x7c, 0x7c,
+    0xbb, 0xbb, 0xbb, 0x96, 0x96, 0x96, 0xc0, 0xc0, 0xc0, 0xf2, 0xf2, 0xf2, 0x81, 0x81, 0x81, 0xbf,
+    0xbf, 0xbf, 0xf7, 0xf7, 0xf7, 0x81, 0x81, 0x81, 0x40, 0x40, 0x40, 0x05, 0x05, 0x05, 0x04, 0x04,
+    0x04, 0x42, 0x42, 0x42, 0x51, 0x51, 0x51, 0x17, 0x17, 0x17, 0x49, 0x49, 0x49, 0x96, 0x96, 0x96,
+    0x91, 0x91, 0x91, 0x12, 0x12, 0x12, 0x83, 0x83, 0x83, 0xbc, 0xbc, 0xbc, 0xc7, 0xc7, 0xc7, 0x63,
+    0x63, 0x63, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc5, 0xc5,
+    0xc5, 0xc2, 0xc2, 0xc2, 0x7c, 0x7c, 0x7c, 0x7f, 0x7f, 0x7f, 0x44, 0x44, 0x44, 0x42, 0x42, 0x42,
+    0xe0, 0xe0, 0xe0, 0xe7, 0xe7, 0xe7, 0xc3, 0xc3, 0xc3, 0x6d, 0x6d, 0x6d, 0x4c, 0x4c, 0x4c, 0x9b,
+    0x9b, 0x9b, 0x82, 0x82, 0x82, 0x98, 0x98, 0x98, 0x8e, 0x8e, 0x8e, 0xc4, 0xc4, 0xc4, 0x1e, 0x1e,
+    0x1e, 0x4c, 0x4c, 0x4c, 0x5c, 0x5c, 0x5c, 0x90, 0x90, 0x90, 0x8b, 0x8b, 0x8b, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0xc6, 0xc6, 0xc6, 0xc7, 0xc7, 0xc7, 0x6e, 0x6e, 0x6e, 0x4c, 0x4c, 0x4c, 0xc4,
+    0xc4, 0xc4, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x7c, 0x7c, 0x7c, 0x7a, 0x7a, 0x7a, 0x7f, 0x7f,
+    0x7f, 0xc5, 0xc5, 0xc5, 0xb4, 0xb4, 0xb4, 0xc4, 0xc4, 0xc4, 0x7b, 0x7b, 0x7b, 0x75, 0x75, 0x75,
+    0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x3b, 0x3b, 0x3b, 0x6b, 0x6b, 0x6b, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x8a, 0x8a, 0x8a, 0xc3, 0xc3, 0xc3, 0x81, 0x81, 0x81, 0xc4, 0xc4, 0xc4, 0x54, 0x54,
+    0x54, 0x61, 0x61, 0x61, 0x3f, 0x3f, 0x3f, 0x6e, 0x6e, 0x6e, 0xc8, 0xc8, 0xc8, 0xf5, 0xf5, 0xf5,
+    0x6d, 0x6d, 0x6d, 0x78, 0x78, 0x78, 0x81, 0x81, 0x81, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x80,
+    0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x3c, 0x3c, 0x3c, 0x3b, 0x3b, 0x3b, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x66, 0x66, 0x66, 0x7c, 0x7c, 0x7c, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
+    0x0d, 0x0d, 0x0d, 0x0f, 0x0f, 0x0f, 0xc6, 0xc6, 0xc6, 0xc8, 0xc8, 0xc8, 0xc1, 0xc1, 0xc1, 0xcd,
+    0xcd, 0xcd, 0xc4, 0xc4, 0xc4, 0xc3, 0xc3, 0xc3, 0xc4, 0xc4, 0xc4, 0xc0, 0xc0, 0xc0, 0xa0, 0xa0,
+    0xa0, 0x81, 0x81, 0x81, 0x96, 0x96, 0x96, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xae, 0xae, 0xae
+};
+
+static const uint8_t palette_lock_red[768] = {
+    0xff, 0x41, 0x42, 0xf9, 0x45, 0x44, 0xf6, 0x46, 0x45, 0xfe, 0x42, 0x42, 0xf0, 0x4a, 0x45, 0xff,
+    0x41, 0x40, 0xe2, 0x4e, 0x52, 0xff, 0x3b, 0x3b, 0xff, 0x40, 0x45, 0xc6, 0xc6, 0xc8, 0xc2, 0xc0,
+    0xc0, 0xc3, 0xc3, 0xc3, 0xc6, 0xc1, 0xc1, 0xc5, 0xbe, 0xc1, 0xc6, 0xc3, 0xc0, 0xc2, 0x82, 0x81,
+    0xff, 0xc7, 0xc3, 0xff, 0x3f, 0x40, 0xff, 0xd4, 0xcc, 0xff, 0xd6, 0xda, 0xff, 0xe3, 0xdb, 0xfe,
+    0x44, 0x3f, 0xbe, 0xc3, 0xc7, 0xf3, 0xc3, 0xc1, 0xd6, 0x56, 0x57, 0xcd, 0x58, 0x54, 0xfe, 0x43,
+    0x47, 0xfe, 0x44, 0x47, 0xf5, 0x45, 0x46, 0x77, 0x4f, 0x50, 0xc2, 0xc4, 0xc1, 0xff, 0x46, 0x44,
+    0xfd, 0xc3, 0xc1, 0x7e, 0x50, 0x4c, 0x18, 0x12, 0x12, 0xc2, 0xc2, 0xc0, 0xc1, 0xc0, 0xbf, 0xf5,
+    0x47, 0x41, 0xc3, 0xbe, 0xbf, 0xbd, 0xbb, 0xbf, 0xe6, 0x4e, 0x4b, 0xc2, 0xc0, 0xc7, 0x51, 0x5a,
+    0x59, 0xc4, 0x5a, 0x59, 0xd1, 0x57, 0x52, 0xf4, 0x46, 0x48, 0xe0, 0x4f, 0x53, 0xf5, 0x48, 0x44,
+    0xf5, 0x48, 0x47, 0xf3, 0xb3, 0xb3, 0xc4, 0xc1, 0xc4, 0xc2, 0x5e, 0x5b, 0xbe, 0x5e, 0x5c, 0xe5,
+    0x4d, 0x55, 0xde, 0x52, 0x55, 0xca, 0x57, 0x5d, 0xb7, 0x61, 0x62, 0xda, 0x59, 0x57, 0xf2, 0xbc,
+    0xb2, 0xc3, 0xc1, 0xc1, 0xd7, 0x54, 0x59, 0xe7, 0xb5, 0xaa, 0xc5, 0xc2, 0xbf, 0xc4, 0xbf, 0xbe,
+    0xe0, 0x50, 0x50, 0xc1, 0xc0, 0xba, 0xb3, 0x7d, 0x7b, 0xd6, 0x52, 0x55, 0xc7, 0xb9, 0xb9, 0xbb,
+    0x64, 0x5d, 0xc3, 0xbb, 0xb9, 0xf6, 0xc0, 0xbd, 0xe0, 0x4e, 0x4c, 0xde, 0x50, 0x4f, 0x89, 0x83,
+    0x81, 0xff, 0xc5, 0xc4, 0x52, 0x42, 0x43, 0xa5, 0x64, 0x6a, 0x31, 0x30, 0x31, 0xd9, 0x58, 0x59,
+    0xea, 0xa1, 0xa1, 0x67, 0x51, 0x54, 0xc3, 0x5b, 0x57, 0xc7, 0x5a, 0x5d, 0xde, 0x98, 0x99, 0x2f,
+    0x0a, 0x11, 0x7e, 0x51, 0x50, 0x8b, 0x7e, 0x87, 0xd0, 0x52, 0x55, 0x80, 0x75, 0x7a, 0xb8, 0x84,
+    0x87, 0x03, 0x02, 0x02, 0x2a, 0x30, 0x26, 0x35, 0x2a, 0x24, 0x2b, 0x20, 0x20, 0xdd, 0x4d, 0x51,
+    0xbd, 0xc6, 0xc5, 0xc0, 0xc7, 0xc5, 0x62, 0x4d, 0x4b, 0x03, 0x04, 0x04, 0xd4, 0x55, 0x55, 0xc0,
+    0xc6, 0xc6, 0x7d, 0x7e, 0x82, 0xc1, 0xc5, 0xc7, 0x80, 0x79, 0x80, 0xbf, 0xbe, 0xc3, 0xc8, 0x5f,
+    0x63, 0xa4, 0xa4, 0xa4, 0x47, 0x4a, 0x4b, 0x09, 0x09, 0x09, 0x04, 0x05, 0x04, 0xce, 0x57, 0x59,
+    0xb6, 0x9b, 0x8a, 0xca, 0xbf, 0xbd, 0x89, 0x99, 0x98, 0xf8, 0x45, 0x4d, 0x9a, 0x9e, 0x9c, 0xc0,
+    0xc4, 0xbf, 0xc4, 0xbf, 0xc3, 0x8a, 0x8e, 0x8f, 0xcd, 0x59, 0x56, 0x05, 0x04, 0x05, 0xe2, 0xb1,
+    0xad, 0x54, 0x2e, 0x2d, 0x46, 0x29, 0x25, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc5, 0xc6, 0xc4,
+    0xd4, 0x59, 0x5c, 0xd3, 0x9a, 0x91, 0x23, 0x1c, 0x1e, 0x21, 0x26, 0x24, 0x5b, 0x4a, 0x46, 0x38,
+    0x4d, 0x46, 0xc9, 0xc3, 0xc7, 0x37, 0x4b, 0x54, 0x77, 0x87, 0x87, 0xa8, 0xa9, 0xa9, 0xb1, 0xaf,
+    0xb1, 0xe0, 0x4e, 0x51, 0xdd, 0x50, 0x58, 0x05, 0x06, 0x07, 0xc5, 0xc6, 0xc7, 0xd3, 0xec, 0xe6,
+    0xe7, 0xaa, 0xa6, 0xff, 0xde, 0xde, 0xc6, 0xc6, 0xc6, 0xf2, 0xf3, 0xf3, 0xff, 0xca, 0xbc, 0xf8,
+    0xdf, 0xe2, 0xf9, 0xf5, 0xf5, 0xfb, 0x43, 0x41, 0x53, 0x34, 0x32, 0x05, 0x05, 0x08, 0x0d, 0x00,
+    0x07, 0x68, 0x48, 0x50, 0x52, 0x4f, 0x50, 0x0c, 0x0d, 0x0b, 0x00, 0x0a, 0x0a, 0x8f, 0x99, 0x99,
+    0xb1, 0x96, 0x9a, 0x0d, 0x15, 0x15, 0x23, 0x35, 0x29, 0x31, 0x24, 0x1e, 0xc7, 0xc7, 0xc8, 0x77,
+    0x4f, 0x50, 0xf7, 0xc9, 0xba, 0xe4, 0xe9, 0xe5, 0xee, 0x4a, 0x51, 0xde, 0x4e, 0x52, 0xd4, 0xda,
+    0xd9, 0xff, 0xf8, 0xff, 0xff, 0xe6, 0xdb, 0xff, 0xec, 0xeb, 0x2f, 0x1b, 0x1e, 0x3b, 0x36, 0x35,
+    0xde, 0xe2, 0xe0, 0xe6, 0xe7, 0xea, 0xc2, 0xc3, 0xc3, 0x46, 0x3b, 0x37, 0x7a, 0x30, 0x31, 0x2b,
+    0x3b, 0x31, 0x43, 0x43, 0x43, 0xd8, 0x9c, 0x99, 0xd7, 0x95, 0x95, 0xca, 0xc5, 0xc1, 0x11, 0x22,
+    0x19, 0x00, 0x05, 0x00, 0x74, 0x51, 0x51, 0xd2, 0x5d, 0x5f, 0xcf, 0x5a, 0x53, 0xf8, 0x47, 0x44,
+    0xf0, 0x47, 0x42, 0xd3, 0xd4, 0xd3, 0xf7, 0xe0, 0xe4, 0x36, 0x1f, 0x19, 0x44, 0x50, 0x4c, 0xcb,
+    0xc4, 0xc5, 0xae, 0x79, 0x79, 0xa4, 0x80, 0x7d, 0x7c, 0x7c, 0x7c, 0x8e, 0x73, 0x6f, 0x7e, 0x81,
+    0x83, 0xdc, 0xbc, 0xbd, 0xff, 0xb6, 0xae, 0xc8, 0xc3, 0xc0, 0x66, 0x57, 0x53, 0x6e, 0x77, 0x7a,
+    0xc3, 0x59, 0x58, 0xcd, 0x5a, 0x53, 0x7c, 0x7c, 0x7c, 0x62, 0x6d, 0x6f, 0xd2, 0x57, 0x5c, 0xe3,
+    0x4d, 0x4e, 0xf1, 0xb2, 0xb4, 0xc4, 0xc6, 0xc3, 0xff, 0x40, 0x42, 0xca, 0xc0, 0xc3, 0x4f, 0x57,
+    0x55, 0x4b, 0x52, 0x51, 0x3f, 0x3f, 0x3f, 0x69, 0x6e, 0x68, 0xca, 0xc8, 0xc7, 0xf9, 0xf3, 0xf3,
+    0x88, 0x60, 0x5b, 0x84, 0x72, 0x73, 0xff, 0x3e, 0x41, 0xc2, 0xc3, 0xc6, 0xc3, 0xc3, 0xc6, 0xd4,
+    0x58, 0x59, 0xdb, 0x52, 0x5a, 0xdb, 0x4f, 0x58, 0x3c, 0x3b, 0x3f, 0x3a, 0x3d, 0x3f, 0xf1, 0x48,
+    0x47, 0xfb, 0x43, 0x44, 0x2d, 0x14, 0x10, 0x35, 0x41, 0x2d, 0xd8, 0x50, 0x4e, 0xee, 0x4e, 0x58,
+    0x0c, 0x0c, 0x0c, 0x08, 0x11, 0x0f, 0xc9, 0xc7, 0xc8, 0xca, 0xcb, 0xcb, 0xc6, 0xc5, 0xc6, 0xcf,
+    0xca, 0xcd, 0xc3, 0xc5, 0xc8, 0xd9, 0xd7, 0xda, 0xcc, 0xc0, 0xc2, 0xd6, 0xbd, 0xc7, 0xca, 0x8e,
+    0x86, 0xdb, 0x7c, 0x82, 0xdd, 0xb3, 0xa9, 0xf2, 0xb2, 0xaa, 0xd9, 0x54, 0x59, 0xd6, 0x55, 0x5a
+};
+
+static const uint8_t palette_lock_green[768] = {
+    0xb5, 0xe6, 0x19, 0xb5, 0xe4, 0x20, 0xb6, 0xe4, 0x22, 0xb5, 0xe5, 0x20, 0xb5, 0xe4, 0x22, 0xb5,
+    0xe4, 0x23, 0xb5, 0xe2, 0x1f, 0xb9, 0xd9, 0x4f, 0xb8, 0xdc, 0x46, 0xc3, 0xc3, 0xc3, 0xc2, 0xc2,
+    0xbf, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xbe, 0xc2, 0xc2, 0xbb, 0xc2, 0xc3, 0xbf, 0x91, 0xa2, 0x5d,
+    0xd4, 0xe6, 0xac, 0xb6, 0xe3, 0x29, 0xb7, 0xe8, 0x10, 0xf1, 0xff, 0x9d, 0xc7, 0xe5, 0x6b, 0xb5,
+    0xe3, 0x2a, 0x59, 0x5b, 0x4d, 0xbc, 0xe0, 0x36, 0xb9, 0xd9, 0x51, 0xbb, 0xd8, 0x5b, 0xb6, 0xe2,
+    0x2a, 0xb7, 0xe5, 0x2a, 0xb7, 0xe1, 0x33, 0x59, 0x5f, 0x53, 0xc4, 0xc3, 0xc6, 0xb3, 0xe1, 0x29,
+    0xba, 0xe3, 0x31, 0x59, 0x64, 0x3b, 0x13, 0x15, 0x11, 0xc5, 0xc4, 0xc7, 0xc4, 0xc3, 0xc6, 0xb5,
+    0xe4, 0x23, 0xc6, 0xc5, 0xc7, 0xc3, 0xc1, 0xc8, 0xb9, 0xde, 0x3d, 0xbf, 0xc2, 0xb0, 0x57, 0x58,
+    0x5d, 0xba, 0xd8, 0x50, 0xbb, 0xd9, 0x56, 0xb6, 0xe4, 0x1f, 0xb9, 0xdb, 0x41, 0xb5, 0xe2, 0x29,
+    0xb6, 0xe2, 0x2c, 0xb5, 0xdd, 0x24, 0xc3, 0xc3, 0xc1, 0xc6, 0xde, 0x72, 0xc8, 0xde, 0x84, 0xe3,
+    0xf5, 0xaf, 0xba, 0xdc, 0x42, 0xed, 0xf5, 0xc2, 0xbb, 0xdc, 0x35, 0xb7, 0xd7, 0x4a, 0xbc, 0xdf,
+    0x47, 0xc2, 0xc2, 0xc1, 0xee, 0xf9, 0xc1, 0xbd, 0xce, 0x9a, 0xc3, 0xc3, 0xc1, 0xc4, 0xc4, 0xc2,
+    0xe3, 0xf3, 0xb2, 0xc5, 0xc4, 0xc2, 0x89, 0x99, 0x58, 0xf9, 0xff, 0xd7, 0xc6, 0xc5, 0xc3, 0xe9,
+    0xfb, 0xc1, 0xc5, 0xc6, 0xc0, 0xc9, 0xda, 0xa5, 0xc4, 0xde, 0x61, 0xe2, 0xf5, 0xab, 0x81, 0x83,
+    0x7e, 0xd1, 0xe2, 0x9c, 0xad, 0xc7, 0x4c, 0x71, 0x7b, 0x47, 0x2e, 0x31, 0x2d, 0xc2, 0xdf, 0x60,
+    0xb5, 0xcb, 0x72, 0x57, 0x59, 0x5a, 0xb6, 0xe6, 0x13, 0xbc, 0xdd, 0x51, 0xab, 0xbf, 0x70, 0x67,
+    0x7a, 0x11, 0x5a, 0x6c, 0x2a, 0x85, 0x88, 0x69, 0xe4, 0xf8, 0xa3, 0x97, 0x99, 0x97, 0x90, 0x91,
+    0x97, 0x00, 0x02, 0x03, 0x6d, 0x87, 0x1a, 0xaf, 0xd3, 0x2b, 0x20, 0x28, 0x10, 0xe8, 0xf6, 0xb3,
+    0xc4, 0xc3, 0xc8, 0xc4, 0xc3, 0xc7, 0x52, 0x56, 0x47, 0x01, 0x01, 0x08, 0xb9, 0xd9, 0x4f, 0xc1,
+    0xc2, 0xb7, 0x78, 0x77, 0x7d, 0xc2, 0xc3, 0xbc, 0xbd, 0xbf, 0xb2, 0xbd, 0xbd, 0xb3, 0xed, 0xfc,
+    0xc5, 0xc4, 0xc4, 0xc4, 0x48, 0x48, 0x4d, 0x09, 0x0a, 0x0e, 0x01, 0x04, 0x06, 0xb6, 0xe0, 0x1e,
+    0xb4, 0xe2, 0x0d, 0xc5, 0xc4, 0xbf, 0x95, 0x94, 0x99, 0xb7, 0xe1, 0x2f, 0xa2, 0xa1, 0xa5, 0xc3,
+    0xc3, 0xbf, 0x19, 0x17, 0x24, 0x57, 0x59, 0x4b, 0xba, 0xdb, 0x50, 0x01, 0x06, 0x06, 0xbc, 0xda,
+    0x4d, 0x33, 0x42, 0x14, 0x30, 0x30, 0x3f, 0x80, 0x80, 0x80, 0xb5, 0xb5, 0xb5, 0xc4, 0xc3, 0xc9,
+    0xb9, 0xdd, 0x45, 0xb7, 0xdd, 0x30, 0x1c, 0x1f, 0x17, 0x23, 0x23, 0x31, 0x4d, 0x58, 0x36, 0x46,
+    0x46, 0x4e, 0xc8, 0xc9, 0xb7, 0x74, 0x73, 0x83, 0x81, 0x81, 0x8b, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9,
+    0xa8, 0xbf, 0xe2, 0x4a, 0xb3, 0xdb, 0x3d, 0x04, 0x09, 0x05, 0xc4, 0xc2, 0xc8, 0xe6, 0xe4, 0xf9,
+    0xb6, 0xc6, 0x90, 0xf2, 0xfc, 0xd7, 0xc6, 0xc6, 0xc6, 0xf3, 0xf2, 0xf4, 0xd3, 0xe4, 0xb0, 0xd7,
+    0xe4, 0xae, 0xbf, 0xbf, 0xbd, 0xb6, 0xe4, 0x27, 0x3a, 0x46, 0x24, 0x09, 0x0d, 0x0c, 0x35, 0x48,
+    0x00, 0x42, 0x4a, 0x29, 0x50, 0x51, 0x4c, 0x0c, 0x0e, 0x08, 0x04, 0x06, 0x05, 0x94, 0x94, 0x95,
+    0x9a, 0xa2, 0x89, 0x11, 0x11, 0x1a, 0x2b, 0x2f, 0x3b, 0x2b, 0x2b, 0x37, 0xc9, 0xc9, 0xca, 0x59,
+    0x60, 0x54, 0xd9, 0xe9, 0xba, 0xe8, 0xe6, 0xf3, 0xb9, 0xe1, 0x31, 0xb9, 0xd8, 0x51, 0xc1, 0xc3,
+    0xba, 0xc6, 0xc8, 0xbd, 0xef, 0xfe, 0xc1, 0xf8, 0xfe, 0xe6, 0x1b, 0x25, 0x14, 0x32, 0x36, 0x31,
+    0xde, 0xdd, 0xe2, 0xe0, 0xe0, 0xe2, 0xc2, 0xc2, 0xc2, 0x3d, 0x3f, 0x43, 0x42, 0x51, 0x10, 0x35,
+    0x31, 0x54, 0x63, 0x63, 0x63, 0xa8, 0xb7, 0x82, 0xa3, 0xa8, 0xa3, 0xc3, 0xc3, 0xbf, 0x1f, 0x1e,
+    0x32, 0x00, 0x00, 0x10, 0x58, 0x60, 0x55, 0xd0, 0xe7, 0x7a, 0xe7, 0xfa, 0xa8, 0xb7, 0xe1, 0x2f,
+    0xb9, 0xd9, 0x4e, 0xd0, 0xcf, 0xd2, 0xd9, 0xd9, 0xd8, 0x69, 0x7a, 0x1e, 0x67, 0x7c, 0x1d, 0xc2,
+    0xc2, 0xbf, 0x8a, 0x95, 0x68, 0x86, 0x8e, 0x7f, 0x7b, 0x7b, 0x7b, 0x7f, 0x89, 0x6c, 0x80, 0x80,
+    0x7a, 0xc4, 0xc9, 0xb1, 0xcb, 0xda, 0x9f, 0xc3, 0xc3, 0xc2, 0x62, 0x66, 0x64, 0x76, 0x75, 0x7c,
+    0xc8, 0xe3, 0x7e, 0xda, 0xf1, 0x9f, 0x3e, 0x42, 0x2b, 0x1f, 0x24, 0x06, 0xbd, 0xd7, 0x6c, 0xd9,
+    0xe7, 0x9a, 0xc2, 0xcd, 0xb0, 0xc3, 0xc2, 0xc7, 0xb6, 0xe6, 0x1c, 0xc4, 0xc3, 0xc0, 0x54, 0x54,
+    0x5a, 0x4f, 0x51, 0x53, 0x77, 0x77, 0x77, 0x66, 0x69, 0x7a, 0xc4, 0xc4, 0xbf, 0xc1, 0xc1, 0xbf,
+    0x67, 0x70, 0x58, 0x74, 0x78, 0x6c, 0xb5, 0xe7, 0x0f, 0xc3, 0xc2, 0xc5, 0xc5, 0xc5, 0xc6, 0xb8,
+    0xd5, 0x58, 0xbc, 0xd7, 0x57, 0xd0, 0xeb, 0x70, 0x3a, 0x3f, 0x31, 0x3c, 0x3d, 0x40, 0xb6, 0xe5,
+    0x1c, 0xb6, 0xe5, 0x1b, 0x67, 0x7a, 0x1e, 0x58, 0x6f, 0x17, 0xb7, 0xd7, 0x51, 0xba, 0xd9, 0x46,
+    0x0c, 0x0c, 0x0c, 0x0f, 0x0e, 0x1a, 0xc8, 0xc8, 0xc6, 0xd9, 0xd8, 0xe5, 0xc3, 0xc3, 0xc2, 0xc1,
+    0xc0, 0xc1, 0xc4, 0xc2, 0xc6, 0xca, 0xca, 0xca, 0xc3, 0xc3, 0xbc, 0xc4, 0xc7, 0xb5, 0x9e, 0xb2,
+    0x63, 0xbd, 0xdd, 0x3a, 0xb9, 0xc7, 0x98, 0xbe, 0xcd, 0x9a, 0xb7, 0xd5, 0x5b, 0xba, 0xd8, 0x54
+};
+
+static const uint8_t image_data_lock[3600] = {
+    0x00, 0x01, 0x02, 0x03, 0xd8, 0x05, 0x05, 0x05, 0x00, 0x00, 0x03, 0x1b, 0x00, 0xe2, 0x00, 0x05,
+    0xa8, 0x30, 0x03, 0xe2, 0x05, 0xd4, 0xad, 0xa7, 0x69, 0x57, 0x9c, 0x83, 0xa1, 0x63, 0x63, 0xa1,
+    0x83, 0x9c, 0xca, 0xf9, 0xc2, 0xad, 0x34, 0x36, 0x00, 0xe2, 0xe2, 0xea, 0x97, 0x05, 0x00, 0xeb,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xe2, 0xeb, 0x01, 0x03,
+    0xd8, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x25, 0x2f, 0xe2, 0xeb, 0x28, 0x28,
+    0xe7, 0x4b, 0x57, 0xa2, 0xf1, 0x63, 0xf0, 0x22, 0x9d, 0x22, 0x22, 0x22, 0x22, 0x8d, 0x63, 0xf1,
+    0xb3, 0xc9, 0x10, 0x13, 0x8c, 0xbf, 0x15, 0x05, 0xeb, 0x00, 0xd8, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xe2, 0x00, 0xeb, 0x03, 0xd8, 0x03, 0x03, 0xeb,
+    0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x25, 0x25, 0xe2, 0x2f, 0xd0, 0x94, 0xc6, 0x82, 0x5b, 0xf1,
+    0xba, 0x7c, 0x21, 0x42, 0xfa, 0x54, 0x54, 0xfa, 0x42, 0x21, 0x7c, 0xba, 0xf1, 0x5b, 0x82, 0x42,
+    0x4b, 0x2b, 0xbf, 0x05, 0x00, 0xea, 0x01, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0xeb, 0x00, 0x00, 0x00, 0x03, 0x01, 0x1b, 0x00, 0x01,
+    0x03, 0x03, 0xd8, 0xe2, 0x08, 0xe7, 0xfc, 0x6c, 0x63, 0x8d, 0x4e, 0xe0, 0xfc, 0x6a, 0x19, 0x39,
+    0x2c, 0x19, 0x2c, 0x78, 0x39, 0xd4, 0x45, 0xfd, 0xe0, 0x4e, 0x6d, 0x63, 0x84, 0x50, 0x06, 0xd8,
+    0x00, 0x03, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x05, 0x03, 0x03, 0xeb, 0x00, 0x00, 0x00, 0x03, 0x1f, 0xbf, 0x02, 0x00, 0x00, 0xd8, 0x00, 0x1a,
+    0x37, 0xb8, 0x83, 0x63, 0x82, 0xe1, 0x47, 0x5f, 0xc0, 0x73, 0x2d, 0x1c, 0x1c, 0x30, 0xea, 0xea,
+    0x97, 0x30, 0x28, 0xa9, 0xd1, 0xcc, 0xe1, 0x83, 0x5b, 0xc3, 0x38, 0x06, 0x1b, 0x11, 0x05, 0x00,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x03, 0xeb,
+    0x00, 0x00, 0x00, 0x03, 0x05, 0x1f, 0x1b, 0x00, 0xe2, 0x03, 0x28, 0xe7, 0x5a, 0xa1, 0x8d, 0x98,
+    0x54, 0xd4, 0x48, 0x08, 0x00, 0xe2, 0xe2, 0x03, 0xd8, 0xd8, 0xe2, 0x00, 0x05, 0xe2, 0xe2, 0x01,
+    0xbf, 0xc0, 0xbe, 0xb7, 0xe8, 0x8d, 0x55, 0xfb, 0x06, 0x25, 0x00, 0xd8, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0xeb, 0x00,
+    0x00, 0x00, 0x00, 0xe2, 0xe2, 0x1c, 0xd0, 0xb8, 0x5e, 0x8d, 0xc4, 0x7a, 0x36, 0x1c, 0xbf, 0x25,
+    0x00, 0xe2, 0xd8, 0x00, 0x00, 0xe2, 0x00, 0xd8, 0x05, 0x00, 0x00, 0x00, 0x25, 0x15, 0x15, 0xe6,
+    0xcc, 0x9c, 0x79, 0xec, 0x81, 0x52, 0xea, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xd8, 0x00, 0x00,
+    0x00, 0x28, 0x47, 0xa2, 0x9a, 0x4c, 0x17, 0x6f, 0xeb, 0x00, 0x00, 0x25, 0x01, 0x1b, 0x03, 0x00,
+    0x00, 0xd8, 0x11, 0xbf, 0x03, 0xd8, 0x00, 0x02, 0x2f, 0x00, 0xe2, 0xeb, 0xe6, 0xcb, 0x6c, 0x6e,
+    0x5c, 0x20, 0x06, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x05, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x05, 0x05, 0x03, 0x03, 0x73, 0xe7, 0x56, 0x63,
+    0x5d, 0x31, 0x06, 0xeb, 0xd8, 0x03, 0xd8, 0x00, 0x01, 0x03, 0x03, 0x00, 0x00, 0x03, 0xbf, 0x1c,
+    0x00, 0xe2, 0xe2, 0x00, 0x05, 0x05, 0xe2, 0xe2, 0x03, 0xfe, 0xcb, 0x4e, 0x8d, 0x56, 0x80, 0x02,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x03, 0x1c, 0xa9, 0x50, 0x22, 0xf1, 0x70, 0x52, 0x01, 0x05,
+    0x05, 0x03, 0x03, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x25, 0x00, 0xe2, 0xe2, 0x00,
+    0x05, 0x05, 0x00, 0xe2, 0xe2, 0x97, 0xe5, 0xa0, 0xf1, 0x22, 0x54, 0x06, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xeb, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03,
+    0x15, 0xd8, 0x00, 0x73, 0xd0, 0x84, 0x6e, 0x9c, 0x12, 0x06, 0x01, 0x03, 0x00, 0x00, 0x00, 0xd8,
+    0x05, 0x03, 0x00, 0xe2, 0xe2, 0x00, 0x00, 0xeb, 0x05, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0xd8, 0x00, 0x1a, 0x58, 0x98, 0x6d, 0x21, 0x2b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xeb, 0xe2, 0x00, 0x03, 0x03, 0x00, 0x00, 0x25, 0x01, 0x00, 0xe2, 0x28,
+    0x10, 0x83, 0xf1, 0xa0, 0xea, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x03, 0xeb,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x15, 0x2f, 0x04, 0x00, 0xe2, 0x03, 0x30, 0xd8, 0xd8, 0x08,
+    0xfa, 0x8d, 0x5e, 0x4b, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x01, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x25, 0x2f, 0xe2, 0xe2, 0x2e, 0xc6, 0xa1, 0x82, 0x34,
+    0xeb, 0x01, 0x25, 0x01, 0xd8, 0x05, 0x05, 0x25, 0xeb, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05,
+    0x01, 0x03, 0x1a, 0x2f, 0x25, 0x03, 0x00, 0x03, 0xeb, 0x1b, 0x00, 0x30, 0x53, 0x82, 0x9d, 0x74,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x11, 0x03, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x1a, 0x30, 0x00, 0xe2, 0x2e, 0xe0, 0xf1, 0xb4, 0xe7, 0x00, 0xd8, 0x03, 0x03,
+    0x97, 0x1a, 0x1a, 0x01, 0xe2, 0xe2, 0x00, 0x11, 0x1a, 0x97, 0x05, 0x05, 0xeb, 0xeb, 0xeb, 0x03,
+    0x05, 0x05, 0x01, 0xeb, 0x00, 0xe2, 0x00, 0xea, 0xff, 0xb4, 0xf0, 0xcf, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x11, 0x05, 0x03, 0x01, 0x03, 0x00, 0x00, 0x02,
+    0x73, 0xe2, 0xe2, 0x2e, 0x9b, 0x8d, 0x4d, 0x48, 0xd8, 0xeb, 0x03, 0x03, 0x03, 0x03, 0x05, 0x01,
+    0xeb, 0x00, 0x00, 0x05, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x03, 0x05, 0x03, 0x03,
+    0x00, 0xe2, 0xe2, 0x30, 0xe7, 0x4d, 0x6d, 0x9c, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x97, 0x03, 0x03, 0x03, 0xd8, 0x00, 0x00, 0x2d, 0x2d, 0xe2, 0xe2, 0x28,
+    0x98, 0x6d, 0xc6, 0x2c, 0x05, 0x01, 0xeb, 0xeb, 0x00, 0xe2, 0xe2, 0x01, 0x2f, 0x2f, 0x05, 0x00,
+    0x00, 0x03, 0xeb, 0xeb, 0x05, 0x00, 0x03, 0x03, 0x03, 0xe2, 0xe2, 0x05, 0x2f, 0x03, 0xe2, 0x15,
+    0xd1, 0xc7, 0x6d, 0xe8, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x1c, 0x11, 0x05, 0x25, 0x04, 0xeb, 0x00, 0x1a, 0x2d, 0xe2, 0xe2, 0xa8, 0x7b, 0x6d, 0xc6, 0xef,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x11, 0x03, 0x00, 0x05, 0x05, 0x03, 0x03, 0x1a, 0x1a, 0x11, 0xe2, 0xeb, 0xa9, 0x42, 0x79, 0xe9,
+    0x01, 0x00, 0xe2, 0x00, 0x03, 0x03, 0xe2, 0xe2, 0x00, 0x03, 0x03, 0x00, 0x30, 0x00, 0x00, 0x05,
+    0x2f, 0x00, 0xe2, 0x03, 0x30, 0x00, 0x00, 0x2e, 0x7b, 0x63, 0xc6, 0x64, 0x2d, 0x2d, 0x2d, 0xea,
+    0x2d, 0x2d, 0x2d, 0xea, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x04, 0xea, 0x00, 0x00,
+    0x00, 0x00, 0xea, 0x2d, 0x2f, 0x02, 0xeb, 0x30, 0x19, 0x42, 0x79, 0xe8, 0x2f, 0x2f, 0x1b, 0x97,
+    0xd8, 0xd8, 0x00, 0x00, 0x03, 0x02, 0x02, 0x03, 0xea, 0xe2, 0xe2, 0x05, 0x03, 0x00, 0x00, 0x97,
+    0xbf, 0x15, 0xd8, 0xee, 0x7b, 0x63, 0xc6, 0x19, 0xeb, 0xeb, 0xeb, 0xeb, 0x01, 0xeb, 0xeb, 0x01,
+    0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0x04, 0xea, 0xeb, 0x00, 0xe2, 0xe2, 0xe2, 0xea,
+    0xea, 0x25, 0xea, 0xa8, 0xd4, 0xc6, 0x79, 0xe8, 0xbf, 0x15, 0x97, 0x01, 0x03, 0x00, 0x00, 0xeb,
+    0x01, 0x2f, 0x2f, 0x03, 0xe2, 0xe2, 0x00, 0x03, 0x03, 0x00, 0x03, 0x2f, 0x25, 0xe2, 0xe2, 0x28,
+    0x7b, 0x6d, 0x5a, 0xd5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x15, 0x11, 0x05, 0x05, 0x05, 0x05, 0x05, 0x11, 0x11, 0x05, 0xe2, 0x00,
+    0x64, 0x42, 0x5b, 0xe9, 0xe2, 0xe2, 0xe2, 0x00, 0x25, 0x2f, 0xeb, 0x00, 0x00, 0x02, 0x25, 0x03,
+    0x00, 0x00, 0x05, 0x03, 0x01, 0x00, 0x00, 0x25, 0x00, 0xe2, 0xe2, 0xa8, 0x7b, 0x63, 0x5a, 0x43,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x11, 0xd8, 0xd8, 0xa9, 0x42, 0x79, 0xe9,
+    0xe2, 0xe2, 0xe2, 0xe2, 0x01, 0x01, 0x97, 0xe2, 0xe2, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0xbf,
+    0x30, 0x00, 0xe2, 0x00, 0x30, 0xa8, 0xa8, 0x19, 0x98, 0x63, 0xc7, 0x37, 0x40, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x49, 0x49,
+    0x40, 0x40, 0x40, 0x40, 0x35, 0x35, 0x48, 0xa9, 0xbd, 0xc6, 0x79, 0xe9, 0x2e, 0x8b, 0x28, 0x30,
+    0x00, 0xe2, 0x00, 0x97, 0x00, 0xe2, 0xe2, 0x03, 0x25, 0x00, 0xd8, 0xbf, 0x1c, 0xe2, 0xe2, 0x01,
+    0x19, 0x91, 0x90, 0xc6, 0x82, 0x63, 0x4e, 0xbc, 0x1d, 0x1d, 0xa5, 0xce, 0xce, 0x1d, 0x1d, 0xa5,
+    0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0xbc, 0xbc, 0xbc, 0xbc,
+    0x1d, 0x1d, 0x21, 0x21, 0x62, 0x4e, 0x5b, 0x82, 0xc6, 0xfc, 0xac, 0x19, 0x00, 0xe2, 0xe2, 0x15,
+    0x05, 0x00, 0x00, 0x03, 0x25, 0x03, 0x03, 0x03, 0x00, 0xe2, 0x00, 0xa9, 0x47, 0xdd, 0x83, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x5b, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x5b, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x6e, 0x5b, 0x63, 0x83, 0xdd, 0x47, 0x18, 0xd8, 0x00, 0x05, 0x15, 0x05, 0x03, 0x03,
+    0x00, 0x97, 0x03, 0xe2, 0xe2, 0xea, 0x2c, 0xfd, 0x6c, 0x63, 0x99, 0x6c, 0x66, 0x9f, 0x9f, 0x72,
+    0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x9f, 0x9f, 0x72, 0x72, 0x72,
+    0x9f, 0x9f, 0x72, 0x72, 0x72, 0x72, 0x9f, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x74, 0x68, 0x68,
+    0x87, 0x9e, 0x63, 0xb3, 0x3d, 0xe5, 0x1b, 0xe2, 0x03, 0x15, 0x1f, 0x03, 0x00, 0x97, 0x03, 0xe2,
+    0xe2, 0x2e, 0x94, 0xdb, 0x63, 0x4e, 0x89, 0xf3, 0xf3, 0xc2, 0xe3, 0x60, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0xf8, 0x71, 0xf8, 0x71, 0x71, 0x0d, 0xf8, 0x71, 0xf8, 0xd9, 0xf8,
+    0x3f, 0xd9, 0xf8, 0xd9, 0xd9, 0x0c, 0x46, 0xb9, 0x0e, 0x1e, 0xab, 0xde, 0xf6, 0x69, 0xd2, 0x5b,
+    0x9c, 0xa6, 0xee, 0x00, 0x00, 0x05, 0x01, 0x00, 0x03, 0x25, 0x03, 0xd8, 0x08, 0x37, 0xc7, 0x63,
+    0x83, 0x8a, 0xf3, 0xb9, 0xc5, 0x24, 0x32, 0x0a, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9,
+    0xd9, 0x0c, 0xde, 0x3f, 0xd9, 0xc5, 0xd9, 0x26, 0xd9, 0x71, 0x44, 0x71, 0xf8, 0x44, 0xf8, 0xf8,
+    0x71, 0xb9, 0xb9, 0x46, 0xcd, 0x23, 0x0b, 0x0a, 0x8e, 0xf8, 0x69, 0x82, 0x63, 0x4a, 0xac, 0x2e,
+    0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1a, 0x48, 0x47, 0xb3, 0x5b, 0x88, 0xf3, 0xd7, 0xcd,
+    0x41, 0xcd, 0x09, 0x61, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xf6, 0x61, 0x27, 0xe3,
+    0x60, 0x60, 0x60, 0xf6, 0xb2, 0x60, 0xde, 0x26, 0xb9, 0x75, 0x41, 0x75, 0x75, 0x27, 0xf6, 0x27,
+    0x8e, 0xf6, 0xe3, 0xf6, 0x23, 0xd7, 0xf6, 0x59, 0x63, 0xe8, 0x47, 0x2c, 0x02, 0xe2, 0x00, 0x03,
+    0x01, 0x00, 0x00, 0x1c, 0xfe, 0x50, 0x9e, 0x4e, 0x27, 0x23, 0x23, 0x3f, 0xcd, 0x0e, 0x75, 0x75,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x61, 0x60, 0x61, 0x61, 0x60, 0x61,
+    0x65, 0x60, 0x0a, 0x67, 0x0a, 0x75, 0x61, 0x60, 0x60, 0x60, 0x60, 0xf6, 0xe4, 0xe3, 0xf6, 0xe3,
+    0x1e, 0x24, 0x09, 0x27, 0x83, 0xf0, 0x50, 0x18, 0x02, 0x00, 0x03, 0x01, 0x03, 0xe2, 0x00, 0x73,
+    0x18, 0xfa, 0x5b, 0x6c, 0xc1, 0x3f, 0xf8, 0xde, 0x3e, 0x23, 0xf2, 0xf8, 0x3e, 0x3e, 0x3e, 0x3e,
+    0x3e, 0x3e, 0x3e, 0x3e, 0xcd, 0x3e, 0x0e, 0xcd, 0x41, 0x3e, 0x26, 0x3e, 0x3f, 0xde, 0xf2, 0x0a,
+    0xde, 0x3f, 0x24, 0x1e, 0x24, 0xe3, 0xf4, 0x32, 0xf2, 0xf4, 0x27, 0x7f, 0x41, 0xd9, 0xd9, 0xc1,
+    0x6c, 0x79, 0x0f, 0x36, 0x02, 0x00, 0x25, 0x01, 0x00, 0x00, 0x00, 0x30, 0x64, 0x0f, 0x5b, 0xda,
+    0xb0, 0xe4, 0x86, 0x29, 0x60, 0x7f, 0xc5, 0xd9, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xcd,
+    0x0e, 0xcd, 0x3f, 0x96, 0xdf, 0xdf, 0xdf, 0xdf, 0x96, 0x26, 0x0d, 0xd9, 0xc5, 0x3b, 0x26, 0x7f,
+    0xd9, 0xd9, 0x32, 0xc5, 0x0c, 0x0a, 0xd7, 0x23, 0x46, 0xf8, 0x0d, 0xb1, 0x2a, 0x5b, 0x0f, 0x64,
+    0x02, 0x00, 0x03, 0x01, 0x00, 0xe2, 0xe2, 0x73, 0xd4, 0x0f, 0x5b, 0x2a, 0xb1, 0xe3, 0x67, 0x67,
+    0x60, 0x60, 0x23, 0x86, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0x60, 0xb2, 0x96, 0xde,
+    0x59, 0xe9, 0xe9, 0xcf, 0xa4, 0x93, 0x60, 0xe3, 0xe3, 0xe4, 0xe3, 0xe4, 0x32, 0x32, 0xf4, 0xf4,
+    0x75, 0x75, 0x41, 0x41, 0x1e, 0xf6, 0xf6, 0xb1, 0x2a, 0x79, 0x0f, 0x2c, 0x2f, 0xe2, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xb2, 0x93, 0x8a, 0x83, 0x5b, 0xf0, 0xf0, 0x5b,
+    0x83, 0x8a, 0x0a, 0x0b, 0x0b, 0x0b, 0xb2, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02,
+    0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0xb2, 0xb0, 0xe8, 0x5b, 0x4e, 0xc8, 0xc8, 0x4e, 0x5b, 0xe9, 0xb0, 0xf2,
+    0x0b, 0x0a, 0x0b, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1,
+    0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a,
+    0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x74, 0x22, 0x22, 0x0b, 0x93, 0x93, 0xb2, 0x22, 0x82, 0x74, 0xe4, 0x0b, 0x0b, 0x0b, 0xe4,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18,
+    0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e,
+    0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x7d, 0xf0, 0x6c,
+    0xb1, 0x93, 0x93, 0xb1, 0x6c, 0xf0, 0x7d, 0x0a, 0x0b, 0x0b, 0xb2, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x7d, 0xf0, 0x6c, 0xb1, 0x93, 0x93, 0xb1,
+    0x6c, 0xf0, 0xc8, 0xa4, 0x0a, 0x0b, 0xf2, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02,
+    0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0xc8, 0xf0, 0x9c, 0xb1, 0x93, 0x93, 0xb1, 0x9c, 0xf0, 0xc8, 0x0a,
+    0x0b, 0x0b, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1,
+    0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a,
+    0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0xe4, 0x7d, 0xf0, 0x9c, 0xb1, 0x93, 0x93, 0x93, 0x9c, 0x6d, 0x7d, 0xf2, 0x0a, 0x0a, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18,
+    0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e,
+    0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x7d, 0xf0, 0x6c,
+    0xb1, 0x93, 0x93, 0xb1, 0x6c, 0xf0, 0xc8, 0x0b, 0x0b, 0x0b, 0xf2, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xc8, 0xf0, 0x9c, 0xb1, 0x93, 0x93, 0xb1,
+    0x9c, 0xf0, 0xc8, 0xe4, 0x32, 0xe4, 0xb2, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02,
+    0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xc8, 0xf0, 0x6c, 0x93, 0x93, 0x93, 0xb1, 0x9c, 0xf0, 0xc8, 0x23,
+    0xb2, 0xb2, 0x23, 0x24, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1,
+    0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a,
+    0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x09, 0x4a, 0xf1, 0xe9, 0xb1, 0x93, 0x93, 0xb1, 0xe9, 0xf0, 0x4a, 0xe4, 0xf4, 0xde, 0x3b, 0xf4,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18,
+    0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e,
+    0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x3b, 0x89, 0x82, 0xf0,
+    0x89, 0x93, 0x93, 0x89, 0xf0, 0x82, 0x89, 0x23, 0x3b, 0x23, 0x09, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x92, 0x93, 0x6c, 0x5b, 0x22, 0xda, 0x9c, 0x22,
+    0x5b, 0xb6, 0xf7, 0xb2, 0x09, 0xf4, 0x23, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02,
+    0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x3b, 0xf4, 0xf5, 0xdc, 0x22, 0xf0, 0x6d, 0xf0, 0xb6, 0x09, 0x3b, 0x32,
+    0x23, 0x3b, 0xf4, 0x24, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1,
+    0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a,
+    0xb1, 0x0c, 0x3b, 0x1e, 0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x92, 0x0a, 0xf4, 0x6b, 0x7e, 0x8a, 0x0a, 0xf7, 0xde, 0x26, 0x0b, 0xf4, 0x23, 0xf4, 0xb2,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18,
+    0x2f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x02, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0x0c, 0x3b, 0x1e,
+    0xe3, 0x32, 0x3b, 0x1e, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xf4, 0x24, 0xde, 0x1e,
+    0x0a, 0x61, 0x0b, 0x0b, 0x0b, 0x0b, 0xb2, 0x23, 0x0b, 0xb2, 0x3b, 0xf4, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0xe3, 0x32, 0x0e, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x2f, 0x00, 0x00, 0x03,
+    0x1a, 0xd8, 0x00, 0x97, 0x39, 0x0f, 0x5b, 0x2a, 0xb1, 0x41, 0x71, 0x0a, 0x61, 0x61, 0x24, 0x23,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x67, 0xd9, 0x26, 0xb1, 0x2a, 0x5b, 0x0f, 0x18, 0x1c, 0x03, 0xeb, 0x00, 0x1b, 0x00, 0x00, 0x97,
+    0xee, 0x0f, 0x5b, 0xda, 0xb1, 0xcd, 0xcd, 0x24, 0x32, 0x32, 0x24, 0x61, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x27, 0x67, 0x75, 0xb0,
+    0x2a, 0x5b, 0x0f, 0x2c, 0xbf, 0x00, 0x00, 0xeb, 0xeb, 0x00, 0x00, 0x15, 0xe6, 0x0f, 0x5b, 0x2a,
+    0xb0, 0x71, 0x3f, 0x23, 0xc5, 0xf8, 0x0c, 0x75, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8e, 0x61, 0x65, 0xb1, 0x2a, 0x5b, 0x0f, 0x78,
+    0x97, 0xe2, 0x00, 0x03, 0x01, 0x03, 0x03, 0x01, 0x64, 0x0f, 0x5b, 0x2a, 0xb1, 0xf8, 0xf8, 0xe4,
+    0x32, 0xd9, 0x65, 0x75, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x24, 0x0a, 0x60, 0xb1, 0x2a, 0x5b, 0x0f, 0x2c, 0x2f, 0x00, 0x00, 0x00,
+    0x1a, 0x03, 0xd8, 0x25, 0x64, 0x0f, 0x79, 0xda, 0xb0, 0x0d, 0x86, 0x67, 0x32, 0x1e, 0x0b, 0xcd,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0xd9, 0xc5, 0x7f, 0xb0, 0x9c, 0x79, 0xfa, 0xe5, 0x2f, 0x00, 0x00, 0x00, 0x11, 0xd8, 0xe2, 0x2f,
+    0x2c, 0x54, 0x8d, 0x4e, 0xa4, 0xcd, 0x0d, 0x67, 0xf6, 0x23, 0x26, 0xd9, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x1e, 0xcd, 0xf8, 0xd9,
+    0x7c, 0x79, 0x90, 0x2b, 0x04, 0x00, 0x03, 0x05, 0x05, 0xeb, 0xe2, 0x1a, 0x48, 0xcc, 0x4e, 0x8d,
+    0x72, 0xf5, 0xc5, 0x60, 0x60, 0x3b, 0x3e, 0xc5, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x60, 0xb2, 0xab, 0x9f, 0x6d, 0xaf, 0xfc, 0x78,
+    0xea, 0xe2, 0x05, 0x15, 0xd8, 0xeb, 0xeb, 0x00, 0x08, 0x58, 0x66, 0x63, 0x4e, 0x0d, 0xf6, 0x60,
+    0x60, 0xcd, 0x0e, 0x60, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x60, 0x60, 0xf6, 0x4e, 0x9d, 0xc9, 0x14, 0x28, 0x00, 0x00, 0x05, 0x15,
+    0xe2, 0x2f, 0x2f, 0xe2, 0xe2, 0xa9, 0xd6, 0xb5, 0xbb, 0xd2, 0x29, 0xf6, 0x7f, 0xcd, 0x0e, 0x60,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0xb2, 0x0b, 0xe4, 0x0b, 0xb2, 0x0b, 0x0a,
+    0xaa, 0x27, 0xe9, 0x5b, 0xed, 0x3a, 0x06, 0x03, 0x03, 0x01, 0x01, 0x03, 0xe2, 0x15, 0x1f, 0xe2,
+    0xe2, 0x73, 0x3c, 0xb8, 0xa3, 0x9e, 0xd3, 0x16, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+    0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x89, 0x9f, 0x77, 0x76, 0x63, 0x5e,
+    0x81, 0x6f, 0xe2, 0xe2, 0x11, 0x25, 0x25, 0x00, 0x00, 0x03, 0x97, 0x97, 0xeb, 0x00, 0x73, 0x37,
+    0xd6, 0x85, 0x9e, 0x8d, 0xf0, 0xa1, 0xa1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6d, 0x6d, 0xb3, 0x50, 0x06, 0xe2, 0xe2, 0xd8,
+    0x03, 0x01, 0x02, 0x01, 0x00, 0xe2, 0x03, 0x1f, 0x2f, 0xd8, 0xd8, 0xef, 0xad, 0x8f, 0x89, 0x9c,
+    0x82, 0x63, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x6e, 0x5b, 0x6e, 0x82, 0x6c, 0x89, 0x95, 0x53, 0x73, 0xe2, 0x03, 0x25, 0x03, 0x00, 0x03, 0x2f
+};
+
+const tIndexedImage lock = { image_data_lock, 60, 60,
+    8, palette_lock };
+
+#endif /* IDX_LOCK_H_ */
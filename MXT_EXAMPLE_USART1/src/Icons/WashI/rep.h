@@ -0,0 +1,93 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: rep
+* size: 60x36, 4 bits per pixel, 16 cores
+*******************************************************************************/
+
+#ifndef IDX_REP_H_
+#define IDX_REP_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_rep[48] = {
+    0xfd, 0xfd, 0xfd, 0xfb, 0xfb, 0xfb, 0xfa, 0xfa, 0xfa, 0xf4, 0xf4, 0xf4, 0x00, 0x00, 0x00, 0x05,
+    0x05, 0x05, 0x5d, 0x5d, 0x5d, 0x56, 0x56, 0x56, 0x49, 0x49, 0x49, 0xb3, 0xb3, 0xb3, 0xd5, 0xd5,
+    0xd5, 0x9e, 0x9e, 0x9e, 0x1a, 0x1a, 0x1a, 0x35, 0x35, 0x35, 0x76, 0x76, 0x76, 0x85, 0x85, 0x85
+};
+
+static const uint8_t image_data_rep[1080] = {
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x02,
+    0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x22, 0x00, 0x10, 0x10, 0x04, 0x42, 0x10, 0x10, 0x11,
+    0x11, 0x10, 0x00, 0x11, 0x10, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x01, 0x20, 0x00, 0x20, 0x01, 0x00, 0x14, 0x40, 0x01, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa0,
+    0x02, 0x00, 0x00, 0x21, 0x12, 0x20, 0x03, 0x04, 0x40, 0x20, 0x02, 0x00, 0x00, 0x00, 0x12, 0x10,
+    0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xd9, 0x30, 0x02,
+    0x20, 0x01, 0x00, 0x20, 0x22, 0x04, 0x40, 0x01, 0x20, 0x21, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x45, 0x6a, 0x00, 0x02, 0x00,
+    0x20, 0x02, 0x10, 0x24, 0x52, 0x21, 0x02, 0x00, 0x10, 0x01, 0x00, 0x02, 0x00, 0x00, 0x02, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x38, 0x44, 0x4c, 0xfa, 0x01, 0x20, 0x02, 0x00,
+    0x13, 0x25, 0x40, 0x00, 0x10, 0x00, 0x10, 0x01, 0x00, 0x03, 0xa9, 0xbe, 0x66, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7c, 0x44, 0x44, 0x4d, 0x93, 0x02, 0x02, 0x01, 0x00, 0x04,
+    0x42, 0x00, 0x10, 0x01, 0x02, 0x00, 0x39, 0xed, 0xc5, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x44, 0x57, 0xa1, 0x00, 0x00, 0x01, 0x04, 0x40, 0x02,
+    0x02, 0x01, 0x20, 0x3b, 0x85, 0x45, 0x44, 0x54, 0x45, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x54, 0x44, 0x54, 0x57, 0xa0, 0x10, 0x02, 0x01, 0x04, 0x40, 0x20, 0x02, 0x20,
+    0x09, 0xd5, 0x44, 0x54, 0x55, 0xcd, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x7c, 0x44, 0x45, 0x5d, 0x93, 0x00, 0x20, 0x20, 0x01, 0x04, 0x42, 0x02, 0x10, 0x03, 0xe5, 0x55,
+    0x45, 0x4c, 0x6b, 0xa3, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x38, 0x55,
+    0x4c, 0xfa, 0x00, 0x10, 0x00, 0x12, 0x01, 0x04, 0x50, 0x20, 0x20, 0x37, 0x54, 0x44, 0x5c, 0xfa,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x45, 0x6a, 0x10,
+    0x12, 0x22, 0x20, 0x00, 0x01, 0x04, 0x40, 0x00, 0x03, 0x64, 0x44, 0x44, 0x8a, 0x00, 0x00, 0x00,
+    0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xd9, 0x30, 0x00, 0x00, 0x00,
+    0x03, 0x20, 0x01, 0x04, 0x51, 0x22, 0x0b, 0x54, 0x44, 0x48, 0xa0, 0x00, 0x02, 0x21, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xa0, 0x03, 0x01, 0x00, 0x03, 0xbd, 0x92,
+    0x01, 0x04, 0x40, 0x00, 0x38, 0x44, 0x54, 0xca, 0x00, 0x02, 0x11, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x03, 0x98, 0x55, 0x83, 0x01, 0x04,
+    0x40, 0x20, 0xac, 0x44, 0x44, 0xe0, 0x00, 0x02, 0x00, 0x22, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x54, 0x54, 0xca, 0x00, 0x04, 0x40, 0x00,
+    0x94, 0x45, 0x44, 0xb0, 0x20, 0x10, 0x02, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x22, 0x01, 0x20, 0x0e, 0x55, 0x45, 0x49, 0x00, 0x04, 0x42, 0x00, 0x95, 0x54,
+    0x54, 0xb0, 0x02, 0x01, 0x02, 0x01, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x01, 0x01, 0x20, 0x0e, 0x44, 0x44, 0x59, 0x00, 0x04, 0x40, 0x10, 0xac, 0x44, 0x45, 0xb0,
+    0x10, 0x00, 0x20, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
+    0x00, 0x20, 0x38, 0x54, 0x45, 0xca, 0x00, 0x04, 0x40, 0x22, 0x38, 0x45, 0x89, 0x20, 0x22, 0x00,
+    0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x21, 0x00,
+    0x95, 0x44, 0x54, 0x83, 0x00, 0x04, 0x40, 0x10, 0x09, 0xdb, 0x30, 0x03, 0x00, 0x20, 0x03, 0x93,
+    0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x11, 0x0a, 0xd5, 0x45,
+    0x45, 0xb0, 0x00, 0x04, 0x42, 0x02, 0x02, 0x30, 0x00, 0x10, 0x02, 0x02, 0x9d, 0x82, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x00, 0x9d, 0x44, 0x54, 0x4e, 0x20,
+    0x00, 0x04, 0x40, 0x20, 0x02, 0x02, 0x01, 0x02, 0x10, 0xa6, 0x54, 0x82, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa6, 0xc5, 0x44, 0x45, 0x63, 0x10, 0x00, 0x04,
+    0x40, 0x10, 0x00, 0x00, 0x02, 0x00, 0x3f, 0xc4, 0x44, 0x83, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x10, 0x23, 0xaa, 0xb7, 0xc4, 0x54, 0x44, 0x5e, 0x30, 0x02, 0x01, 0x04, 0x40, 0x10,
+    0x00, 0x00, 0x00, 0x3b, 0xd5, 0x44, 0x54, 0xc7, 0x77, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x88, 0xdc, 0x44, 0x44, 0x44, 0x5d, 0x92, 0x00, 0x30, 0x01, 0x04, 0x40, 0x10, 0x00, 0x00,
+    0x0a, 0x65, 0x54, 0x45, 0x44, 0x54, 0x44, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55,
+    0x44, 0x44, 0x44, 0xc8, 0xb3, 0x00, 0x02, 0x02, 0x01, 0x04, 0x40, 0x10, 0x00, 0x00, 0x0a, 0x75,
+    0x54, 0x44, 0x54, 0x44, 0x54, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x44, 0x44, 0x5c,
+    0x8e, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x40, 0x10, 0x00, 0x00, 0x10, 0x39, 0xd4, 0x45,
+    0x45, 0xc7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0xeb, 0x9a, 0x30, 0x00,
+    0x11, 0x00, 0x21, 0x11, 0x01, 0x04, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc4, 0x44, 0x83,
+    0x00, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x12, 0x20, 0x02, 0x00, 0x11, 0x02, 0x01, 0x20,
+    0x00, 0x00, 0x01, 0x04, 0x40, 0x10, 0x00, 0x00, 0x20, 0x02, 0x00, 0xa6, 0xc4, 0x81, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x01, 0x04, 0x40, 0x10, 0x00, 0x00, 0x02, 0x02, 0x00, 0x03, 0x9d, 0x83, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x20, 0x01, 0x20, 0x02, 0x02, 0x00, 0x10, 0x00, 0x01, 0x04,
+    0x40, 0x20, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x92, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x42, 0x01,
+    0x00, 0x30, 0x11, 0x11, 0x11, 0x11, 0x00, 0x02, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x20, 0x24, 0x40, 0x21, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x02, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x44, 0x45, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x45, 0x44, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
+};
+
+const tIndexedImage rep = { image_data_rep, 60, 36,
+    4, palette_rep };
+
+#endif /* IDX_REP_H_ */
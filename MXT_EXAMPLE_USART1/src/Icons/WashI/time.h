@@ -0,0 +1,537 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: time
+* size: 128x128, 4 bits per pixel, 16 cores
+*******************************************************************************/
+
+#ifndef IDX_TIME_H_
+#define IDX_TIME_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_time[48] = {
+    0xff, 0xff, 0xff, 0x01, 0x01, 0x01, 0xfe, 0xfe, 0xfe, 0x0b, 0x0b, 0x0b, 0xaf, 0xaf, 0xaf, 0xce,
+    0xce, 0xce, 0x67, 0x67, 0x67, 0x7c, 0x7c, 0x7c, 0x1c, 0x1c, 0x1c, 0x2f, 0x2f, 0x2f, 0x40, 0x40,
+    0x40, 0x52, 0x52, 0x52, 0x8d, 0x8d, 0x8d, 0x9e, 0x9e, 0x9e, 0xf5, 0xf5, 0xf5, 0xfc, 0xfc, 0xfc
+};
+
+static const uint8_t image_data_time[8192] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x20, 0x20, 0x02, 0x00, 0x2f, 0x22, 0x00, 0x00, 0xfe, 0x55, 0x4d, 0xc7, 0x76,
+    0x67, 0x7c, 0xd4, 0x55, 0xe2, 0x00, 0x20, 0x02, 0xff, 0x00, 0x20, 0x00, 0xf0, 0x02, 0xf0, 0x00,
+    0x20, 0x20, 0x22, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x20, 0x02, 0x0f, 0x00, 0xff, 0x22, 0x0f, 0xe4, 0xc6, 0xa8, 0x31, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x13, 0x89, 0xb7, 0x45, 0xe0, 0x0f, 0xff, 0x00, 0x20, 0x00, 0x20, 0x02, 0xf0,
+    0x0f, 0x02, 0x02, 0x22, 0x02, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x22, 0x02, 0xff, 0x0f, 0xf0, 0x5d, 0x69, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x96, 0xd5, 0x02, 0xf0, 0xff, 0x20, 0x0f, 0x00, 0x02,
+    0x00, 0x0f, 0x20, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x2f, 0x02, 0xf5, 0xca, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x97, 0x5f, 0x00, 0x2f, 0x00, 0x2f, 0x00,
+    0x20, 0x02, 0x02, 0x0f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0xf2, 0x02, 0x5c, 0x93, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0xc5, 0x22, 0x2f, 0x20, 0x00,
+    0x02, 0x20, 0x0f, 0xf0, 0x47, 0xe0, 0xf2, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x02, 0x2f, 0x0f, 0x46, 0x31, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x65, 0x00, 0xf0, 0x02,
+    0x00, 0x20, 0x02, 0x04, 0x11, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0xff, 0x0e, 0x4a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa4, 0xf0, 0xe2,
+    0x20, 0x20, 0x02, 0x58, 0x11, 0xaf, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x49, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x94, 0x00,
+    0x2f, 0x20, 0xf0, 0xb1, 0x11, 0x35, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x02, 0x02, 0x22, 0xf0,
+    0x49, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0xa5,
+    0x0f, 0x2f, 0x0c, 0x11, 0x11, 0x1d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x02, 0xf2, 0x20, 0x00, 0xf2, 0x5b,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0xbe, 0x00, 0x53, 0x11, 0x13, 0x16, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x0f, 0xf2, 0xfc, 0x31,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x89, 0x9a,
+    0x99, 0x98, 0x83, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x13, 0xdf, 0xa1, 0x11, 0x11, 0x18, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x02, 0xf0, 0x05, 0xa1, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x39, 0xb7, 0x45, 0x5e, 0xee, 0x20,
+    0x02, 0xfe, 0xe5, 0x54, 0xc6, 0x93, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x18, 0x11, 0x11, 0x11, 0x11, 0x52, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x20, 0x02, 0x0f, 0xc3, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x74, 0xef, 0x20, 0x20, 0x00, 0x00, 0x02,
+    0xf0, 0x00, 0x20, 0x00, 0x00, 0x2e, 0x47, 0xa3, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x20, 0x0f, 0x22, 0xeb, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0xad, 0x5f, 0x0f, 0x00, 0xff, 0xf2, 0x02, 0xff, 0x00,
+    0x02, 0xff, 0x20, 0x2f, 0xff, 0x00, 0xf0, 0xf5, 0xdb, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xf0, 0x25, 0x91, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0xc5, 0x02, 0x02, 0xff, 0x00, 0x22, 0x22, 0x20, 0x00, 0x22,
+    0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x2f, 0x00, 0xf0, 0x5c, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xf0, 0x43, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x1a, 0x4f, 0x02, 0x0f, 0x0f, 0x00, 0xf2, 0x02, 0x00, 0x20, 0x02, 0x20,
+    0x02, 0x00, 0x02, 0x20, 0x20, 0x0f, 0x00, 0xf2, 0xf0, 0xf0, 0xf4, 0xa1, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0xf0, 0x2f, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x1b, 0x5f, 0x0f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xf0, 0xf5, 0xb1, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x22, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x00, 0x0f, 0xf0, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x1a, 0x50, 0x20, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2f, 0x02, 0x04, 0xa1, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x22, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0x00, 0x2f, 0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x18, 0xdf, 0x22, 0x22, 0x20, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xf2, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x22, 0xf0, 0xfd, 0x81, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x52, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x20, 0x02, 0xf0, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x6e, 0x2f, 0x0f, 0x22, 0x00, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x00, 0x22, 0x20, 0x02, 0xeb, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xd0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0xf0, 0xff, 0x2c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x84, 0x0e, 0x02, 0x20, 0x00, 0x22, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x2f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x22, 0x00, 0x20, 0xff, 0xf6, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb0, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x02, 0x02, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a,
+    0xe2, 0x2f, 0x20, 0x00, 0xf2, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x20, 0x02, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x20, 0x00, 0x2f, 0x20, 0xe0, 0xc1, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8e, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0xe4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x70,
+    0x0f, 0x00, 0x00, 0x22, 0x00, 0x02, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x5e, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x00, 0x0e, 0x05, 0x31, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0xff, 0x53, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x2f,
+    0xf0, 0x02, 0x02, 0x00, 0x22, 0x20, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xd8, 0x33, 0xa5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x02, 0x22, 0xf0, 0xfa, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1c, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x0e, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x50, 0xf2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x2c, 0x11, 0x11, 0x18,
+    0x52, 0x22, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x33, 0x1d, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x0f, 0x0b, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x85, 0x0f, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0xe3, 0x11, 0x11, 0x11,
+    0xbf, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf5, 0x11, 0x31, 0x11,
+    0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xae, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0xf0, 0x71, 0x11, 0x13, 0x11, 0x11, 0x11, 0x18, 0x50, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0xf2, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x38, 0x9a, 0xbc, 0xe0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x85, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x11, 0x13, 0x89,
+    0xab, 0x67, 0xd4, 0x55, 0xee, 0x20, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xe8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x50, 0xf0, 0xff, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x41, 0x11, 0x11, 0x11,
+    0x3e, 0x0f, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x55, 0x5e, 0xe2,
+    0x00, 0x00, 0x22, 0x00, 0x20, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x20, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x0f, 0x0f, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0xd1, 0x11, 0x11, 0x11,
+    0x8e, 0xff, 0x20, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xf2,
+    0x2f, 0xff, 0xf2, 0x2f, 0x22, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc0, 0xe0, 0x02, 0x02, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x41, 0x11, 0x11, 0x11,
+    0x3e, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x22, 0xf2, 0x00,
+    0x22, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0xe9, 0x11, 0x11, 0x11, 0x11, 0x13, 0x16, 0x2f, 0x00, 0x20, 0x20, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x20, 0x22, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x0f, 0x02, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9e, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x02, 0x20, 0x20, 0xf2, 0x02, 0x20,
+    0x02, 0x00, 0xf0, 0xfe, 0x81, 0x11, 0x11, 0x11, 0x11, 0x13, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x20, 0x00,
+    0x0f, 0x00, 0x0f, 0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1c, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x02, 0x0f, 0x00, 0xf0,
+    0x02, 0x02, 0x22, 0x53, 0x11, 0x11, 0x11, 0x11, 0x11, 0xaf, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe2, 0xfe, 0xf0, 0xf0, 0x02, 0x20,
+    0x20, 0x0f, 0xf0, 0x71, 0x11, 0x11, 0x11, 0x11, 0x13, 0x52, 0x2f, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x02, 0x20, 0x00, 0x00, 0x00, 0x0f,
+    0x20, 0x22, 0x05, 0x31, 0x11, 0x11, 0x11, 0x11, 0x16, 0xf2, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xed, 0x7c, 0x5f, 0xf0, 0xf2, 0x00,
+    0x00, 0xff, 0x07, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8e, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x31, 0x11, 0x16, 0xe0, 0x00, 0x2f,
+    0x22, 0x00, 0xe8, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xc1, 0x31, 0x11, 0x11, 0xb0, 0x0f, 0x00,
+    0x20, 0x00, 0xd1, 0x11, 0x11, 0x11, 0x11, 0x18, 0xef, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x05, 0x31, 0x11, 0x11, 0x11, 0x14, 0x2f, 0x00,
+    0x00, 0xf2, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x1c, 0xf2, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xfd, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x02, 0x02,
+    0x0f, 0x05, 0x31, 0x11, 0x11, 0x11, 0x11, 0x8e, 0x00, 0x02, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x07, 0x11, 0x11, 0x11, 0x11, 0x13, 0x50, 0xf0,
+    0x2f, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x60, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2c, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc0, 0xf0,
+    0x00, 0xf9, 0x11, 0x11, 0x11, 0x11, 0x13, 0x52, 0xf2, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x31, 0x11, 0x11, 0x11, 0x11, 0xaf, 0x02,
+    0x20, 0x53, 0x13, 0x11, 0x11, 0x11, 0x1a, 0x20, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x8e, 0x22,
+    0xf2, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x1d, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe0, 0xd1, 0x11, 0x11, 0x11, 0x11, 0x8e, 0xf0,
+    0xf0, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x35, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x53, 0x11, 0x11, 0x11, 0x11, 0xaf, 0x00,
+    0x0e, 0x81, 0x11, 0x11, 0x11, 0x11, 0xa0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x06, 0x13, 0x11, 0x11, 0x11, 0x42, 0xf0,
+    0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x91, 0x11, 0x11, 0x16, 0xf0, 0x22,
+    0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x50, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe7, 0x81, 0x19, 0xd2, 0xf2, 0x00,
+    0x0b, 0x11, 0x11, 0x11, 0x11, 0x18, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x02, 0xe5, 0x5f, 0xf2, 0x00, 0x22,
+    0xe9, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf0, 0x2f, 0x02, 0x2f, 0x00, 0x22, 0x0f,
+    0x53, 0x11, 0x11, 0x11, 0x11, 0x1c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0xf2, 0xf0, 0x0f, 0x00, 0x20,
+    0x41, 0x11, 0x11, 0x11, 0x11, 0x14, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x20, 0x22, 0x22, 0x20, 0x2f,
+    0xc1, 0x11, 0x11, 0x11, 0x11, 0x35, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf0, 0x0f, 0x02, 0x00, 0xf2, 0x00,
+    0x61, 0x11, 0x11, 0x11, 0x11, 0x9e, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0xfe, 0x00, 0xf0,
+    0xb1, 0x11, 0x11, 0x11, 0x11, 0xa2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x00, 0xf0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2f, 0xda, 0x88, 0xb5, 0xf2,
+    0xa1, 0x11, 0x11, 0x11, 0x11, 0xb0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x3e, 0xf2, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x20, 0xfb, 0x11, 0x11, 0x11, 0xd0,
+    0x91, 0x11, 0x11, 0x11, 0x11, 0x70, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x0f, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x2f, 0x61, 0x31, 0x11, 0x11, 0x15,
+    0x81, 0x11, 0x11, 0x11, 0x11, 0xc2, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x00, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xfe, 0x81, 0x11, 0x11, 0x11, 0x1b,
+    0x31, 0x11, 0x11, 0x11, 0x11, 0xd2, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x3e, 0xf0, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x11, 0x11, 0x11, 0x11, 0x18,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0xd0, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x8e, 0x0f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x24, 0x31, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0xd0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0xf0, 0x41, 0x11, 0x11, 0x11,
+    0x34, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0xd0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x41, 0x11, 0x11, 0x11,
+    0x11, 0xa4, 0x02, 0xf2, 0x20, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0xd0, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x41, 0x31, 0x11, 0x11,
+    0x11, 0x11, 0xa5, 0x0f, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x20, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x31, 0x11, 0x11, 0x11, 0x11, 0xd2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x41, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0xb5, 0x02, 0x0f, 0x20, 0x0f, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x11, 0x11, 0x11, 0x11, 0x13,
+    0x31, 0x11, 0x11, 0x11, 0x11, 0xd2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0xd1, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0xb5, 0xf0, 0x0f, 0x00, 0x2f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x0e, 0x31, 0x11, 0x11, 0x11, 0x1a,
+    0x81, 0x11, 0x11, 0x11, 0x11, 0xc0, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x58, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x13, 0xb5, 0xf2, 0xff, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0xf0, 0x71, 0x31, 0x11, 0x11, 0x35,
+    0x91, 0x11, 0x11, 0x11, 0x11, 0x60, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x0e, 0xc8, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x65, 0xf0, 0xff, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0xe6, 0x13, 0x11, 0x11, 0xdf,
+    0xa1, 0x11, 0x11, 0x11, 0x11, 0xb0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x0e, 0x73, 0x11,
+    0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x65, 0x00, 0xe0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x02, 0x0f, 0xda, 0x89, 0xb5, 0x00,
+    0xb1, 0x11, 0x11, 0x11, 0x11, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0xff, 0x0e, 0x73,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x7e, 0x0f, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2f, 0x02, 0x02, 0xff, 0x20, 0x22,
+    0x71, 0x11, 0x11, 0x11, 0x11, 0x8e, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0xfe,
+    0x63, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x7e, 0x02, 0x0f, 0x22, 0x00, 0x00, 0x00,
+    0x2f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0xf0, 0xf0, 0xff, 0x20,
+    0xd1, 0x11, 0x11, 0x11, 0x11, 0x35, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xf0, 0x0e,
+    0x05, 0x63, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xce, 0x20, 0x00, 0x22, 0x2f, 0x02,
+    0x00, 0x22, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x02, 0x2f, 0x02, 0xf0, 0xf2, 0x00,
+    0x51, 0x11, 0x11, 0x11, 0x11, 0x14, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x22, 0x00,
+    0xf0, 0xf5, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xce, 0x2e, 0x02, 0x00, 0x20,
+    0xe0, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x20, 0xf0, 0x02, 0x22, 0x02, 0xf0, 0x20,
+    0xe8, 0x11, 0x11, 0x11, 0x11, 0x17, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02,
+    0x0e, 0x22, 0x25, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xdf, 0x2f, 0x0f, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x02, 0xf0, 0xf0, 0x2f, 0x0f, 0x02,
+    0x09, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x02,
+    0x20, 0x02, 0xf0, 0x05, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0xdf, 0x22, 0x0f,
+    0x20, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf5, 0x5e, 0x22, 0xf2, 0x00,
+    0x06, 0x11, 0x11, 0x11, 0x11, 0x18, 0xe0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0x0f, 0x0f, 0x20, 0x05, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x4e, 0x02,
+    0x2f, 0x00, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0d, 0x93, 0x18, 0x6e, 0x00, 0x2f,
+    0xfd, 0x11, 0x11, 0x11, 0x11, 0x11, 0x50, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20,
+    0x2f, 0x02, 0x02, 0x02, 0xf0, 0x04, 0xa1, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x40,
+    0x0f, 0xf0, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x61, 0x11, 0x11, 0x19, 0xe2, 0x00,
+    0x05, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20,
+    0x20, 0x02, 0x00, 0x0f, 0x0f, 0x00, 0xf4, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a,
+    0x40, 0x0f, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x04, 0x11, 0x11, 0x11, 0x31, 0x60, 0xf2,
+    0x0e, 0x81, 0x11, 0x11, 0x11, 0x11, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf0, 0x24, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x1a, 0x50, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x35, 0x0f,
+    0xf0, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x35, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x0f, 0x22, 0xfd, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x1c, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x53, 0x11, 0x11, 0x11, 0x11, 0x14, 0xf0,
+    0x0f, 0xc1, 0x11, 0x11, 0x11, 0x13, 0x1c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x00, 0x20, 0x2f, 0xed, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x50, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x14, 0x2f,
+    0x20, 0x53, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x0f, 0xf2, 0x22, 0xec, 0x81, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x70, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x35, 0x02,
+    0xf0, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x02, 0x00, 0x20, 0xec, 0x81, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x31, 0x11, 0x11, 0x11, 0x11, 0xa2, 0x22,
+    0x0e, 0xfc, 0x11, 0x11, 0x11, 0x11, 0x11, 0x62, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x0f, 0xf2, 0x22, 0x2f, 0x00, 0xe7, 0x31, 0x11, 0x11,
+    0x11, 0x11, 0x70, 0xf2, 0x00, 0x00, 0x00, 0x02, 0x25, 0x11, 0x11, 0x11, 0x11, 0x11, 0xd0, 0xf2,
+    0x20, 0x25, 0x31, 0x11, 0x11, 0x11, 0x11, 0x85, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0xff, 0x00, 0x00, 0x20, 0x02, 0xff, 0xff, 0xe7, 0x31, 0x11,
+    0x31, 0x13, 0x52, 0x20, 0x00, 0x00, 0x00, 0x22, 0x0e, 0x81, 0x11, 0x11, 0x11, 0x13, 0x5e, 0x00,
+    0x20, 0x22, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x17, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x22, 0x20, 0x02, 0x00, 0x00, 0xf0, 0x22, 0xe6, 0x31,
+    0x11, 0x3d, 0x22, 0x02, 0x00, 0x00, 0x00, 0x22, 0xf0, 0xb1, 0x11, 0x11, 0x11, 0x1b, 0x02, 0x00,
+    0x02, 0x00, 0x41, 0x11, 0x11, 0x11, 0x11, 0x18, 0xe0, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2f, 0x20, 0x5c,
+    0x6c, 0x50, 0x20, 0x20, 0x02, 0x00, 0x02, 0x02, 0x20, 0x58, 0x11, 0x11, 0x11, 0x35, 0x0f, 0x20,
+    0x20, 0xf0, 0xe8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x72, 0x02, 0xf0, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0x00,
+    0x0f, 0x02, 0xf0, 0x20, 0x22, 0x00, 0xf0, 0x20, 0x20, 0xf5, 0x91, 0x11, 0x19, 0x52, 0xf0, 0x20,
+    0x00, 0x0f, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x85, 0xe0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x2e,
+    0xff, 0x22, 0x00, 0x20, 0x20, 0xf2, 0x00, 0x00, 0x0f, 0x02, 0xe4, 0x77, 0x4e, 0xf0, 0x02, 0x0f,
+    0x22, 0x02, 0x2e, 0x31, 0x11, 0x11, 0x11, 0x11, 0x16, 0x22, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00,
+    0xf0, 0x22, 0x00, 0x20, 0x00, 0xf0, 0x02, 0x0f, 0x00, 0x20, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x00,
+    0x02, 0x20, 0x00, 0x71, 0x31, 0x11, 0x11, 0x11, 0x11, 0x50, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0xf0,
+    0x00, 0x00, 0x02, 0x02, 0xf0, 0x0f, 0x0f, 0xf2, 0xff, 0x00, 0x00, 0xff, 0x2f, 0x02, 0x20, 0x20,
+    0x02, 0x0f, 0xf2, 0xe3, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9f, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x00,
+    0x22, 0x00, 0xff, 0x00, 0x0f, 0x0f, 0xe0, 0x20, 0x02, 0xf0, 0xf2, 0x0f, 0x20, 0x00, 0x2f, 0x02,
+    0xf0, 0x0f, 0x0f, 0xf7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x00, 0x0f, 0x20, 0xf0, 0x2e, 0x44, 0x50, 0x20, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00,
+    0x00, 0x20, 0x02, 0x0e, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x50, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x20, 0x20,
+    0x22, 0x02, 0x00, 0xf0, 0x02, 0x0e, 0x61, 0x11, 0x1b, 0xe0, 0x22, 0xf0, 0x22, 0x02, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x22, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9e, 0x0f, 0x02, 0x00, 0x0f, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x0f, 0x00, 0xf0, 0x0f, 0xea, 0x11, 0x11, 0x11, 0x9e, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0xea, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x02, 0x00, 0xf2, 0x20, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x20, 0x0f, 0x00, 0xf0, 0x61, 0x11, 0x11, 0x11, 0x16, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x05, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x70, 0xe0, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x22, 0x0f, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x13, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x2f, 0x0f, 0x22, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x20, 0xf0, 0x41, 0x31, 0x11, 0x11, 0x11, 0x11, 0x5f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xe9, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x40, 0xf0, 0x00, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x20, 0xff, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x50, 0xf2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2f, 0x05, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x85, 0x0f, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x2f, 0x25, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x50, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x22, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1c, 0x2f, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x85, 0x0f, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x02, 0xf5, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb2, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x40, 0x22,
+    0x22, 0x02, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x22,
+    0x20, 0xf0, 0x0f, 0x0e, 0x81, 0x11, 0x11, 0x11, 0x19, 0xe0, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xf0, 0x53, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1c, 0xf2,
+    0x22, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x0f, 0x00,
+    0x02, 0x00, 0xf2, 0xf0, 0xc1, 0x31, 0x11, 0x31, 0x35, 0x0f, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0e, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x6f,
+    0x02, 0x0f, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x20, 0x02, 0xff,
+    0x2f, 0xf0, 0x00, 0x0f, 0x07, 0x11, 0x11, 0x18, 0x50, 0xe0, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0xe0, 0xd1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a,
+    0x50, 0xf0, 0xf2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x20, 0x22,
+    0x02, 0x0f, 0xe0, 0x00, 0xf0, 0x56, 0xab, 0xce, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x00, 0x0e, 0x0c, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x0f, 0x22, 0x57,
+    0x67, 0x50, 0x02, 0x02, 0x20, 0xff, 0x00, 0xf0, 0x2f, 0xf0, 0x2f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x0f, 0xf0, 0xe0, 0xc1, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0xb5, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x5b, 0x11,
+    0x11, 0x16, 0xe2, 0x02, 0x00, 0x20, 0x0f, 0xff, 0x00, 0x02, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x00, 0x02, 0x0e, 0x0c, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x13, 0xc2, 0xf0, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfd, 0x81, 0x11,
+    0x11, 0x31, 0x62, 0xf0, 0x20, 0xf0, 0xf0, 0x0f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0xd1, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x19, 0x4f, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xa1, 0x13, 0x11,
+    0x11, 0x13, 0x15, 0x0f, 0x02, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0xf4, 0x31, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x1a, 0x42, 0x22, 0x22, 0x00, 0x02, 0x20, 0x00, 0x02, 0x22, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0xf2, 0x0f, 0x20, 0x00, 0x20, 0x02, 0x20, 0x00, 0x22, 0x00, 0xfa, 0x13, 0x11, 0x11,
+    0x11, 0x11, 0x17, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x58, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x1a, 0xde, 0x0f, 0x0f, 0xf0, 0x20, 0x02, 0x20, 0x00, 0x0f, 0xf0, 0xf0,
+    0x20, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x00, 0x02, 0x00, 0x00, 0xf2, 0x41, 0x31, 0x11, 0x11,
+    0x11, 0x11, 0x16, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x22, 0x0f, 0x0e, 0xa1, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x75, 0x2f, 0x20, 0xe2, 0xf2, 0x02, 0x0f, 0x00, 0x0f, 0x0f,
+    0x00, 0x00, 0x20, 0xf0, 0x00, 0xf2, 0xff, 0xfe, 0xf0, 0xff, 0x20, 0x20, 0x61, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x17, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0xe7, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0x50, 0x00, 0x20, 0xff, 0x02, 0x00, 0x02, 0x02,
+    0x0f, 0x0f, 0x00, 0x00, 0xf2, 0x00, 0x02, 0xf0, 0x02, 0x00, 0x0f, 0x22, 0xb1, 0x31, 0x11, 0x11,
+    0x11, 0x11, 0x15, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0xf0, 0x0f, 0xf0, 0x48, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x39, 0x64, 0x5f, 0x20, 0x2f, 0x0f, 0x02, 0x02,
+    0x00, 0x20, 0x00, 0x2f, 0x00, 0x25, 0x47, 0x6d, 0xe0, 0xf0, 0x00, 0xf0, 0x61, 0x11, 0x11, 0x11,
+    0x11, 0x31, 0xb0, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xf0, 0x02, 0xf0, 0xf5, 0xb1, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x39, 0xbd, 0xe0, 0x20, 0x00, 0x02,
+    0x0f, 0x00, 0x2f, 0xf0, 0x4b, 0x93, 0x11, 0x11, 0x34, 0x20, 0x0f, 0xf0, 0x41, 0x31, 0x11, 0x11,
+    0x11, 0x1b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x0f, 0x20, 0x22, 0x00, 0x24, 0x81,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9e, 0x22, 0x02, 0x20,
+    0x00, 0x0f, 0x00, 0xeb, 0x11, 0x11, 0x13, 0x11, 0x11, 0x42, 0xe0, 0x22, 0x0b, 0x13, 0x11, 0x31,
+    0x18, 0xdf, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x22, 0xf2, 0xe6,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x20, 0x20, 0x20,
+    0x20, 0x22, 0x0f, 0x61, 0x13, 0x11, 0x11, 0x11, 0x11, 0x9f, 0x02, 0x20, 0x2f, 0x61, 0x11, 0x13,
+    0x6e, 0x0f, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x5a, 0x11, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xd0, 0xf2, 0x00,
+    0x20, 0x2f, 0x25, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x22, 0x00, 0x0f, 0x05, 0xc6, 0xc5,
+    0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x20, 0x4a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x6f, 0x00, 0xf0,
+    0x0f, 0x20, 0xfd, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x2f, 0x0f, 0x0f, 0x22, 0x00, 0xf0,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0xf2, 0x02, 0x4b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb0, 0x0f, 0x00,
+    0x00, 0x2f, 0x2c, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x20, 0xf0, 0xf0, 0x02, 0xff, 0x22,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf2, 0x20, 0x56, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x60, 0xf2, 0x00,
+    0xf0, 0x0f, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8e, 0x0f, 0x02, 0x00, 0x20, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0xff, 0x00, 0xed, 0xa3, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0xf0, 0xf2,
+    0x00, 0xf2, 0x0e, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0xd0, 0xf0, 0x02, 0x02, 0x22, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x0f, 0x20, 0xfe, 0x00, 0x25, 0xca, 0x31, 0x11, 0x11, 0x11, 0x11, 0x16, 0x20, 0x20, 0x00,
+    0x20, 0x02, 0x22, 0xd1, 0x11, 0x11, 0x11, 0x11, 0x1c, 0x0f, 0x02, 0x00, 0x22, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0xff, 0x02, 0x20, 0xe4, 0x6a, 0x31, 0x11, 0x11, 0x6f, 0xf2, 0x0f, 0x20,
+    0x0f, 0xf0, 0x00, 0x0d, 0x81, 0x11, 0x18, 0xa7, 0x52, 0xf0, 0x02, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x02, 0x02, 0x00, 0x22, 0xff, 0x02, 0x20, 0xe4, 0xc6, 0x75, 0x02, 0x00, 0x20, 0x00,
+    0x20, 0x02, 0x02, 0xf0, 0xed, 0x7c, 0x4e, 0x20, 0x22, 0x00, 0xf0, 0x20, 0x00, 0x20, 0x02, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const tIndexedImage time = { image_data_time, 128, 128,
+    4, palette_time };
+
+#endif /* IDX_TIME_H_ */
@@ -0,0 +1,138 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: unlocked
+* size: 60x60, 4 bits per pixel, 16 cores
+*******************************************************************************/
+
+#ifndef IDX_UNLOCKED_H_
+#define IDX_UNLOCKED_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_unlocked[48] = {
+    0xc3, 0xc3, 0xc3, 0xc1, 0xc1, 0xc1, 0x04, 0x04, 0x04, 0xa2, 0xa2, 0xa2, 0x54, 0x54, 0x54, 0xff,
+    0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x92, 0x92, 0x92, 0xf1, 0xf1, 0xf1, 0x6c, 0x6c, 0x6c, 0x83, 0x83,
+    0x83, 0x19, 0x19, 0x19, 0x2c, 0x2c, 0x2c, 0x3c, 0x3c, 0x3c, 0xc5, 0xc5, 0xc5, 0xdb, 0xdb, 0xdb
+};
+
+static const uint8_t image_data_unlocked[1800] = {
+    0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x65, 0x65, 0x56, 0x56, 0x68, 0x1a, 0x4c, 0xb2, 0x2b,
+    0xc4, 0xa1, 0x86, 0x65, 0x66, 0x56, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x56, 0x65, 0x55, 0x55, 0x65, 0x65, 0x8f, 0xad, 0x22, 0x2b, 0xbb, 0xbb, 0xb2, 0x22,
+    0xc7, 0xf8, 0x56, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x65, 0x66, 0x56, 0x65, 0x6f, 0xab, 0x22, 0xbc, 0x4a, 0x33, 0x33, 0xa4, 0xcb, 0x22, 0xb7,
+    0xf6, 0x55, 0x65, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+    0x55, 0x55, 0x56, 0x14, 0x22, 0xc9, 0x18, 0x56, 0x55, 0x55, 0x55, 0x81, 0x9c, 0x22, 0x41, 0x66,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x65,
+    0x83, 0xc2, 0xb9, 0xe5, 0x55, 0x65, 0x56, 0x65, 0x56, 0x55, 0x5f, 0x9b, 0x2c, 0x36, 0x55, 0x66,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x66, 0x58, 0x3b, 0x2d,
+    0x35, 0x56, 0x65, 0x66, 0x55, 0x55, 0x56, 0x55, 0x55, 0x63, 0xd2, 0xb7, 0x86, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x55, 0x63, 0xb2, 0x4f, 0x56, 0x65,
+    0x66, 0x55, 0x65, 0x56, 0x65, 0x56, 0x55, 0x66, 0xf4, 0x2b, 0x35, 0x65, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66, 0x56, 0xfc, 0x24, 0xe5, 0x55, 0x65, 0x56, 0x56,
+    0x65, 0x55, 0x56, 0x65, 0x56, 0x55, 0x5e, 0xd2, 0xcf, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x56, 0x65, 0x58, 0x92, 0xce, 0x66, 0x65, 0x65, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x56, 0xec, 0x29, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x65, 0x56, 0x51, 0xbb, 0x38, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x63, 0x2b, 0x16, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x56, 0x55, 0x64, 0x2d, 0x85, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x56, 0x58, 0xd2, 0x46, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x65,
+    0xfb, 0x23, 0x66, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x66,
+    0x32, 0xbf, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x3b, 0xbf,
+    0x65, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x56, 0xfb, 0xb3,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x56, 0x66, 0x55, 0x66, 0x66,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x65, 0x84, 0x29, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x65, 0x55, 0x65,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x89, 0x24, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x56, 0x56, 0x55, 0x65, 0x65, 0x66, 0x65, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x6a, 0x2d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x65, 0x56, 0x56, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x65, 0x56, 0x67, 0x2d, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x66, 0x55, 0x65, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x55, 0x55, 0x67, 0x2d, 0x65, 0x56, 0x65, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x66, 0x56, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x56, 0x55, 0x67, 0x2d, 0x56, 0x65, 0x56, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x56,
+    0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x66,
+    0x87, 0x2d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x65, 0x66, 0x56,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x67, 0x2d,
+    0x66, 0x55, 0x56, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xfa, 0x2d, 0x55, 0x56,
+    0x65, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x58, 0x1a, 0x94, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4c, 0x2b, 0xa1, 0x85, 0x66, 0x56,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xe9, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x9e, 0x55, 0x65, 0x55, 0x55,
+    0x55, 0x65, 0x66, 0x51, 0xd2, 0x24, 0xa7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7a, 0xd2, 0x2d, 0xe5, 0x65, 0x55, 0x55, 0x66, 0x55,
+    0x65, 0xf4, 0x2c, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe1, 0x00, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0xe7, 0xc2, 0x4f, 0x65, 0x55, 0x55, 0x65, 0x65, 0x58, 0xa2,
+    0xb3, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x10, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x0e, 0xe1, 0x3c, 0x2a, 0x66, 0x55, 0x55, 0x55, 0x66, 0x5f, 0xd2, 0xa0, 0x11,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xee, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0xea, 0x2d, 0xf5, 0x55, 0x55, 0x65, 0x65, 0x51, 0x2c, 0x10, 0xee, 0x1e, 0x1e,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x10, 0x00, 0x11, 0x00, 0xee, 0x00, 0x00, 0x01, 0x10, 0x00, 0x11,
+    0x0e, 0x11, 0xc2, 0x35, 0x55, 0x55, 0x66, 0x55, 0x63, 0x24, 0xf0, 0x10, 0xe1, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0xe0, 0xe0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x11, 0x0f,
+    0xd2, 0x36, 0x55, 0x55, 0x56, 0x55, 0x67, 0x24, 0xfe, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0xe0, 0x1f, 0x42, 0x75,
+    0x55, 0x55, 0x55, 0x65, 0x57, 0x24, 0x81, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x9d, 0xd9, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0x01, 0x0f, 0x42, 0x75, 0x55, 0x55,
+    0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x1c, 0x22, 0x22,
+    0xce, 0x10, 0xe0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55,
+    0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xd2, 0xca, 0xac, 0x2d, 0xe1,
+    0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24,
+    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbb, 0xe5, 0x5e, 0xbb, 0x30, 0x01, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x2d, 0x85, 0x5f, 0xd2, 0xa0, 0x00, 0xe1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x24, 0x85, 0x68, 0x42, 0xa0, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0x24, 0x85, 0x68, 0x4b, 0xa1, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1a, 0xb4, 0x85, 0x58, 0x42, 0xa0, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75,
+    0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x24,
+    0x85, 0x68, 0x4b, 0xae, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55,
+    0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0x24, 0x85, 0x68,
+    0x42, 0xae, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55,
+    0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x24, 0x85, 0x58, 0x42, 0xa1,
+    0xee, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24,
+    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2d, 0x85, 0x68, 0xdb, 0xa1, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb2, 0x36, 0x83, 0x2b, 0x3e, 0x11, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe1, 0x42, 0xb4, 0x4b, 0x24, 0x0e, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0xed, 0xb2, 0x2b, 0xde, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x74, 0x47, 0x00, 0x01, 0xee, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75,
+    0x55, 0x55, 0x56, 0x55, 0x57, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
+    0x0e, 0xe0, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55,
+    0x56, 0x55, 0x67, 0x24, 0x80, 0x01, 0xe0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x55, 0x56,
+    0x57, 0x24, 0xf1, 0xe0, 0x10, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x66, 0x56, 0x57, 0x24,
+    0x80, 0x0e, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe1, 0x0f, 0x42, 0x76, 0x55, 0x55, 0x56, 0x55, 0x67, 0x24, 0xf0, 0x00,
+    0xe0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0x42, 0x75, 0x55, 0x55, 0x56, 0x55, 0x63, 0x24, 0xf0, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1e, 0xef, 0x42, 0x35, 0x55, 0x55, 0x65, 0x65, 0x53, 0x2c, 0xe0, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x0e,
+    0xc2, 0x36, 0x55, 0x55, 0x65, 0x66, 0x5e, 0xc2, 0x70, 0x10, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2d, 0xe5,
+    0x55, 0x55, 0x56, 0x55, 0x58, 0xa2, 0xc0, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2a, 0x86, 0x55, 0x55,
+    0x55, 0x66, 0x56, 0xed, 0x2d, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xe0, 0x01, 0xd2, 0xde, 0x55, 0x55, 0x55, 0x65, 0x55,
+    0x55, 0x63, 0xc2, 0xb4, 0x73, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x37, 0x4b, 0x2c, 0x15, 0x65, 0x55, 0x55, 0x55, 0x66, 0x56, 0x58,
+    0x1d, 0x22, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0x22, 0xd1, 0x66, 0x55, 0x55, 0x55, 0x56, 0x65, 0x56, 0x56, 0x68, 0x34,
+    0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x2b, 0x43, 0x86, 0x65, 0x66, 0x55, 0x55
+};
+
+const tIndexedImage unlocked = { image_data_unlocked, 60, 60,
+    4, palette_unlocked };
+
+#endif /* IDX_UNLOCKED_H_ */
@@ -0,0 +1,537 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: vortex
+* size: 128x128, 4 bits per pixel, 16 cores
+*******************************************************************************/
+
+#ifndef IDX_VORTEX_H_
+#define IDX_VORTEX_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_vortex[48] = {
+    0xff, 0xff, 0xff, 0x01, 0x01, 0x01, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0x73,
+    0x73, 0x73, 0x36, 0x36, 0x36, 0x55, 0x55, 0x55, 0xb4, 0xb4, 0xb4, 0xc5, 0xc5, 0xc5, 0x06, 0x06,
+    0x06, 0x15, 0x15, 0x15, 0x8a, 0x8a, 0x8a, 0x9c, 0x9c, 0x9c, 0xd6, 0xd6, 0xd6, 0xe6, 0xe6, 0xe6
+};
+
+static const uint8_t image_data_vortex[8192] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0xe9, 0x89, 0x99, 0x9e, 0xef, 0x43, 0x02, 0x00, 0x00,
+    0x20, 0x34, 0x20, 0x20, 0x02, 0x20, 0x32, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd6, 0xa1, 0x11, 0x11, 0x1a, 0xab, 0xb6, 0x67, 0x5c, 0x89,
+    0xf3, 0x00, 0x23, 0x32, 0x30, 0x00, 0x00, 0x02, 0x20, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x07, 0x1a, 0x1a, 0xaa, 0xaa, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0xb6, 0x7c, 0x94, 0x03, 0x03, 0x30, 0x30, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x23, 0xc1, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xaa, 0xaa,
+    0x11, 0x11, 0x1b, 0x7d, 0xe0, 0x03, 0x20, 0x30, 0x22, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x0f, 0xb1, 0x1a, 0xb5, 0x55, 0x55, 0x55, 0x77, 0x66, 0xba, 0x11, 0x11,
+    0x11, 0xaa, 0xa1, 0x11, 0xa6, 0xd4, 0x32, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x0d, 0x1a, 0x1b, 0xf0, 0x00, 0x22, 0x20, 0x22, 0x22, 0x4f, 0x98, 0xc5,
+    0x6b, 0x11, 0x11, 0xaa, 0x11, 0x16, 0x40, 0x33, 0x33, 0x30, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x23, 0x35, 0x1a, 0x1d, 0x04, 0x33, 0x33, 0x33, 0x22, 0x02, 0x00, 0x22, 0x00,
+    0x04, 0xed, 0x7b, 0x11, 0x1a, 0xa1, 0x90, 0x40, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x23, 0x05, 0x1a, 0x1e, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x32, 0x24,
+    0x22, 0x03, 0x24, 0x95, 0x61, 0x16, 0x43, 0x0f, 0xde, 0x30, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x05, 0x1a, 0x19, 0x22, 0x22, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x22,
+    0x03, 0x23, 0x32, 0x02, 0x49, 0xdf, 0x00, 0x46, 0x1a, 0x5f, 0x03, 0x30, 0x00, 0x30, 0x20, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x0d, 0x1a, 0x15, 0x02, 0x20, 0x02, 0x33, 0x34, 0x30, 0x33, 0x00, 0x20,
+    0x00, 0x20, 0x02, 0x33, 0x02, 0x02, 0x30, 0x91, 0xa1, 0x1b, 0xd2, 0x04, 0x23, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x2e, 0xa1, 0x1a, 0xd4, 0x44, 0x32, 0x02, 0x20, 0x02, 0x02, 0x44, 0x22,
+    0x30, 0x02, 0x20, 0x00, 0x33, 0x40, 0x30, 0x46, 0x11, 0xaa, 0x17, 0x40, 0x30, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x5a, 0x11, 0x1b, 0x66, 0x66, 0x77, 0xcd, 0x8f, 0x32, 0x00, 0x22,
+    0x23, 0x00, 0x22, 0x00, 0x00, 0x20, 0x03, 0x04, 0x5a, 0x1a, 0xa1, 0xb9, 0x03, 0x40, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x46, 0x1a, 0xa1, 0x11, 0x11, 0x11, 0x11, 0xaa, 0xb7, 0xc9, 0xf0,
+    0x02, 0x33, 0x22, 0x00, 0x00, 0x22, 0x20, 0x23, 0x29, 0x61, 0x1a, 0x1a, 0xd0, 0x40, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x6a, 0x11, 0x11, 0x11, 0x1a, 0xaa, 0xa1, 0x11, 0x11, 0xb6,
+    0xce, 0x00, 0x02, 0x32, 0x00, 0x00, 0x02, 0x20, 0x32, 0x25, 0x11, 0x1a, 0x15, 0x04, 0x23, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0x28, 0x76, 0x66, 0xbb, 0xa1, 0x11, 0x11, 0x1a, 0xaa, 0x11,
+    0x1a, 0x6c, 0xf0, 0x22, 0x30, 0x03, 0x02, 0x02, 0x32, 0x30, 0x8b, 0xa1, 0xa1, 0x50, 0x30, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x22, 0x02, 0x22, 0x34, 0xfe, 0x8d, 0x57, 0xba, 0x11, 0x11,
+    0xa1, 0x11, 0xa7, 0x92, 0x23, 0x22, 0x20, 0x20, 0x00, 0x23, 0x0f, 0x61, 0xaa, 0x17, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x20, 0x00, 0x00, 0x00, 0x20, 0x03, 0x32, 0x22, 0x20, 0x00, 0x00, 0x02, 0x4e, 0xd7, 0x61,
+    0x11, 0x1a, 0x11, 0x16, 0x82, 0x23, 0x22, 0x02, 0x00, 0x00, 0x30, 0x47, 0x1a, 0xa1, 0x50, 0x30,
+    0x20, 0x20, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x02, 0x20, 0x20, 0x00, 0x02, 0x20, 0x00, 0x22, 0x22, 0x23, 0x40, 0x03, 0x20, 0x4e,
+    0xc6, 0x1a, 0x1a, 0xa1, 0x16, 0x80, 0x30, 0x20, 0x00, 0x22, 0x03, 0x22, 0x71, 0x1a, 0x15, 0x04,
+    0x00, 0x03, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x23, 0x00, 0x02, 0x02, 0x20, 0x00, 0x03, 0x20, 0x02, 0x33, 0x33, 0x34, 0x43, 0x44, 0x30,
+    0x22, 0x95, 0xb1, 0x1a, 0xaa, 0x17, 0xe3, 0x22, 0x04, 0x00, 0x30, 0x22, 0x07, 0x11, 0x11, 0xd0,
+    0x44, 0x20, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0x22, 0x22, 0x23, 0x20, 0x03, 0x00, 0x00, 0x20, 0x02,
+    0x00, 0x03, 0x4d, 0x61, 0x11, 0x11, 0xac, 0x23, 0x40, 0x03, 0x22, 0x00, 0x30, 0x71, 0xa1, 0x18,
+    0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x22, 0x02, 0x00, 0x23, 0x32, 0x00, 0x03, 0x02, 0x4e, 0x98, 0xdc, 0x55, 0x55, 0x55, 0x5c,
+    0xd8, 0x8e, 0x40, 0x38, 0x61, 0x11, 0x11, 0x6f, 0x24, 0x32, 0x00, 0x03, 0x40, 0x46, 0x11, 0xab,
+    0xe2, 0x20, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x23, 0x32, 0x03, 0x20, 0x4e, 0xd5, 0x76, 0xb1, 0x11, 0x11, 0xa1, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0xab, 0x65, 0xc6, 0x11, 0x1a, 0x1b, 0x80, 0x30, 0x32, 0x20, 0x04, 0x0f, 0xb1, 0x11,
+    0x70, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x23, 0x20, 0x03, 0xf8, 0x56, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xaa, 0xaa, 0xaa, 0x1a,
+    0x11, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa1, 0x1c, 0x03, 0x30, 0x02, 0x20, 0x20, 0x9a, 0x11,
+    0x1c, 0x03, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x00, 0x4e, 0xc6, 0xb1, 0x11, 0x11, 0xaa, 0x11, 0x1a, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0xa1, 0x1a, 0x11, 0x11, 0xa1, 0x50, 0x03, 0x20, 0x02, 0x22, 0x0c, 0x11,
+    0x1a, 0xe2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00, 0x30, 0x03, 0x20,
+    0x23, 0xec, 0x61, 0x11, 0x11, 0xa1, 0x11, 0x11, 0x1a, 0x11, 0x11, 0xb6, 0x75, 0xd8, 0x99, 0xee,
+    0x99, 0x8d, 0x57, 0x6a, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x17, 0x22, 0x20, 0x20, 0x02, 0x00, 0x71,
+    0xa1, 0x72, 0x20, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x20, 0x20, 0x03, 0x30, 0x0f,
+    0xd6, 0x11, 0x11, 0xaa, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa6, 0xc9, 0xf0, 0x20, 0x02, 0x32, 0x02,
+    0x02, 0x00, 0x20, 0x3f, 0x8c, 0x6a, 0x11, 0x1a, 0x11, 0x1a, 0x70, 0x23, 0x03, 0x00, 0x40, 0xeb,
+    0x1a, 0x18, 0x33, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x03, 0x22, 0x0e, 0x5b,
+    0x11, 0xaa, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x6d, 0xf0, 0x20, 0x02, 0x23, 0x33, 0x20, 0x02,
+    0x33, 0x33, 0x32, 0x03, 0x00, 0x3f, 0xd6, 0xa1, 0x11, 0x1a, 0x17, 0xf0, 0x30, 0x02, 0x02, 0x0c,
+    0x11, 0x1b, 0x43, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x20, 0x02, 0x24, 0x2e, 0x5a, 0x11,
+    0xaa, 0xa1, 0xa7, 0xb1, 0x11, 0xa1, 0x1b, 0x5e, 0x02, 0x32, 0x23, 0x22, 0x22, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x02, 0x34, 0x00, 0x20, 0xe5, 0xba, 0x11, 0xa1, 0xbd, 0x02, 0x42, 0x03, 0x03,
+    0x61, 0xa1, 0xc2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x20, 0x42, 0x0f, 0x5a, 0x11, 0xa1,
+    0x11, 0xbc, 0x97, 0x11, 0x1a, 0x1a, 0x5f, 0x00, 0x32, 0x00, 0x20, 0x02, 0x00, 0x00, 0x22, 0x20,
+    0x02, 0x20, 0x00, 0x00, 0x00, 0x24, 0x32, 0x20, 0xf5, 0xba, 0x1a, 0x11, 0x7f, 0x02, 0x20, 0x40,
+    0x81, 0x11, 0xbf, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x03, 0x04, 0xcb, 0x11, 0xa1, 0x1a,
+    0x78, 0x09, 0xb1, 0x1a, 0xaa, 0x5f, 0x02, 0x32, 0x02, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x22, 0x00, 0x02, 0x22, 0x33, 0x20, 0xf5, 0xa1, 0x1a, 0x1b, 0x83, 0x43, 0x03,
+    0x27, 0x1a, 0x1c, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23, 0x96, 0x11, 0xa1, 0x1a, 0x5e,
+    0x30, 0xc1, 0x1a, 0xa1, 0x6e, 0x30, 0x34, 0x02, 0x20, 0x00, 0x22, 0x00, 0x00, 0x22, 0x00, 0x02,
+    0x20, 0x20, 0x00, 0x00, 0x02, 0x32, 0x00, 0x20, 0x30, 0x40, 0xe6, 0x11, 0xa1, 0x1c, 0x03, 0x02,
+    0x09, 0x1a, 0x1b, 0x42, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x35, 0x11, 0xaa, 0x1a, 0x5f, 0x00,
+    0x37, 0x1a, 0xa1, 0xac, 0x00, 0x04, 0x00, 0x20, 0x00, 0x22, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x02, 0x20, 0x00, 0x02, 0x00, 0x30, 0x02, 0x04, 0x02, 0x22, 0xc1, 0x1a, 0xa1, 0x72, 0x23,
+    0x23, 0x71, 0xaa, 0xd0, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x03, 0x20, 0x02, 0x0e, 0x61, 0xaa, 0x11, 0x7e, 0x32, 0x34,
+    0x71, 0xaa, 0x1b, 0x90, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x02, 0x22, 0x00, 0x20, 0x02,
+    0x20, 0x20, 0x22, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x20, 0x30, 0x39, 0xb1, 0xa1, 0x17, 0x40,
+    0x40, 0x81, 0xa1, 0x62, 0x20, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x32, 0x42, 0x8a, 0xaa, 0x11, 0xb8, 0x22, 0x03, 0x46,
+    0x1a, 0xa1, 0x64, 0x03, 0x22, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x30, 0x00, 0x00, 0x20, 0x00,
+    0x20, 0x20, 0x00, 0x00, 0x20, 0x00, 0x02, 0x20, 0x20, 0x20, 0x03, 0x00, 0xf7, 0x11, 0xa1, 0x64,
+    0x04, 0x06, 0x11, 0x19, 0x23, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x32, 0x02, 0x0c, 0x11, 0x1a, 0x17, 0xf0, 0x33, 0x34, 0x61,
+    0xaa, 0x15, 0x23, 0x30, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x03, 0x30, 0x00, 0x20, 0x03,
+    0x00, 0x33, 0x02, 0x20, 0x20, 0x03, 0x00, 0x03, 0x00, 0x30, 0x02, 0x23, 0x22, 0x51, 0xaa, 0x16,
+    0x40, 0x0c, 0x1a, 0x15, 0x02, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x03, 0x02, 0x5a, 0x11, 0x1a, 0xd2, 0x22, 0x20, 0x07, 0x1a,
+    0x11, 0xc2, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x23, 0x02, 0x02, 0x20, 0x24, 0x30,
+    0x32, 0x20, 0x00, 0x22, 0x22, 0x20, 0x03, 0x20, 0x00, 0x02, 0x20, 0x03, 0x03, 0x05, 0x1a, 0xa1,
+    0x73, 0x3f, 0xb1, 0x1b, 0xf2, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x02, 0x27, 0x1a, 0x1a, 0x6e, 0x30, 0x30, 0x42, 0x51, 0xaa,
+    0x1c, 0x23, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x03, 0x43, 0x20, 0x22, 0x02,
+    0x02, 0x02, 0x43, 0x22, 0x02, 0x20, 0x20, 0x02, 0x00, 0x02, 0x00, 0x30, 0x02, 0x30, 0xc1, 0xaa,
+    0x15, 0x03, 0x71, 0xa1, 0x82, 0x30, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x71, 0xa1, 0x17, 0xf0, 0x33, 0x04, 0x0d, 0x11, 0xa1,
+    0x52, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x02, 0x00, 0x2f, 0xe9, 0x99,
+    0x9e, 0xf3, 0x00, 0x22, 0x33, 0x00, 0x20, 0x03, 0x03, 0x20, 0x00, 0x23, 0x03, 0x04, 0x05, 0x11,
+    0xa1, 0xc0, 0x81, 0xa1, 0x70, 0x30, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x02, 0x05, 0x1a, 0xa1, 0x70, 0x04, 0x20, 0x22, 0x91, 0xaa, 0x17,
+    0x02, 0x30, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x30, 0x49, 0xc7, 0x6b, 0xa1, 0x11,
+    0x1a, 0xb6, 0x7c, 0x94, 0x20, 0x33, 0x00, 0x20, 0x02, 0x00, 0x32, 0x00, 0x20, 0x23, 0x20, 0x71,
+    0xa1, 0x19, 0x3b, 0x11, 0xbf, 0x03, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x51, 0xaa, 0x15, 0x03, 0x00, 0x20, 0x24, 0x61, 0xa1, 0x62,
+    0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x95, 0xb1, 0x11, 0x11, 0x1a, 0xaa,
+    0x1a, 0x11, 0x11, 0x1b, 0x59, 0x00, 0x32, 0x30, 0x20, 0x22, 0x00, 0x20, 0x03, 0x00, 0x02, 0x36,
+    0x1a, 0x1b, 0x07, 0x1a, 0x18, 0x04, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x00, 0x30, 0x23, 0x3d, 0x11, 0xa1, 0x70, 0x22, 0x02, 0x02, 0x07, 0x1a, 0x1b, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x23, 0x00, 0x86, 0xa1, 0x1a, 0xaa, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0xaa, 0x11, 0x11, 0x68, 0x33, 0x02, 0x02, 0x03, 0x20, 0x20, 0x02, 0x00, 0x00, 0x4f,
+    0xb1, 0xa1, 0x58, 0x1a, 0x15, 0x03, 0x20, 0x20, 0x03, 0x00, 0x30, 0x30, 0x00, 0x40, 0x20, 0x00,
+    0x02, 0x00, 0x20, 0x20, 0x32, 0xea, 0x11, 0x17, 0x23, 0x32, 0x00, 0x32, 0x81, 0x1a, 0x18, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x20, 0xe6, 0x11, 0xaa, 0x11, 0x1a, 0xb6, 0x75, 0x55,
+    0x57, 0x6b, 0xa1, 0x11, 0xa1, 0x11, 0x7e, 0x24, 0x30, 0x30, 0x03, 0x03, 0x00, 0x00, 0x30, 0x04,
+    0x81, 0x11, 0x1d, 0xb1, 0x16, 0x23, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, 0x22, 0x02, 0x30, 0x02,
+    0x02, 0x00, 0x20, 0x02, 0x04, 0x61, 0xa1, 0x64, 0x02, 0x00, 0x02, 0x04, 0x6a, 0x11, 0x50, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x30, 0x45, 0xa1, 0x1a, 0x11, 0xa7, 0xd9, 0x40, 0x30, 0x03,
+    0x33, 0x04, 0x9d, 0x7a, 0x11, 0xaa, 0x1a, 0x53, 0x22, 0x23, 0x00, 0x20, 0x02, 0x00, 0x20, 0x02,
+    0x05, 0x11, 0x16, 0x6a, 0x1a, 0xf0, 0x20, 0x30, 0x30, 0x32, 0x02, 0x32, 0x02, 0x24, 0x02, 0x20,
+    0x00, 0x02, 0x00, 0x22, 0x35, 0x1a, 0x1b, 0xe2, 0x03, 0x00, 0x33, 0x0c, 0x1a, 0xa6, 0x40, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0e, 0x61, 0x1a, 0x11, 0xbc, 0xf3, 0x00, 0x00, 0x34, 0x40,
+    0x03, 0x00, 0x00, 0x3f, 0xcb, 0x1a, 0xa1, 0x16, 0xf0, 0x30, 0x00, 0x20, 0x02, 0x00, 0x00, 0x23,
+    0x24, 0x61, 0xaa, 0xa1, 0x11, 0x80, 0x30, 0x30, 0x20, 0x03, 0x30, 0x02, 0x34, 0x00, 0x42, 0x03,
+    0x20, 0x00, 0x02, 0x30, 0x81, 0xa1, 0x18, 0x03, 0x22, 0x03, 0x00, 0xfb, 0x11, 0x18, 0x42, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x9b, 0x1a, 0xa1, 0xbc, 0x40, 0x00, 0x43, 0x22, 0x00, 0x02,
+    0x22, 0x02, 0x33, 0x02, 0x34, 0xcb, 0xa1, 0xa1, 0xb9, 0x03, 0x30, 0x02, 0x02, 0x20, 0x00, 0x00,
+    0x30, 0x81, 0x11, 0xa1, 0xa1, 0x52, 0x22, 0x00, 0x03, 0x02, 0x0e, 0x56, 0xbb, 0x6c, 0x42, 0x30,
+    0x20, 0x20, 0x22, 0x0f, 0xba, 0xaa, 0x52, 0x40, 0x20, 0x30, 0x23, 0x51, 0xa1, 0x70, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0x08, 0xa1, 0x11, 0x17, 0xf2, 0x23, 0x40, 0x00, 0x00, 0x20, 0x02,
+    0x00, 0x00, 0x00, 0x20, 0x23, 0x0f, 0x71, 0x1a, 0x1a, 0x83, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x02, 0x47, 0xaa, 0x1a, 0x11, 0x70, 0x30, 0x20, 0x30, 0x30, 0xca, 0x11, 0x11, 0x11, 0xb9, 0x20,
+    0x02, 0x20, 0x20, 0x4c, 0x1a, 0x1b, 0x40, 0x02, 0x23, 0x20, 0x2f, 0xb1, 0x11, 0x90, 0x40, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x1a, 0x1a, 0xd0, 0x42, 0x22, 0x02, 0x02, 0x22, 0x00, 0x00,
+    0x20, 0x00, 0x02, 0x20, 0x30, 0x24, 0x0d, 0xa1, 0xa1, 0x18, 0x24, 0x20, 0x20, 0x00, 0x02, 0x22,
+    0x20, 0x29, 0x11, 0x11, 0x11, 0xb4, 0x30, 0x20, 0x03, 0x05, 0x1a, 0x1a, 0x11, 0xaa, 0x11, 0x83,
+    0x02, 0x00, 0x02, 0xea, 0x11, 0x18, 0x03, 0x30, 0x00, 0x02, 0x25, 0x1a, 0x17, 0x32, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x29, 0xa1, 0xa1, 0xb9, 0x04, 0x20, 0x02, 0x00, 0x00, 0x22, 0x33, 0x33,
+    0x33, 0x20, 0x00, 0x02, 0x03, 0x00, 0x30, 0x9b, 0x1a, 0x1a, 0x90, 0x30, 0x00, 0x22, 0x00, 0x00,
+    0x02, 0x20, 0x71, 0xa1, 0x11, 0xae, 0x03, 0x02, 0x30, 0x81, 0xa1, 0x1a, 0x6b, 0x11, 0xa1, 0xbf,
+    0x00, 0x32, 0x00, 0x51, 0xa1, 0x70, 0x23, 0x03, 0x20, 0x30, 0x81, 0xa1, 0x19, 0x02, 0x20, 0x00,
+    0x20, 0x03, 0x00, 0x22, 0xfb, 0x11, 0x1b, 0xe2, 0x30, 0x30, 0x20, 0x02, 0x23, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x42, 0x00, 0x03, 0x00, 0x04, 0x0e, 0xb1, 0xa1, 0xbf, 0x32, 0x22, 0x20, 0x02, 0x02,
+    0x00, 0x30, 0x91, 0x11, 0x11, 0x18, 0x00, 0x30, 0x30, 0x71, 0xaa, 0x6f, 0x20, 0x8b, 0xaa, 0x1c,
+    0x22, 0x00, 0x3e, 0x11, 0x1a, 0xe0, 0x30, 0x30, 0x00, 0x2f, 0xb1, 0x11, 0x70, 0x22, 0x00, 0x03,
+    0x03, 0x00, 0x02, 0x20, 0x71, 0xa1, 0xbe, 0x02, 0x00, 0x02, 0x00, 0x30, 0x30, 0xf8, 0xc5, 0x77,
+    0x5c, 0x8f, 0x03, 0x22, 0x20, 0x04, 0x00, 0x33, 0xeb, 0x1a, 0x17, 0x30, 0x20, 0x20, 0x22, 0x02,
+    0x02, 0x04, 0x07, 0x11, 0x11, 0x1c, 0x03, 0x02, 0x0f, 0xb1, 0x1b, 0x43, 0x22, 0x38, 0x11, 0x16,
+    0x22, 0x34, 0x05, 0x1a, 0x15, 0x04, 0x00, 0x00, 0x30, 0x27, 0x1a, 0x11, 0xd0, 0x40, 0x20, 0x00,
+    0x03, 0x00, 0x24, 0x0c, 0x1a, 0x1a, 0x92, 0x30, 0x40, 0x30, 0x03, 0x03, 0x87, 0xa1, 0x11, 0x11,
+    0x11, 0x1b, 0x78, 0x40, 0x23, 0x02, 0x03, 0x20, 0x08, 0x11, 0x11, 0xd4, 0x20, 0x00, 0x30, 0x02,
+    0x30, 0x23, 0x0d, 0x1a, 0x11, 0x15, 0x23, 0x03, 0x2e, 0xa1, 0xa7, 0x33, 0x03, 0x00, 0x61, 0x1b,
+    0x20, 0x20, 0xfb, 0xa1, 0xae, 0x02, 0x00, 0x20, 0x30, 0xd1, 0xa1, 0xab, 0x44, 0x00, 0x00, 0x20,
+    0x22, 0x00, 0x30, 0xeb, 0x1a, 0x1c, 0x04, 0x02, 0x03, 0x03, 0x30, 0x86, 0x11, 0xaa, 0xaa, 0xaa,
+    0xab, 0xa1, 0x11, 0x69, 0x02, 0x20, 0x00, 0x23, 0x33, 0xc1, 0xa1, 0xbf, 0x03, 0x20, 0x30, 0x00,
+    0x20, 0x02, 0x3f, 0xb1, 0x1a, 0x17, 0x22, 0x02, 0x0e, 0x1a, 0x17, 0x00, 0x22, 0x32, 0x61, 0x1a,
+    0x20, 0x33, 0xc1, 0xa1, 0x70, 0x30, 0x22, 0x03, 0x0f, 0xb1, 0x1a, 0x17, 0x02, 0x03, 0x00, 0x20,
+    0x00, 0x20, 0x30, 0x51, 0xa1, 0x60, 0x23, 0x00, 0x02, 0x30, 0x45, 0x1a, 0xaa, 0x11, 0x11, 0x11,
+    0x11, 0x1a, 0xa1, 0x11, 0x53, 0x32, 0x22, 0x00, 0x20, 0x26, 0x1a, 0x15, 0x02, 0x00, 0x20, 0x20,
+    0x22, 0x02, 0x00, 0x71, 0x1a, 0x16, 0x20, 0x22, 0x0e, 0x1a, 0x15, 0x24, 0x30, 0x00, 0x61, 0xa1,
+    0x02, 0x03, 0x61, 0x11, 0x90, 0x40, 0x30, 0x03, 0x25, 0x1a, 0x11, 0x18, 0x32, 0x23, 0x00, 0x30,
+    0x00, 0x02, 0x0e, 0xaa, 0xa1, 0xe0, 0x30, 0x04, 0x20, 0x0f, 0x61, 0xa1, 0x11, 0xb5, 0xd9, 0xee,
+    0x9d, 0x5b, 0x11, 0xaa, 0x16, 0x42, 0x20, 0x20, 0x03, 0x29, 0xa1, 0xaa, 0xe0, 0x03, 0x00, 0x22,
+    0x20, 0x20, 0x42, 0x81, 0x11, 0x1b, 0x42, 0x32, 0x29, 0x1a, 0x15, 0x04, 0x00, 0x42, 0x61, 0x1a,
+    0x04, 0x29, 0x1a, 0x16, 0x33, 0x00, 0x20, 0x40, 0x9a, 0x11, 0x11, 0xbf, 0x03, 0x00, 0x20, 0x30,
+    0x32, 0x03, 0x05, 0x11, 0x15, 0x23, 0x20, 0x20, 0x00, 0xf6, 0xaa, 0x1a, 0xbd, 0x40, 0x22, 0x00,
+    0x00, 0x24, 0xdb, 0x1a, 0xa1, 0x64, 0x00, 0x32, 0x20, 0x30, 0x51, 0xa1, 0x53, 0x02, 0x00, 0x20,
+    0x02, 0x00, 0x02, 0xfb, 0x11, 0x1a, 0xf2, 0x32, 0x08, 0x1a, 0x1c, 0x02, 0x03, 0x00, 0x61, 0x11,
+    0x20, 0x25, 0x1a, 0x1d, 0x03, 0x20, 0x03, 0x02, 0x71, 0x11, 0xa1, 0x70, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x22, 0xfb, 0x11, 0xae, 0x02, 0x20, 0x00, 0x22, 0x71, 0xaa, 0x15, 0x40, 0x03, 0x33, 0x22,
+    0x33, 0x02, 0x04, 0x51, 0x1a, 0xa7, 0x02, 0x00, 0x02, 0x20, 0xea, 0x11, 0xbf, 0x20, 0x02, 0x20,
+    0x20, 0x03, 0x22, 0x37, 0x1a, 0x11, 0xe0, 0x32, 0x0d, 0x1a, 0x1d, 0x03, 0x02, 0x22, 0x61, 0x1a,
+    0x03, 0x4b, 0x11, 0xbf, 0x02, 0x00, 0x32, 0x09, 0xa1, 0x11, 0xa1, 0xc2, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xd1, 0xa1, 0x72, 0x32, 0x02, 0x03, 0x0c, 0x1a, 0x11, 0xc0, 0x22, 0x00, 0x00, 0x00,
+    0x20, 0x03, 0x30, 0x2c, 0x11, 0xa1, 0xc0, 0x40, 0x20, 0x03, 0x07, 0x1a, 0x1d, 0x03, 0x22, 0x00,
+    0x00, 0x30, 0x03, 0x0c, 0x11, 0x11, 0x90, 0x33, 0x0c, 0x1a, 0x18, 0x03, 0x00, 0x30, 0x61, 0x1a,
+    0x20, 0x81, 0xa1, 0x72, 0x02, 0x00, 0x03, 0x07, 0x11, 0x11, 0x11, 0x83, 0x22, 0x00, 0x00, 0x00,
+    0x20, 0x22, 0x71, 0xa1, 0x80, 0x23, 0x00, 0x22, 0xea, 0xa1, 0x1c, 0x04, 0x22, 0x00, 0x00, 0x00,
+    0x03, 0x02, 0x02, 0x33, 0xca, 0x11, 0xae, 0x04, 0x03, 0x02, 0x28, 0x1a, 0x17, 0x03, 0x22, 0x02,
+    0x00, 0x00, 0x22, 0x08, 0x11, 0x11, 0x80, 0x33, 0x25, 0x11, 0x19, 0x22, 0x22, 0x00, 0x61, 0x1b,
+    0x40, 0x51, 0xa1, 0xd0, 0x30, 0x02, 0x22, 0xea, 0x1a, 0x11, 0xaa, 0xe0, 0x22, 0x00, 0x00, 0x00,
+    0x03, 0x0f, 0xb1, 0x1b, 0x42, 0x02, 0x00, 0x30, 0x71, 0xa1, 0x73, 0x40, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x20, 0x30, 0x27, 0x1a, 0x17, 0x03, 0x03, 0x03, 0x04, 0xb1, 0x1b, 0x42, 0x00, 0x02,
+    0x02, 0x02, 0x20, 0x0e, 0xa1, 0x11, 0x82, 0x32, 0x07, 0x11, 0xaf, 0x20, 0x02, 0x04, 0xb1, 0x1b,
+    0x02, 0x61, 0x1a, 0xe0, 0x30, 0x02, 0x30, 0xc1, 0x11, 0x11, 0x1b, 0x40, 0x22, 0x00, 0x00, 0x00,
+    0x04, 0x09, 0x1a, 0x17, 0x03, 0x00, 0x22, 0x3e, 0xa1, 0x1b, 0xe0, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x32, 0x04, 0x0e, 0xb1, 0x1a, 0xe0, 0x20, 0x03, 0x00, 0x71, 0xa1, 0x90, 0x22, 0x00,
+    0x02, 0x02, 0x20, 0x24, 0xb1, 0xa1, 0xd2, 0x30, 0x4b, 0x11, 0xb4, 0x02, 0x03, 0x04, 0xb1, 0x16,
+    0x0f, 0xa1, 0x16, 0x02, 0x02, 0x02, 0x04, 0x61, 0xa1, 0xa1, 0x16, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x0c, 0x1a, 0x1d, 0x03, 0x00, 0x22, 0x0c, 0x1a, 0xa5, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x20, 0x40, 0x51, 0xb1, 0xc0, 0x22, 0x00, 0x40, 0xd1, 0xa1, 0xc0, 0x32, 0x00,
+    0x02, 0x20, 0x00, 0x02, 0x61, 0xa1, 0xd0, 0x30, 0xfa, 0x11, 0x70, 0x02, 0x03, 0x0f, 0xa1, 0x16,
+    0x28, 0x1a, 0x15, 0x03, 0x02, 0x03, 0x09, 0x1a, 0x16, 0xb1, 0x17, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x05, 0x1a, 0xa9, 0x03, 0x00, 0x22, 0x06, 0x1a, 0x1e, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x03, 0x00, 0x33, 0x20, 0xe1, 0x11, 0x63, 0x22, 0x00, 0x32, 0x91, 0xa1, 0x50, 0x30, 0x02,
+    0x20, 0x20, 0x22, 0x00, 0x71, 0xa1, 0xd0, 0x42, 0x81, 0xa1, 0x50, 0x40, 0x03, 0x2e, 0x11, 0x17,
+    0x0c, 0x1a, 0x1d, 0x32, 0x22, 0x03, 0x35, 0x1a, 0x15, 0xb1, 0x15, 0x33, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x27, 0x11, 0xbf, 0x23, 0x00, 0x30, 0xfb, 0x11, 0x62, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x03, 0x02, 0x00, 0x06, 0x11, 0xbf, 0x00, 0x22, 0x03, 0xfa, 0x11, 0x70, 0x20, 0x02,
+    0x20, 0x20, 0x23, 0x30, 0x51, 0xa1, 0xd2, 0x42, 0xc1, 0xa1, 0x80, 0x40, 0x23, 0x08, 0x1a, 0x15,
+    0x07, 0x11, 0x1e, 0x02, 0x02, 0x20, 0x4b, 0x11, 0xb8, 0xa1, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x26, 0x11, 0xb4, 0x00, 0x30, 0x20, 0x91, 0xa1, 0x70, 0x32, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x20, 0x20, 0x23, 0x27, 0x1a, 0x19, 0x02, 0x20, 0x20, 0x4b, 0x11, 0x63, 0x02, 0x30,
+    0x20, 0x22, 0x00, 0x30, 0x51, 0xa1, 0xd0, 0x40, 0x71, 0x1a, 0xe0, 0x20, 0x03, 0x0d, 0x1a, 0x1c,
+    0x36, 0x11, 0xb4, 0x02, 0x02, 0x30, 0x91, 0xa1, 0x7e, 0x1a, 0x1c, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x06, 0x11, 0x62, 0x22, 0x00, 0x20, 0x81, 0xa1, 0xc0, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x1a, 0x18, 0x04, 0x02, 0x20, 0x46, 0x11, 0x63, 0x03, 0x20,
+    0x02, 0x00, 0x02, 0x30, 0xc1, 0xa1, 0xd0, 0x24, 0xb1, 0x16, 0x23, 0x00, 0x04, 0x05, 0x11, 0x18,
+    0xfb, 0x11, 0x60, 0x20, 0x20, 0x30, 0xc1, 0xa1, 0x8e, 0x1a, 0x1c, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x4b, 0x11, 0x62, 0x00, 0x03, 0x32, 0x81, 0xa1, 0xc0, 0x32, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x1a, 0x1d, 0x02, 0x00, 0x32, 0x06, 0x11, 0x64, 0x00, 0x20,
+    0x02, 0x00, 0x00, 0x30, 0xc1, 0xa1, 0x80, 0x28, 0x1a, 0x17, 0x02, 0x02, 0x02, 0x07, 0x11, 0xae,
+    0x91, 0xa1, 0x50, 0x30, 0x00, 0x30, 0x61, 0x1a, 0xf9, 0x1a, 0x1c, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x4b, 0x11, 0x60, 0x02, 0x02, 0x20, 0x81, 0xa1, 0xc0, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x1a, 0x18, 0x20, 0x20, 0x22, 0x06, 0x11, 0x64, 0x00, 0x30,
+    0x02, 0x02, 0x00, 0x30, 0xc1, 0xa1, 0x80, 0x05, 0x1a, 0x1d, 0x24, 0x20, 0x30, 0x26, 0xa1, 0xb4,
+    0xd1, 0xa1, 0xc2, 0x30, 0x02, 0x0f, 0xb1, 0x16, 0x09, 0x1a, 0x15, 0x23, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x26, 0x11, 0x64, 0x03, 0x00, 0x23, 0x91, 0xa1, 0x52, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x05, 0x1a, 0x19, 0x22, 0x03, 0x02, 0x4b, 0x11, 0x60, 0x20, 0x30,
+    0x02, 0x02, 0x00, 0x30, 0x51, 0xa1, 0x90, 0x46, 0x11, 0xbf, 0x02, 0x20, 0x00, 0xfa, 0x11, 0x60,
+    0xc1, 0xa1, 0x82, 0x30, 0x22, 0x08, 0x1a, 0x15, 0x09, 0x1a, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x06, 0x11, 0xbf, 0x02, 0x22, 0x23, 0xfa, 0x11, 0x73, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x11, 0xbe, 0x03, 0x02, 0x02, 0xfb, 0x11, 0x60, 0x20, 0x20,
+    0x00, 0x02, 0x00, 0x30, 0x51, 0x11, 0x93, 0x91, 0x1a, 0x72, 0x00, 0x22, 0x22, 0x81, 0xa1, 0x50,
+    0x71, 0xa1, 0x90, 0x30, 0x02, 0x2c, 0x1a, 0x1d, 0x29, 0x1a, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x07, 0x11, 0x1e, 0x30, 0x20, 0x00, 0x36, 0x11, 0xbf, 0x03, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xfa, 0x11, 0x62, 0x03, 0x00, 0x32, 0xe1, 0xa1, 0x72, 0x30, 0x00,
+    0x00, 0x02, 0x00, 0x32, 0x71, 0x11, 0xe0, 0x71, 0xa1, 0xd0, 0x42, 0x02, 0x40, 0xc1, 0xa1, 0xd3,
+    0x71, 0x1a, 0xe0, 0x32, 0x02, 0x37, 0xa1, 0x1e, 0x09, 0x11, 0x16, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x2c, 0x1a, 0x1d, 0x22, 0x00, 0x23, 0x35, 0xaa, 0x1d, 0x20, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xd1, 0xa1, 0x50, 0x22, 0x00, 0x30, 0xd1, 0xa1, 0xc2, 0x32, 0x00,
+    0x00, 0x02, 0x00, 0x32, 0x61, 0x1b, 0xff, 0xb1, 0x1b, 0xf0, 0x02, 0x00, 0x23, 0x71, 0x1a, 0xe0,
+    0x6a, 0x1b, 0x43, 0x02, 0x22, 0x06, 0x11, 0xbf, 0x0e, 0xa1, 0x16, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x08, 0x1a, 0x15, 0x03, 0x00, 0x23, 0x08, 0x11, 0x16, 0x30, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x61, 0xa1, 0x92, 0x32, 0x02, 0x22, 0x51, 0xa1, 0x80, 0x32, 0x00,
+    0x00, 0x02, 0x00, 0x32, 0x61, 0x1b, 0x0d, 0x1a, 0x17, 0x03, 0x03, 0x02, 0x0f, 0xb1, 0x1b, 0x22,
+    0xb1, 0x1b, 0x42, 0x20, 0x20, 0xfb, 0x11, 0x60, 0x0f, 0xa1, 0x1a, 0xf0, 0x20, 0x00, 0x20, 0x00,
+    0x02, 0x2f, 0xa1, 0x16, 0x20, 0x20, 0x00, 0x22, 0x61, 0x11, 0xc0, 0x32, 0x03, 0x00, 0x20, 0x00,
+    0x20, 0x00, 0x03, 0x23, 0x2c, 0x1a, 0x16, 0x30, 0x20, 0x03, 0x02, 0x61, 0x1a, 0xf3, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x2f, 0xa1, 0x16, 0x26, 0x1a, 0x18, 0x03, 0x20, 0x32, 0x28, 0x1a, 0x17, 0x03,
+    0xb1, 0x16, 0x20, 0x22, 0x32, 0xea, 0x11, 0x70, 0x04, 0xb1, 0x11, 0x92, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x61, 0x1a, 0xe0, 0x30, 0x23, 0x00, 0xd1, 0xa1, 0xa9, 0x32, 0x20, 0x00, 0x20, 0x00,
+    0x02, 0x00, 0x00, 0x30, 0x9a, 0x11, 0x18, 0x02, 0x03, 0x00, 0x3e, 0x11, 0x16, 0x30, 0x00, 0x02,
+    0x00, 0x20, 0x24, 0x09, 0x11, 0x15, 0x81, 0xa1, 0x60, 0x00, 0x00, 0x03, 0x25, 0x11, 0xad, 0x03,
+    0xb1, 0x16, 0x00, 0x00, 0x20, 0x81, 0xa1, 0x52, 0x24, 0x61, 0xa1, 0xd0, 0x22, 0x00, 0x00, 0x00,
+    0x02, 0x40, 0xc1, 0xa1, 0xc3, 0x03, 0x00, 0x32, 0x07, 0x1a, 0x1b, 0xe0, 0x23, 0x42, 0x00, 0x22,
+    0x22, 0x03, 0x03, 0x2e, 0xb1, 0xa1, 0x72, 0x23, 0x20, 0x23, 0x25, 0x11, 0x1c, 0x03, 0x22, 0x22,
+    0x20, 0x30, 0x24, 0x0c, 0x1a, 0x1d, 0x71, 0xa1, 0xd0, 0x32, 0x02, 0x30, 0x46, 0x11, 0xbf, 0x22,
+    0xa1, 0x16, 0x22, 0x00, 0x30, 0xd1, 0xa1, 0xd2, 0x42, 0x61, 0xa1, 0x70, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xea, 0xa1, 0xb4, 0x20, 0x32, 0x20, 0x3f, 0xb1, 0xa1, 0xb8, 0x02, 0x03, 0x30, 0x00,
+    0x00, 0x40, 0x30, 0x8b, 0x1a, 0x1b, 0xe2, 0x30, 0x00, 0x30, 0x4b, 0x1a, 0xae, 0x02, 0x22, 0x00,
+    0x00, 0x22, 0x02, 0x07, 0x11, 0xa5, 0x1a, 0x16, 0x30, 0x00, 0x02, 0x20, 0x81, 0xaa, 0x70, 0x00,
+    0x11, 0x16, 0x02, 0x02, 0x32, 0xc1, 0xa1, 0x80, 0x40, 0x71, 0xa1, 0x64, 0x22, 0x20, 0x00, 0x00,
+    0x00, 0x03, 0x26, 0x11, 0x1d, 0x04, 0x00, 0x04, 0x30, 0x81, 0x1a, 0x1a, 0x5f, 0x03, 0x04, 0x23,
+    0x02, 0x30, 0x45, 0xa1, 0xa1, 0xa9, 0x03, 0x02, 0x20, 0x20, 0xd1, 0xa1, 0x70, 0x00, 0x22, 0x02,
+    0x00, 0x02, 0x22, 0x4b, 0x11, 0xbb, 0x11, 0x1d, 0x32, 0x30, 0x22, 0x20, 0x71, 0xa1, 0xd3, 0x20,
+    0x11, 0x16, 0x02, 0x00, 0x23, 0x51, 0x11, 0x90, 0x40, 0x51, 0xa1, 0x1e, 0x02, 0x20, 0x00, 0x00,
+    0x02, 0x03, 0x08, 0x1a, 0x1b, 0xf2, 0x22, 0x30, 0x03, 0x28, 0xa1, 0xa1, 0x1b, 0x59, 0xf0, 0x02,
+    0x04, 0x95, 0xb1, 0x1a, 0x1a, 0x83, 0x30, 0x02, 0x00, 0x34, 0xb1, 0x11, 0x80, 0x30, 0x03, 0x02,
+    0x22, 0x00, 0x42, 0xe1, 0x11, 0x11, 0x11, 0x60, 0x02, 0x00, 0x20, 0x3f, 0xa1, 0x1b, 0xf0, 0x20,
+    0xa1, 0x16, 0x22, 0x00, 0x22, 0x51, 0x11, 0x92, 0x40, 0xd1, 0xa1, 0x1c, 0x02, 0x20, 0x00, 0x00,
+    0x02, 0x00, 0x03, 0x61, 0xa1, 0x50, 0x30, 0x20, 0x22, 0x40, 0x9b, 0x11, 0xa1, 0xa1, 0xb6, 0x66,
+    0x6b, 0x11, 0xaa, 0x11, 0xb9, 0x02, 0x22, 0x02, 0x04, 0x05, 0x1a, 0x16, 0x02, 0x30, 0x00, 0x00,
+    0x22, 0x20, 0x30, 0x51, 0xa1, 0xa1, 0x1a, 0x92, 0x32, 0x03, 0x20, 0x0c, 0x1a, 0x15, 0x03, 0x30,
+    0xa1, 0x16, 0x22, 0x22, 0x32, 0x51, 0xa1, 0xe2, 0x30, 0x91, 0x1a, 0x16, 0x02, 0x20, 0x00, 0x20,
+    0x00, 0x03, 0x30, 0x81, 0x11, 0xaf, 0x32, 0x02, 0x00, 0x23, 0x0f, 0x71, 0x11, 0x1a, 0x11, 0x11,
+    0x11, 0xaa, 0x11, 0xa7, 0x40, 0x42, 0x02, 0x00, 0x30, 0x91, 0x11, 0x18, 0x02, 0x00, 0x20, 0x02,
+    0x00, 0x22, 0x00, 0x6a, 0x11, 0x1a, 0x15, 0x30, 0x00, 0x20, 0x03, 0xfb, 0x11, 0x19, 0x02, 0x00,
+    0xa1, 0x16, 0x02, 0x00, 0x33, 0x51, 0x1a, 0xe0, 0x23, 0xfa, 0x11, 0x11, 0x92, 0x32, 0x02, 0x00,
+    0x00, 0x20, 0x02, 0x27, 0x11, 0x1e, 0x23, 0x02, 0x00, 0x02, 0x02, 0x09, 0x7b, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0xa7, 0x90, 0x23, 0x00, 0x30, 0x22, 0x0f, 0x61, 0xa1, 0x70, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x29, 0x1a, 0x11, 0x11, 0xbf, 0x02, 0x20, 0x20, 0x30, 0xc1, 0xaa, 0x60, 0x20, 0x00,
+    0xb1, 0x1b, 0xf0, 0x34, 0x30, 0x61, 0x1a, 0xf0, 0x30, 0x36, 0x11, 0xa1, 0x54, 0x00, 0x30, 0x02,
+    0x03, 0x00, 0x22, 0x3f, 0x7a, 0x50, 0x00, 0x30, 0x30, 0x20, 0x03, 0x00, 0x2f, 0xd7, 0x6b, 0xbb,
+    0xb6, 0x7d, 0xf0, 0x03, 0x30, 0x34, 0x00, 0x22, 0x47, 0x11, 0xab, 0xf0, 0x22, 0x00, 0x00, 0x00,
+    0x20, 0x04, 0x25, 0x11, 0x11, 0x11, 0x80, 0x32, 0x02, 0x02, 0x04, 0xb1, 0xa1, 0x82, 0x22, 0x20,
+    0x71, 0xa1, 0x70, 0x03, 0x0d, 0x1a, 0x16, 0x03, 0x22, 0x07, 0x11, 0x11, 0xbf, 0x23, 0x02, 0x02,
+    0x20, 0x22, 0x20, 0x20, 0x33, 0x04, 0x02, 0x02, 0x30, 0x02, 0x20, 0x24, 0x30, 0x32, 0x04, 0xff,
+    0x42, 0x32, 0x03, 0x30, 0x00, 0x00, 0x32, 0x40, 0x71, 0xa1, 0x18, 0x03, 0x20, 0x00, 0x00, 0x00,
+    0x20, 0x30, 0xfa, 0x11, 0x1a, 0x15, 0x33, 0x02, 0x20, 0x04, 0x0c, 0x11, 0x16, 0x30, 0x00, 0x22,
+    0x9a, 0x11, 0x16, 0x5c, 0x61, 0x1a, 0xac, 0x02, 0x03, 0x2c, 0x1a, 0x1a, 0x1c, 0x32, 0x23, 0x00,
+    0x00, 0x20, 0x03, 0x04, 0x03, 0x20, 0x03, 0xf3, 0x03, 0x20, 0x03, 0x00, 0x03, 0x32, 0x32, 0x02,
+    0x02, 0x00, 0x32, 0x02, 0x20, 0x30, 0x30, 0x07, 0x1a, 0xa1, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0xc1, 0xa1, 0xa1, 0x70, 0x02, 0x00, 0x03, 0x40, 0xeb, 0x11, 0x18, 0x00, 0x30, 0x02,
+    0x05, 0x1a, 0xa1, 0x11, 0x1a, 0xa1, 0x64, 0x03, 0x02, 0x39, 0x1a, 0x11, 0x1b, 0xf0, 0x30, 0x23,
+    0x03, 0x02, 0x02, 0x00, 0x02, 0x00, 0x47, 0x17, 0xf2, 0x04, 0x00, 0x03, 0x20, 0x02, 0x20, 0x22,
+    0x20, 0x00, 0x00, 0x00, 0x20, 0x22, 0x0f, 0x61, 0xa1, 0x15, 0x03, 0x23, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x3f, 0xb1, 0x11, 0x16, 0xf3, 0x30, 0x22, 0x00, 0x02, 0x71, 0xaa, 0x72, 0x22, 0x00, 0x00,
+    0x20, 0x51, 0xa1, 0xaa, 0xa1, 0x16, 0xf3, 0x00, 0x20, 0x24, 0xb1, 0x11, 0xa1, 0x52, 0x40, 0x00,
+    0x22, 0x02, 0x30, 0x23, 0x02, 0x40, 0x81, 0x11, 0xb8, 0x00, 0x42, 0x22, 0x02, 0x32, 0x00, 0x30,
+    0x00, 0x22, 0x02, 0x30, 0x23, 0x02, 0x8b, 0x1a, 0xa1, 0x53, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x0c, 0x11, 0xa1, 0xbe, 0x20, 0x20, 0x00, 0x22, 0x3d, 0xaa, 0x1a, 0xe2, 0x30, 0x00, 0x20,
+    0x00, 0x38, 0x6a, 0x11, 0x1b, 0xc4, 0x02, 0x20, 0x00, 0x22, 0x71, 0x11, 0x11, 0xae, 0x03, 0x23,
+    0x02, 0x30, 0x23, 0x00, 0x20, 0x22, 0x91, 0xaa, 0x11, 0x7e, 0x00, 0x32, 0x30, 0x00, 0x22, 0x00,
+    0x23, 0x00, 0x00, 0x33, 0x20, 0xf7, 0x1a, 0x1a, 0x15, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0xea, 0x11, 0x1b, 0xe3, 0x23, 0x03, 0x30, 0x02, 0xfb, 0x1a, 0x1c, 0x02, 0x00, 0x42, 0x02,
+    0x30, 0x20, 0x2f, 0x99, 0xe4, 0x20, 0x20, 0x02, 0x02, 0x22, 0xc1, 0x11, 0x1a, 0x17, 0x04, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x20, 0x32, 0x2d, 0xa1, 0xaa, 0x1b, 0x5e, 0x02, 0x20, 0x43, 0x23, 0x03,
+    0x32, 0x24, 0x30, 0x20, 0xf5, 0xa1, 0xaa, 0x1a, 0xd0, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x32, 0x71, 0xa1, 0xbe, 0x02, 0x02, 0x00, 0x03, 0x32, 0x61, 0xa1, 0x64, 0x22, 0x30, 0x00, 0x30,
+    0x00, 0x00, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x03, 0x20, 0x91, 0x11, 0x11, 0x11, 0x80, 0x40,
+    0x20, 0x02, 0x20, 0x20, 0x00, 0x20, 0x30, 0x96, 0x11, 0xa1, 0x1a, 0x7d, 0xf0, 0x02, 0x00, 0x02,
+    0x20, 0x02, 0x3f, 0xd7, 0xa1, 0x1a, 0x11, 0x69, 0x22, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x23,
+    0x0d, 0x1a, 0x1a, 0xe2, 0x33, 0x02, 0x00, 0x33, 0x05, 0x1a, 0x1a, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0x46, 0x11, 0x11, 0xa1, 0xbf, 0x03,
+    0x03, 0x30, 0x03, 0x03, 0x20, 0x00, 0x23, 0x04, 0x5a, 0x1a, 0x11, 0x11, 0xb6, 0x5c, 0x89, 0xee,
+    0x98, 0xc5, 0x6a, 0x11, 0x1a, 0xa1, 0xa5, 0x40, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x30,
+    0xfb, 0x1a, 0x1c, 0x03, 0x02, 0x20, 0x02, 0x20, 0xc1, 0x1a, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x05, 0x1a, 0x11, 0x1a, 0x17, 0x04,
+    0x30, 0x02, 0x20, 0x30, 0x02, 0x22, 0x00, 0x23, 0x3e, 0x7a, 0xa1, 0xaa, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0xaa, 0x11, 0xa7, 0xe3, 0x22, 0x22, 0x00, 0x00, 0x00, 0x23, 0x03, 0x20, 0x03,
+    0x71, 0xa1, 0x63, 0x30, 0x20, 0x02, 0x22, 0x08, 0xaa, 0x11, 0x72, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x38, 0x11, 0x1b, 0xa1, 0x11, 0xc0,
+    0x30, 0x20, 0x30, 0x00, 0x03, 0x00, 0x40, 0x02, 0x20, 0x2e, 0x5b, 0x11, 0xa1, 0xaa, 0xaa, 0x1a,
+    0xaa, 0xaa, 0x11, 0x11, 0xb5, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x04, 0x0c,
+    0x11, 0x1a, 0x90, 0x30, 0x03, 0x00, 0x22, 0xfb, 0x11, 0xa6, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x24, 0xb1, 0x1b, 0x51, 0x1a, 0x18,
+    0x23, 0x00, 0x02, 0x03, 0x02, 0x30, 0x02, 0x20, 0x33, 0x32, 0x34, 0x85, 0x6b, 0x11, 0x1a, 0x11,
+    0x11, 0x11, 0xb6, 0x58, 0x40, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x40, 0xd1,
+    0x1a, 0x1c, 0x23, 0x00, 0x30, 0x00, 0x20, 0x91, 0x11, 0xbf, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x32, 0x51, 0xa1, 0xc5, 0x1a, 0x1a,
+    0x93, 0x32, 0x02, 0x20, 0x30, 0x23, 0x02, 0x02, 0x02, 0x02, 0x33, 0x03, 0x0f, 0x9d, 0xc5, 0x55,
+    0x5c, 0xd9, 0xf3, 0x20, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x09, 0xa1,
+    0x11, 0x70, 0x32, 0x03, 0x02, 0x23, 0x33, 0x27, 0x16, 0xe0, 0x40, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x23, 0x9a, 0x11, 0x6f, 0x61, 0x11,
+    0xa9, 0x03, 0x00, 0x20, 0x20, 0x00, 0x00, 0x02, 0x20, 0x23, 0x02, 0x04, 0x22, 0x20, 0x02, 0x02,
+    0x20, 0x02, 0x20, 0x32, 0x00, 0x04, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0x9b, 0x1a,
+    0xa6, 0x42, 0x20, 0x20, 0x23, 0x30, 0x30, 0x24, 0xf4, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1a, 0x18, 0xfb, 0x11,
+    0x1b, 0x90, 0x40, 0x02, 0x02, 0x20, 0x00, 0x20, 0x00, 0x00, 0x22, 0x00, 0x20, 0x33, 0x33, 0x24,
+    0x34, 0x33, 0x20, 0x20, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0xb1, 0xa1,
+    0xbe, 0x22, 0x03, 0x03, 0x0f, 0x56, 0x80, 0x32, 0x02, 0x30, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x08, 0x1a, 0x16, 0x39, 0xa1,
+    0xa1, 0xa9, 0x04, 0x03, 0x00, 0x20, 0x22, 0x02, 0x20, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x02, 0x30, 0x02, 0x40, 0x8a, 0x1a, 0x1a,
+    0x90, 0x40, 0x02, 0x22, 0x8b, 0x11, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x33, 0x04, 0x61, 0xa1, 0x83, 0x9a,
+    0x1a, 0xa1, 0xd2, 0x30, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x32, 0x02, 0x22, 0x02, 0x02, 0x22, 0x3d, 0xa1, 0xa1, 0xa9,
+    0x30, 0x04, 0x30, 0x45, 0x11, 0xa1, 0xaf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x40, 0xd1, 0xa1, 0x60, 0x09,
+    0xb1, 0xaa, 0x15, 0x20, 0x40, 0x20, 0x04, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x00, 0x02, 0x02, 0x20, 0x43, 0x23, 0x51, 0x1a, 0x1b, 0x90,
+    0x23, 0x20, 0x08, 0xb1, 0xaa, 0x11, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x30, 0x23, 0x4b, 0xaa, 0x18, 0x00,
+    0xeb, 0x11, 0xa1, 0x6e, 0x04, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x22, 0x00, 0x30, 0x04, 0x00, 0xe6, 0x1a, 0xa1, 0xbe, 0x04,
+    0x22, 0x39, 0x61, 0x1a, 0x11, 0xb9, 0x32, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x22, 0x00, 0x3d, 0x11, 0x16, 0x43,
+    0x0f, 0x61, 0x1a, 0x1b, 0xc0, 0x34, 0x30, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0x20, 0x32, 0x04, 0x22, 0x2c, 0xa1, 0x1a, 0x16, 0xf3, 0x40,
+    0x29, 0x71, 0x1a, 0xa1, 0xa5, 0xf0, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x33, 0x04, 0x61, 0xa1, 0xc0,
+    0x42, 0x47, 0xa1, 0xa1, 0x16, 0x92, 0x20, 0x42, 0x22, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x29, 0x61, 0x1a, 0xa1, 0x74, 0x00, 0x48,
+    0x71, 0x1a, 0x11, 0x16, 0x80, 0x23, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x30, 0x00, 0x30, 0x81, 0x11, 0xbe,
+    0x03, 0x00, 0xdb, 0x11, 0xa1, 0x17, 0xe3, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x34, 0x03, 0x3e, 0x71, 0x1a, 0x1a, 0xad, 0x03, 0xec, 0x61,
+    0x11, 0xa1, 0x1b, 0xc4, 0x20, 0x30, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x22, 0x03, 0x04, 0x27, 0x1a, 0x16,
+    0x03, 0x23, 0x0e, 0x61, 0x1a, 0x1a, 0xa7, 0x92, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x20, 0x39, 0x7a, 0x11, 0x11, 0x17, 0xf4, 0xd7, 0xa1, 0x11,
+    0xa1, 0x1b, 0xcf, 0x02, 0x32, 0x20, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0xb1, 0x11,
+    0xc0, 0x40, 0x30, 0x2d, 0xb1, 0x1a, 0x11, 0x16, 0xdf, 0x00, 0x03, 0x33, 0x40, 0x22, 0x00, 0x23,
+    0x02, 0x22, 0x23, 0x33, 0x02, 0x00, 0xfd, 0x61, 0x11, 0xa1, 0x1b, 0x7c, 0x7a, 0x11, 0x1a, 0x11,
+    0x1b, 0xcf, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0xd1, 0xa1,
+    0x18, 0x03, 0x30, 0x30, 0xf5, 0xa1, 0xa1, 0xa1, 0x1a, 0x7c, 0xe2, 0x03, 0x00, 0x32, 0x02, 0x20,
+    0x02, 0x00, 0x22, 0x00, 0x4e, 0xd7, 0xb1, 0x11, 0x11, 0x11, 0xaa, 0xb1, 0x11, 0xaa, 0x11, 0xa6,
+    0xd4, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x07, 0x1a,
+    0x1b, 0xf0, 0x30, 0x04, 0x02, 0xf5, 0xb1, 0x1a, 0xa1, 0x1a, 0xab, 0x7c, 0x8e, 0xf4, 0x32, 0x00,
+    0x02, 0x4f, 0xe8, 0xc7, 0xba, 0x11, 0x11, 0x1a, 0x11, 0x11, 0x11, 0x1a, 0x11, 0x11, 0xb5, 0xe2,
+    0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x2f, 0xb1,
+    0xaa, 0x63, 0x22, 0x20, 0x22, 0x02, 0xfc, 0x61, 0x1a, 0xaa, 0x11, 0xa1, 0x1a, 0xab, 0x66, 0x66,
+    0x66, 0xba, 0x11, 0xa1, 0x11, 0xaa, 0x11, 0x11, 0x11, 0x1a, 0x11, 0x1a, 0xa6, 0x59, 0x33, 0x30,
+    0x42, 0x03, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x32, 0x9a,
+    0x1a, 0x17, 0x20, 0x22, 0x30, 0x33, 0x00, 0x39, 0x5a, 0x11, 0xa1, 0x1a, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x1a, 0xaa, 0xaa, 0xa1, 0x1a, 0xaa, 0x11, 0x11, 0x11, 0x1b, 0x7c, 0x92, 0x02, 0x22, 0x30,
+    0x20, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x0d,
+    0xa1, 0xaa, 0x73, 0x23, 0x02, 0x02, 0x33, 0x22, 0x2e, 0x71, 0x11, 0xa1, 0x11, 0x11, 0x1a, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xb6, 0x5d, 0xe3, 0x00, 0x20, 0x40, 0x00, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x40,
+    0x51, 0xaa, 0x17, 0x20, 0x23, 0x02, 0x20, 0x03, 0x40, 0x38, 0x61, 0x11, 0xa1, 0x11, 0x11, 0x1b,
+    0xbb, 0xbb, 0xbb, 0xbb, 0x66, 0x77, 0xcd, 0x9e, 0x30, 0x02, 0x20, 0x33, 0x22, 0x03, 0x03, 0x00,
+    0x22, 0x02, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x20, 0x22,
+    0x25, 0x11, 0x11, 0x74, 0x22, 0x00, 0x02, 0x20, 0x04, 0x00, 0x38, 0x61, 0x11, 0xa1, 0x11, 0x1b,
+    0x7c, 0x9f, 0x30, 0x20, 0x20, 0x00, 0x00, 0x20, 0x23, 0x32, 0x22, 0x20, 0x02, 0x00, 0x30, 0x22,
+    0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x71, 0x1a, 0x16, 0xf2, 0x33, 0x00, 0x32, 0x20, 0x03, 0x32, 0x39, 0x7a, 0x11, 0x1a, 0xa1,
+    0x11, 0xab, 0x75, 0xd9, 0xef, 0x44, 0x33, 0x00, 0x03, 0x03, 0x20, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x05, 0x1a, 0xa1, 0xb8, 0x04, 0x22, 0x20, 0x00, 0x30, 0x03, 0x02, 0x0e, 0xc6, 0xa1, 0x11,
+    0xaa, 0xa1, 0x11, 0xa1, 0x1b, 0xbb, 0x66, 0x67, 0x82, 0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x20, 0x51, 0x11, 0xa1, 0x53, 0x04, 0x23, 0x30, 0x22, 0x02, 0x33, 0x40, 0x03, 0xec, 0x6b,
+    0x11, 0x11, 0x1a, 0xaa, 0x11, 0x11, 0x1a, 0x1a, 0x16, 0xe3, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0x2d, 0x1a, 0xaa, 0x16, 0x90, 0x03, 0x22, 0x00, 0x20, 0x02, 0x02, 0x40, 0x22, 0x0f,
+    0x8c, 0x7b, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa1, 0x6f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x03, 0x32, 0x9b, 0x1a, 0xa1, 0xa5, 0xf2, 0x24, 0x00, 0x32, 0x02, 0x02, 0x20, 0x24, 0x22,
+    0x02, 0x04, 0xe8, 0xd5, 0x76, 0x66, 0xbb, 0xb1, 0x1a, 0x17, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x23, 0x2f, 0x71, 0x1a, 0xa1, 0xac, 0x43, 0x03, 0x00, 0x20, 0x20, 0x02, 0x20, 0x02,
+    0x33, 0x32, 0x00, 0x03, 0x20, 0x00, 0x43, 0x4c, 0xa1, 0x1a, 0xe2, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x03, 0x02, 0x22, 0x0d, 0xb1, 0x11, 0xa1, 0xbc, 0xf2, 0x32, 0x23, 0x22, 0x00, 0x32, 0x02,
+    0x00, 0x00, 0x23, 0x33, 0x03, 0x03, 0x00, 0x30, 0x51, 0xa1, 0xd2, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x20, 0x32, 0x03, 0x32, 0xf7, 0x1a, 0x1a, 0x11, 0xb5, 0x93, 0x00, 0x02, 0x40, 0x03, 0x00,
+    0x20, 0x02, 0x00, 0x00, 0x20, 0x30, 0x23, 0x30, 0x9a, 0xa1, 0x50, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x96, 0x11, 0x1a, 0x11, 0x16, 0xc9, 0x22, 0x22, 0x33, 0x33,
+    0x30, 0x22, 0x00, 0x20, 0x20, 0x00, 0x32, 0x32, 0x91, 0xa1, 0x50, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x00, 0x97, 0x11, 0xaa, 0x11, 0x11, 0x67, 0xde, 0x30, 0x00,
+    0x00, 0x22, 0x03, 0x42, 0x24, 0x34, 0x32, 0x40, 0xc1, 0xa1, 0xc2, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0x02, 0x97, 0xb1, 0x1a, 0xa1, 0x1a, 0x11, 0xb7, 0xcd,
+    0x9f, 0x43, 0x20, 0x02, 0x22, 0x00, 0x33, 0x09, 0xb1, 0x11, 0x90, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x02, 0x40, 0x02, 0xfd, 0x6a, 0x11, 0x1a, 0xa1, 0x11, 0x1a,
+    0x1a, 0xb6, 0x77, 0x55, 0xcc, 0xcc, 0xcc, 0x7b, 0x1a, 0x16, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x22, 0x02, 0x2e, 0xc7, 0xaa, 0x11, 0x11, 0xaa,
+    0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xa1, 0xa9, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x30, 0x30, 0x03, 0x00, 0x02, 0xf8, 0x57, 0xb1, 0x11,
+    0x11, 0x11, 0x1a, 0xaa, 0xaa, 0xaa, 0x1a, 0xa1, 0x1b, 0x90, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x02, 0x02, 0x00, 0x20, 0x24, 0x40, 0x03, 0x30, 0x4e, 0x8c,
+    0x57, 0x6b, 0xba, 0x11, 0x11, 0x11, 0x1a, 0xb7, 0xd4, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x22, 0x22, 0x00, 0x20, 0x20, 0x20, 0x02, 0x22, 0x32, 0x00, 0x00,
+    0x00, 0x04, 0xfe, 0x99, 0x88, 0x88, 0x89, 0x40, 0x03, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const tIndexedImage vortex = { image_data_vortex, 128, 128,
+    4, palette_vortex };
+
+#endif /* IDX_VORTEX_H_ */
@@ -0,0 +1,537 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: water
+* size: 128x128, 4 bits per pixel, 16 cores
+*******************************************************************************/
+
+#ifndef IDX_WATER_H_
+#define IDX_WATER_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_water[48] = {
+    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0x01, 0x01, 0x01, 0xf0, 0xf0, 0xf0, 0x04,
+    0x04, 0x04, 0x89, 0x89, 0x89, 0xa3, 0xa3, 0xa3, 0x0e, 0x0e, 0x0e, 0x24, 0x24, 0x24, 0xbb, 0xbb,
+    0xbb, 0xcf, 0xcf, 0xcf, 0x3c, 0x3c, 0x3c, 0x4f, 0x4f, 0x4f, 0x62, 0x62, 0x62, 0x75, 0x75, 0x75
+};
+
+static const uint8_t image_data_water[8192] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
+    0x11, 0x01, 0x00, 0x00, 0x10, 0x12, 0x20, 0x10, 0x02, 0x4a, 0x7f, 0xdc, 0x99, 0x85, 0x53, 0x55,
+    0x89, 0xcd, 0xe6, 0xab, 0x20, 0x00, 0x00, 0x22, 0x20, 0x00, 0x00, 0x10, 0x01, 0x01, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x11, 0x00,
+    0x01, 0x00, 0x01, 0x01, 0x21, 0x11, 0x02, 0xb7, 0xec, 0x83, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x35, 0x9d, 0xfa, 0x42, 0x10, 0x01, 0x22, 0x10, 0x01, 0x01, 0x10, 0x11, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x11, 0x00, 0x02,
+    0x10, 0x10, 0x02, 0x02, 0x10, 0x47, 0xe9, 0x33, 0x33, 0x33, 0x35, 0x55, 0x33, 0x33, 0x33, 0x33,
+    0x53, 0x33, 0x55, 0x33, 0x35, 0x33, 0x8c, 0x6b, 0x20, 0x00, 0x20, 0x01, 0x20, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x02, 0x01, 0x14, 0x7d, 0x83, 0x33, 0x55, 0x33, 0x35, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x55, 0x55, 0x35, 0x33, 0x35, 0x33, 0x33, 0x9f, 0xb1, 0x02, 0x20, 0x10, 0x20, 0x12, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x01,
+    0x02, 0x01, 0x2b, 0xe8, 0x33, 0x35, 0x53, 0x35, 0x55, 0x33, 0x35, 0x53, 0x35, 0x55, 0x58, 0x85,
+    0x55, 0x33, 0x33, 0x33, 0x55, 0x55, 0x35, 0x55, 0x33, 0x5c, 0x74, 0x02, 0x12, 0x10, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x21,
+    0x10, 0x1a, 0xc3, 0x33, 0x55, 0x53, 0x35, 0x53, 0x33, 0x59, 0xce, 0x67, 0xab, 0xb4, 0x44, 0x4b,
+    0xba, 0xa7, 0xfd, 0x98, 0x33, 0x33, 0x35, 0x53, 0x55, 0x33, 0x39, 0xf4, 0x10, 0x10, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x02, 0x20,
+    0x27, 0xc3, 0x33, 0x55, 0x35, 0x33, 0x53, 0x8c, 0xf7, 0xb2, 0x10, 0x00, 0x00, 0x01, 0x11, 0x00,
+    0x00, 0x10, 0x00, 0x24, 0xb7, 0xd9, 0x33, 0x33, 0x55, 0x35, 0x35, 0x58, 0xf4, 0x20, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x20, 0x0a,
+    0xc3, 0x35, 0x33, 0x35, 0x35, 0x38, 0xe7, 0x40, 0x10, 0x00, 0x22, 0x22, 0x22, 0x12, 0x22, 0x21,
+    0x10, 0x22, 0x22, 0x01, 0x10, 0x02, 0xb6, 0xc5, 0x33, 0x35, 0x33, 0x53, 0x38, 0xf4, 0x12, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x10, 0x1b, 0xd3,
+    0x33, 0x53, 0x35, 0x33, 0x8d, 0xa4, 0x10, 0x02, 0x22, 0x22, 0x21, 0x00, 0x01, 0x11, 0x00, 0x21,
+    0x01, 0x10, 0x12, 0x12, 0x22, 0x00, 0x10, 0x0b, 0x69, 0x33, 0x35, 0x53, 0x53, 0x39, 0x70, 0x20,
+    0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x20, 0x11, 0x22, 0x68, 0x35,
+    0x53, 0x33, 0x33, 0x96, 0x42, 0x01, 0x12, 0x20, 0x02, 0x00, 0x02, 0x00, 0x10, 0x14, 0xab, 0x20,
+    0x10, 0x01, 0x01, 0x10, 0x00, 0x22, 0x22, 0x11, 0x12, 0xad, 0x53, 0x35, 0x33, 0x53, 0x3c, 0xb2,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x01, 0x10, 0xb9, 0x33, 0x33,
+    0x35, 0x35, 0xc7, 0x20, 0x01, 0x22, 0x10, 0x02, 0x14, 0x76, 0xb0, 0x10, 0x02, 0x49, 0x53, 0xe2,
+    0x10, 0x02, 0x0b, 0xf6, 0xb4, 0x00, 0x01, 0x20, 0x21, 0x21, 0xbe, 0x83, 0x35, 0x33, 0x53, 0x56,
+    0x12, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x16, 0x53, 0x55, 0x33,
+    0x33, 0x9a, 0x20, 0x02, 0x22, 0x00, 0x04, 0xaf, 0x98, 0x33, 0x5b, 0x10, 0x11, 0xf3, 0x55, 0x3a,
+    0x02, 0x21, 0xa5, 0x33, 0x38, 0xd6, 0xb1, 0x11, 0x11, 0x21, 0x12, 0x4e, 0x53, 0x55, 0x35, 0x33,
+    0xc4, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x12, 0x14, 0xd3, 0x53, 0x33, 0x53,
+    0x97, 0x20, 0x22, 0x20, 0x00, 0x4a, 0xe8, 0x35, 0x33, 0x55, 0x3d, 0x01, 0x20, 0xd3, 0x55, 0x37,
+    0x12, 0x10, 0xd3, 0x55, 0x33, 0x33, 0x5c, 0x6b, 0x02, 0x01, 0x20, 0x20, 0xbc, 0x33, 0x33, 0x35,
+    0x38, 0xa0, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x20, 0xb9, 0x35, 0x33, 0x53, 0x5e,
+    0x40, 0x12, 0x22, 0x02, 0x4f, 0x93, 0x33, 0x55, 0x33, 0x35, 0x3d, 0x12, 0x21, 0x73, 0x53, 0x94,
+    0x02, 0x11, 0xd3, 0x53, 0x55, 0x53, 0x35, 0x35, 0xda, 0x21, 0x02, 0x21, 0x00, 0x79, 0x33, 0x53,
+    0x53, 0x3f, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x53, 0x53, 0x35, 0x39, 0xb2,
+    0x11, 0x22, 0x00, 0xbe, 0x83, 0x35, 0x33, 0x53, 0x53, 0x35, 0x37, 0x02, 0x01, 0x06, 0xcd, 0xb1,
+    0x20, 0x20, 0xa3, 0x55, 0x33, 0x53, 0x55, 0x35, 0x33, 0x97, 0x20, 0x12, 0x12, 0x24, 0xe3, 0x35,
+    0x35, 0x53, 0xd4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x63, 0x55, 0x35, 0x53, 0xf4, 0x11,
+    0x21, 0x01, 0xbd, 0x33, 0x35, 0x33, 0x55, 0x35, 0x35, 0x9e, 0xa0, 0x20, 0x20, 0x10, 0x01, 0x10,
+    0x01, 0x01, 0x0b, 0xfd, 0x83, 0x33, 0x33, 0x53, 0x35, 0x33, 0x97, 0x20, 0x20, 0x12, 0x0a, 0x83,
+    0x53, 0x55, 0x3c, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x0f, 0x35, 0x33, 0x33, 0x87, 0x02, 0x21,
+    0x11, 0x4e, 0x53, 0x55, 0x33, 0x53, 0x35, 0x8d, 0x7b, 0x11, 0x10, 0x10, 0x00, 0x01, 0x11, 0x11,
+    0x00, 0x00, 0x00, 0x11, 0x4a, 0xf9, 0x33, 0x35, 0x33, 0x35, 0x33, 0x9a, 0x10, 0x21, 0x10, 0x4c,
+    0x35, 0x33, 0x53, 0x9b, 0x12, 0x01, 0x01, 0x10, 0x27, 0xec, 0xcd, 0x74, 0x12, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x21, 0x20, 0xe5, 0x53, 0x53, 0x39, 0xb1, 0x20, 0x21,
+    0x17, 0x85, 0x35, 0x35, 0x55, 0x35, 0xd7, 0x41, 0x20, 0x02, 0x10, 0x11, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x02, 0xbf, 0x93, 0x33, 0x33, 0x55, 0x33, 0xe4, 0x02, 0x22, 0x00,
+    0xf3, 0x55, 0x35, 0x59, 0xb1, 0x20, 0x02, 0x1a, 0x93, 0x35, 0x33, 0x59, 0xa0, 0x21, 0x10, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x22, 0x02, 0x0f, 0x33, 0x35, 0x53, 0xd4, 0x01, 0x12, 0x04,
+    0xd3, 0x55, 0x33, 0x53, 0x58, 0xfb, 0x02, 0x01, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x20, 0x47, 0xc3, 0x35, 0x33, 0x35, 0x58, 0x70, 0x01, 0x02,
+    0x07, 0x53, 0x33, 0x53, 0x9b, 0x12, 0x21, 0xa5, 0x35, 0x33, 0x55, 0x35, 0x37, 0x00, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x21, 0xf3, 0x55, 0x33, 0x3e, 0x10, 0x22, 0x00, 0x78,
+    0x35, 0x33, 0x53, 0x38, 0x64, 0x12, 0x12, 0x12, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x01, 0x0a, 0xc3, 0x33, 0x33, 0x35, 0x3e, 0x42, 0x20,
+    0x21, 0xa8, 0x35, 0x35, 0x59, 0x40, 0x0b, 0x83, 0x53, 0x55, 0x55, 0x35, 0x55, 0xb1, 0x22, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x12, 0x06, 0x35, 0x33, 0x53, 0xf0, 0x02, 0x01, 0x2f, 0x33,
+    0x55, 0x33, 0x35, 0xf4, 0x20, 0x21, 0x00, 0x10, 0x22, 0x10, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x12, 0x21, 0x0a, 0xc3, 0x35, 0x33, 0x33, 0x9b, 0x12,
+    0x02, 0x0b, 0x83, 0x53, 0x35, 0x94, 0x0f, 0x35, 0x33, 0x33, 0x33, 0x33, 0x53, 0xd0, 0x20, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0x75, 0x53, 0x55, 0x3f, 0x12, 0x12, 0x14, 0xc3, 0x53,
+    0x33, 0x55, 0xd4, 0x01, 0x02, 0x10, 0x12, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x11, 0x02, 0x02, 0x26, 0x83, 0x35, 0x33, 0x38, 0xa0,
+    0x20, 0x21, 0xb8, 0x53, 0x35, 0x5d, 0x49, 0x33, 0x33, 0x97, 0xac, 0x35, 0x35, 0x8b, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x1b, 0x53, 0x33, 0x35, 0xf0, 0x20, 0x20, 0xb9, 0x35, 0x33,
+    0x53, 0x87, 0x01, 0x12, 0x02, 0x01, 0x00, 0x10, 0x01, 0x20, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x10, 0x10, 0x20, 0x21, 0xbd, 0x33, 0x53, 0x53, 0x36,
+    0x01, 0x12, 0x1b, 0x83, 0x33, 0x35, 0xc8, 0x33, 0x38, 0xb0, 0x04, 0x93, 0x53, 0x5a, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x49, 0x33, 0x35, 0x3e, 0x02, 0x02, 0x0b, 0x83, 0x33, 0x35,
+    0x3d, 0x40, 0x22, 0x01, 0x10, 0x00, 0x20, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x02, 0x12, 0x00, 0x65, 0x33, 0x33, 0x53,
+    0xf0, 0x11, 0x12, 0xa5, 0x33, 0x33, 0x53, 0x35, 0x3d, 0x12, 0x20, 0xd3, 0x53, 0x37, 0x02, 0x00,
+    0x00, 0x20, 0x10, 0x21, 0x00, 0x02, 0xd5, 0x53, 0x53, 0xd0, 0x11, 0x11, 0xb8, 0x35, 0x35, 0x53,
+    0x60, 0x11, 0x01, 0x10, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x20, 0x02,
+    0x10, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x11, 0x1b, 0x95, 0x33, 0x35,
+    0x3f, 0x01, 0x12, 0x07, 0x33, 0x35, 0x33, 0x33, 0x36, 0x02, 0x02, 0x93, 0x53, 0x3a, 0x02, 0x20,
+    0x00, 0x01, 0x20, 0x00, 0x12, 0x26, 0x33, 0x35, 0x39, 0x42, 0x12, 0x1b, 0x83, 0x53, 0x53, 0x57,
+    0x02, 0x20, 0x20, 0x12, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x00,
+    0x00, 0x01, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x4c, 0x55, 0x33,
+    0x55, 0xf0, 0x20, 0x20, 0x63, 0x53, 0x53, 0x35, 0x3a, 0x02, 0x1b, 0x33, 0x35, 0x54, 0x11, 0x01,
+    0x01, 0x12, 0x00, 0x12, 0x11, 0xb5, 0x35, 0x33, 0x8b, 0x02, 0x10, 0xb9, 0x35, 0x35, 0x38, 0xb0,
+    0x22, 0x00, 0x00, 0x10, 0x10, 0x10, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x12,
+    0x20, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0xe3, 0x53,
+    0x33, 0x36, 0x02, 0x20, 0x2e, 0x35, 0x33, 0x53, 0x94, 0x02, 0x07, 0x35, 0x53, 0xc1, 0x10, 0x01,
+    0x10, 0x00, 0x02, 0x00, 0x02, 0xc3, 0x53, 0x33, 0x70, 0x22, 0x24, 0x93, 0x53, 0x33, 0x9b, 0x22,
+    0x00, 0x21, 0x02, 0x01, 0x02, 0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x11,
+    0x01, 0x10, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1e, 0x53,
+    0x35, 0x53, 0x70, 0x22, 0x04, 0x95, 0x33, 0x35, 0xd1, 0x12, 0x0e, 0x55, 0x53, 0xf0, 0x20, 0x10,
+    0x01, 0x00, 0x20, 0x02, 0x06, 0x55, 0x33, 0x5e, 0x12, 0x00, 0x0d, 0x35, 0x35, 0x39, 0xb1, 0x01,
+    0x22, 0x00, 0x11, 0x20, 0x10, 0x20, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xb7,
+    0xb2, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x12, 0x11, 0x63,
+    0x33, 0x33, 0x5a, 0x02, 0x20, 0xb5, 0x35, 0x53, 0x60, 0x20, 0x29, 0x33, 0x53, 0x70, 0x21, 0x00,
+    0x01, 0x01, 0x00, 0x20, 0xb8, 0x35, 0x33, 0x94, 0x00, 0x20, 0xf3, 0x53, 0x53, 0x8b, 0x22, 0x01,
+    0x00, 0x12, 0x00, 0x20, 0x20, 0x22, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x16, 0x33,
+    0x3d, 0x22, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x47, 0xee, 0xf9,
+    0x33, 0x35, 0x39, 0xb0, 0x12, 0x16, 0x33, 0x35, 0xb0, 0x20, 0xb3, 0x33, 0x38, 0x40, 0x01, 0x01,
+    0x10, 0x02, 0x01, 0x20, 0xd3, 0x53, 0x33, 0xa0, 0x20, 0x27, 0x35, 0x33, 0x35, 0xb1, 0x10, 0x00,
+    0x01, 0x10, 0x02, 0x10, 0x01, 0x4d, 0x89, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 0xa3, 0x55,
+    0x53, 0xf0, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x26, 0x83, 0x33, 0x53,
+    0x33, 0x33, 0x35, 0xd0, 0x10, 0x12, 0x69, 0x97, 0x01, 0x11, 0x63, 0x53, 0x3c, 0x02, 0x00, 0x10,
+    0x10, 0x10, 0x12, 0x0a, 0x33, 0x35, 0x3e, 0x12, 0x04, 0x49, 0x35, 0x33, 0x37, 0x12, 0x01, 0x01,
+    0x11, 0x01, 0x00, 0x10, 0x20, 0xe3, 0x53, 0x94, 0x00, 0x00, 0x00, 0x00, 0x10, 0x14, 0x93, 0x53,
+    0x35, 0x5b, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x11, 0xd3, 0x35, 0x55, 0x33,
+    0x33, 0x33, 0x35, 0x36, 0x12, 0x10, 0x02, 0x11, 0x20, 0x22, 0xd3, 0x55, 0x3f, 0x11, 0x20, 0x20,
+    0x10, 0x00, 0x10, 0x1c, 0x33, 0x33, 0x84, 0x10, 0x20, 0xd3, 0x53, 0x53, 0x60, 0x20, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x93, 0x55, 0x3b, 0x10, 0x21, 0x01, 0x10, 0x02, 0x0f, 0x35, 0x33,
+    0x33, 0x3c, 0x10, 0x10, 0x01, 0x10, 0x01, 0x21, 0x20, 0x20, 0x11, 0x0f, 0x35, 0x33, 0x53, 0x53,
+    0x33, 0x33, 0x53, 0x35, 0xb0, 0x10, 0x21, 0x12, 0x00, 0x22, 0x93, 0x33, 0x3a, 0x01, 0x10, 0x11,
+    0x00, 0x20, 0x20, 0x75, 0x33, 0x53, 0x60, 0x22, 0x07, 0x33, 0x55, 0x3c, 0x21, 0x10, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x93, 0x55, 0x3b, 0x12, 0x00, 0x10, 0x00, 0x00, 0xb5, 0x53, 0x35,
+    0x35, 0x33, 0x72, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x10, 0xb5, 0x33, 0x33, 0x35, 0x33,
+    0x35, 0x35, 0x33, 0x53, 0xe0, 0x12, 0x00, 0x20, 0x11, 0x1b, 0x53, 0x53, 0x84, 0x11, 0x00, 0x00,
+    0x02, 0x01, 0x10, 0xc3, 0x35, 0x39, 0x20, 0x20, 0x49, 0x35, 0x33, 0x84, 0x02, 0x01, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x93, 0x33, 0x3b, 0x02, 0x01, 0x00, 0x22, 0x10, 0xc3, 0x53, 0x33,
+    0x33, 0x33, 0x84, 0x20, 0x10, 0x00, 0x2b, 0xee, 0xb0, 0x20, 0x21, 0xf3, 0x53, 0x33, 0xe7, 0xe9,
+    0x55, 0x35, 0x53, 0x53, 0xd0, 0x21, 0x00, 0x20, 0x12, 0x06, 0x35, 0x53, 0xc0, 0x21, 0x01, 0x01,
+    0x01, 0x02, 0x0b, 0x35, 0x33, 0x37, 0x02, 0x11, 0xf3, 0x53, 0x53, 0x72, 0x20, 0x10, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x95, 0x53, 0x3b, 0x01, 0x01, 0x11, 0x00, 0x27, 0x33, 0x33, 0x3c,
+    0x83, 0x35, 0x3f, 0x02, 0x00, 0x20, 0xb8, 0x33, 0x8b, 0x01, 0x20, 0xc3, 0x35, 0x5f, 0x10, 0x01,
+    0xb6, 0xd8, 0x33, 0x33, 0xa2, 0x20, 0x11, 0x01, 0x02, 0x0d, 0x55, 0x33, 0x61, 0x21, 0x02, 0x01,
+    0x20, 0x11, 0x07, 0x33, 0x53, 0x91, 0x00, 0x0b, 0x53, 0x33, 0x5d, 0x11, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x93, 0x53, 0x3b, 0x12, 0x00, 0x20, 0x12, 0x29, 0x35, 0x33, 0x92,
+    0xd3, 0x55, 0x33, 0xb0, 0x10, 0x20, 0x63, 0x58, 0x56, 0x12, 0x11, 0xc3, 0x53, 0x3b, 0x24, 0x22,
+    0x00, 0x04, 0xaf, 0xea, 0x21, 0x01, 0x20, 0x01, 0x01, 0x49, 0x33, 0x33, 0xa2, 0x00, 0x10, 0x01,
+    0x11, 0x02, 0x06, 0x35, 0x53, 0xe0, 0x42, 0x0e, 0x35, 0x33, 0x8b, 0x01, 0x22, 0x02, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x93, 0x33, 0x3b, 0x02, 0x01, 0x00, 0x20, 0x65, 0x53, 0x53, 0x71,
+    0xb8, 0x33, 0x53, 0xd0, 0x20, 0x10, 0xf3, 0x53, 0x36, 0x02, 0x00, 0xc3, 0x55, 0x36, 0x02, 0x12,
+    0x22, 0x22, 0x00, 0x21, 0x00, 0x10, 0x10, 0x10, 0x11, 0xb5, 0x33, 0x58, 0x40, 0x10, 0x10, 0x11,
+    0x00, 0x12, 0x07, 0x35, 0x53, 0x92, 0x20, 0xb5, 0x33, 0x53, 0xf2, 0x20, 0x00, 0x11, 0x02, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xc3, 0x55, 0x84, 0x00, 0x02, 0x02, 0x04, 0x93, 0x55, 0x3c, 0x02,
+    0x1f, 0x35, 0x53, 0x3a, 0x04, 0x20, 0xf3, 0x55, 0x56, 0x12, 0x20, 0xe3, 0x53, 0x38, 0x74, 0x11,
+    0x10, 0x21, 0x22, 0x21, 0x01, 0x20, 0x10, 0x00, 0x20, 0x63, 0x55, 0x3d, 0x10, 0x11, 0x10, 0x10,
+    0x00, 0x01, 0x1b, 0x53, 0x35, 0x3c, 0xa7, 0x93, 0x33, 0x38, 0x41, 0x00, 0x10, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xb9, 0x33, 0x70, 0x12, 0x00, 0x12, 0x06, 0x35, 0x33, 0x3a, 0x02,
+    0x04, 0x93, 0x35, 0x5d, 0x10, 0x20, 0xf3, 0x53, 0x3f, 0x02, 0x10, 0xa3, 0x33, 0x53, 0x58, 0xc6,
+    0xb4, 0x02, 0x10, 0x12, 0x10, 0x10, 0x01, 0x10, 0x20, 0xd3, 0x55, 0x36, 0x02, 0x01, 0x00, 0x10,
+    0x10, 0x01, 0x01, 0xc5, 0x53, 0x33, 0x33, 0x35, 0x35, 0x36, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0xab, 0x02, 0x10, 0x10, 0x11, 0x49, 0x35, 0x33, 0xe2, 0x20,
+    0x10, 0x63, 0x33, 0x33, 0xa1, 0x20, 0xf3, 0x55, 0x36, 0x02, 0x01, 0x0d, 0x35, 0x33, 0x53, 0x33,
+    0x39, 0xe7, 0xb0, 0x01, 0x00, 0x22, 0x00, 0x01, 0x04, 0x85, 0x33, 0x3a, 0x11, 0x11, 0x00, 0x01,
+    0x02, 0x00, 0x20, 0xa3, 0x55, 0x35, 0x53, 0x53, 0x53, 0x94, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x10, 0x01, 0x02, 0x20, 0x63, 0x55, 0x35, 0xa0, 0x11,
+    0x12, 0x49, 0x55, 0x35, 0xd0, 0x20, 0xf3, 0x83, 0x36, 0x20, 0x20, 0x04, 0x93, 0x35, 0x55, 0x35,
+    0x33, 0x33, 0x5c, 0xfa, 0x42, 0x00, 0x02, 0x22, 0x1a, 0x53, 0x33, 0x94, 0x11, 0x10, 0x00, 0x00,
+    0x02, 0x01, 0x01, 0x06, 0x33, 0x55, 0x35, 0x55, 0x38, 0xb0, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x01, 0x20, 0x02, 0x02, 0x02, 0xc3, 0x35, 0x3d, 0x02, 0x00,
+    0x01, 0x16, 0x35, 0x33, 0x5b, 0x00, 0x63, 0x85, 0x56, 0x02, 0x01, 0x20, 0x4c, 0x35, 0x33, 0x53,
+    0x33, 0x55, 0x33, 0x33, 0x8d, 0x6b, 0x40, 0x02, 0x0f, 0x35, 0x33, 0xd0, 0x11, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x02, 0x11, 0xa8, 0x33, 0x55, 0x33, 0xcb, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x01, 0x10, 0x12, 0x0a, 0x33, 0x33, 0x3a, 0x02, 0x01,
+    0x11, 0x04, 0x95, 0x55, 0x36, 0x01, 0x48, 0x33, 0x84, 0x02, 0x00, 0x11, 0x02, 0xae, 0x93, 0x33,
+    0x35, 0x55, 0x35, 0x55, 0x33, 0x35, 0x9e, 0x7b, 0x65, 0x35, 0x53, 0x62, 0x11, 0x00, 0x01, 0x00,
+    0x00, 0x10, 0x00, 0x11, 0x22, 0x7e, 0xcd, 0xfa, 0x00, 0x20, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x01, 0x11, 0x10, 0x11, 0x0f, 0x35, 0x53, 0xc1, 0x21, 0x00,
+    0x01, 0x01, 0xf3, 0x53, 0x3c, 0x20, 0x2b, 0xff, 0xb0, 0x02, 0x00, 0x02, 0x20, 0x10, 0x2b, 0x6c,
+    0x83, 0x33, 0x33, 0x53, 0x35, 0x53, 0x33, 0x33, 0x33, 0x33, 0x38, 0xb0, 0x10, 0x00, 0x01, 0x00,
+    0x02, 0x02, 0x00, 0x10, 0x12, 0x10, 0x10, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x2c, 0x53, 0x33, 0x70, 0x11, 0x00,
+    0x20, 0x20, 0xb3, 0x33, 0x35, 0x41, 0x21, 0x02, 0x21, 0x10, 0x22, 0x01, 0x00, 0x22, 0x01, 0x00,
+    0x4a, 0xe9, 0x53, 0x33, 0x55, 0x53, 0x55, 0x33, 0x33, 0x38, 0x3f, 0x12, 0x10, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x21, 0x02, 0x10, 0x12, 0x12, 0x22, 0x10, 0x02, 0x02, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x10, 0x02, 0x01, 0x01, 0x48, 0x33, 0x35, 0xb1, 0x10, 0x02,
+    0x01, 0x02, 0x29, 0x53, 0x53, 0xa0, 0x11, 0x21, 0x10, 0x00, 0x00, 0x20, 0x10, 0x02, 0x01, 0x22,
+    0x10, 0x02, 0xb7, 0xd8, 0x33, 0x33, 0x55, 0x35, 0x55, 0x53, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x02, 0x10, 0x01, 0x01, 0x00, 0x10, 0x00, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x10, 0x48, 0x35, 0x38, 0x40, 0x10, 0x10,
+    0x10, 0x01, 0x0c, 0x35, 0x55, 0xa2, 0x11, 0x01, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x12, 0x00,
+    0x02, 0x20, 0x00, 0x04, 0xa6, 0xc5, 0x35, 0x33, 0x33, 0x5e, 0x41, 0x01, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x48, 0x33, 0x33, 0xb1, 0x20, 0x01,
+    0x10, 0x11, 0x29, 0x53, 0x33, 0xa0, 0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x00, 0x02, 0x01,
+    0x00, 0x00, 0x01, 0x11, 0x10, 0x14, 0x7e, 0xc9, 0xcf, 0xb1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2c, 0x33, 0x53, 0x61, 0x20, 0x10,
+    0x00, 0x21, 0xa5, 0x33, 0x38, 0x40, 0x10, 0x02, 0x01, 0x02, 0x00, 0x10, 0x00, 0x02, 0x00, 0x11,
+    0x00, 0x00, 0x01, 0x11, 0x12, 0x20, 0x01, 0x10, 0x02, 0x10, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0f, 0x35, 0x33, 0x84, 0x04, 0x10,
+    0x12, 0x10, 0xc3, 0x53, 0x3c, 0x11, 0x11, 0x20, 0x02, 0x02, 0x00, 0x10, 0x22, 0x00, 0x10, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x22, 0x10, 0x12, 0x21, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x2b, 0x33, 0x35, 0x5c, 0x40, 0x11,
+    0x00, 0x2e, 0x35, 0x35, 0x36, 0x01, 0x00, 0x01, 0x12, 0x12, 0x20, 0x20, 0x00, 0x10, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0xd5, 0x53, 0x33, 0x86, 0xb4,
+    0xb7, 0x95, 0x53, 0x35, 0x94, 0x02, 0x02, 0x10, 0x02, 0xf9, 0x9d, 0x41, 0x20, 0x02, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x01, 0x11, 0x21, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xb8, 0x35, 0x55, 0x33, 0x55,
+    0x53, 0x33, 0x35, 0x53, 0x70, 0x20, 0x10, 0x01, 0x1d, 0x35, 0x33, 0x94, 0x02, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x10, 0x01, 0x1a, 0x33, 0x33, 0x53, 0x35,
+    0x35, 0x53, 0x55, 0x36, 0x02, 0x10, 0x20, 0x21, 0x73, 0x53, 0x35, 0x5e, 0x12, 0x20, 0x20, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x21, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x20, 0x21, 0xa8, 0x35, 0x35, 0x33,
+    0x53, 0x55, 0x33, 0x61, 0x21, 0x00, 0x00, 0x24, 0x85, 0x35, 0x33, 0x33, 0xa0, 0x20, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x02, 0x12, 0x11, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x02, 0x11, 0x12, 0x00, 0x10, 0x02, 0x04, 0xe5, 0x33, 0x33,
+    0x33, 0x53, 0xca, 0x02, 0x11, 0x00, 0x02, 0x2e, 0x35, 0x35, 0x33, 0x33, 0x94, 0x11, 0x00, 0x20,
+    0x10, 0x01, 0x00, 0x21, 0x21, 0x00, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01, 0x20, 0x00, 0x10, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x12, 0xb4, 0x01, 0x21, 0x02, 0x02, 0x10, 0x0b, 0xfc, 0x98,
+    0x9c, 0xea, 0x10, 0x20, 0x10, 0x01, 0x11, 0xa3, 0x33, 0x33, 0x33, 0x35, 0x3f, 0x11, 0x12, 0x01,
+    0x00, 0x21, 0x02, 0x00, 0x02, 0x01, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x0a, 0xdd, 0xb1, 0x10, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xb9, 0x38, 0xf0, 0x20, 0x02, 0x00, 0x02, 0x12, 0x00, 0x44,
+    0x40, 0x21, 0x02, 0x00, 0x20, 0x20, 0x02, 0x93, 0x33, 0x39, 0xc3, 0x33, 0x33, 0xb1, 0x00, 0x20,
+    0x00, 0x00, 0x02, 0x6d, 0x62, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0xb5, 0x33, 0x8b, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x04, 0x93, 0x55, 0x36, 0x02, 0x00, 0x00, 0x22, 0x00, 0x21, 0x01,
+    0x01, 0x10, 0x22, 0x02, 0x01, 0x01, 0x26, 0x35, 0x35, 0x37, 0xb3, 0x33, 0x53, 0xc0, 0x21, 0x00,
+    0x00, 0x01, 0x2e, 0x35, 0x3e, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0xf3, 0x55, 0x36, 0x01, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x35, 0x33, 0x35, 0xb0, 0x20, 0x02, 0x00, 0x20, 0x02, 0x01,
+    0x02, 0x11, 0x00, 0x10, 0x00, 0x20, 0xb8, 0x33, 0x53, 0xc2, 0x2f, 0x35, 0x35, 0x5a, 0x11, 0x00,
+    0x02, 0x01, 0x48, 0x35, 0x58, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0xf3, 0x55, 0x36, 0x22, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x20, 0xa3, 0x53, 0x35, 0x53, 0xd1, 0x11, 0x00, 0x12, 0x00, 0x01, 0x10,
+    0x10, 0x00, 0x01, 0x10, 0x10, 0x10, 0xe3, 0x53, 0x33, 0xa0, 0x22, 0x93, 0x33, 0x3c, 0x02, 0x01,
+    0x00, 0x11, 0x48, 0x33, 0x38, 0x40, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x20, 0xf3, 0x53, 0x5f, 0x02, 0x20,
+    0x00, 0x00, 0x00, 0x11, 0x12, 0xc3, 0x33, 0x33, 0x33, 0x37, 0x01, 0x10, 0x00, 0x02, 0x10, 0x00,
+    0x01, 0x11, 0x00, 0x02, 0x02, 0x1a, 0x53, 0x35, 0x3e, 0x22, 0x11, 0x73, 0x55, 0x33, 0xa0, 0x21,
+    0x01, 0x20, 0x45, 0x35, 0x38, 0x41, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x21, 0xf5, 0x55, 0x36, 0x12, 0x02,
+    0x00, 0x00, 0x00, 0x11, 0x06, 0x35, 0x33, 0x33, 0x33, 0x39, 0x40, 0x11, 0x20, 0x10, 0x02, 0x22,
+    0x12, 0x00, 0x01, 0x10, 0x10, 0x1d, 0x33, 0x33, 0x84, 0x10, 0x02, 0x2c, 0x33, 0x33, 0xc2, 0x00,
+    0x00, 0x10, 0x48, 0x33, 0x38, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xf3, 0x55, 0x36, 0x02, 0x00,
+    0x10, 0x00, 0x20, 0x20, 0x49, 0x33, 0x53, 0x85, 0x33, 0x53, 0x60, 0x20, 0x02, 0x00, 0x21, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x20, 0xa3, 0x33, 0x53, 0x61, 0x21, 0x02, 0x07, 0x33, 0x35, 0x3a, 0x02,
+    0x01, 0x10, 0x48, 0x33, 0x38, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf3, 0x55, 0x36, 0x02, 0x02,
+    0x02, 0x10, 0x00, 0x21, 0xf3, 0x53, 0x33, 0xad, 0x35, 0x33, 0x84, 0x00, 0x00, 0x02, 0x01, 0xad,
+    0xda, 0x02, 0x11, 0x10, 0x00, 0xc3, 0x55, 0x39, 0x40, 0x11, 0x02, 0x01, 0x93, 0x35, 0x3c, 0x02,
+    0x20, 0x00, 0x48, 0x35, 0x38, 0x40, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 0x21, 0x63, 0x55, 0x36, 0x02, 0x00,
+    0x00, 0x01, 0x21, 0x2b, 0x83, 0x55, 0x3d, 0x0b, 0x55, 0x35, 0x5f, 0x22, 0x10, 0x10, 0x0a, 0x53,
+    0x38, 0xb1, 0x00, 0x02, 0x07, 0x33, 0x35, 0x37, 0x12, 0x01, 0x00, 0x20, 0x73, 0x33, 0x35, 0xa0,
+    0x10, 0x20, 0x28, 0x35, 0x38, 0x21, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0xb9, 0x33, 0x94, 0x20, 0x00,
+    0x10, 0x11, 0x01, 0x0f, 0x55, 0x33, 0x5b, 0x20, 0xe3, 0x53, 0x38, 0x40, 0x10, 0x12, 0x0f, 0x38,
+    0x83, 0x60, 0x20, 0x20, 0x2c, 0x55, 0x35, 0xc0, 0x00, 0x12, 0x00, 0x00, 0x29, 0x53, 0x53, 0xc0,
+    0x12, 0x01, 0x06, 0x35, 0x36, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x2b, 0x66, 0x40, 0x02, 0x02,
+    0x01, 0x20, 0x02, 0x48, 0x33, 0x55, 0xe1, 0x21, 0xb5, 0x35, 0x53, 0xf1, 0x11, 0x20, 0x1e, 0x33,
+    0x33, 0x62, 0x10, 0x20, 0x75, 0x33, 0x53, 0xa0, 0x12, 0x10, 0x00, 0x21, 0x07, 0x35, 0x33, 0x5a,
+    0x11, 0x21, 0x01, 0x7f, 0x70, 0x02, 0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x02, 0x02, 0x01, 0x10, 0x00, 0x10, 0x20,
+    0x01, 0x00, 0x20, 0x63, 0x53, 0x35, 0xb2, 0x20, 0x2f, 0x33, 0x33, 0x94, 0x00, 0x02, 0x2f, 0x55,
+    0x55, 0x61, 0x01, 0x11, 0xc3, 0x53, 0x3c, 0x01, 0x10, 0x01, 0x10, 0x01, 0x12, 0x93, 0x55, 0x3d,
+    0x01, 0x00, 0x02, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x21, 0x22, 0x21, 0x01, 0x01,
+    0x01, 0x00, 0x10, 0xc3, 0x33, 0x5e, 0x00, 0x11, 0x0b, 0x55, 0x53, 0x37, 0x02, 0x02, 0x0f, 0x35,
+    0x53, 0x61, 0x22, 0x0a, 0x53, 0x35, 0x3a, 0x22, 0x10, 0x20, 0x12, 0x01, 0x20, 0x73, 0x53, 0x33,
+    0xa2, 0x20, 0x20, 0x21, 0x20, 0x20, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x00, 0x10, 0x10,
+    0x00, 0x12, 0x0b, 0x53, 0x33, 0x3b, 0x12, 0x00, 0x02, 0xd3, 0x55, 0x3e, 0x11, 0x02, 0x2f, 0x55,
+    0x35, 0x61, 0x02, 0x1e, 0x35, 0x53, 0xc1, 0x01, 0x01, 0x00, 0x10, 0x01, 0x10, 0x29, 0x35, 0x33,
+    0xd0, 0x10, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x10, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x07, 0x35, 0x53, 0xc1, 0x11, 0x01, 0x22, 0x73, 0x53, 0x39, 0x10, 0x02, 0x0e, 0x35,
+    0x53, 0x60, 0x21, 0x48, 0x33, 0x33, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x35, 0x33,
+    0x3a, 0x21, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x12, 0x01, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x21, 0x16, 0x53, 0x33, 0xe1, 0x00, 0x10, 0x10, 0x45, 0x33, 0x38, 0x42, 0x00, 0x26, 0x55,
+    0x53, 0x70, 0x40, 0x75, 0x53, 0x39, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x93, 0x55,
+    0x3f, 0x11, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x11, 0x16, 0x35, 0x53, 0xe0, 0x20, 0x20, 0x20, 0xb3, 0x35, 0x39, 0x21, 0x22, 0x04, 0x85,
+    0x39, 0x42, 0x20, 0xd3, 0x35, 0x3f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x21, 0x73, 0x33,
+    0x59, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x12, 0x12, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x17, 0x55, 0x33, 0x84, 0x02, 0x02, 0x20, 0x63, 0x33, 0x3c, 0x01, 0x10, 0x21, 0x46,
+    0x64, 0x00, 0x22, 0x93, 0x53, 0x3a, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0xb8, 0x53,
+    0x35, 0xb0, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x02, 0x04, 0x83, 0x55, 0x3d, 0x02, 0x00, 0x1a, 0x53, 0x55, 0x3f, 0x11, 0x00, 0x01, 0x10,
+    0x01, 0x20, 0x0b, 0x53, 0x53, 0x84, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x35,
+    0x35, 0x71, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x21, 0x01, 0x22, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x10, 0x22, 0xe3, 0x53, 0x33, 0xc7, 0xbb, 0xf5, 0x53, 0x33, 0x3b, 0x10, 0x21, 0x01, 0x12,
+    0x20, 0x02, 0x1a, 0x35, 0x33, 0xc0, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0e, 0x35,
+    0x53, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x20, 0x01, 0x10, 0x02, 0x21, 0x11, 0x10, 0x00, 0x00,
+    0x11, 0x00, 0x10, 0xb5, 0x33, 0x55, 0x33, 0x53, 0x35, 0x35, 0x33, 0xe1, 0x22, 0x00, 0x10, 0x20,
+    0x01, 0x10, 0x0a, 0x33, 0x53, 0xc2, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1e, 0x35,
+    0x53, 0x61, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0b, 0xfc, 0x9c, 0xe7, 0xb1, 0x01, 0x11, 0x10, 0x00, 0x00,
+    0x10, 0x11, 0x01, 0x27, 0x35, 0x33, 0x53, 0x33, 0x53, 0x35, 0x39, 0x40, 0x00, 0x00, 0x11, 0x00,
+    0x00, 0x01, 0x1b, 0x33, 0x33, 0x92, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x0d, 0x35,
+    0x53, 0x70, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xf3, 0x33, 0x33, 0x33, 0x5c, 0xfa, 0x40, 0x00, 0x02, 0x21,
+    0x10, 0x20, 0x01, 0x10, 0x65, 0x35, 0x53, 0x35, 0x33, 0x33, 0x94, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x24, 0x83, 0x33, 0x3b, 0x02, 0x01, 0x00, 0x00, 0x10, 0x00, 0x10, 0x10, 0x49, 0x35,
+    0x33, 0xa1, 0x11, 0x00, 0x10, 0x01, 0x01, 0x10, 0x02, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x0e, 0x35, 0x53, 0x53, 0x33, 0x33, 0x35, 0x8d, 0x6b, 0x20, 0x00,
+    0x02, 0x00, 0x20, 0x12, 0x0a, 0x93, 0x33, 0x33, 0x53, 0x5f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x01, 0x10, 0xc3, 0x53, 0x36, 0x22, 0x01, 0x01, 0x10, 0x00, 0x11, 0x01, 0x11, 0xa3, 0x33,
+    0x38, 0x42, 0x00, 0x00, 0x01, 0x11, 0x01, 0x00, 0x22, 0x21, 0x11, 0x10, 0x12, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x63, 0x55, 0x55, 0x35, 0x55, 0x55, 0x33, 0x35, 0x35, 0x9e, 0x74,
+    0x11, 0x20, 0x22, 0x01, 0x21, 0x27, 0xec, 0x99, 0xc6, 0xb2, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x21, 0x63, 0x53, 0x38, 0x41, 0x12, 0x00, 0x00, 0x01, 0x01, 0x01, 0x11, 0xc3, 0x55,
+    0x3d, 0x01, 0x11, 0x01, 0x02, 0x00, 0x20, 0x02, 0x00, 0x10, 0x01, 0x12, 0x20, 0x12, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x83, 0x53, 0x53, 0x33, 0x33, 0x35, 0x53, 0x35, 0x53, 0x33, 0x58,
+    0xc6, 0xa4, 0x00, 0x21, 0x12, 0x02, 0x00, 0x21, 0x10, 0x02, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x11, 0xb5, 0x33, 0x53, 0xe0, 0x20, 0x12, 0x12, 0x10, 0x00, 0x02, 0x16, 0x35, 0x33,
+    0x37, 0x00, 0x11, 0x00, 0x10, 0x10, 0x21, 0x11, 0xbf, 0xdc, 0xe7, 0x41, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x27, 0x35, 0x33, 0x3f, 0xb7, 0xf9, 0x53, 0x35, 0x55, 0x33, 0x55, 0x33,
+    0x33, 0x39, 0xda, 0x21, 0x00, 0x21, 0x21, 0x00, 0x04, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x02, 0x0e, 0x35, 0x35, 0x3f, 0x02, 0x12, 0x10, 0x00, 0x22, 0x20, 0x73, 0x53, 0x53,
+    0xc2, 0x01, 0x00, 0x10, 0x02, 0x00, 0x10, 0x4d, 0x53, 0x35, 0x33, 0x87, 0x22, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x0e, 0x35, 0x53, 0xe1, 0x20, 0x14, 0xb7, 0xd8, 0x33, 0x33, 0x35, 0x35,
+    0x35, 0x53, 0x33, 0xcb, 0x02, 0x02, 0x01, 0x02, 0x10, 0x00, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x02, 0x1b, 0x83, 0x33, 0x33, 0xe4, 0x01, 0x02, 0x20, 0x10, 0x0f, 0x53, 0x33, 0x53,
+    0x70, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0b, 0x93, 0x35, 0x53, 0x55, 0x35, 0x60, 0x02, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x11, 0x29, 0x53, 0x35, 0x71, 0x21, 0x20, 0x00, 0x24, 0xaf, 0xc5, 0x33, 0x33,
+    0x53, 0x33, 0x55, 0x39, 0xb0, 0x10, 0x10, 0x20, 0x00, 0x11, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x02, 0x00, 0x20, 0x73, 0x53, 0x35, 0x58, 0x6b, 0x20, 0x02, 0x46, 0x95, 0x33, 0x35, 0x3f,
+    0x02, 0x10, 0x11, 0x01, 0x10, 0x11, 0x0c, 0x33, 0x35, 0x55, 0x53, 0x53, 0x37, 0x01, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x11, 0xb5, 0x35, 0x35, 0xb0, 0x10, 0x10, 0x12, 0x10, 0x00, 0x14, 0x7e, 0x93,
+    0x35, 0x35, 0x33, 0x53, 0xc1, 0x20, 0x01, 0x10, 0x00, 0x11, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x11, 0x02, 0x0f, 0x35, 0x53, 0x35, 0x33, 0x9c, 0xc9, 0x53, 0x53, 0x33, 0x53, 0xc2,
+    0x10, 0x01, 0x00, 0x20, 0x01, 0x00, 0x73, 0x35, 0x53, 0x33, 0x33, 0x35, 0x3c, 0x11, 0x01, 0x00,
+    0x02, 0x00, 0x10, 0x20, 0x75, 0x35, 0x3c, 0x10, 0x00, 0x10, 0x10, 0x01, 0x22, 0x00, 0x20, 0x2b,
+    0x6d, 0x83, 0x33, 0x35, 0x37, 0x22, 0x00, 0x00, 0x01, 0x00, 0x4b, 0x41, 0x01, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0xf3, 0x35, 0x33, 0x35, 0x33, 0x33, 0x33, 0x53, 0x35, 0x3d, 0x40,
+    0x11, 0x01, 0x00, 0x00, 0x10, 0x04, 0x93, 0x33, 0x38, 0x6a, 0xd3, 0x33, 0x53, 0xb0, 0x20, 0x10,
+    0x00, 0x10, 0x11, 0x20, 0xe3, 0x55, 0x3e, 0x02, 0x10, 0x10, 0x01, 0x11, 0x02, 0x22, 0x22, 0x00,
+    0x12, 0x47, 0x93, 0x33, 0x3d, 0x01, 0x01, 0x20, 0x12, 0x0a, 0x83, 0x8b, 0x00, 0x01, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x07, 0x83, 0x35, 0x53, 0x35, 0x53, 0x35, 0x35, 0x33, 0xf0, 0x22,
+    0x01, 0x20, 0x02, 0x00, 0x12, 0x26, 0x38, 0x35, 0x3a, 0x12, 0x1c, 0x35, 0x53, 0x60, 0x21, 0x00,
+    0x10, 0x10, 0x10, 0x02, 0x93, 0x33, 0x37, 0x02, 0x01, 0x01, 0x00, 0x10, 0x02, 0x00, 0x21, 0x22,
+    0x21, 0x10, 0x73, 0x53, 0x39, 0x01, 0x20, 0x10, 0x02, 0x29, 0x35, 0x3c, 0x20, 0x01, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x20, 0xbd, 0x53, 0x33, 0x33, 0x55, 0x33, 0x33, 0xcb, 0x12, 0x00,
+    0x10, 0x01, 0x00, 0x22, 0x00, 0x48, 0x33, 0x33, 0xd1, 0x21, 0x1f, 0x35, 0x53, 0xf1, 0x20, 0x01,
+    0x02, 0x00, 0x10, 0x1b, 0x53, 0x33, 0x8b, 0x10, 0x00, 0x02, 0x10, 0x20, 0xbe, 0xfa, 0x40, 0x11,
+    0x02, 0x40, 0xb3, 0x53, 0x39, 0x40, 0x00, 0x10, 0x10, 0x48, 0x33, 0x38, 0x41, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x10, 0xbf, 0xc8, 0x33, 0x33, 0x89, 0xea, 0x20, 0x20, 0x21,
+    0x01, 0x01, 0x01, 0x00, 0x22, 0xe5, 0x33, 0x53, 0xa0, 0x22, 0x0c, 0x53, 0x33, 0x60, 0x21, 0x01,
+    0x01, 0x01, 0x22, 0x17, 0x35, 0x53, 0xc2, 0x20, 0x10, 0x21, 0x01, 0x1b, 0x53, 0x33, 0x8d, 0x6b,
+    0x20, 0x01, 0x63, 0x53, 0x3c, 0x01, 0x20, 0x00, 0x21, 0x48, 0x33, 0x38, 0x41, 0x01, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x21, 0x21, 0x20, 0x14, 0xba, 0xab, 0x42, 0x02, 0x02, 0x10, 0x20,
+    0x00, 0x10, 0x12, 0x04, 0x0a, 0x33, 0x55, 0x3e, 0x10, 0x20, 0xa3, 0x33, 0x53, 0xa0, 0x20, 0x10,
+    0x00, 0x10, 0x02, 0x0e, 0x35, 0x53, 0xf0, 0x11, 0x01, 0x00, 0x12, 0x0f, 0x38, 0x53, 0x33, 0x55,
+    0x9e, 0x7f, 0x53, 0x35, 0x3e, 0x22, 0x00, 0x10, 0x00, 0x45, 0x35, 0x38, 0x40, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0x10, 0x01, 0x11, 0x10, 0x21, 0x20, 0x00, 0x02,
+    0x10, 0x01, 0x10, 0x20, 0x49, 0x35, 0x33, 0x84, 0x02, 0x12, 0xc5, 0x55, 0x39, 0x22, 0x00, 0x20,
+    0x10, 0x10, 0x00, 0x49, 0x33, 0x33, 0xa0, 0x11, 0x02, 0x00, 0x21, 0x0f, 0x35, 0x33, 0x35, 0x53,
+    0x33, 0x33, 0x33, 0x33, 0x5a, 0x00, 0x12, 0x00, 0x10, 0x48, 0x33, 0x38, 0x40, 0x11, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x12, 0x10, 0x21, 0x02, 0x22, 0x12, 0x10, 0x00, 0x00, 0x21, 0x02,
+    0x02, 0x00, 0x01, 0x21, 0xe5, 0x53, 0x53, 0x62, 0x20, 0x07, 0x33, 0x35, 0x37, 0x10, 0x20, 0x01,
+    0x01, 0x01, 0x21, 0xb3, 0x33, 0x38, 0x40, 0x11, 0x21, 0x02, 0x01, 0x14, 0x83, 0x33, 0x33, 0x33,
+    0x35, 0x55, 0x33, 0x53, 0xe0, 0x20, 0x01, 0x02, 0x20, 0x48, 0x35, 0x38, 0x40, 0x11, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x10, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x02, 0x06, 0x33, 0x35, 0x3c, 0x00, 0x01, 0x49, 0x35, 0x33, 0x94, 0x01, 0x02, 0x00,
+    0x10, 0x00, 0x21, 0x63, 0x53, 0x5c, 0x02, 0x01, 0x01, 0x22, 0x10, 0x20, 0x73, 0x35, 0x33, 0x33,
+    0x35, 0x35, 0x53, 0x3c, 0x22, 0x10, 0x10, 0x00, 0x00, 0x48, 0x35, 0x38, 0x42, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x01,
+    0x00, 0x10, 0x20, 0xa5, 0x33, 0x33, 0x8b, 0x02, 0x20, 0xf3, 0x53, 0x53, 0x70, 0x11, 0x00, 0x10,
+    0x00, 0x21, 0x10, 0xe3, 0x35, 0x3f, 0x02, 0x10, 0xa9, 0x8f, 0x22, 0x02, 0x0e, 0x33, 0x53, 0x33,
+    0x33, 0x53, 0x35, 0xf2, 0x21, 0x00, 0x00, 0x01, 0x10, 0x0c, 0x35, 0x5c, 0x21, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x10,
+    0x10, 0x12, 0x1b, 0x83, 0x33, 0x53, 0x70, 0x11, 0x0b, 0x53, 0x35, 0x3c, 0x10, 0x20, 0x10, 0x00,
+    0x00, 0x20, 0x14, 0x93, 0x55, 0x3a, 0x22, 0x04, 0x83, 0x53, 0xf0, 0x02, 0x14, 0x93, 0x33, 0x33,
+    0x8f, 0xde, 0x64, 0x20, 0x10, 0x00, 0x00, 0x01, 0x20, 0x2b, 0x95, 0x9b, 0x00, 0x01, 0x10, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x12, 0x00, 0x11,
+    0x11, 0x10, 0x49, 0x33, 0x35, 0x3e, 0x02, 0x02, 0x2c, 0x35, 0x35, 0x5a, 0x02, 0x00, 0x00, 0x10,
+    0x11, 0x00, 0x2b, 0x33, 0x33, 0x84, 0x21, 0x27, 0x35, 0x35, 0x3a, 0x21, 0x20, 0xb8, 0x35, 0x35,
+    0x3e, 0x02, 0x01, 0x21, 0x00, 0x01, 0x10, 0x00, 0x01, 0x01, 0x24, 0x22, 0x10, 0x11, 0x10, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x02, 0x00,
+    0x01, 0x14, 0x95, 0x33, 0x53, 0xc2, 0x00, 0x21, 0x63, 0x33, 0x53, 0xf0, 0x20, 0x02, 0x00, 0x01,
+    0x01, 0x02, 0x06, 0x35, 0x33, 0xd1, 0x10, 0x0e, 0x33, 0x35, 0x39, 0x41, 0x11, 0x0a, 0x33, 0x53,
+    0x35, 0xd2, 0x04, 0x00, 0x00, 0x01, 0x10, 0x00, 0x20, 0x20, 0x21, 0x01, 0x10, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02,
+    0x20, 0x49, 0x55, 0x35, 0x58, 0x41, 0x22, 0x0a, 0x35, 0x35, 0x39, 0x40, 0x00, 0x10, 0x02, 0x01,
+    0x00, 0x12, 0x0d, 0x35, 0x53, 0x60, 0x20, 0x19, 0x35, 0x33, 0x53, 0xd0, 0x21, 0x20, 0x73, 0x55,
+    0x35, 0x3d, 0x41, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x12, 0x11, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x20,
+    0x0b, 0x93, 0x33, 0x53, 0x8b, 0x10, 0x20, 0x49, 0x33, 0x35, 0x3a, 0x02, 0x12, 0x00, 0x01, 0x00,
+    0x00, 0x10, 0x49, 0x33, 0x35, 0xa0, 0x20, 0xb5, 0x33, 0x33, 0x35, 0x3f, 0x02, 0x02, 0x06, 0x35,
+    0x33, 0x53, 0x94, 0x02, 0x10, 0x00, 0x00, 0x11, 0x01, 0x20, 0x02, 0x01, 0x00, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x12,
+    0xa8, 0x33, 0x35, 0x38, 0xa1, 0x22, 0x02, 0xc3, 0x55, 0x33, 0xf0, 0x21, 0x00, 0x02, 0x00, 0x11,
+    0x01, 0x01, 0xb3, 0x33, 0x38, 0x41, 0x21, 0x73, 0x53, 0x35, 0x53, 0x53, 0x60, 0x20, 0x20, 0x63,
+    0x53, 0x35, 0x38, 0xa0, 0x21, 0x00, 0x10, 0x01, 0x01, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x17,
+    0x53, 0x53, 0x33, 0x5a, 0x11, 0x11, 0x2e, 0x35, 0x35, 0x3c, 0x21, 0x10, 0x10, 0x01, 0x01, 0x01,
+    0x01, 0x20, 0xa3, 0x35, 0x3c, 0x02, 0x20, 0xe3, 0x53, 0x35, 0x33, 0x33, 0x37, 0x02, 0x02, 0x16,
+    0x33, 0x33, 0x33, 0x3f, 0x10, 0x20, 0x00, 0x00, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x01, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x10, 0x01, 0x01, 0x00, 0x10, 0x12, 0x04, 0xd3,
+    0x35, 0x35, 0x38, 0xa0, 0x20, 0x20, 0xf3, 0x53, 0x53, 0x8b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x21, 0xb5, 0x33, 0x38, 0x40, 0x04, 0x93, 0x53, 0x5c, 0x35, 0x33, 0x38, 0xa0, 0x21, 0x20,
+    0x75, 0x33, 0x33, 0x35, 0xcb, 0x02, 0x20, 0x01, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x11, 0x00, 0x02, 0x00, 0x20, 0x01, 0x02, 0x21, 0xa9, 0x33,
+    0x53, 0x53, 0x8b, 0x02, 0x01, 0x16, 0x33, 0x33, 0x33, 0xa2, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x49, 0x53, 0x33, 0xca, 0xac, 0x33, 0x33, 0x84, 0xe3, 0x53, 0x53, 0x8a, 0x02, 0x02,
+    0x2a, 0x85, 0x35, 0x33, 0x38, 0x64, 0x02, 0x20, 0x12, 0x01, 0x10, 0x02, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x01, 0x10, 0x10, 0x10, 0x00, 0x12, 0x20, 0x4e, 0x35, 0x53,
+    0x35, 0x5c, 0x40, 0x20, 0x22, 0x63, 0x53, 0x35, 0x36, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x2e, 0x35, 0x35, 0x33, 0x35, 0x33, 0x55, 0xd2, 0x2c, 0x35, 0x35, 0x35, 0xa0, 0x12,
+    0x20, 0xbc, 0x35, 0x33, 0x53, 0x39, 0x71, 0x02, 0x11, 0x00, 0x12, 0x10, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x02, 0x01, 0x22, 0x20, 0x26, 0x85, 0x35, 0x33,
+    0x53, 0xe2, 0x01, 0x12, 0x06, 0x35, 0x33, 0x83, 0xf1, 0x21, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x10, 0x04, 0x83, 0x53, 0x55, 0x55, 0x35, 0x35, 0xb1, 0x04, 0xc3, 0x55, 0x33, 0x57, 0x10,
+    0x12, 0x11, 0xf3, 0x53, 0x33, 0x53, 0x3c, 0xa1, 0x20, 0x22, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x10, 0x00, 0x10, 0x12, 0x10, 0x01, 0x11, 0x22, 0x00, 0x47, 0x95, 0x53, 0x33, 0x53,
+    0x87, 0x02, 0x22, 0x20, 0xf3, 0x53, 0x35, 0x3e, 0x22, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x01, 0x11, 0xa5, 0x33, 0x33, 0x35, 0x53, 0x57, 0x01, 0x20, 0x49, 0x35, 0x35, 0x53, 0x62,
+    0x02, 0x02, 0x0a, 0x93, 0x53, 0x33, 0x53, 0x39, 0x74, 0x02, 0x02, 0x20, 0x11, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x10, 0x20, 0x4f, 0x83, 0x33, 0x33, 0x35, 0x3c,
+    0xb0, 0x40, 0x11, 0x2e, 0x35, 0x33, 0x53, 0xe0, 0x01, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x11, 0x1a, 0x95, 0x35, 0x33, 0x39, 0xa2, 0x22, 0x02, 0x14, 0x95, 0x53, 0x33, 0x3e,
+    0x40, 0x20, 0x20, 0x4e, 0x33, 0x55, 0x35, 0x33, 0x38, 0xeb, 0x20, 0x00, 0x11, 0x11, 0x11, 0x10,
+    0x11, 0x10, 0x00, 0x00, 0x12, 0x21, 0x21, 0x01, 0x24, 0xad, 0x83, 0x53, 0x53, 0x35, 0x38, 0x62,
+    0x02, 0x02, 0x04, 0xc3, 0x53, 0x38, 0x3e, 0x22, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x10, 0x20, 0x47, 0xec, 0xcd, 0x74, 0x01, 0x20, 0x10, 0x10, 0x4c, 0x35, 0x35, 0x33,
+    0xcb, 0x12, 0x02, 0x20, 0xbc, 0x33, 0x33, 0x53, 0x33, 0x33, 0x9f, 0xa4, 0x11, 0x11, 0x11, 0x11,
+    0x22, 0x22, 0x22, 0x22, 0x00, 0x01, 0x10, 0xb7, 0xe8, 0x33, 0x55, 0x33, 0x55, 0x33, 0xe4, 0x12,
+    0x22, 0x20, 0xa8, 0x35, 0x33, 0x53, 0xe2, 0x10, 0x00, 0x20, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd3, 0x53, 0x35,
+    0x38, 0x70, 0x11, 0x02, 0x00, 0x79, 0x33, 0x35, 0x35, 0x33, 0x33, 0x38, 0xcf, 0x7b, 0x41, 0x01,
+    0x00, 0x11, 0x00, 0x01, 0x2b, 0xa7, 0xe9, 0x83, 0x33, 0x55, 0x33, 0x53, 0x35, 0xcb, 0x01, 0x21,
+    0x20, 0x2f, 0x33, 0x33, 0x33, 0x5f, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x35, 0x53,
+    0x53, 0x3d, 0x42, 0x21, 0x12, 0x02, 0x7c, 0x33, 0x33, 0x53, 0x35, 0x55, 0x33, 0x35, 0x89, 0xcd,
+    0xee, 0xee, 0xed, 0xcc, 0x98, 0x53, 0x33, 0x35, 0x53, 0x35, 0x53, 0x35, 0xdb, 0x21, 0x21, 0x12,
+    0x0b, 0xc5, 0x53, 0x53, 0x33, 0x60, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x63, 0x35,
+    0x35, 0x53, 0x87, 0x11, 0x02, 0x01, 0x20, 0xad, 0x53, 0x33, 0x55, 0x33, 0x35, 0x53, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x35, 0x33, 0x55, 0x35, 0x55, 0x33, 0x39, 0xfb, 0x11, 0x11, 0x21, 0x14,
+    0xf5, 0x53, 0x33, 0x33, 0x8a, 0x21, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x1a, 0x93,
+    0x55, 0x33, 0x53, 0xcb, 0x20, 0x12, 0x20, 0x10, 0x46, 0xc5, 0x33, 0x33, 0x55, 0x53, 0x35, 0x53,
+    0x53, 0x55, 0x55, 0x33, 0x53, 0x35, 0x55, 0x33, 0x33, 0x8d, 0x74, 0x10, 0x12, 0x02, 0x01, 0x79,
+    0x35, 0x33, 0x55, 0x3c, 0x42, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x20, 0x4d,
+    0x33, 0x55, 0x33, 0x33, 0xdb, 0x21, 0x02, 0x21, 0x01, 0x1b, 0x7d, 0x93, 0x33, 0x33, 0x33, 0x35,
+    0x55, 0x53, 0x35, 0x55, 0x33, 0x33, 0x33, 0x59, 0xe7, 0x40, 0x00, 0x22, 0x20, 0x01, 0xac, 0x33,
+    0x53, 0x55, 0x33, 0xf1, 0x11, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x01, 0x20,
+    0x78, 0x33, 0x53, 0x53, 0x35, 0xdb, 0x12, 0x02, 0x22, 0x00, 0x20, 0x2b, 0x6f, 0xc9, 0x83, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x38, 0x9d, 0xf7, 0xb2, 0x00, 0x02, 0x22, 0x00, 0x12, 0xac, 0x33, 0x55,
+    0x35, 0x35, 0x9a, 0x02, 0x21, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x12,
+    0x04, 0xd3, 0x35, 0x33, 0x53, 0x55, 0xda, 0x40, 0x01, 0x21, 0x22, 0x01, 0x00, 0x02, 0x4b, 0xa7,
+    0x76, 0x66, 0x67, 0x7a, 0xb4, 0x22, 0x10, 0x11, 0x22, 0x22, 0x00, 0x24, 0x79, 0x33, 0x33, 0x35,
+    0x53, 0x5f, 0x41, 0x02, 0x01, 0x01, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x11,
+    0x22, 0x0a, 0x93, 0x35, 0x33, 0x53, 0x33, 0x9f, 0xb2, 0x02, 0x00, 0x22, 0x22, 0x10, 0x00, 0x02,
+    0x10, 0x00, 0x11, 0x10, 0x01, 0x01, 0x22, 0x22, 0x11, 0x01, 0x2a, 0xe8, 0x33, 0x35, 0x33, 0x53,
+    0x3c, 0xb1, 0x11, 0x20, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x01, 0x46, 0x83, 0x35, 0x33, 0x55, 0x33, 0x3c, 0xfb, 0x40, 0x10, 0x00, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x02, 0x04, 0xae, 0x93, 0x53, 0x53, 0x33, 0x53, 0x39,
+    0x70, 0x02, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x21, 0x46, 0x83, 0x35, 0x53, 0x55, 0x33, 0x33, 0x9d, 0x6a, 0x42, 0x01, 0x10, 0x10,
+    0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x24, 0x76, 0xc8, 0x33, 0x33, 0x33, 0x35, 0x35, 0x39, 0x72,
+    0x21, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x02, 0x01, 0x46, 0x93, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x89, 0xdf, 0x6a, 0xbb,
+    0xb4, 0x44, 0x4b, 0xba, 0x76, 0xed, 0x95, 0x33, 0x35, 0x53, 0x55, 0x35, 0x53, 0x5c, 0x72, 0x21,
+    0x01, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x10, 0x21, 0x00, 0x47, 0xc5, 0x33, 0x55, 0x53, 0x35, 0x53, 0x33, 0x33, 0x33, 0x35,
+    0x55, 0x88, 0x55, 0x53, 0x33, 0x33, 0x33, 0x55, 0x53, 0x35, 0x53, 0x33, 0x8e, 0xb0, 0x01, 0x20,
+    0x20, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x01, 0x20, 0x10, 0x0b, 0x6c, 0x53, 0x33, 0x35, 0x53, 0x53, 0x35, 0x55, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x55, 0x35, 0x33, 0x35, 0x55, 0x33, 0x35, 0xd7, 0x40, 0x11, 0x21, 0x02,
+    0x00, 0x10, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x20, 0x01, 0x22, 0x22, 0x00, 0xb6, 0xc8, 0x33, 0x33, 0x33, 0x35, 0x33, 0x55,
+    0x33, 0x33, 0x33, 0x35, 0x35, 0x53, 0x33, 0x33, 0x33, 0x9d, 0x74, 0x00, 0x12, 0x20, 0x00, 0x20,
+    0x21, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x21, 0x00, 0x10, 0x20, 0x01, 0x00, 0x11, 0x00, 0x04, 0xa6, 0xd9, 0x53, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0xcd, 0x6b, 0x20, 0x00, 0x12, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x02, 0x02, 0x10, 0x11, 0x01, 0x12, 0x10, 0x00, 0x02, 0xba, 0x6f, 0xdc, 0x98,
+    0x85, 0x33, 0x58, 0x99, 0xcd, 0xf7, 0xa4, 0x20, 0x00, 0x01, 0x21, 0x00, 0x10, 0x20, 0x00, 0x10,
+    0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const tIndexedImage water = { image_data_water, 128, 128,
+    4, palette_water };
+
+#endif /* IDX_WATER_H_ */
@@ -0,0 +1,670 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: cancelar
+* size: 160x60, 8 bits per pixel, 256 cores
+*******************************************************************************/
+
+#ifndef IDX_CANCELAR_H_
+#define IDX_CANCELAR_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_cancelar[768] = {
+    0xbc, 0x3b, 0x3b, 0xbe, 0x9a, 0x9d, 0xff, 0x50, 0x4e, 0xc6, 0x3b, 0x43, 0xff, 0x4d, 0x4d, 0xb4,
+    0x43, 0x4b, 0x77, 0x5b, 0x5a, 0xa9, 0x3b, 0x3b, 0xd7, 0x69, 0x70, 0x59, 0x29, 0x25, 0xe5, 0x86,
+    0x72, 0x83, 0x54, 0x53, 0xff, 0xbf, 0xbd, 0xce, 0x20, 0x21, 0xae, 0x3d, 0x3b, 0xaf, 0x43, 0x4e,
+    0x7a, 0x5d, 0x60, 0xa9, 0xa6, 0x9f, 0x7d, 0x6e, 0x6d, 0x98, 0x6c, 0x6a, 0xb3, 0x9e, 0xa2, 0xd9,
+    0x19, 0x18, 0xcf, 0x20, 0x1a, 0xff, 0xfb, 0xfc, 0xe9, 0xd2, 0xcf, 0x44, 0x1f, 0x1a, 0xb7, 0x3e,
+    0x41, 0x58, 0x1b, 0x25, 0x69, 0x16, 0x1f, 0x6e, 0x2a, 0x23, 0x54, 0x59, 0x48, 0x6e, 0x61, 0x61,
+    0x46, 0x15, 0x1a, 0xa5, 0x49, 0x5d, 0xab, 0x60, 0x67, 0xe4, 0x12, 0x12, 0xfe, 0xb4, 0xb6, 0x8c,
+    0x4b, 0x50, 0x8b, 0x51, 0x52, 0xa1, 0x40, 0x46, 0xde, 0x16, 0x15, 0xde, 0x17, 0x19, 0x85, 0x37,
+    0x3b, 0x83, 0x4e, 0x56, 0xf8, 0xfe, 0xfd, 0xae, 0x34, 0x37, 0xfb, 0x03, 0x04, 0xfe, 0xc3, 0xc9,
+    0xfd, 0xce, 0xca, 0xff, 0x5c, 0x61, 0xe5, 0x7e, 0x79, 0x8b, 0x7d, 0x74, 0xce, 0x1f, 0x2a, 0xc9,
+    0x26, 0x2a, 0x9a, 0x43, 0x42, 0xc1, 0x27, 0x28, 0x6b, 0x62, 0x63, 0x99, 0x93, 0x8e, 0xbd, 0x2c,
+    0x2a, 0xf2, 0xed, 0xeb, 0xf3, 0xfa, 0xeb, 0xaa, 0x33, 0x35, 0x6a, 0x5e, 0x60, 0xfb, 0xfa, 0xf3,
+    0xff, 0xfc, 0xf4, 0xba, 0x2e, 0x2f, 0x78, 0x55, 0x59, 0xd9, 0x9b, 0xaa, 0x84, 0x24, 0x29, 0x81,
+    0x33, 0x26, 0xea, 0xe7, 0xe2, 0x5c, 0x46, 0x4b, 0x1b, 0x09, 0x05, 0xf1, 0xf1, 0xe6, 0xac, 0x34,
+    0x3f, 0x9a, 0x87, 0x88, 0x69, 0x63, 0x63, 0x68, 0x5e, 0x5f, 0xc8, 0xb5, 0xb6, 0x6c, 0x3f, 0x45,
+    0x32, 0x17, 0x10, 0x31, 0x1b, 0x1a, 0x21, 0x00, 0x00, 0xe6, 0x11, 0x14, 0xf2, 0x0c, 0x14, 0xdd,
+    0x17, 0x1e, 0x85, 0x81, 0x6f, 0x90, 0x96, 0x71, 0x98, 0x44, 0x49, 0x98, 0x4f, 0x4f, 0xe3, 0x17,
+    0x1d, 0xb1, 0x34, 0x32, 0x7e, 0x54, 0x51, 0x7d, 0x57, 0x56, 0xe8, 0xb5, 0xb2, 0x76, 0x5a, 0x55,
+    0xd3, 0xab, 0xaa, 0x8f, 0x4a, 0x4a, 0xde, 0x87, 0x94, 0xf9, 0x88, 0xa4, 0xb6, 0x3f, 0x3b, 0xd1,
+    0x1e, 0x25, 0xc9, 0x25, 0x25, 0xae, 0x32, 0x3b, 0x7a, 0x58, 0x57, 0xdf, 0xeb, 0xe6, 0x67, 0x5b,
+    0x5b, 0x6f, 0x4d, 0x44, 0x6c, 0x4d, 0x52, 0x79, 0x43, 0x47, 0x79, 0x53, 0x4e, 0xc7, 0x63, 0x73,
+    0xe8, 0xc2, 0xc2, 0xad, 0x6d, 0x71, 0xa8, 0x3e, 0x40, 0xa8, 0x44, 0x4c, 0xff, 0xef, 0xdf, 0xfe,
+    0xf2, 0xea, 0xd4, 0xd1, 0xd0, 0xe0, 0xd2, 0xd3, 0x5f, 0x13, 0x0e, 0x57, 0x18, 0x1e, 0x0e, 0x00,
+    0x00, 0x19, 0x00, 0x00, 0x79, 0x34, 0x31, 0x78, 0x36, 0x3a, 0x88, 0x31, 0x33, 0x81, 0x53, 0x53,
+    0xe9, 0xff, 0xfe, 0xf2, 0xfe, 0xfc, 0xcb, 0x29, 0x2f, 0xca, 0x2d, 0x39, 0xe5, 0x12, 0x1c, 0xf0,
+    0x0e, 0x18, 0xbe, 0x2b, 0x1d, 0xbc, 0x2c, 0x26, 0x9f, 0x36, 0x2e, 0xab, 0x36, 0x2c, 0x11, 0x02,
+    0x02, 0x1e, 0x01, 0x02, 0xb0, 0x30, 0x25, 0xb0, 0x30, 0x2f, 0xeb, 0xa8, 0xa0, 0xed, 0xa9, 0xb2,
+    0xf5, 0xc1, 0xbd, 0xf0, 0xc9, 0xce, 0x83, 0x48, 0x45, 0x84, 0x4f, 0x4f, 0x72, 0x5d, 0x5d, 0x72,
+    0x66, 0x65, 0xff, 0xdc, 0xdc, 0xfe, 0xe2, 0xe6, 0xc0, 0x24, 0x1c, 0xc1, 0x25, 0x24, 0x3e, 0x3e,
+    0x3d, 0x59, 0x49, 0x49, 0xb7, 0x3a, 0x1e, 0xb6, 0x3c, 0x39, 0x9e, 0x40, 0x40, 0x86, 0x77, 0x71,
+    0x96, 0x75, 0x73, 0xa6, 0x94, 0x8c, 0xaa, 0x99, 0x98, 0x63, 0x4c, 0x4f, 0x62, 0x56, 0x57, 0x44,
+    0x25, 0x29, 0x45, 0x2f, 0x2d, 0x44, 0x0b, 0x0d, 0x44, 0x17, 0x0f, 0x5c, 0x2e, 0x37, 0x6b, 0x31,
+    0x33, 0xae, 0xad, 0xab, 0xbb, 0xc4, 0xb4, 0xa0, 0x28, 0x29, 0xab, 0x2c, 0x2b, 0xde, 0x16, 0x21,
+    0xdd, 0x21, 0x2b, 0xe7, 0x17, 0x1e, 0xf5, 0x1c, 0x21, 0xcb, 0xa5, 0xa4, 0xc4, 0xbb, 0xb1, 0x8d,
+    0x4c, 0x45, 0xe5, 0xe2, 0xdd, 0x4a, 0x6a, 0x5b, 0x64, 0x5b, 0x5c, 0xc4, 0x58, 0x60, 0xbe, 0x67,
+    0x68, 0xbe, 0x89, 0x89, 0xcc, 0x82, 0x88, 0x2b, 0x01, 0x00, 0x2f, 0x08, 0x0a, 0xac, 0x87, 0x83,
+    0xee, 0xf8, 0xf2, 0xec, 0xff, 0xf4, 0xcd, 0x98, 0x99, 0xde, 0x96, 0x94, 0x19, 0x0f, 0x06, 0x1c,
+    0x19, 0x15, 0xf4, 0xe0, 0xd7, 0xf4, 0xe4, 0xe3, 0xcb, 0xc2, 0xbc, 0xd4, 0xc7, 0xca, 0x75, 0x4a,
+    0x44, 0x75, 0x4d, 0x52, 0x8b, 0x5b, 0x61, 0x99, 0x5e, 0x61, 0x8f, 0x41, 0x3d, 0x8e, 0x43, 0x45,
+    0xd5, 0xe5, 0xd5, 0xd1, 0xf7, 0xe0, 0xaa, 0x72, 0x78, 0xab, 0x77, 0x85, 0xfe, 0xc9, 0xd2, 0xfd,
+    0xd2, 0xd6, 0xf4, 0x98, 0x99, 0xff, 0x9f, 0x98, 0xf1, 0xd4, 0xca, 0xf3, 0xd5, 0xd3, 0xe3, 0x7b,
+    0x7e, 0xe6, 0x88, 0x88, 0xa2, 0x8d, 0x90, 0xad, 0x8d, 0x8f, 0xea, 0x0e, 0x0f, 0xf5, 0x08, 0x0f,
+    0xfe, 0xa6, 0x9d, 0xfe, 0xa4, 0xab, 0xa0, 0x49, 0x4f, 0x9f, 0x53, 0x52, 0xa8, 0xa6, 0xa6, 0xb8,
+    0xa5, 0xa9, 0xeb, 0x0c, 0x0a, 0xf1, 0x09, 0x07, 0x9d, 0x37, 0x43, 0xa4, 0x35, 0x43, 0x98, 0x37,
+    0x35, 0xa4, 0x33, 0x36, 0xff, 0xef, 0xf4, 0xff, 0xf6, 0xf5, 0xab, 0x37, 0x46, 0xad, 0x37, 0x4e,
+    0x87, 0x7d, 0x7d, 0x87, 0x89, 0x84, 0xa1, 0x35, 0x3b, 0xac, 0x38, 0x39, 0xa1, 0x6b, 0x62, 0xa0,
+    0x6e, 0x70, 0x87, 0x23, 0x32, 0x8a, 0x2f, 0x36, 0x8b, 0x52, 0x5d, 0x95, 0x52, 0x5e, 0xb9, 0x2e,
+    0x34, 0xb9, 0x2f, 0x3f, 0xb2, 0x35, 0x33, 0xb7, 0x36, 0x3c, 0xa1, 0x3d, 0x38, 0xa2, 0x3e, 0x3e
+};
+
+static const uint8_t image_data_cancelar[9600] = {
+    0x74, 0x74, 0xd7, 0x04, 0xb2, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xb2, 0x02, 0xd7, 0x74, 0x74,
+    0x74, 0x0a, 0x86, 0x28, 0xdf, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xe7, 0x28, 0x87, 0x0a, 0x74,
+    0xd7, 0x87, 0x16, 0x53, 0x2e, 0xdf, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xe7, 0xe7,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0xe7, 0xe7, 0x2e, 0x2e, 0x2e, 0xe7, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x53, 0x16, 0x3a, 0xe0,
+    0x02, 0x15, 0x84, 0xdf, 0xe7, 0xdf, 0x2e, 0xe7, 0xe7, 0x2e, 0x2e, 0x2e, 0x2e, 0xe7, 0xe7, 0xe6,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0xe6, 0xe6, 0xe7, 0xe7, 0x2e, 0xe7, 0xe7, 0xe7, 0xe7, 0x2e, 0x2e, 0x2e, 0x54, 0x53, 0x15, 0x31,
+    0xb2, 0xdf, 0xdf, 0xdf, 0xdf, 0xe7, 0xe7, 0x54, 0xe7, 0xe7, 0x2e, 0x2e, 0x2e, 0xe7, 0xe6, 0xe6,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe6, 0xe6, 0xe7, 0x2e, 0x2e, 0x2e, 0xe7, 0xe7, 0xe6, 0xe7, 0xe7, 0xe7, 0xe7, 0xdf, 0xdf, 0xb2,
+    0x2e, 0xdf, 0xdf, 0xdf, 0x54, 0xe6, 0xe6, 0x85, 0xe6, 0xdf, 0x2e, 0x2e, 0x2e, 0xe7, 0xe6, 0xe6,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe6, 0xe6, 0xe7, 0x2e, 0x2e, 0xdf, 0xdf, 0xe6, 0xe6, 0xe6, 0xe6, 0xe7, 0xdf, 0xdf, 0xdf, 0x2e,
+    0x2e, 0xdf, 0x2e, 0xe7, 0xe6, 0x53, 0x23, 0xe6, 0xe6, 0xdf, 0xdf, 0x2e, 0x2e, 0x2e, 0xe7, 0xe7,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe7, 0xe7, 0x2e, 0x2e, 0x2e, 0xdf, 0xdf, 0xde, 0xe6, 0x23, 0xe6, 0xe6, 0xe7, 0x2e, 0x2e, 0xdf,
+    0x2e, 0xe7, 0xe7, 0xde, 0x23, 0x23, 0x23, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0x2e, 0x2e, 0xe7, 0xe7,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe7, 0xe7, 0xe7, 0xdf, 0xdf, 0xdf, 0x54, 0xde, 0x23, 0x23, 0x23, 0xe6, 0xde, 0xdf, 0xe7, 0xdf,
+    0xe6, 0xe6, 0xe6, 0xde, 0x23, 0x23, 0x53, 0xde, 0xde, 0x54, 0xdf, 0xdf, 0xdf, 0xdf, 0xe7, 0xe7,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xe7, 0xe7, 0xe7, 0xdf, 0x54, 0x54, 0x54, 0x54, 0xde, 0x23, 0x23, 0x23, 0xe6, 0xe6, 0xe6, 0xe6,
+    0xe6, 0x23, 0x23, 0x23, 0x23, 0xde, 0xde, 0x54, 0x54, 0xde, 0xde, 0xde, 0xde, 0xde, 0xe6, 0xe6,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde, 0xde,
+    0xe6, 0xe6, 0xde, 0x23, 0x53, 0x53, 0x53, 0xde, 0xde, 0xde, 0xde, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0xde, 0x54, 0x54, 0xde, 0x53, 0x28, 0x28, 0x28, 0x28, 0x23, 0x23,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+    0x23, 0x23, 0x28, 0x15, 0x15, 0x28, 0x53, 0x85, 0x54, 0xde, 0xde, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x28, 0x23, 0x23, 0xde, 0x54, 0x54, 0xde, 0x23, 0x15, 0x16, 0x16, 0x15, 0x28, 0x28,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x28, 0x28, 0x15, 0x16, 0x16, 0x15, 0x28, 0x53, 0x54, 0xde, 0xde, 0x23, 0x23, 0x28, 0x28, 0x28,
+    0x23, 0x28, 0x28, 0x28, 0x28, 0x53, 0xde, 0xde, 0x53, 0x28, 0x15, 0x16, 0x16, 0x16, 0x15, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x15, 0x16, 0x16, 0x16, 0x15, 0x28, 0x53, 0xde, 0xde, 0x23, 0x23, 0x28, 0x28, 0x28, 0x84,
+    0x84, 0x29, 0x15, 0x15, 0x15, 0x28, 0x53, 0x53, 0x53, 0x28, 0x15, 0x16, 0x16, 0x16, 0x15, 0x29,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x15, 0x15, 0x16, 0x16, 0x15, 0x28, 0x53, 0x53, 0x23, 0x28, 0x15, 0x15, 0x15, 0x29, 0x84,
+    0x84, 0x55, 0x15, 0x16, 0x16, 0x15, 0x28, 0x23, 0x23, 0x28, 0x15, 0x15, 0x15, 0x15, 0x5a, 0x84,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x53, 0x29, 0x15, 0x15, 0x15, 0x15, 0x28, 0x53, 0x23, 0x28, 0x15, 0x16, 0x16, 0x15, 0xaf, 0x84,
+    0x84, 0xaf, 0x16, 0x16, 0x16, 0x16, 0x15, 0x28, 0x23, 0x28, 0x28, 0x15, 0x15, 0x29, 0x84, 0x85,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x85, 0x84, 0x29, 0x15, 0x15, 0x29, 0x28, 0x23, 0x23, 0x15, 0x16, 0x16, 0x16, 0x16, 0xaf, 0x84,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x15, 0x15, 0x16, 0x16, 0x15, 0x29, 0x15, 0x16, 0x0d, 0x16, 0x55, 0xb1, 0x84, 0x15, 0x86, 0x9c,
+    0x86, 0x98, 0x5a, 0x53, 0x53, 0x29, 0x15, 0x16, 0x98, 0x98, 0x16, 0x15, 0x5a, 0xaf, 0x34, 0x37,
+    0x98, 0x98, 0x16, 0x28, 0x28, 0x5a, 0x65, 0x34, 0x99, 0x66, 0x16, 0x28, 0x28, 0xaf, 0x65, 0x34,
+    0xaf, 0xaf, 0x55, 0x16, 0x16, 0x16, 0x15, 0x28, 0x28, 0x28, 0x15, 0x16, 0x0d, 0x65, 0x65, 0x65,
+    0x16, 0x15, 0x29, 0x15, 0x16, 0x16, 0x15, 0x28, 0x28, 0x28, 0x15, 0x16, 0x98, 0x98, 0x16, 0x84,
+    0x98, 0x16, 0x29, 0x85, 0x84, 0x15, 0x16, 0x15, 0x23, 0xb1, 0xb0, 0x0d, 0x55, 0xb1, 0x28, 0x16,
+    0x28, 0x28, 0x15, 0x16, 0x16, 0x16, 0x16, 0x16, 0x65, 0x55, 0x55, 0x15, 0x16, 0x16, 0x98, 0x98,
+    0x16, 0x28, 0x23, 0x28, 0x15, 0x16, 0x15, 0x28, 0x28, 0x15, 0x15, 0x29, 0x85, 0x85, 0x55, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x29, 0xb0, 0x15, 0x16, 0xb0, 0x15, 0x15, 0xb0, 0x65, 0x65, 0x34, 0xb0, 0x65, 0x16, 0x16, 0x98,
+    0x16, 0x15, 0x28, 0x28, 0x16, 0x0d, 0x98, 0x0d, 0x16, 0x16, 0x15, 0x5a, 0x84, 0xaf, 0x0d, 0x87,
+    0x99, 0x0d, 0x16, 0x15, 0x29, 0x55, 0x65, 0x34, 0x66, 0x98, 0x16, 0x15, 0x28, 0x55, 0x65, 0x34,
+    0xaf, 0x55, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x28, 0x15, 0x15, 0x16, 0x0d, 0x0d, 0x65, 0x65,
+    0x16, 0x15, 0x29, 0x15, 0x16, 0x16, 0x15, 0x15, 0x28, 0x28, 0x15, 0x16, 0x98, 0x98, 0x16, 0x84,
+    0x98, 0x16, 0x15, 0x84, 0x5a, 0x15, 0x16, 0x15, 0xb1, 0x15, 0x99, 0x8d, 0x41, 0x82, 0x98, 0x86,
+    0x29, 0x15, 0x15, 0x16, 0x16, 0x16, 0x16, 0x16, 0x65, 0x55, 0x55, 0x55, 0x16, 0x16, 0x16, 0x98,
+    0x16, 0x15, 0x29, 0x29, 0x16, 0x16, 0x16, 0x15, 0x16, 0x16, 0x16, 0x15, 0x84, 0x84, 0x15, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x15, 0x15, 0x15, 0x65, 0x16, 0x66, 0x35, 0x34, 0x82, 0x83, 0xfa, 0xad, 0xae, 0x3a, 0x34, 0xb0,
+    0xb0, 0xb0, 0xb1, 0x65, 0x99, 0x87, 0x99, 0x0d, 0x65, 0xaf, 0xaf, 0xaf, 0xaf, 0x55, 0x0d, 0x98,
+    0x0d, 0x0d, 0x16, 0x15, 0x15, 0x15, 0x65, 0x0d, 0x66, 0x98, 0x16, 0x16, 0x15, 0x16, 0x0d, 0x34,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x16, 0x16, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x98, 0x16, 0x55, 0x55, 0x0d, 0x0d, 0x0d, 0x55, 0x55, 0x55, 0x55, 0x0d, 0x98, 0x98, 0x16, 0x55,
+    0x16, 0x16, 0x65, 0x65, 0x65, 0x0d, 0x16, 0x55, 0xaf, 0x35, 0xd7, 0x97, 0x75, 0x30, 0x32, 0x88,
+    0xaf, 0x55, 0x65, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x65, 0x55, 0xaf, 0xaf, 0x55, 0x65, 0x0d, 0x0d,
+    0x66, 0x0d, 0x65, 0x65, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x98, 0x98, 0x0d, 0x65, 0x65, 0x0d, 0x99,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x35, 0x98, 0xb0, 0xb0, 0x98, 0xfa, 0x05, 0xdb, 0x24, 0xd4, 0x96, 0x97, 0xd5, 0xe1, 0x08, 0xfb,
+    0x99, 0x65, 0xb0, 0x0d, 0x99, 0x3a, 0x37, 0x65, 0x65, 0x65, 0x34, 0x34, 0x0d, 0x15, 0x15, 0x16,
+    0x65, 0x65, 0x16, 0x16, 0x16, 0x16, 0x65, 0x65, 0x0d, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x0d, 0x0d,
+    0x16, 0x16, 0x16, 0x98, 0x66, 0x66, 0x66, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x16, 0x16, 0x16,
+    0x98, 0x0d, 0x65, 0x65, 0x65, 0x34, 0x34, 0x34, 0x65, 0x65, 0x65, 0x34, 0x99, 0x66, 0x0d, 0x15,
+    0x65, 0x0d, 0x34, 0x34, 0x35, 0x66, 0x65, 0xaf, 0xb0, 0x8d, 0x90, 0x2c, 0x2c, 0xed, 0xc2, 0x1b,
+    0x34, 0x34, 0x65, 0x0d, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x65, 0x55, 0xaf, 0x65, 0x65, 0x65, 0x65,
+    0x37, 0x35, 0x34, 0x34, 0x34, 0x34, 0x34, 0x66, 0x66, 0x99, 0x99, 0x99, 0x66, 0x66, 0x66, 0x66,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x8c, 0x99, 0x66, 0x35, 0x03, 0xe0, 0x74, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xed, 0x97, 0xd5,
+    0x08, 0xad, 0x82, 0x34, 0x66, 0x66, 0x66, 0x65, 0x65, 0x34, 0x37, 0x87, 0x99, 0x16, 0x15, 0x28,
+    0x34, 0x65, 0x0d, 0x16, 0x16, 0x0d, 0x0d, 0x34, 0x65, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x0d, 0x0d,
+    0x16, 0x16, 0x16, 0x0d, 0x66, 0x66, 0x35, 0x35, 0x35, 0x34, 0x34, 0x0d, 0x0d, 0x16, 0x16, 0x16,
+    0x98, 0x66, 0x0d, 0x65, 0x65, 0x35, 0x37, 0x35, 0x34, 0x34, 0x34, 0x66, 0x99, 0x66, 0x0d, 0x0d,
+    0x65, 0x0d, 0x37, 0x37, 0x3a, 0x37, 0x66, 0xaf, 0xb0, 0x4a, 0xd9, 0x80, 0x80, 0x17, 0x14, 0x50,
+    0x35, 0x35, 0x66, 0x66, 0x66, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x0d, 0x65, 0x65, 0x65, 0x34, 0x34,
+    0x35, 0x35, 0x35, 0x35, 0x34, 0x34, 0x34, 0x66, 0x66, 0x99, 0x99, 0x99, 0x99, 0x99, 0x66, 0x0d,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x3a, 0x03, 0xae, 0x05, 0xd5, 0x74, 0x40, 0xc1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x2c, 0x40,
+    0x96, 0x7e, 0xfa, 0x82, 0x35, 0x98, 0x98, 0x16, 0x15, 0x65, 0x66, 0x87, 0x86, 0x66, 0x16, 0x16,
+    0x34, 0x34, 0x0d, 0x16, 0x16, 0x66, 0x66, 0x35, 0x34, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x0d, 0x65,
+    0x16, 0x16, 0x16, 0x0d, 0x66, 0x35, 0x37, 0x37, 0x37, 0x35, 0x34, 0x65, 0x65, 0x65, 0x15, 0x16,
+    0x86, 0x98, 0x66, 0x0d, 0x65, 0x66, 0x3a, 0x3a, 0x37, 0x35, 0x37, 0x37, 0x99, 0x66, 0x0d, 0x0d,
+    0x65, 0x66, 0x37, 0x3a, 0x3a, 0x87, 0x99, 0x65, 0x34, 0xeb, 0x91, 0x80, 0x80, 0x17, 0x14, 0x51,
+    0x87, 0x87, 0x37, 0x99, 0x66, 0x0d, 0x16, 0x16, 0x16, 0x16, 0x0d, 0x0d, 0x0d, 0x66, 0x34, 0x34,
+    0x35, 0x35, 0x37, 0x35, 0x34, 0x65, 0x34, 0x66, 0x66, 0x66, 0x66, 0x99, 0x86, 0x99, 0x0d, 0x55,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x65, 0x37, 0x72, 0x74, 0x40, 0x40, 0x3b, 0x2c, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x2c, 0x3f,
+    0x40, 0x20, 0xad, 0x99, 0x16, 0x98, 0x98, 0x16, 0x15, 0x15, 0x0d, 0x99, 0x87, 0x99, 0x98, 0x98,
+    0x35, 0x35, 0x0d, 0x16, 0x16, 0x99, 0x37, 0x37, 0x35, 0x34, 0x0d, 0x0d, 0x16, 0x0d, 0x34, 0x34,
+    0x66, 0x66, 0x0d, 0x0d, 0x34, 0x35, 0x37, 0x37, 0x37, 0x35, 0x35, 0x34, 0x65, 0x65, 0x0d, 0x0d,
+    0x86, 0x86, 0x99, 0x0d, 0x0d, 0x66, 0x87, 0x87, 0x86, 0x99, 0x86, 0x87, 0x99, 0x66, 0x66, 0x99,
+    0x0d, 0x66, 0x66, 0x37, 0x87, 0x86, 0x86, 0x16, 0x65, 0x2d, 0x30, 0x17, 0x2c, 0x17, 0x14, 0x51,
+    0x86, 0x86, 0x86, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x98, 0x99, 0x99, 0x99, 0x66, 0x66,
+    0x0d, 0x66, 0x99, 0x99, 0x66, 0x0d, 0x66, 0x99, 0x66, 0x0d, 0x65, 0x66, 0x86, 0x86, 0x0d, 0x55,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0xb0, 0xfa, 0x0c, 0x75, 0x3f, 0x2c, 0x17, 0x17, 0x14, 0x47, 0x48, 0x52, 0x20, 0x13, 0x18, 0x40,
+    0xc1, 0xbe, 0x3d, 0x34, 0x16, 0x98, 0x86, 0x98, 0x16, 0x66, 0x3a, 0x41, 0x8d, 0x41, 0x87, 0x87,
+    0xfa, 0x37, 0x0d, 0x0d, 0x66, 0x87, 0x8d, 0x2d, 0xfb, 0xfa, 0x82, 0x35, 0x37, 0x3a, 0x41, 0xfa,
+    0x3a, 0x3a, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x37, 0x37, 0x37, 0x35, 0x37, 0x37, 0x3a, 0x3a,
+    0x41, 0x3a, 0x3a, 0x66, 0x0d, 0x0d, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x37, 0x37, 0x3a,
+    0x99, 0x37, 0x35, 0x35, 0x99, 0x86, 0x86, 0x16, 0x16, 0xfc, 0x0c, 0xed, 0x17, 0xed, 0x01, 0x51,
+    0x86, 0x86, 0x98, 0x99, 0x37, 0x37, 0x37, 0x3a, 0x3a, 0x3a, 0x87, 0x87, 0x87, 0x87, 0x99, 0x99,
+    0x16, 0x16, 0x86, 0x86, 0x66, 0x99, 0x87, 0x87, 0x37, 0x34, 0x65, 0x35, 0x8c, 0x8c, 0x37, 0x65,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0xfa, 0x08, 0x97, 0x40, 0x2c, 0xc1, 0x17, 0x95, 0x52, 0xa7, 0x44, 0xe9, 0xee, 0x44, 0x1d, 0xf4,
+    0xd0, 0x52, 0xae, 0x34, 0xb0, 0x98, 0x3a, 0x8c, 0x89, 0x07, 0xea, 0xea, 0xff, 0x3d, 0xfa, 0x83,
+    0xf3, 0xae, 0x82, 0x16, 0x16, 0x41, 0xfe, 0xce, 0x27, 0xe9, 0xfb, 0xfa, 0x2d, 0xeb, 0xf2, 0xe8,
+    0x72, 0xad, 0x2d, 0xfa, 0x82, 0x99, 0x82, 0x66, 0x82, 0x37, 0x3a, 0xae, 0xfd, 0xf3, 0xf2, 0xf2,
+    0x72, 0xad, 0x2d, 0x83, 0x99, 0x66, 0x66, 0x98, 0x98, 0x86, 0x8c, 0x00, 0xae, 0x67, 0xeb, 0xee,
+    0x89, 0xae, 0x00, 0x82, 0x35, 0x86, 0x98, 0x66, 0x66, 0x8d, 0x0c, 0x40, 0x17, 0xed, 0x14, 0x50,
+    0x16, 0x66, 0x82, 0x37, 0xfa, 0x1a, 0xeb, 0xe9, 0xf2, 0xf2, 0x72, 0x88, 0xae, 0x8d, 0x87, 0x3a,
+    0x16, 0x98, 0x3a, 0x86, 0x86, 0x9d, 0x88, 0xfe, 0xfc, 0xfa, 0x37, 0xae, 0xfe, 0xfe, 0xeb, 0xfa,
+    0x37, 0x37, 0x99, 0x37, 0x3a, 0x3a, 0x37, 0x3a, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0xe8, 0x24, 0xed, 0x40, 0x81, 0x2c, 0x39, 0x52, 0x1c, 0xe9, 0xfb, 0x82, 0x83, 0xfb, 0xeb, 0x72,
+    0x19, 0xbd, 0xfa, 0x83, 0xfa, 0xb9, 0xdb, 0x24, 0xd5, 0x97, 0xec, 0x97, 0x96, 0x24, 0xda, 0x67,
+    0x7e, 0xfc, 0x35, 0x0d, 0x66, 0xfc, 0x8e, 0x97, 0x97, 0x2f, 0x58, 0xe8, 0xba, 0x0c, 0xd5, 0x97,
+    0xd5, 0x0c, 0x6f, 0xad, 0xae, 0x83, 0x98, 0x35, 0x98, 0x83, 0x5b, 0x72, 0x22, 0x8e, 0xd4, 0x97,
+    0x97, 0xd5, 0x62, 0x73, 0x2d, 0x98, 0x82, 0x66, 0x3a, 0xfc, 0xf3, 0x05, 0xd6, 0xd5, 0x96, 0xec,
+    0x96, 0x0c, 0x08, 0x05, 0xfa, 0x41, 0x87, 0x66, 0x66, 0x3d, 0x30, 0x40, 0x17, 0x17, 0x14, 0xc5,
+    0xb0, 0x66, 0x99, 0x67, 0x6f, 0x62, 0x2f, 0x96, 0xec, 0xec, 0xd5, 0xd5, 0xe1, 0xda, 0xeb, 0xf3,
+    0x82, 0x99, 0x3a, 0x8c, 0x9d, 0xd7, 0xd5, 0x74, 0x24, 0x73, 0xef, 0xe1, 0x96, 0x75, 0x2f, 0xe3,
+    0x87, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x87, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+    0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+    0x61, 0x97, 0x40, 0x81, 0x80, 0xc1, 0xa5, 0xa7, 0x4a, 0x83, 0x83, 0x37, 0x41, 0xfa, 0x41, 0x37,
+    0x88, 0xfc, 0xfa, 0x3d, 0xc3, 0xed, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0xed, 0xec, 0x30,
+    0xe3, 0xea, 0x37, 0xb0, 0x82, 0x88, 0x0c, 0x40, 0x17, 0x17, 0x20, 0x70, 0xec, 0xed, 0x40, 0x40,
+    0x17, 0xed, 0xec, 0x62, 0xf2, 0xae, 0x37, 0x66, 0x99, 0x8c, 0xfe, 0x8e, 0x75, 0x40, 0xed, 0x17,
+    0x17, 0xec, 0xec, 0x96, 0xba, 0x1a, 0x99, 0x3a, 0xae, 0x9e, 0x8e, 0x97, 0xed, 0x17, 0x17, 0x17,
+    0x40, 0x40, 0xed, 0x96, 0xb9, 0x3d, 0x00, 0x99, 0x82, 0xf2, 0xd8, 0x81, 0x81, 0x17, 0x14, 0x50,
+    0x66, 0x82, 0xfd, 0xd6, 0x97, 0x17, 0x17, 0x17, 0x2c, 0x17, 0x17, 0xed, 0x75, 0x75, 0x0c, 0xe3,
+    0x8c, 0x41, 0xfa, 0xae, 0xf2, 0x0c, 0xed, 0x40, 0xed, 0x20, 0x97, 0xec, 0xed, 0x17, 0x75, 0xa3,
+    0xae, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3a, 0x41, 0x41, 0x41, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0xf5, 0xed, 0x40, 0x81, 0xc1, 0xac, 0x7b, 0xe8, 0xfb, 0x35, 0x37, 0xfc, 0x89, 0xae, 0x3a, 0x82,
+    0x37, 0x37, 0xfa, 0x36, 0x97, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x3f, 0x40, 0x40,
+    0x5e, 0x44, 0xfa, 0x82, 0x37, 0xea, 0xd8, 0x3c, 0x2c, 0x2c, 0x77, 0x17, 0x40, 0x3f, 0x40, 0x2c,
+    0x81, 0x3f, 0x40, 0x75, 0xb5, 0xeb, 0x00, 0x37, 0x83, 0x89, 0x30, 0x74, 0x40, 0xc0, 0x81, 0x81,
+    0x81, 0x2c, 0x17, 0x75, 0xd9, 0x1d, 0xfb, 0xfb, 0x36, 0x5e, 0x75, 0xed, 0x2c, 0x80, 0x80, 0x2c,
+    0x80, 0x80, 0xc0, 0x17, 0x97, 0x58, 0x1a, 0x83, 0x83, 0xe9, 0x18, 0x80, 0x80, 0x17, 0x01, 0x50,
+    0x87, 0xfd, 0xf2, 0xd4, 0x17, 0x17, 0x80, 0x80, 0x80, 0x80, 0x81, 0x3f, 0x17, 0x17, 0xec, 0x70,
+    0xea, 0xf3, 0xfd, 0x4a, 0x58, 0xd4, 0x17, 0xc1, 0x17, 0x77, 0xec, 0x17, 0x2c, 0x81, 0x2c, 0x9a,
+    0xad, 0x8d, 0xfa, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x01, 0xed, 0x17, 0xed, 0x17, 0x39, 0xbd, 0xe8, 0xfa, 0x82, 0x82, 0x9c, 0x89, 0x89, 0xfa, 0x83,
+    0x99, 0x99, 0xfc, 0xce, 0xec, 0x81, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x2c, 0x2c, 0x81, 0x2c,
+    0x75, 0x7d, 0x67, 0x82, 0x3a, 0x9e, 0xd8, 0x2c, 0x81, 0x2c, 0x17, 0x17, 0x40, 0x3c, 0x40, 0x75,
+    0x2c, 0x2c, 0x3c, 0x40, 0xb3, 0x45, 0x4a, 0xfa, 0x3d, 0xdb, 0x75, 0x40, 0x3f, 0x81, 0x2c, 0x2c,
+    0x81, 0x17, 0x17, 0x2c, 0x40, 0x52, 0xef, 0xe9, 0xbb, 0x40, 0x40, 0x40, 0x80, 0x80, 0x80, 0x17,
+    0xc1, 0x80, 0x80, 0x2c, 0x17, 0x70, 0x44, 0xfb, 0xfb, 0xe9, 0x18, 0x80, 0x80, 0x17, 0x01, 0xa7,
+    0x8d, 0x0e, 0x36, 0x96, 0x17, 0x2c, 0x80, 0x80, 0x80, 0x81, 0xc0, 0x2c, 0x17, 0x17, 0x2c, 0x2c,
+    0x7c, 0xea, 0x67, 0x67, 0x27, 0xd9, 0x2c, 0x80, 0x80, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x17, 0xa6,
+    0xad, 0xae, 0xfc, 0x8d, 0x8d, 0x41, 0x41, 0xfc, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+    0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+    0xb3, 0xec, 0x17, 0x17, 0x17, 0xcc, 0x79, 0x9e, 0x5b, 0x87, 0x87, 0x87, 0x8c, 0x8d, 0xfc, 0x8d,
+    0xfc, 0x41, 0xfd, 0xe8, 0x8f, 0x91, 0xdc, 0xa3, 0x51, 0xc4, 0x7a, 0x51, 0x4b, 0x17, 0x17, 0x2c,
+    0x3f, 0x13, 0xf6, 0xfa, 0x00, 0xea, 0x70, 0x17, 0x2c, 0xc0, 0x3f, 0x40, 0x39, 0x51, 0xbe, 0x13,
+    0x3b, 0x2c, 0x2c, 0x3c, 0x40, 0xbd, 0x36, 0xe9, 0x73, 0x96, 0x75, 0x3f, 0xc1, 0xc0, 0xf0, 0x51,
+    0x7b, 0x09, 0xb3, 0x40, 0x3f, 0x52, 0xe9, 0xe8, 0x96, 0x81, 0x49, 0x40, 0x69, 0xb7, 0xc5, 0xbd,
+    0xa6, 0xb4, 0xc0, 0x81, 0xc0, 0x40, 0xaa, 0xee, 0xfb, 0xe9, 0xd9, 0x81, 0x81, 0x17, 0x01, 0x50,
+    0x9d, 0xad, 0x9e, 0x8f, 0x91, 0xdd, 0xa4, 0x51, 0x48, 0x7b, 0x19, 0xdd, 0xed, 0x17, 0x2c, 0x80,
+    0x5d, 0x2a, 0xfb, 0xfb, 0xef, 0xd4, 0xc0, 0x81, 0x81, 0x2c, 0x3b, 0x39, 0x7b, 0xbe, 0x4f, 0x52,
+    0xad, 0x8d, 0xfc, 0x8d, 0x5b, 0x5b, 0x8d, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0x5e, 0xed, 0x17, 0x2c, 0x17, 0x42, 0x79, 0xff, 0x0e, 0x8c, 0x8c, 0x8c, 0x9d, 0xfc, 0x67, 0x4a,
+    0x89, 0x8d, 0xfd, 0x67, 0xe8, 0x1c, 0xa7, 0x78, 0x1d, 0x45, 0x45, 0x7e, 0x59, 0xd5, 0x17, 0x2c,
+    0x81, 0xbf, 0x1c, 0xae, 0xfd, 0xce, 0x30, 0x17, 0xed, 0x17, 0x17, 0x4d, 0x8a, 0x50, 0x2a, 0xf7,
+    0x4e, 0xed, 0x40, 0x3f, 0x40, 0x50, 0x92, 0x58, 0xbc, 0xec, 0x40, 0x81, 0xc1, 0xf0, 0x52, 0x1b,
+    0x7e, 0xf2, 0x2a, 0x33, 0xac, 0x52, 0xef, 0x6f, 0xed, 0xc1, 0x40, 0x75, 0xa6, 0xc4, 0xaa, 0xe9,
+    0xe8, 0x7d, 0x96, 0x17, 0x81, 0x3c, 0x13, 0x44, 0xfb, 0xe9, 0xd5, 0x2c, 0x2c, 0x17, 0x01, 0x50,
+    0x41, 0xae, 0x72, 0xea, 0x78, 0xbd, 0x78, 0x1d, 0x7e, 0xea, 0xea, 0x7c, 0x96, 0xed, 0x2c, 0x80,
+    0x57, 0x09, 0x67, 0xfb, 0xee, 0xd4, 0x40, 0x2c, 0xc0, 0x40, 0x33, 0x8a, 0x09, 0xce, 0xf7, 0x44,
+    0x8d, 0xfc, 0x5b, 0x5b, 0xfc, 0x5b, 0x8d, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+    0x43, 0x17, 0xc1, 0x80, 0xc1, 0x12, 0x1c, 0x07, 0x5b, 0x89, 0x89, 0x89, 0x89, 0x2d, 0x67, 0xfb,
+    0x89, 0xfc, 0xfa, 0xfa, 0x1a, 0xf2, 0x88, 0x89, 0x9c, 0x9c, 0x9c, 0x00, 0xeb, 0xd4, 0x17, 0x81,
+    0x80, 0x4b, 0x1c, 0x4a, 0x3d, 0xce, 0x30, 0xed, 0x17, 0x17, 0xe5, 0x7a, 0xa9, 0xb5, 0x9e, 0x1a,
+    0xd3, 0xed, 0x40, 0x3f, 0x40, 0xa5, 0x4f, 0x25, 0x43, 0xed, 0x3f, 0x81, 0x2c, 0x7b, 0x1b, 0x58,
+    0xfc, 0xfa, 0x3d, 0xca, 0xa6, 0xbd, 0xef, 0x63, 0xed, 0xc1, 0x40, 0x96, 0x8b, 0x09, 0x9e, 0x83,
+    0xfb, 0xef, 0x8f, 0x40, 0x3c, 0x3c, 0xa1, 0x78, 0x4a, 0xe9, 0xd4, 0x17, 0x17, 0x40, 0x14, 0x50,
+    0x41, 0x8c, 0x64, 0xfe, 0xea, 0xff, 0x07, 0x5b, 0x8d, 0x41, 0xfc, 0xfe, 0x2f, 0xed, 0x2c, 0x80,
+    0x57, 0xa8, 0xfb, 0x83, 0xfb, 0xd4, 0x40, 0x3c, 0x40, 0xc8, 0x7a, 0x09, 0x2a, 0x07, 0x2d, 0x5b,
+    0xfc, 0xfc, 0x8d, 0x5b, 0xfc, 0xfc, 0x8d, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0xb3, 0xed, 0x17, 0x81, 0x2c, 0x4b, 0x79, 0x27, 0x9d, 0xfc, 0x89, 0x89, 0x88, 0xfe, 0xf3, 0x4a,
+    0x89, 0x8c, 0x83, 0x83, 0x8d, 0xe8, 0x71, 0x60, 0x76, 0xc0, 0x81, 0x80, 0x80, 0x81, 0x81, 0x17,
+    0x17, 0x39, 0xa8, 0x07, 0xfa, 0xfe, 0xd8, 0x2c, 0x2c, 0x17, 0x11, 0x50, 0x36, 0xfb, 0xfa, 0xfe,
+    0x56, 0x40, 0x17, 0x2c, 0x81, 0xa5, 0xf7, 0xff, 0x5e, 0x40, 0x2c, 0x2c, 0x69, 0x7a, 0xce, 0x37,
+    0x89, 0x41, 0x41, 0xfc, 0x2d, 0x67, 0xee, 0x8f, 0xed, 0x2c, 0x2c, 0x17, 0x17, 0x3f, 0x3f, 0x17,
+    0xec, 0x17, 0x3f, 0x17, 0x17, 0x40, 0x11, 0xa8, 0x67, 0xfb, 0xd4, 0x81, 0x81, 0x17, 0x01, 0x50,
+    0x9d, 0x2d, 0x67, 0xef, 0x27, 0x71, 0x60, 0x77, 0x3b, 0x3b, 0x3f, 0x17, 0x17, 0x17, 0x17, 0x2c,
+    0xa1, 0xa8, 0x36, 0x07, 0xf2, 0xd4, 0xed, 0x17, 0x17, 0x01, 0xa7, 0x36, 0xeb, 0x3d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+    0xbb, 0xed, 0x17, 0x2c, 0x2c, 0xe5, 0x1b, 0xea, 0x2d, 0x5b, 0x89, 0x89, 0xfe, 0x07, 0x4a, 0x67,
+    0x88, 0x07, 0x3d, 0x3d, 0xb9, 0x30, 0x75, 0x40, 0x40, 0x3f, 0x17, 0x81, 0x81, 0x81, 0x2c, 0x2c,
+    0x17, 0x39, 0xa8, 0xf2, 0xfa, 0xff, 0xd8, 0x2c, 0x2c, 0x17, 0x11, 0x50, 0x36, 0xfb, 0xfd, 0xfe,
+    0x56, 0xed, 0x17, 0x2c, 0x81, 0xa5, 0xf7, 0xff, 0x90, 0x3f, 0x2c, 0x81, 0x76, 0xc4, 0xce, 0x83,
+    0x72, 0x88, 0x8d, 0x9d, 0x3d, 0xee, 0x27, 0x90, 0x17, 0x2c, 0x17, 0x17, 0xed, 0x2c, 0x81, 0xc1,
+    0x40, 0x81, 0x80, 0x81, 0x3f, 0x3f, 0x11, 0xa8, 0x07, 0xee, 0xd4, 0x2c, 0x81, 0x17, 0x01, 0x20,
+    0x88, 0xfe, 0x73, 0x21, 0xd4, 0xec, 0x17, 0x17, 0x81, 0x2c, 0x2c, 0x3f, 0x3f, 0x17, 0x2c, 0x2c,
+    0xa1, 0xa8, 0x36, 0x07, 0xe8, 0xd4, 0xed, 0x17, 0x17, 0x14, 0xa7, 0x36, 0xfe, 0xf3, 0xf3, 0xf3,
+    0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0xf5, 0xed, 0xed, 0xc0, 0x81, 0x17, 0x20, 0xe2, 0x4a, 0xfd, 0x9d, 0xfc, 0x88, 0xeb, 0x4a, 0xee,
+    0xe2, 0xce, 0x36, 0xe3, 0x30, 0x75, 0x40, 0x40, 0x17, 0xed, 0x17, 0x17, 0x17, 0x2c, 0xc0, 0x2c,
+    0x17, 0x39, 0xa8, 0xfe, 0xfd, 0x9e, 0xd8, 0x2c, 0x2c, 0x17, 0xe4, 0x50, 0x36, 0xfb, 0xfd, 0xfe,
+    0xa0, 0xec, 0x17, 0x17, 0x2c, 0xa5, 0x7e, 0x9e, 0x90, 0x3f, 0x2c, 0x17, 0x69, 0x48, 0x36, 0x99,
+    0x45, 0xff, 0x72, 0x88, 0xff, 0x73, 0xf7, 0x5e, 0x40, 0xc1, 0x17, 0x17, 0x17, 0x3f, 0x81, 0x2c,
+    0x40, 0xc1, 0x80, 0x80, 0x81, 0x69, 0x1e, 0xbe, 0xff, 0xee, 0xd4, 0x81, 0x81, 0x17, 0x01, 0x50,
+    0x9e, 0x59, 0x92, 0x74, 0xed, 0x3f, 0xc0, 0x2c, 0x2c, 0xc0, 0x17, 0x17, 0x17, 0x3f, 0x2c, 0x81,
+    0xa1, 0x20, 0xcf, 0xff, 0x9e, 0x30, 0xed, 0x2c, 0x17, 0x14, 0xa7, 0x36, 0xfe, 0x07, 0x07, 0xf3,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0xcf, 0x96, 0x40, 0x81, 0xc1, 0xc0, 0xa0, 0x2a, 0x27, 0x67, 0x3d, 0xf3, 0x72, 0x72, 0xe8, 0xe9,
+    0xcf, 0xcf, 0x25, 0xc2, 0x75, 0x40, 0x81, 0x81, 0x12, 0xa9, 0xbd, 0x52, 0x7b, 0xc8, 0x17, 0x3f,
+    0x17, 0x39, 0x19, 0x9e, 0xfd, 0x9e, 0xd8, 0x2c, 0x2c, 0x17, 0xe4, 0x50, 0x58, 0xfd, 0xfd, 0xfe,
+    0xf5, 0xec, 0xec, 0x17, 0x2c, 0xa5, 0x7e, 0x36, 0x60, 0x40, 0x17, 0x17, 0x2c, 0x51, 0xcf, 0x03,
+    0x05, 0x07, 0x9e, 0xce, 0xb5, 0x2a, 0xe2, 0x8f, 0xed, 0x2c, 0xc1, 0xb6, 0x7a, 0x8a, 0x7b, 0x52,
+    0x52, 0x8a, 0x7a, 0x7a, 0x8a, 0xc4, 0x7a, 0xaa, 0x72, 0xee, 0xd5, 0x80, 0x80, 0x2c, 0x11, 0xc5,
+    0xfe, 0x2a, 0x60, 0x75, 0x40, 0x81, 0x81, 0x12, 0xc5, 0xc5, 0x7a, 0x8a, 0xc8, 0x17, 0x17, 0x17,
+    0x39, 0x19, 0xcf, 0x9e, 0xce, 0x30, 0x17, 0x2c, 0x2c, 0x14, 0xa7, 0x61, 0x9e, 0xfe, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe2, 0xc2, 0x40, 0xc0, 0x81, 0x2c, 0xec, 0x13, 0x58, 0x27, 0x73, 0x73, 0xce, 0x2a, 0xe3, 0xbc,
+    0x97, 0xcd, 0x25, 0x70, 0xed, 0x2c, 0xc1, 0xe4, 0x8a, 0x20, 0x7d, 0x2b, 0x6d, 0xd9, 0x17, 0xed,
+    0x17, 0x39, 0x19, 0x9e, 0x0e, 0x36, 0xd8, 0x2c, 0x17, 0x17, 0x11, 0x50, 0x58, 0x4a, 0x0e, 0x9e,
+    0xf5, 0xec, 0xec, 0x17, 0x2c, 0xa5, 0x7c, 0x36, 0xbb, 0x40, 0x17, 0x17, 0x17, 0xf0, 0x7d, 0xeb,
+    0xfb, 0x4a, 0xcf, 0xbf, 0xd8, 0x93, 0x58, 0xbc, 0xed, 0x40, 0x81, 0x2c, 0x9a, 0xa3, 0xcf, 0xef,
+    0xe8, 0x25, 0x6d, 0xf8, 0x25, 0x6d, 0xca, 0xce, 0x4a, 0xef, 0xd4, 0x80, 0x80, 0x81, 0x11, 0xc5,
+    0x4a, 0x9e, 0x90, 0x40, 0x3c, 0xc1, 0xab, 0x7a, 0xa9, 0x4f, 0x4f, 0xcb, 0x96, 0xec, 0x17, 0x17,
+    0x39, 0x19, 0xcf, 0x36, 0xcf, 0x30, 0x40, 0x81, 0x2c, 0x14, 0xa7, 0xb5, 0x36, 0xfe, 0xff, 0x72,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0xff, 0xe3, 0x74, 0x40, 0xc1, 0x81, 0x17, 0xec, 0x43, 0x71, 0x61, 0x25, 0x13, 0xbb, 0x91, 0xed,
+    0xec, 0xa9, 0x4f, 0x91, 0x17, 0xc0, 0x81, 0x69, 0x3e, 0xcc, 0xcc, 0xd3, 0x91, 0x17, 0x75, 0x40,
+    0x17, 0x39, 0x19, 0x36, 0x72, 0xce, 0xd8, 0x2c, 0x17, 0x17, 0x11, 0x50, 0x61, 0xee, 0x72, 0x36,
+    0xa0, 0xed, 0x17, 0x2c, 0x81, 0xa5, 0x7c, 0x36, 0xf4, 0x75, 0x17, 0x17, 0x2c, 0xc0, 0xdd, 0x22,
+    0xef, 0x6f, 0x5e, 0x75, 0x40, 0xbe, 0x2a, 0xe3, 0x75, 0x3f, 0xc1, 0x2c, 0x3b, 0xa2, 0xcd, 0x21,
+    0x21, 0xf9, 0xd3, 0x43, 0xd4, 0xd5, 0x26, 0x36, 0xfb, 0xef, 0xd4, 0x2c, 0x81, 0x2c, 0x11, 0xc5,
+    0xfb, 0x0f, 0x8f, 0x75, 0x40, 0x2c, 0x3b, 0x6a, 0xf8, 0x2b, 0xbb, 0xd5, 0xed, 0x17, 0x17, 0x17,
+    0x39, 0x19, 0x61, 0x36, 0xcf, 0xd9, 0x40, 0x81, 0x2c, 0x14, 0x50, 0xb5, 0x36, 0x9e, 0xff, 0x72,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0x72, 0x36, 0xbb, 0x40, 0x2c, 0xc0, 0x17, 0x17, 0x17, 0xed, 0x75, 0xed, 0x40, 0x40, 0x40, 0x40,
+    0xec, 0xa6, 0x4f, 0x60, 0x17, 0x17, 0xc1, 0x81, 0x81, 0xed, 0x17, 0xed, 0x17, 0x40, 0x40, 0x3c,
+    0x17, 0x39, 0x19, 0xcf, 0xff, 0xcf, 0xd8, 0x17, 0x17, 0x17, 0x14, 0x50, 0x61, 0x72, 0x72, 0x36,
+    0x33, 0x17, 0x17, 0x2c, 0x81, 0xa5, 0x7c, 0x36, 0xb5, 0x90, 0xec, 0x17, 0x81, 0x81, 0x40, 0x75,
+    0xec, 0xed, 0x40, 0x3f, 0x40, 0xbd, 0xcf, 0x59, 0x70, 0x40, 0x40, 0x17, 0x17, 0x17, 0x17, 0x97,
+    0xed, 0xec, 0x17, 0xec, 0x17, 0x97, 0xbd, 0x59, 0xee, 0xef, 0xd4, 0x17, 0x17, 0x17, 0x01, 0x50,
+    0x1a, 0xea, 0x8f, 0x40, 0x3c, 0xc1, 0x2c, 0x17, 0xed, 0xec, 0xec, 0xed, 0xed, 0x17, 0x81, 0x2c,
+    0xdc, 0x19, 0x61, 0x58, 0x92, 0xd9, 0x40, 0x2c, 0x2c, 0x14, 0xa8, 0xb5, 0x36, 0x36, 0x9e, 0x27,
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0xeb, 0x27, 0x92, 0xbf, 0x40, 0x17, 0x17, 0x17, 0xed, 0x17, 0x17, 0x40, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x40, 0x48, 0x4f, 0x13, 0xec, 0x17, 0xc1, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xc1, 0x2c, 0x2c,
+    0x17, 0x39, 0x19, 0xcf, 0x9e, 0xcf, 0xd9, 0x17, 0x17, 0x17, 0x14, 0x50, 0x61, 0x9e, 0x27, 0x58,
+    0xf0, 0x17, 0x17, 0x2c, 0x2c, 0xa5, 0x7c, 0x36, 0xb5, 0xcd, 0x97, 0x17, 0x2c, 0x80, 0xc1, 0x40,
+    0x80, 0x81, 0x81, 0xc1, 0x3c, 0x7b, 0xcf, 0x58, 0x26, 0xc6, 0x40, 0x40, 0x2c, 0xc1, 0x81, 0x2c,
+    0xc1, 0xc1, 0x80, 0x81, 0x2c, 0x46, 0x8a, 0xca, 0x36, 0x58, 0xd4, 0x17, 0x17, 0x17, 0x01, 0x50,
+    0x27, 0x58, 0x13, 0xed, 0x3f, 0x81, 0x81, 0x2c, 0x17, 0x17, 0x17, 0x17, 0x40, 0x81, 0x80, 0x80,
+    0xdc, 0x19, 0x61, 0xcf, 0x92, 0xd8, 0x40, 0x2c, 0x17, 0x14, 0xa8, 0x25, 0xcf, 0x36, 0x27, 0x27,
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0xfe, 0x73, 0xcf, 0x4f, 0xa0, 0x77, 0x17, 0x17, 0x17, 0x17, 0x2c, 0xc1, 0x81, 0x2c, 0x3f, 0xb6,
+    0x1e, 0x7b, 0x6d, 0x25, 0xbb, 0xec, 0x40, 0x3f, 0xc1, 0x81, 0x81, 0xc1, 0xc1, 0xf1, 0x2c, 0x3f,
+    0x17, 0x4b, 0xa8, 0xb5, 0x36, 0xcf, 0xd5, 0x17, 0xed, 0x17, 0x14, 0xbe, 0xb5, 0x36, 0x36, 0x58,
+    0x33, 0x17, 0xed, 0x2c, 0x17, 0x19, 0x7d, 0x36, 0xce, 0x2a, 0xf5, 0x91, 0x17, 0x81, 0xc1, 0x40,
+    0x81, 0x81, 0x80, 0xd1, 0x1e, 0x52, 0xe8, 0xee, 0x2a, 0x13, 0xb4, 0x3c, 0x81, 0xc1, 0xc1, 0x40,
+    0x3c, 0xc1, 0xc1, 0x81, 0x2c, 0xb4, 0x48, 0xca, 0xb5, 0x92, 0xd8, 0x17, 0x81, 0x17, 0xa2, 0x51,
+    0x59, 0x2a, 0x93, 0x01, 0xc7, 0x2c, 0x2c, 0x81, 0x2c, 0x3c, 0x17, 0x17, 0xf1, 0x81, 0x80, 0x80,
+    0xdd, 0x20, 0xcf, 0xcf, 0xb5, 0xd8, 0x40, 0x17, 0x17, 0xa2, 0xa7, 0x25, 0x61, 0xce, 0xe2, 0xe8,
+    0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x27, 0xce, 0x61, 0xcd, 0xcb, 0xa9, 0x42, 0xdc, 0x77, 0x46, 0x3f, 0xc0, 0x76, 0xa2, 0x9b, 0x48,
+    0x8b, 0xaa, 0x61, 0x58, 0xcf, 0x25, 0x01, 0x18, 0x75, 0x49, 0xb6, 0x39, 0x51, 0x8a, 0xc6, 0xed,
+    0xec, 0x12, 0x19, 0x59, 0xe2, 0x92, 0x60, 0xec, 0x17, 0xc7, 0xa0, 0x19, 0x92, 0xcf, 0xcf, 0x61,
+    0xcc, 0x97, 0xed, 0x17, 0x77, 0x51, 0x7c, 0x58, 0x59, 0x59, 0x6d, 0x4f, 0x12, 0xb4, 0x46, 0x75,
+    0xc7, 0xc9, 0x95, 0xc5, 0x8a, 0x09, 0x0f, 0xee, 0xe2, 0x6d, 0x4f, 0x5f, 0x39, 0xc9, 0x75, 0xed,
+    0x75, 0xc7, 0xc9, 0x39, 0x47, 0x8b, 0xbe, 0xb5, 0xb5, 0x25, 0x70, 0x3b, 0xc0, 0x49, 0x56, 0xc5,
+    0x61, 0x61, 0x92, 0x6d, 0xcc, 0xa2, 0x77, 0x17, 0x3f, 0xb6, 0xa1, 0xa6, 0x48, 0xb6, 0x2c, 0xc0,
+    0x10, 0x09, 0xcf, 0xce, 0xb5, 0x5e, 0x75, 0xed, 0x97, 0xa0, 0xa7, 0x92, 0x61, 0x58, 0x36, 0x27,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0xce, 0x59, 0x61, 0x2a, 0x92, 0x26, 0x6d, 0xa9, 0x51, 0x48, 0x7a, 0x7a, 0x7b, 0xbe, 0x20, 0x1b,
+    0x92, 0x61, 0x9e, 0x73, 0x0f, 0xce, 0xaa, 0x20, 0xbe, 0x52, 0x52, 0xbe, 0x20, 0xa9, 0x2b, 0xbd,
+    0x7a, 0x52, 0x79, 0x2a, 0xce, 0x59, 0x93, 0xa5, 0x8a, 0x8a, 0x7b, 0x19, 0xb5, 0xe3, 0x59, 0x61,
+    0x26, 0x6d, 0x52, 0x7b, 0xbd, 0xbd, 0x92, 0x61, 0xcf, 0xcf, 0x61, 0x26, 0x6d, 0xa6, 0xbe, 0x8b,
+    0x8b, 0xbe, 0xa7, 0x20, 0x6d, 0x59, 0xea, 0x58, 0x26, 0x5c, 0x93, 0x25, 0x7d, 0x20, 0xbd, 0x52,
+    0x52, 0x8b, 0x52, 0x50, 0x09, 0x1b, 0x26, 0xcf, 0x36, 0xcf, 0x93, 0xa5, 0x8a, 0x8a, 0x7b, 0x19,
+    0xce, 0x61, 0xe2, 0x58, 0x25, 0x6d, 0x19, 0x7b, 0x7b, 0x7b, 0xbd, 0x79, 0xaa, 0x6d, 0xbe, 0x8a,
+    0x52, 0x1b, 0x61, 0xe3, 0xb5, 0xca, 0xa5, 0x8a, 0x7b, 0xbd, 0x79, 0xb5, 0xcf, 0x61, 0xcf, 0xe2,
+    0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0xb5, 0xb5, 0x59, 0xe3, 0x59, 0x92, 0x25, 0xcc, 0x0b, 0x42, 0xcb, 0x5d, 0xf8, 0x25, 0x25, 0xf9,
+    0x26, 0xce, 0x73, 0xe8, 0xe8, 0x59, 0x92, 0x93, 0x92, 0xf9, 0x25, 0x25, 0x25, 0xf9, 0xf9, 0xf9,
+    0x10, 0xca, 0x92, 0x59, 0x58, 0x61, 0x93, 0xcb, 0x42, 0x68, 0x6e, 0x26, 0x92, 0xcf, 0x61, 0xcf,
+    0x58, 0x59, 0x25, 0x25, 0x2b, 0x6d, 0xf9, 0x25, 0x59, 0x61, 0x61, 0x61, 0x25, 0x93, 0x2b, 0xf8,
+    0x2b, 0x2b, 0xf9, 0x25, 0x59, 0xe2, 0x36, 0x59, 0x6e, 0xca, 0x25, 0x21, 0xe2, 0x25, 0x6e, 0x0b,
+    0x26, 0x26, 0x2b, 0xcb, 0x2b, 0x25, 0x58, 0x36, 0x36, 0xe2, 0x25, 0x2b, 0xf8, 0x2b, 0x92, 0x26,
+    0xb5, 0x59, 0xe2, 0xe2, 0x58, 0x25, 0xf8, 0xf8, 0x7f, 0x26, 0x25, 0xcf, 0x21, 0xf9, 0x25, 0x25,
+    0x42, 0xf8, 0x61, 0xce, 0xb5, 0x92, 0x6e, 0x42, 0xf8, 0x2b, 0xf9, 0x61, 0xce, 0x59, 0x58, 0xcf,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0x26, 0x26, 0x61, 0x92, 0xcf, 0x59, 0x25, 0x92, 0x25, 0x2b, 0x2b, 0x25, 0x25, 0x25, 0x25, 0x59,
+    0xca, 0x26, 0x58, 0xe2, 0x59, 0x26, 0x6e, 0x0b, 0x26, 0x61, 0x25, 0x61, 0x25, 0x26, 0x6d, 0x25,
+    0xcb, 0x7f, 0x61, 0x61, 0xb5, 0x61, 0x26, 0x2b, 0xcb, 0x5d, 0x6e, 0x92, 0x92, 0xb5, 0xe3, 0x25,
+    0x58, 0x58, 0xe3, 0x25, 0x25, 0x93, 0x93, 0x93, 0x92, 0x61, 0x61, 0xcf, 0xcf, 0x59, 0x25, 0x25,
+    0x2b, 0x93, 0x25, 0x93, 0x93, 0x59, 0x27, 0x2a, 0x26, 0x0b, 0x26, 0x61, 0x25, 0xf8, 0x0b, 0x6e,
+    0xb5, 0x25, 0x2b, 0x2b, 0xf8, 0xcd, 0xce, 0x36, 0x36, 0x59, 0x25, 0x25, 0xf8, 0x25, 0x25, 0x61,
+    0xb5, 0xcf, 0xcf, 0x58, 0x59, 0x25, 0x92, 0x6d, 0x93, 0x25, 0x61, 0x61, 0xe2, 0xcf, 0x58, 0x25,
+    0x42, 0x6d, 0xcf, 0x36, 0x61, 0x93, 0x6e, 0x5d, 0x2b, 0x92, 0x61, 0xb5, 0xb5, 0x92, 0x61, 0x59,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x93, 0x93, 0x25, 0x25, 0x61, 0xb5, 0xb5, 0x26, 0x92, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x61,
+    0x6e, 0x0b, 0x92, 0x59, 0x92, 0x93, 0x5c, 0x6e, 0x93, 0x92, 0x59, 0x25, 0x26, 0x26, 0x26, 0x26,
+    0x0b, 0x26, 0xcf, 0x59, 0x58, 0xce, 0x25, 0xf8, 0x2b, 0x0b, 0x93, 0xb5, 0x59, 0xb5, 0x26, 0x25,
+    0x59, 0xb5, 0x59, 0x92, 0x26, 0x26, 0x2b, 0xf8, 0xf9, 0x61, 0xb5, 0xb5, 0x58, 0x61, 0x25, 0xf8,
+    0x26, 0x26, 0xca, 0x5f, 0x5f, 0x92, 0x27, 0x0f, 0xcf, 0x93, 0x0b, 0x0b, 0x5c, 0x6e, 0x5c, 0x93,
+    0xb5, 0x61, 0xf9, 0xf8, 0x2b, 0xcf, 0x59, 0x58, 0xb5, 0xb5, 0x93, 0x2b, 0x2b, 0x2b, 0x26, 0x92,
+    0xb5, 0xb5, 0x26, 0x25, 0x25, 0x26, 0xf8, 0xf9, 0x93, 0x26, 0x25, 0x25, 0x92, 0x25, 0xf9, 0x25,
+    0x5d, 0x93, 0x59, 0x58, 0xce, 0xb5, 0x93, 0x2b, 0xf8, 0x25, 0xcf, 0x61, 0x26, 0x92, 0x26, 0x92,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0x2b, 0x26, 0x26, 0x26, 0xb5, 0xb5, 0xb5, 0xb5, 0x26, 0x59, 0x61, 0x61, 0x92, 0x93, 0x93, 0x5c,
+    0x10, 0x6d, 0x59, 0x21, 0xcf, 0x26, 0x0b, 0x6e, 0x93, 0x26, 0x26, 0x92, 0x93, 0x92, 0xb5, 0xb5,
+    0x93, 0x25, 0x61, 0xcf, 0xcf, 0x58, 0x59, 0x26, 0x2b, 0x5c, 0x93, 0xb5, 0xb5, 0x92, 0x25, 0x25,
+    0x92, 0xca, 0x93, 0x25, 0xf9, 0xf8, 0x2b, 0x2b, 0x92, 0x25, 0x59, 0xb5, 0x61, 0xe3, 0x26, 0xcb,
+    0xcf, 0x26, 0x93, 0x6b, 0x6e, 0x26, 0xe2, 0x58, 0xcd, 0x5c, 0x6e, 0x93, 0x26, 0x93, 0x93, 0x59,
+    0x59, 0x61, 0x93, 0x2b, 0xf8, 0x92, 0x59, 0xce, 0xb5, 0x92, 0x93, 0x2b, 0x93, 0x93, 0x26, 0x59,
+    0xb5, 0xb5, 0x93, 0x93, 0x6e, 0x0b, 0x93, 0x92, 0x25, 0x92, 0x93, 0xcc, 0x0b, 0x92, 0x93, 0xf9,
+    0x42, 0x2b, 0x59, 0x36, 0xce, 0xb5, 0x93, 0x26, 0x25, 0xf9, 0x61, 0xb5, 0x92, 0x93, 0x26, 0x25,
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0xf8, 0x26, 0x26, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0xb5, 0x61, 0x25, 0x26, 0x0b, 0x6e, 0x6e,
+    0xcb, 0xcc, 0x25, 0xe2, 0x21, 0x26, 0x6d, 0x0b, 0x0b, 0x92, 0x92, 0x26, 0x93, 0x92, 0xe3, 0xcf,
+    0x0b, 0x92, 0x59, 0x36, 0xce, 0x59, 0x61, 0x25, 0x2b, 0x93, 0x92, 0xb5, 0xb5, 0xb5, 0x26, 0x25,
+    0x6e, 0x6e, 0x6e, 0x26, 0x92, 0x25, 0xf8, 0x2b, 0x26, 0x25, 0xb5, 0xb5, 0xb5, 0xb5, 0x0b, 0x5d,
+    0x59, 0xcf, 0x59, 0x26, 0xca, 0x92, 0x59, 0x25, 0x6b, 0x5f, 0x26, 0x58, 0x58, 0x61, 0x59, 0x61,
+    0x92, 0x93, 0x0b, 0x2b, 0xf8, 0x26, 0xce, 0x59, 0xb5, 0x92, 0x93, 0x26, 0xf8, 0x25, 0xcf, 0x58,
+    0x58, 0xb5, 0x92, 0x0b, 0x5c, 0x5c, 0x93, 0x26, 0x25, 0x26, 0x0b, 0xca, 0x6e, 0x0b, 0x0b, 0x93,
+    0x42, 0xf8, 0xcf, 0xb5, 0x59, 0xb5, 0x93, 0x2b, 0x25, 0x25, 0xcf, 0xb5, 0xb5, 0x93, 0xca, 0x26,
+    0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x7f, 0x0b, 0x0b, 0x0b, 0x0b, 0x7f, 0x7f, 0x7f,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x0b, 0x0b,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+    0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5d, 0x5d, 0x5c, 0x5c, 0x5c, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+    0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x42,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x5f, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x10, 0x10, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x10, 0x94, 0x94, 0x94, 0x10, 0x10,
+    0x95, 0x95, 0x1f, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x1f, 0x1f, 0x94, 0x94, 0x94, 0x95, 0x12,
+    0xa2, 0xa4, 0x95, 0x95, 0x6a, 0x3e, 0x95, 0x6a, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xa4, 0x95, 0x3e, 0x3e, 0x95, 0x95, 0x3e, 0xa2,
+    0x77, 0x95, 0xa4, 0x1f, 0x95, 0x3e, 0x1f, 0x95, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x12, 0x95, 0x6a, 0x1f, 0x4d, 0xa4, 0x9f, 0xb6,
+    0x17, 0xe4, 0x9f, 0x4d, 0x95, 0x38, 0xb8, 0xa4, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xa4, 0x4d, 0x38, 0x38, 0x38, 0xf0, 0xab, 0x17,
+    0x17, 0x17, 0xb6, 0x39, 0x12, 0x4c, 0x95, 0x95, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+    0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x95, 0x95, 0x4c, 0x12, 0xa2, 0x46, 0x17, 0x17
+};
+
+const tIndexedImage cancelar = { image_data_cancelar, 160, 60,
+    8, palette_cancelar };
+
+#endif /* IDX_CANCELAR_H_ */
@@ -0,0 +1,329 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: configurar
+* size: 161x60, 4 bits per pixel, 16 cores
+*******************************************************************************/
+
+#ifndef IDX_CONFIGURAR_H_
+#define IDX_CONFIGURAR_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_configurar[48] = {
+    0x99, 0x99, 0x99, 0x96, 0x96, 0x96, 0x9b, 0x9b, 0x9b, 0x40, 0x40, 0x40, 0x9f, 0x9f, 0x9f, 0xa9,
+    0xa9, 0xa9, 0x08, 0x08, 0x08, 0x22, 0x22, 0x22, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0x83, 0x83,
+    0x83, 0x92, 0x92, 0x92, 0x58, 0x58, 0x58, 0x6b, 0x6b, 0x6b, 0xbd, 0xbd, 0xbd, 0xd2, 0xd2, 0xd2
+};
+
+static const uint8_t image_data_configurar[4860] = {
+    0x99, 0xf5, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4e, 0xf9,
+    0x90, 0x9f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x5e, 0x90, 0xf4, 0xb2, 0x11, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x01, 0x10, 0x80, 0x51, 0x04, 0x11, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x02, 0x22, 0x00, 0xe0, 0x42, 0x01, 0x10, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x11, 0x21, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x11, 0x24, 0x21, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x41, 0x11, 0x12, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x20, 0x12, 0xb0, 0x22, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x14, 0x2b, 0x20,
+    0x12, 0x00, 0x01, 0x4b, 0x14, 0x0b, 0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x01, 0x11, 0x00, 0x42, 0x1b, 0x11, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x21, 0x21, 0x00, 0x12, 0x14, 0x01, 0x24, 0x1b, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x14, 0x01, 0x24, 0xb1, 0x00, 0x2b, 0x4b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x01,
+    0x02, 0x01, 0x4f, 0x89, 0x98, 0xfb, 0x11, 0x12, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x42, 0x02, 0x0b, 0x44, 0x20, 0x20, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x01, 0x10, 0x15, 0x89, 0x99, 0x98, 0x9c, 0x2f, 0x89, 0x85, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x1a, 0x2e, 0xf8, 0x89, 0x8f, 0xe5, 0xa0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x10, 0x11, 0x1f, 0x99, 0x99, 0x99, 0x96, 0x49, 0x98, 0x90, 0xa0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x0e, 0x89, 0x99, 0x99, 0x98, 0x98,
+    0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x12, 0x00, 0x28, 0x99, 0x91, 0x76, 0x36, 0x59, 0x99, 0x9a, 0xcb, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xf8, 0x98, 0x99, 0x99, 0x99,
+    0x99, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x12, 0x02, 0x49, 0x99, 0x97, 0x3b, 0xbd, 0xbf, 0x88, 0xe7, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x99, 0x89, 0xfd, 0x76,
+    0x7c, 0xf9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x10, 0x10, 0x29, 0x98, 0x97, 0xa4, 0xb4, 0x4b, 0x36, 0x67, 0xa1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x14, 0x11, 0x10, 0x59, 0x98, 0x9f, 0x76,
+    0xca, 0x1b, 0xda, 0xf6, 0xa1, 0x40, 0xa4, 0x10, 0x14, 0x01, 0x02, 0x14, 0x11, 0xb4, 0x2b, 0x21,
+    0x2b, 0x04, 0xb1, 0x4b, 0x10, 0x01, 0x22, 0x49, 0x99, 0x96, 0xb1, 0x21, 0x02, 0x02, 0x10, 0x41,
+    0x01, 0x11, 0x42, 0x02, 0xb2, 0x21, 0x4b, 0x12, 0x14, 0x12, 0xb4, 0x00, 0x4b, 0x02, 0x02, 0x12,
+    0x21, 0x10, 0x4a, 0x41, 0x21, 0x14, 0xb2, 0x21, 0x10, 0x0b, 0x44, 0xb2, 0x1b, 0x41, 0x01, 0xb2,
+    0x02, 0xbb, 0x20, 0x41, 0x41, 0x41, 0x41, 0x12, 0x00, 0x02, 0x12, 0x00, 0x10, 0xf9, 0x89, 0x97,
+    0x7b, 0x01, 0x4b, 0x2b, 0xd6, 0xb2, 0xb2, 0x55, 0xf8, 0x98, 0x88, 0xf5, 0x4b, 0x22, 0x02, 0xf9,
+    0x9f, 0x05, 0xf8, 0x99, 0xff, 0x44, 0x14, 0xe9, 0x99, 0x99, 0x99, 0x89, 0x50, 0x0f, 0x89, 0x94,
+    0x42, 0x14, 0x1f, 0x88, 0x98, 0x99, 0x89, 0x89, 0xeb, 0x48, 0x89, 0x80, 0x20, 0x01, 0x58, 0x89,
+    0x82, 0x12, 0x18, 0x99, 0xf2, 0xef, 0x98, 0xe0, 0xb4, 0x04, 0xf8, 0x88, 0x98, 0xf5, 0x11, 0x20,
+    0x4b, 0xf8, 0x9f, 0x45, 0x89, 0x8e, 0x10, 0x01, 0x02, 0x00, 0x02, 0x12, 0x02, 0x14, 0x99, 0x98,
+    0xe6, 0xd4, 0x42, 0x10, 0x14, 0x02, 0xb5, 0x24, 0xf8, 0x99, 0x89, 0x99, 0x99, 0xf2, 0x21, 0xb0,
+    0x89, 0x85, 0xa9, 0x89, 0x98, 0x98, 0xe1, 0x02, 0xf9, 0x89, 0x98, 0x99, 0x99, 0xad, 0x18, 0x99,
+    0x9c, 0xa0, 0x04, 0x88, 0x99, 0x99, 0x99, 0x99, 0x98, 0xdd, 0x19, 0x99, 0x83, 0xa0, 0x11, 0x08,
+    0x99, 0x93, 0xb4, 0xb9, 0x88, 0x50, 0x99, 0x98, 0x2d, 0xb4, 0xf9, 0x88, 0x99, 0x99, 0x98, 0x54,
+    0xb4, 0x01, 0x88, 0x94, 0xb9, 0x99, 0x82, 0xd0, 0x22, 0x21, 0x00, 0x00, 0x12, 0x02, 0x0e, 0x99,
+    0x99, 0xd7, 0x01, 0xb2, 0xb5, 0xbb, 0x5b, 0x4b, 0x19, 0x99, 0x99, 0x99, 0x99, 0x89, 0x94, 0x14,
+    0x10, 0x89, 0x88, 0x89, 0x98, 0x99, 0x98, 0x9b, 0x14, 0xe9, 0x98, 0x99, 0x98, 0x99, 0x3d, 0x09,
+    0x98, 0x93, 0xd4, 0x28, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x3c, 0x09, 0x99, 0x97, 0xa4, 0x44,
+    0x09, 0x98, 0x97, 0xa0, 0x08, 0x99, 0x89, 0x99, 0x89, 0x13, 0x2f, 0x89, 0x99, 0x99, 0x99, 0x99,
+    0x8a, 0x4b, 0x00, 0x98, 0x98, 0x99, 0x99, 0x91, 0x32, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x2f,
+    0x99, 0x99, 0x3c, 0xb5, 0x44, 0xb0, 0x04, 0x24, 0x00, 0xf8, 0x98, 0x8d, 0x66, 0x3f, 0x99, 0x99,
+    0xdb, 0x22, 0x89, 0x99, 0x9f, 0x37, 0x3f, 0x89, 0x9f, 0xc4, 0xbc, 0x79, 0x99, 0x96, 0x66, 0x6d,
+    0xb8, 0x99, 0x9c, 0xd1, 0xe8, 0x99, 0xf3, 0x67, 0x59, 0x99, 0x36, 0x6d, 0x19, 0x99, 0x97, 0xab,
+    0xb0, 0x09, 0x99, 0x97, 0xa2, 0x28, 0x99, 0x99, 0x89, 0x99, 0xa3, 0x29, 0x98, 0xb7, 0x66, 0xc8,
+    0x89, 0x9d, 0xb0, 0x21, 0x89, 0x99, 0x99, 0x99, 0x9a, 0x3b, 0x12, 0x41, 0x00, 0x00, 0x00, 0x10,
+    0x4f, 0x99, 0x88, 0x6a, 0x4b, 0xb0, 0x41, 0x20, 0xb0, 0x15, 0x89, 0x99, 0xc6, 0xca, 0xba, 0x89,
+    0x98, 0x0a, 0x2b, 0x89, 0x99, 0xf7, 0x6d, 0x12, 0x99, 0x99, 0x31, 0x14, 0x48, 0x99, 0x97, 0xa4,
+    0x40, 0x48, 0x99, 0x8c, 0xd2, 0xf9, 0x98, 0x37, 0xaa, 0xa8, 0x89, 0xec, 0x24, 0x49, 0x99, 0x83,
+    0xa0, 0x22, 0x29, 0x99, 0x87, 0xa1, 0x19, 0x99, 0x98, 0xf3, 0x63, 0x73, 0x08, 0x57, 0x6c, 0xab,
+    0xbe, 0x99, 0x91, 0xc4, 0x00, 0x89, 0x99, 0x9f, 0x76, 0x37, 0x34, 0x4b, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x2f, 0x98, 0x99, 0x6a, 0x41, 0x02, 0x10, 0x14, 0x4b, 0x1e, 0x98, 0x9f, 0x6d, 0x44, 0x20,
+    0xf9, 0x99, 0xe3, 0x12, 0x99, 0x99, 0xc6, 0xa2, 0x22, 0x98, 0x89, 0x7a, 0x5a, 0x49, 0x99, 0x87,
+    0x21, 0xb0, 0x28, 0x99, 0x93, 0xd1, 0xf8, 0x99, 0x7a, 0x15, 0x49, 0x99, 0xe7, 0x01, 0x18, 0x99,
+    0x97, 0xa2, 0x20, 0x18, 0x99, 0x97, 0xa1, 0x19, 0x98, 0x9f, 0x67, 0xa1, 0xda, 0x4b, 0x73, 0xb2,
+    0xb0, 0x4e, 0x99, 0x95, 0x3b, 0x40, 0x89, 0x99, 0xf6, 0x7a, 0xba, 0xab, 0x42, 0x01, 0x00, 0x01,
+    0x00, 0x02, 0x0f, 0x99, 0x99, 0x60, 0xb2, 0x20, 0x14, 0x10, 0xb4, 0x2f, 0x99, 0x94, 0x62, 0x11,
+    0x02, 0xe9, 0x89, 0x97, 0x21, 0x89, 0x99, 0x3d, 0x01, 0x0b, 0x99, 0x99, 0x3a, 0x10, 0x59, 0x99,
+    0x96, 0xa0, 0x41, 0x28, 0x99, 0x93, 0xd0, 0xe9, 0x99, 0xe0, 0x05, 0xf9, 0x99, 0xa3, 0x00, 0x29,
+    0x98, 0x97, 0xd2, 0x10, 0x09, 0x99, 0x97, 0xa2, 0x28, 0x99, 0x8c, 0x7b, 0x10, 0x41, 0x02, 0x4e,
+    0xf8, 0x99, 0x89, 0x89, 0x85, 0x30, 0x00, 0x89, 0x98, 0xc7, 0xb0, 0x00, 0x4b, 0x01, 0x12, 0x00,
+    0x00, 0x4b, 0x20, 0x0f, 0x98, 0x98, 0x7b, 0xb2, 0x01, 0x04, 0xb4, 0xb0, 0x0f, 0x99, 0x8a, 0x32,
+    0x21, 0x14, 0x59, 0x99, 0x86, 0x14, 0x89, 0x98, 0x3d, 0x10, 0x00, 0x89, 0x99, 0x3d, 0x00, 0x49,
+    0x99, 0x96, 0xb0, 0x10, 0x08, 0x99, 0x93, 0xd0, 0x2f, 0x98, 0x99, 0x99, 0x98, 0x98, 0x73, 0x21,
+    0x19, 0x99, 0x97, 0xa0, 0xb2, 0x09, 0x89, 0x97, 0xa2, 0x18, 0x99, 0x93, 0xd0, 0x00, 0x01, 0xbe,
+    0x89, 0x89, 0x99, 0x99, 0x99, 0x9e, 0x72, 0x0b, 0x89, 0x99, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x00, 0x1e, 0x99, 0x89, 0xdd, 0x40, 0x04, 0x21, 0x00, 0x40, 0x48, 0x99, 0x9b,
+    0x3b, 0x11, 0x4b, 0xe9, 0x89, 0x96, 0xb1, 0x99, 0x89, 0x3d, 0x10, 0x00, 0x89, 0x99, 0x3d, 0x00,
+    0x49, 0x99, 0x96, 0xb0, 0x10, 0x08, 0x99, 0x93, 0xd0, 0xbf, 0x89, 0x98, 0x99, 0x99, 0x83, 0x6a,
+    0xb4, 0x09, 0x99, 0x97, 0xa2, 0x40, 0xb9, 0x99, 0x97, 0xa2, 0x18, 0x99, 0x93, 0xd1, 0x02, 0x21,
+    0x58, 0x98, 0x98, 0x99, 0x99, 0x99, 0x95, 0x70, 0x02, 0x89, 0x99, 0x3d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x40, 0x00, 0x15, 0x99, 0x99, 0x4d, 0x4b, 0x11, 0x10, 0x1b, 0x4b, 0x1f, 0x98,
+    0x94, 0x34, 0x05, 0xb4, 0xe9, 0x98, 0x86, 0x1b, 0x99, 0x89, 0x3d, 0x10, 0x00, 0x89, 0x99, 0x3d,
+    0x00, 0x49, 0x99, 0x96, 0xb0, 0x10, 0x08, 0x99, 0x93, 0xd0, 0xe8, 0x99, 0x4f, 0x88, 0xfa, 0x76,
+    0xd4, 0x0b, 0x09, 0x89, 0x93, 0xab, 0xb0, 0x18, 0x99, 0x87, 0xa2, 0x18, 0x99, 0x93, 0xd1, 0x00,
+    0x21, 0xf9, 0x99, 0x8d, 0x76, 0x6d, 0x99, 0x9e, 0x71, 0x02, 0x89, 0x99, 0x3d, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x20, 0x12, 0x12, 0x89, 0x99, 0x83, 0x00, 0x14, 0xb1, 0x54, 0xb4, 0x0f,
+    0x99, 0x88, 0x34, 0xb1, 0xb4, 0xf8, 0x99, 0xe6, 0x04, 0x89, 0x99, 0x3d, 0x10, 0x00, 0x89, 0x99,
+    0x3d, 0x00, 0x49, 0x99, 0x96, 0xb0, 0x10, 0x08, 0x99, 0x93, 0xd0, 0xf9, 0x9e, 0x63, 0x76, 0x67,
+    0x3a, 0xb0, 0x42, 0x08, 0x98, 0x93, 0xa4, 0x04, 0x59, 0x98, 0x97, 0xa2, 0x18, 0x99, 0x93, 0xd2,
+    0x21, 0x02, 0xf9, 0x99, 0xd6, 0xca, 0x1e, 0x99, 0x9e, 0x30, 0x10, 0x89, 0x99, 0x3d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x20, 0x12, 0x01, 0xe9, 0x89, 0x9f, 0xa4, 0x4b, 0x00, 0x1e, 0x84,
+    0x55, 0x89, 0x98, 0xdb, 0x20, 0x54, 0x89, 0x99, 0xd7, 0xb4, 0x89, 0x99, 0x3d, 0x10, 0x00, 0x89,
+    0x99, 0x3d, 0x00, 0x49, 0x99, 0x96, 0xb0, 0x10, 0x08, 0x99, 0x93, 0xd0, 0x89, 0x88, 0xc4, 0xb4,
+    0x22, 0xb4, 0x42, 0x0b, 0x08, 0x99, 0x8b, 0xdb, 0x22, 0x89, 0x89, 0x97, 0xa2, 0x18, 0x99, 0x93,
+    0xd2, 0x2b, 0x02, 0xf9, 0x99, 0xcc, 0x14, 0x1f, 0x99, 0x8e, 0x70, 0x00, 0x89, 0x99, 0x3d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x10, 0x21, 0x2f, 0x98, 0x99, 0x8e, 0x44, 0x45, 0x89,
+    0x93, 0xa2, 0x88, 0x89, 0x84, 0x42, 0x58, 0x88, 0x98, 0x6c, 0x01, 0x89, 0x99, 0x3d, 0x10, 0x00,
+    0x89, 0x99, 0x3d, 0x00, 0x49, 0x99, 0x96, 0xb0, 0x10, 0x08, 0x99, 0x93, 0xd0, 0x89, 0x99, 0x98,
+    0x89, 0x8f, 0x85, 0x04, 0xb4, 0x0f, 0x99, 0x98, 0xb4, 0x58, 0x99, 0x98, 0x97, 0xa2, 0x18, 0x99,
+    0x93, 0xd1, 0x00, 0x20, 0xf9, 0x98, 0xfa, 0x45, 0xf9, 0x99, 0x95, 0x70, 0x20, 0x89, 0x99, 0x3d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0xf9, 0x98, 0x99, 0x99, 0x99,
+    0x99, 0x87, 0xab, 0x59, 0x99, 0x99, 0x99, 0x98, 0x99, 0x83, 0x6a, 0x41, 0x89, 0x99, 0x3d, 0x10,
+    0x00, 0x89, 0x99, 0x3d, 0x00, 0x49, 0x99, 0x96, 0xb0, 0x10, 0x08, 0x99, 0x93, 0xd0, 0xe9, 0x88,
+    0x99, 0x99, 0x99, 0x99, 0xf0, 0x42, 0x05, 0x98, 0x99, 0x89, 0x99, 0x9f, 0x89, 0x97, 0xa2, 0x18,
+    0x99, 0x93, 0xd1, 0x12, 0x21, 0xe8, 0x99, 0x89, 0x89, 0x98, 0x89, 0x9e, 0x70, 0x01, 0x89, 0x99,
+    0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x21, 0x02, 0x14, 0xa5, 0x99, 0x99, 0x99,
+    0x99, 0x98, 0xc6, 0xa4, 0x02, 0x89, 0x99, 0x98, 0x99, 0x8f, 0x36, 0xd2, 0xb2, 0x89, 0x99, 0x3d,
+    0x10, 0x00, 0x89, 0x99, 0x3d, 0x00, 0x49, 0x99, 0x96, 0xb0, 0x10, 0x08, 0x99, 0x93, 0xd0, 0xbf,
+    0x99, 0x99, 0x99, 0x99, 0x89, 0x9e, 0xb1, 0x00, 0xe9, 0x99, 0x98, 0x98, 0xaa, 0x99, 0x97, 0xa2,
+    0x18, 0x99, 0x93, 0xd0, 0x00, 0x00, 0x0e, 0x99, 0x99, 0x89, 0x8f, 0xf8, 0x9e, 0x72, 0x21, 0x89,
+    0x99, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xca, 0xe8,
+    0x98, 0xf5, 0xc6, 0x7c, 0xb4, 0x4b, 0xda, 0xe8, 0x98, 0xfe, 0xc6, 0x7d, 0x12, 0x2b, 0x88, 0x88,
+    0x7d, 0xb0, 0x02, 0x88, 0x9f, 0x7a, 0x00, 0x48, 0x98, 0xf6, 0xa2, 0x20, 0x2f, 0x89, 0xf7, 0xd0,
+    0xf9, 0x99, 0xc6, 0x66, 0x75, 0x99, 0x98, 0x31, 0x14, 0xba, 0x58, 0x9f, 0x47, 0x6a, 0x88, 0xf7,
+    0xa1, 0x28, 0x89, 0xf7, 0xdb, 0x41, 0x20, 0x12, 0xae, 0x89, 0x8e, 0xd6, 0x59, 0x9b, 0x31, 0x14,
+    0xf8, 0x9f, 0x7d, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x04, 0x1a,
+    0xc7, 0x66, 0x67, 0x3d, 0xa4, 0x2b, 0xb2, 0x5b, 0xc7, 0x66, 0x66, 0x3c, 0xa2, 0x2b, 0x22, 0x03,
+    0x66, 0x6a, 0x51, 0x04, 0xb3, 0x66, 0x6a, 0x10, 0x4b, 0x76, 0x66, 0x12, 0xb0, 0x1b, 0x36, 0x66,
+    0xa5, 0x99, 0x95, 0x6c, 0xb0, 0x0d, 0x98, 0x89, 0x7b, 0x21, 0x20, 0xd7, 0x66, 0x63, 0xa2, 0xd6,
+    0x66, 0xb1, 0x01, 0x36, 0x66, 0xa0, 0x21, 0x20, 0x12, 0x2d, 0x76, 0x66, 0x7c, 0xb3, 0x66, 0x30,
+    0x12, 0xb3, 0x66, 0x6a, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11,
+    0x12, 0x4b, 0x11, 0x11, 0x02, 0x21, 0x02, 0x20, 0x11, 0x10, 0x00, 0x20, 0x12, 0x40, 0x02, 0x2b,
+    0x0b, 0x12, 0x00, 0x12, 0x4b, 0x0b, 0x2b, 0x05, 0x01, 0x4b, 0x12, 0x10, 0x41, 0x02, 0x04, 0xb4,
+    0x0b, 0x0f, 0x98, 0x9a, 0x34, 0x01, 0x45, 0x99, 0x99, 0x7a, 0x02, 0x20, 0x00, 0x0b, 0x40, 0x1a,
+    0x40, 0xb2, 0x11, 0x01, 0x14, 0x20, 0xb2, 0x01, 0x22, 0x10, 0x20, 0x04, 0x41, 0x12, 0x2b, 0x11,
+    0x24, 0x10, 0x4a, 0x0b, 0x02, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2,
+    0x42, 0x11, 0x02, 0x40, 0x04, 0x41, 0xb0, 0x01, 0x10, 0x22, 0x01, 0x21, 0x24, 0x1b, 0x10, 0x00,
+    0x00, 0x24, 0x21, 0x12, 0x4b, 0xb2, 0x44, 0x14, 0x4a, 0x40, 0x02, 0x20, 0xbb, 0x1b, 0x4b, 0x21,
+    0x21, 0x01, 0x2e, 0x98, 0x98, 0xb4, 0x15, 0xe8, 0x89, 0x9f, 0x6a, 0x12, 0x22, 0x22, 0x21, 0xb0,
+    0x50, 0xb2, 0x12, 0x10, 0x40, 0x12, 0xb1, 0x22, 0x11, 0x20, 0x10, 0xb0, 0x21, 0x12, 0x40, 0x02,
+    0x21, 0x0b, 0x22, 0x01, 0x21, 0x22, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x1b, 0x24, 0x00, 0x02, 0x0b, 0x14, 0x44, 0x00, 0x22, 0x00, 0x02, 0x21, 0xbb, 0xb4, 0x41,
+    0x21, 0x12, 0xb1, 0x02, 0x4b, 0x12, 0x20, 0xb0, 0x20, 0x1b, 0x2b, 0x21, 0x11, 0x44, 0x4b, 0x12,
+    0x11, 0x4b, 0x42, 0x45, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x83, 0x74, 0x01, 0x10, 0xbb, 0x14,
+    0x4b, 0xb4, 0x02, 0x20, 0x41, 0x12, 0x0b, 0x04, 0x00, 0x10, 0x20, 0x10, 0x42, 0x22, 0x20, 0x10,
+    0x10, 0xb2, 0x21, 0x01, 0x10, 0x40, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb0, 0x00, 0x01, 0x12, 0xb2, 0x42, 0x00, 0x01, 0x40, 0x11, 0x00, 0x1b, 0x12, 0x44, 0x02,
+    0x2b, 0x12, 0x40, 0xb2, 0x41, 0x10, 0x00, 0x14, 0x00, 0x11, 0x14, 0x41, 0x42, 0x00, 0x11, 0x15,
+    0x10, 0x22, 0x04, 0x2b, 0xb4, 0x59, 0x99, 0x99, 0x89, 0x89, 0x98, 0x36, 0xd1, 0x12, 0x20, 0x24,
+    0x2b, 0x14, 0x10, 0x2b, 0x10, 0x10, 0x00, 0x01, 0x5b, 0x11, 0x02, 0x00, 0x02, 0x21, 0x11, 0x00,
+    0x22, 0x14, 0x02, 0x14, 0x21, 0x2b, 0x00, 0x2b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x22, 0x20, 0x01, 0x41, 0xb1, 0x22, 0x00, 0x10, 0x00, 0x11, 0x24, 0x20, 0x11,
+    0x01, 0x12, 0x0b, 0x10, 0x40, 0x11, 0x04, 0x12, 0xb1, 0x04, 0x04, 0x01, 0x0b, 0xb0, 0x2b, 0xb4,
+    0x02, 0xb2, 0x04, 0xb1, 0x24, 0x4b, 0x1d, 0xae, 0x88, 0x88, 0xf5, 0xc6, 0x7d, 0x02, 0x20, 0x02,
+    0x1b, 0x14, 0xb4, 0x0b, 0x44, 0x21, 0x42, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x10, 0x20, 0x04, 0x40,
+    0x04, 0x2b, 0x01, 0xb2, 0x11, 0xb4, 0x41, 0x00, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x02, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x20, 0x00, 0x00, 0x11, 0x12,
+    0x01, 0x22, 0x12, 0x02, 0x2b, 0x21, 0x02, 0x12, 0xb4, 0x04, 0x21, 0x01, 0x41, 0x14, 0x20, 0x02,
+    0x40, 0x11, 0x41, 0x00, 0x20, 0x21, 0x22, 0x02, 0xac, 0x76, 0x66, 0x66, 0x3d, 0xb1, 0x41, 0x10,
+    0x00, 0x02, 0x01, 0x4b, 0x22, 0x21, 0x00, 0xb2, 0x4b, 0x20, 0x10, 0x20, 0x20, 0x10, 0x21, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x40, 0x04, 0x01, 0xb4, 0x11, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe0, 0x12, 0x11, 0x4b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x24, 0xb0, 0xe0, 0x85, 0xa1, 0x44, 0x42, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0xb4, 0x80, 0x9f, 0x40, 0x1b, 0xb0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x24, 0x5f, 0x90, 0x99, 0x8e, 0x52, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xf9, 0x90
+};
+
+const tIndexedImage configurar = { image_data_configurar, 161, 60,
+    4, palette_configurar };
+
+#endif /* IDX_CONFIGURAR_H_ */
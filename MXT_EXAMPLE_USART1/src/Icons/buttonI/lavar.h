@@ -0,0 +1,870 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: lavar
+* size: 160x80, 8 bits per pixel, 256 cores
+*******************************************************************************/
+
+#ifndef IDX_LAVAR_H_
+#define IDX_LAVAR_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_lavar[768] = {
+    0x65, 0xab, 0x4b, 0x63, 0xab, 0x4a, 0x67, 0xaa, 0x4b, 0x5b, 0xb4, 0x44, 0x5d, 0xb3, 0x46, 0x6d,
+    0xa5, 0x55, 0x6c, 0xa3, 0x56, 0x6e, 0x94, 0x64, 0x57, 0xc3, 0x4d, 0x53, 0xcf, 0x4f, 0x78, 0xa8,
+    0x6f, 0x8f, 0xa9, 0x93, 0x22, 0xe3, 0x1a, 0x25, 0xe2, 0x1e, 0xf5, 0xfa, 0xf1, 0x1f, 0xe6, 0x18,
+    0x9f, 0xa3, 0xa3, 0x93, 0xfa, 0x91, 0x12, 0xf1, 0x0c, 0x6e, 0xe2, 0x66, 0x7e, 0xeb, 0x7a, 0x39,
+    0xce, 0x28, 0x3a, 0xcf, 0x2d, 0x00, 0x27, 0x00, 0xe2, 0xee, 0xe0, 0xf2, 0xf2, 0xeb, 0x00, 0x30,
+    0x00, 0x05, 0x29, 0x02, 0x37, 0xcb, 0x2f, 0x1f, 0x6c, 0x16, 0xca, 0xff, 0xc6, 0x3e, 0xd6, 0x28,
+    0xc3, 0xdf, 0xc4, 0xc8, 0xf6, 0xbf, 0x62, 0xae, 0x49, 0x62, 0xaf, 0x44, 0x48, 0xc2, 0x34, 0x4b,
+    0xc9, 0x4b, 0x44, 0x87, 0x39, 0x7e, 0xb8, 0x73, 0x7f, 0xcb, 0x73, 0x8b, 0xb1, 0x8b, 0x35, 0xc5,
+    0x24, 0xbf, 0xfc, 0xb3, 0x57, 0xb8, 0x41, 0x69, 0x61, 0x66, 0x69, 0x7b, 0x65, 0x37, 0xd2, 0x25,
+    0x37, 0x84, 0x2d, 0x38, 0x94, 0x30, 0x41, 0xca, 0x2f, 0x27, 0x55, 0x21, 0x37, 0x58, 0x38, 0x2c,
+    0x6e, 0x27, 0x39, 0x70, 0x3d, 0x70, 0x73, 0x6e, 0x75, 0x8b, 0x6e, 0x5e, 0xb0, 0x42, 0x54, 0xbd,
+    0x4c, 0x60, 0xbc, 0x51, 0xe0, 0xff, 0xde, 0xeb, 0xff, 0xe2, 0x3f, 0xcf, 0x2a, 0x46, 0xce, 0x38,
+    0x8e, 0xe4, 0x84, 0x90, 0xfc, 0x81, 0x81, 0x77, 0x8a, 0x93, 0x93, 0x93, 0xfe, 0xf9, 0xfe, 0x65,
+    0xad, 0x4a, 0x3a, 0xae, 0x33, 0x55, 0xc8, 0x4c, 0x5f, 0xad, 0x50, 0x26, 0xdf, 0x1e, 0x2d, 0xdb,
+    0x1a, 0xee, 0xff, 0xed, 0xf7, 0xff, 0xf1, 0x9c, 0x9f, 0x95, 0x07, 0x54, 0x04, 0x18, 0x51, 0x09,
+    0x40, 0xe0, 0x29, 0x2a, 0x4a, 0x28, 0x5f, 0x55, 0x5d, 0x26, 0x7c, 0x17, 0x10, 0x30, 0x12, 0x21,
+    0x29, 0x26, 0x5c, 0xff, 0x54, 0x44, 0x7f, 0x38, 0x37, 0xc1, 0x22, 0x4f, 0xbc, 0x39, 0x52, 0xbb,
+    0x3f, 0x40, 0xdc, 0x2c, 0x48, 0xdb, 0x3e, 0x5b, 0xb5, 0x43, 0x2d, 0xda, 0x22, 0x42, 0xd2, 0x2d,
+    0x46, 0xd2, 0x3a, 0x33, 0xd5, 0x27, 0xc7, 0xb9, 0xd0, 0xd0, 0xcf, 0xce, 0xa2, 0x9c, 0x9d, 0x67,
+    0xde, 0x5e, 0x5c, 0xfe, 0x5a, 0x96, 0xab, 0x89, 0xa0, 0xa9, 0x9b, 0x3d, 0xcd, 0x2c, 0x43, 0xcc,
+    0x35, 0x75, 0x9a, 0x71, 0x81, 0x9b, 0x86, 0x4c, 0xc0, 0x3b, 0x52, 0xbf, 0x3e, 0x2f, 0xd4, 0x24,
+    0xeb, 0xde, 0xf2, 0x63, 0xa5, 0x4b, 0x5f, 0xa5, 0x56, 0x60, 0xb2, 0x43, 0x37, 0xd1, 0x29, 0x51,
+    0x6d, 0x4e, 0x58, 0x6b, 0x5d, 0x6a, 0xaa, 0x4f, 0x70, 0xac, 0x5f, 0xec, 0xfc, 0xec, 0x63, 0x80,
+    0x5f, 0xb7, 0xbd, 0xb5, 0xbe, 0xd2, 0xbc, 0xfe, 0xf5, 0xfe, 0x47, 0xde, 0x3b, 0x1d, 0x7d, 0x1b,
+    0x27, 0x9b, 0x12, 0x5d, 0xb4, 0x48, 0x49, 0xa5, 0x3d, 0x5b, 0xab, 0x42, 0x01, 0x0e, 0x01, 0x00,
+    0x19, 0x00, 0x9b, 0xf6, 0x96, 0x4e, 0xe5, 0x4f, 0x43, 0xfd, 0x4b, 0x17, 0x58, 0x13, 0x26, 0x55,
+    0x1a, 0x06, 0x5b, 0x02, 0x88, 0xbf, 0x87, 0x89, 0xd3, 0x82, 0x43, 0xc8, 0x34, 0x4b, 0xc7, 0x3b,
+    0x2d, 0xd9, 0x24, 0x1a, 0xeb, 0x13, 0x1c, 0xec, 0x17, 0x31, 0xd4, 0x1c, 0xd7, 0xd5, 0xd8, 0xe6,
+    0xd9, 0xec, 0xa0, 0xde, 0x9e, 0x9f, 0xf1, 0x98, 0x02, 0x3c, 0x01, 0x09, 0x4a, 0x03, 0xd6, 0xfb,
+    0xd2, 0x00, 0x8c, 0x00, 0x15, 0x7d, 0x0e, 0x1b, 0xe9, 0x14, 0x1d, 0xe7, 0x15, 0xbb, 0xe3, 0xb2,
+    0xba, 0xf2, 0xb2, 0x6b, 0xb5, 0x53, 0x71, 0xb6, 0x62, 0x49, 0xb0, 0x3f, 0x55, 0xae, 0x44, 0x37,
+    0xc2, 0x2b, 0x3b, 0xbf, 0x47, 0x4b, 0x4f, 0x50, 0x54, 0x5f, 0x54, 0x37, 0xd2, 0x33, 0xda, 0xfe,
+    0xd6, 0xe8, 0xfb, 0xe1, 0x56, 0x8f, 0x57, 0x64, 0x87, 0x71, 0x3e, 0xe0, 0x33, 0x44, 0xfc, 0x46,
+    0x03, 0xfd, 0x02, 0x09, 0xf7, 0x08, 0x31, 0x3c, 0x36, 0x33, 0x4d, 0x35, 0x33, 0xad, 0x21, 0x38,
+    0xbc, 0x28, 0x97, 0x7d, 0x9a, 0xa1, 0x98, 0x99, 0x17, 0xed, 0x10, 0x18, 0xed, 0x12, 0xfe, 0xf2,
+    0xfe, 0xac, 0xde, 0xa4, 0xac, 0xec, 0xa5, 0xa4, 0xfb, 0xa1, 0xaf, 0xfc, 0xae, 0x2c, 0xd9, 0x28,
+    0xd8, 0xfe, 0xc7, 0x34, 0xd9, 0x27, 0x36, 0xd8, 0x2f, 0xd1, 0xff, 0xc9, 0xd0, 0xff, 0xc2, 0xd0,
+    0xe9, 0xc5, 0xd0, 0xf6, 0xcb, 0x5f, 0xb1, 0x47, 0x61, 0xb0, 0x4a, 0x4c, 0x7c, 0x4b, 0x5a, 0x8f,
+    0x4a, 0x9a, 0xc0, 0x8b, 0xa8, 0xc5, 0xa6, 0xaa, 0xd0, 0xa8, 0x42, 0xd6, 0x2e, 0x49, 0xd5, 0x40,
+    0x63, 0xca, 0x57, 0x67, 0xc6, 0x6a, 0x63, 0xae, 0x56, 0x65, 0xae, 0x5f, 0xe8, 0xdf, 0xf0, 0x32,
+    0xd3, 0x2c, 0x39, 0xd1, 0x2c, 0x99, 0xca, 0x8c, 0xa8, 0xd0, 0x9e, 0x69, 0xa8, 0x4b, 0x6b, 0xa7,
+    0x53, 0x29, 0x7e, 0x2a, 0x2a, 0x89, 0x22, 0x0e, 0x41, 0x16, 0x18, 0x4d, 0x16, 0x2f, 0xcb, 0x21,
+    0x39, 0xc9, 0x24, 0x36, 0xc4, 0x2d, 0x38, 0xc4, 0x38, 0x6d, 0xc0, 0x62, 0x6e, 0xd1, 0x62, 0x45,
+    0x6c, 0x41, 0x47, 0x7b, 0x39, 0x56, 0xb7, 0x3f, 0x59, 0xb6, 0x43, 0x51, 0xb2, 0x3f, 0x5c, 0xb3,
+    0x43, 0x5e, 0xb6, 0x4d, 0x5e, 0xb6, 0x55, 0x0d, 0x69, 0x04, 0x17, 0x6d, 0x06, 0x24, 0xd3, 0x14,
+    0x28, 0xd5, 0x1d, 0xff, 0xe9, 0xfe, 0xfe, 0xef, 0xfe, 0xe7, 0xe1, 0xef, 0xdf, 0xe4, 0xdd, 0xe5,
+    0xe1, 0xef, 0x3e, 0x90, 0x32, 0x4a, 0x8d, 0x3c, 0xa9, 0xa1, 0xac, 0xb7, 0xb1, 0xb9, 0x96, 0xda,
+    0x8f, 0x9a, 0xe8, 0x92, 0x21, 0x3a, 0x1c, 0x27, 0x49, 0x1b, 0xf8, 0xff, 0xfa, 0xff, 0xfe, 0xfd
+};
+
+static const uint8_t image_data_lavar[12800] = {
+    0xc0, 0xc4, 0x41, 0xaf, 0x92, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0x92, 0x88, 0x11, 0x1e, 0xc0,
+    0xc4, 0x41, 0x5c, 0x0d, 0x12, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0x0d, 0x87, 0x41, 0xc4,
+    0x41, 0x5c, 0xf0, 0x92, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0x92, 0xf0, 0xcf, 0xbd,
+    0xaf, 0x0d, 0x92, 0x12, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xb1,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x92, 0x92, 0xbf, 0x66,
+    0x92, 0x12, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x12, 0x92, 0x0d,
+    0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb1, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1,
+    0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb0, 0xb0, 0xb0, 0xb1, 0xb1, 0xb1, 0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xb1, 0xb0, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+    0xb1, 0xb1, 0xb1, 0x12, 0x12, 0x12, 0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0x12, 0x12, 0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb0, 0xb0, 0xb0,
+    0xb1, 0xb1, 0x12, 0x12, 0x12, 0x12, 0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x12, 0x12, 0x12,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1,
+    0x12, 0x12, 0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x12, 0x12, 0x12, 0x12, 0xb1, 0xb1,
+    0xb1, 0x12, 0x12, 0xb8, 0xb8, 0x12, 0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0x12, 0x12, 0xb8, 0xb8, 0x12, 0x12, 0x12,
+    0xb1, 0xb1, 0x12, 0xb8, 0xb9, 0x12, 0x12, 0xb1, 0xb1, 0xb1, 0x12, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0xb1, 0xb1, 0xb1, 0xb1, 0x12, 0xb8, 0xb8, 0x91, 0xb8, 0x12, 0x12,
+    0xb1, 0xb1, 0x12, 0xb8, 0xb9, 0x12, 0x12, 0xb1, 0xb1, 0x12, 0xb8, 0xb8, 0x91, 0xb8, 0xb8, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0xb8, 0xb8, 0x12, 0x12, 0xb1, 0xb1, 0x12, 0xb8, 0x91, 0x91, 0xb8, 0x12, 0x12,
+    0xb1, 0xb1, 0x12, 0xb8, 0xb8, 0xb8, 0x12, 0x12, 0x12, 0x12, 0xb8, 0x91, 0x91, 0xb8, 0x12, 0xb1,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0xb1, 0x12, 0xb8, 0xb8, 0xb8, 0xb8, 0x12, 0x12, 0xb1, 0x12, 0xb8, 0xb8, 0xb8, 0xb8, 0x12, 0xb1,
+    0xb1, 0x12, 0x12, 0xb8, 0xb8, 0xb8, 0x12, 0x12, 0x12, 0xb8, 0xb8, 0x91, 0xb8, 0x12, 0xb1, 0xb1,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0xb1, 0xb1, 0xb8, 0x91, 0x91, 0x91, 0xb8, 0x12, 0x12, 0x12, 0x12, 0xb8, 0xb8, 0x12, 0xb1, 0xb1,
+    0xb1, 0x12, 0xb8, 0xb8, 0x91, 0xb8, 0x12, 0x12, 0x12, 0xb8, 0xb8, 0xb8, 0xb8, 0xb1, 0xb1, 0xb1,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0xb1, 0xb1, 0xb8, 0x9e, 0x9e, 0x9e, 0xb8, 0x12, 0x12, 0x12, 0x12, 0xb8, 0x12, 0x12, 0xb1, 0xb0,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0x12, 0x12, 0x12, 0xb8, 0x9d, 0x0f, 0x0f, 0x9e, 0x9d, 0x91, 0x91, 0x91, 0x92, 0x0f,
+    0x12, 0xb8, 0xb8, 0x91, 0x9d, 0x9e, 0x9d, 0x91, 0xb8, 0xb8, 0x12, 0x12, 0xb8, 0xb8, 0xb9, 0x91,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+    0x9d, 0x91, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0x91, 0xb9, 0xb8, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0xb8, 0xb8, 0x91, 0x9d, 0x9e, 0x9d, 0x91, 0xb9, 0xb8, 0x12, 0x12, 0xb8, 0xb8, 0xb9, 0x91,
+    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+    0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x9d, 0x91, 0x91, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xb8, 0xb8, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0xb8, 0xb8, 0xb8, 0x91, 0x9d, 0x9d, 0x9d, 0x91, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x92, 0x92, 0x91, 0xb9, 0xb9, 0x91, 0x92, 0x92, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0xb8, 0xb8, 0x91, 0x91, 0x9d, 0x9d, 0x92, 0x91, 0x91, 0xb9, 0xb8, 0xb8, 0x91, 0x91, 0x9d, 0x9d,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x92, 0x92, 0x9d, 0x91, 0x91, 0x91, 0x91, 0x9d, 0x0f, 0x0c, 0x0d, 0x0d, 0x49, 0x0d, 0x0d, 0x0d,
+    0x91, 0x91, 0x91, 0x9d, 0x9d, 0x9d, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x9d, 0x9e, 0x9e,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x0d, 0x0d, 0x0c, 0x0f, 0x91, 0xb8, 0x12, 0x12, 0x12, 0xb8, 0xb9, 0x91, 0xb8, 0xb8, 0x12, 0x12,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9d, 0x9d, 0x91, 0x91, 0x91, 0x91, 0x9d, 0x9d, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x0d, 0x0d, 0x0d, 0x0c, 0x9d, 0x12, 0xb1, 0xb1, 0xb1, 0x12, 0x12, 0x12, 0x12, 0xb1, 0xb1, 0xb0,
+    0x0c, 0x0c, 0x0f, 0x9e, 0x9e, 0x9d, 0x91, 0x91, 0x9d, 0x9d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0c, 0x0d, 0x0d, 0x0c, 0x9e, 0x91, 0xb8, 0xb8, 0x9d, 0x0d, 0xc1, 0xa9, 0xa9, 0xc2, 0xc1, 0x5e,
+    0x49, 0x0d, 0x0c, 0x0f, 0x9e, 0x9d, 0x91, 0x9d, 0x9d, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0xb8, 0x9d, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x5e, 0x1c, 0x13, 0xbe, 0x9a, 0x79, 0x3c, 0x9a, 0xbb,
+    0x90, 0xc1, 0x49, 0x0d, 0x0f, 0x92, 0x9d, 0x9d, 0x9e, 0x0f, 0x0c, 0x0d, 0x0d, 0x0c, 0x0c, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x12, 0xb8, 0x9e, 0x0c, 0x0d, 0x0d, 0x5e, 0xc2, 0x25, 0x97, 0x79, 0xff, 0x7d, 0xba, 0x7d, 0x70,
+    0x9b, 0xbf, 0xbf, 0x0d, 0x0c, 0x9e, 0x9d, 0x92, 0x0f, 0x0c, 0x0d, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0xb8, 0x9e, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0xc1, 0x3f, 0x86, 0x79, 0xff, 0xba, 0xba, 0xff, 0x18,
+    0x4e, 0xd5, 0xc1, 0x49, 0x0d, 0x9e, 0x9d, 0x92, 0x0c, 0x0d, 0x0d, 0x49, 0x49, 0x0d, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x9e, 0x0c, 0x49, 0x49, 0x49, 0x0f, 0x9e, 0x0c, 0xd6, 0x41, 0xaa, 0x4b, 0xfe, 0x4c, 0x3d, 0x21,
+    0x98, 0x60, 0xd5, 0x5e, 0x0d, 0x0f, 0x9e, 0x9e, 0x0c, 0x49, 0x49, 0x5e, 0x49, 0x49, 0x0c, 0x0f,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x9e, 0x0c, 0x5e, 0x5e, 0x49, 0x0c, 0x9e, 0x0c, 0xd6, 0x11, 0x3c, 0xfe, 0xff, 0xff, 0x4c, 0xc5,
+    0x99, 0x60, 0x1c, 0xc1, 0x49, 0x0c, 0x0f, 0x9e, 0x0c, 0x49, 0x5e, 0x5e, 0x49, 0x49, 0x0c, 0x0c,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x9e, 0x0c, 0x5e, 0xbf, 0x5e, 0x0c, 0x0f, 0x49, 0x6a, 0x86, 0x4b, 0x44, 0xf1, 0xf2, 0x44, 0xf4,
+    0x98, 0x8e, 0x1c, 0xae, 0xf0, 0x0c, 0x0c, 0x0f, 0x0d, 0x49, 0x5e, 0x5e, 0x5e, 0x49, 0x0c, 0x0f,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x0f, 0x49, 0xbf, 0xbf, 0x5e, 0x0c, 0x0f, 0x49, 0x60, 0x86, 0x4b, 0x44, 0xf2, 0xf2, 0x44, 0x18,
+    0x98, 0x8f, 0x6a, 0xae, 0xf0, 0x0c, 0x0f, 0x0c, 0x49, 0x49, 0x5e, 0x5e, 0x5e, 0x49, 0x0c, 0x9e,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x0c, 0x49, 0xbf, 0xbf, 0xbf, 0x0c, 0x9e, 0x0c, 0xa9, 0x11, 0x3c, 0xff, 0x44, 0x44, 0x4c, 0xc5,
+    0x98, 0x25, 0x8e, 0xd6, 0xf0, 0x0d, 0x9e, 0x0c, 0x49, 0x49, 0x5e, 0x5e, 0x5e, 0x49, 0x0c, 0x9e,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x49, 0x5e, 0x5e, 0x4a, 0x4a, 0x90, 0xbf, 0xbf, 0xa9, 0x11, 0x4b, 0x44, 0xff, 0x4c, 0xff, 0x70,
+    0x1a, 0x08, 0xa9, 0x5e, 0x5e, 0x49, 0x0c, 0x9e, 0x0c, 0xbf, 0xd5, 0xc2, 0xf0, 0x5e, 0x6f, 0xa9,
+    0x3a, 0xd0, 0x40, 0xa0, 0x21, 0xaa, 0x4c, 0x4c, 0x19, 0x19, 0xc5, 0xd8, 0xd1, 0x1c, 0x0d, 0xb8,
+    0x4a, 0x93, 0x93, 0x1f, 0xd5, 0xcf, 0xa6, 0x08, 0x3a, 0x09, 0xd5, 0xf0, 0x4a, 0x93, 0x93, 0x5b,
+    0x9e, 0x49, 0x49, 0x0f, 0x9e, 0x93, 0x24, 0x08, 0x6e, 0x6e, 0x47, 0x1c, 0x0f, 0x12, 0xef, 0x3f,
+    0xa9, 0xe2, 0xd0, 0xfa, 0x9f, 0xf4, 0x19, 0xff, 0x0e, 0xff, 0xab, 0x9f, 0x97, 0x8f, 0x61, 0x4a,
+    0xa9, 0xbf, 0xbf, 0xbf, 0x49, 0x9d, 0xb8, 0x5e, 0x6e, 0xd3, 0xec, 0x25, 0xa9, 0xf0, 0x0d, 0xb1,
+    0x8c, 0xc5, 0x4b, 0xab, 0xaa, 0x96, 0x5a, 0xd5, 0x0c, 0x0c, 0x4a, 0x93, 0x2f, 0x61, 0xbf, 0x0d,
+    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x49, 0x5e, 0x5e, 0x4a, 0x4a, 0x90, 0xbf, 0xbf, 0xa9, 0x11, 0x4b, 0x44, 0x44, 0x4c, 0xff, 0x70,
+    0x1a, 0x08, 0x16, 0x5e, 0x49, 0x49, 0x49, 0x0c, 0xef, 0xc1, 0xdf, 0xc1, 0xc1, 0x6f, 0x6a, 0x13,
+    0xbe, 0xaa, 0x3c, 0xab, 0x4b, 0x4c, 0xab, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x9a, 0x40, 0xcf, 0xd5,
+    0x9e, 0x4a, 0x1f, 0x15, 0x87, 0xbe, 0x1e, 0xaa, 0xc3, 0xbe, 0x41, 0x1c, 0x5b, 0x93, 0xf0, 0xf0,
+    0x4a, 0xc1, 0xf0, 0xf0, 0x6f, 0x41, 0x2b, 0xc3, 0xc3, 0x21, 0x2b, 0x25, 0xbf, 0xb8, 0x5e, 0x6d,
+    0x14, 0xbd, 0x9a, 0x3c, 0x4b, 0x4c, 0xfe, 0x0e, 0xff, 0xfe, 0xff, 0x4c, 0xaa, 0xc3, 0x41, 0x6d,
+    0xa9, 0xf0, 0xef, 0xbf, 0x49, 0x9e, 0x0f, 0x74, 0x86, 0xc3, 0x9a, 0x1e, 0xbe, 0x65, 0xe1, 0x56,
+    0x3c, 0x4b, 0xfe, 0xff, 0x4c, 0xc3, 0x9c, 0x7e, 0x49, 0x0c, 0x4a, 0x93, 0x2f, 0x61, 0x5e, 0x49,
+    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x49, 0x90, 0x5e, 0x4a, 0x4a, 0x90, 0xbf, 0xbf, 0xa9, 0x11, 0x4b, 0x44, 0x44, 0x4c, 0xff, 0x70,
+    0x1a, 0x47, 0xd6, 0x49, 0x49, 0x5e, 0x49, 0x49, 0x49, 0xc1, 0x6f, 0x90, 0x90, 0x1c, 0x41, 0x1e,
+    0x4c, 0x0e, 0xfe, 0xff, 0x0e, 0xfe, 0xfe, 0xfe, 0xff, 0x44, 0x44, 0xba, 0xfe, 0x79, 0xfa, 0xe3,
+    0x0c, 0xf0, 0xa9, 0xa9, 0x13, 0xc3, 0x4b, 0xfe, 0x4b, 0x3c, 0xc4, 0xdc, 0x8e, 0x5e, 0x0d, 0xf0,
+    0x93, 0xc2, 0xd5, 0xa9, 0xd0, 0x9a, 0x3d, 0x4b, 0x4c, 0x4c, 0x4b, 0x4e, 0xa9, 0x49, 0xa9, 0x41,
+    0xaa, 0x3c, 0x79, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x44, 0x7d, 0xff, 0xfe, 0x4b, 0x9f,
+    0xb5, 0x7e, 0x5e, 0x4a, 0x4a, 0x0f, 0xef, 0x3f, 0x9a, 0x4c, 0x4c, 0x4b, 0x3d, 0xc9, 0x0a, 0xc3,
+    0xfe, 0xfe, 0xff, 0xff, 0x0e, 0x3c, 0x98, 0xe2, 0xbf, 0x49, 0x4a, 0x6f, 0x61, 0x90, 0x5e, 0x49,
+    0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+    0x49, 0x90, 0x90, 0x4a, 0x4a, 0x90, 0xd5, 0xbf, 0xa9, 0x11, 0x4b, 0x44, 0x44, 0x4c, 0xfe, 0x70,
+    0x1a, 0x47, 0x61, 0x0c, 0x49, 0x5e, 0x61, 0x90, 0xc1, 0x5e, 0x5e, 0x5e, 0xf0, 0xcf, 0x9a, 0x4b,
+    0x44, 0x44, 0x7d, 0xf2, 0x7d, 0x44, 0xff, 0x7d, 0x44, 0x7d, 0xf1, 0xba, 0xf1, 0xfe, 0x4b, 0x6b,
+    0xbf, 0xa9, 0xa9, 0x60, 0x65, 0xaa, 0xf2, 0xf2, 0x7d, 0x4c, 0x4c, 0x75, 0xa3, 0xbf, 0x0c, 0xbf,
+    0x3e, 0x61, 0xd5, 0x25, 0xfa, 0x4c, 0x44, 0x44, 0xf2, 0xba, 0x94, 0x85, 0x25, 0xd5, 0xe2, 0xc4,
+    0xfe, 0xfe, 0xff, 0x44, 0x44, 0x7d, 0x7d, 0xff, 0xff, 0xba, 0xba, 0xf1, 0xf1, 0x7d, 0xf2, 0xff,
+    0xd0, 0xb5, 0x5b, 0xef, 0x4a, 0x0c, 0xef, 0x47, 0xaa, 0x44, 0xf1, 0x44, 0x44, 0x52, 0xf1, 0xff,
+    0x44, 0x7d, 0x7d, 0x44, 0xff, 0x3d, 0x1a, 0x6d, 0xd6, 0x90, 0x5e, 0x90, 0x90, 0x90, 0x5e, 0x49,
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+    0x5e, 0xbf, 0x6f, 0x4a, 0x4a, 0x61, 0xd5, 0xbf, 0xa9, 0x86, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0x70,
+    0x1a, 0x47, 0x61, 0x0c, 0x49, 0x6f, 0xd6, 0xd5, 0xc1, 0xf0, 0x4a, 0x0d, 0xf0, 0x47, 0x3c, 0x0e,
+    0x44, 0xf2, 0xba, 0x7d, 0x44, 0x44, 0xfe, 0xfe, 0xff, 0x7d, 0xba, 0xba, 0x44, 0xff, 0x4c, 0xaa,
+    0x9b, 0x25, 0xa6, 0xe1, 0x8f, 0xc6, 0xf2, 0xf1, 0x44, 0xff, 0x44, 0x7b, 0x30, 0xd5, 0xef, 0xbf,
+    0xce, 0x5e, 0xbf, 0xa6, 0xc6, 0x44, 0x44, 0x44, 0xba, 0xf1, 0xb6, 0x1a, 0xa6, 0xc2, 0x8f, 0xc4,
+    0x7d, 0x44, 0x7d, 0xf2, 0x44, 0xff, 0xff, 0x0e, 0x4c, 0xff, 0x7d, 0x7d, 0xba, 0x44, 0x44, 0xff,
+    0xc4, 0xee, 0x8f, 0x1f, 0xc1, 0x49, 0xbf, 0x3a, 0x4b, 0x7d, 0x7d, 0x44, 0x7d, 0x70, 0xf2, 0xf1,
+    0x44, 0x44, 0x44, 0xba, 0xfe, 0x79, 0x1a, 0xa3, 0x6a, 0x61, 0x90, 0x90, 0x90, 0x5e, 0x5e, 0x4a,
+    0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+    0x90, 0x61, 0x61, 0x93, 0x4a, 0x61, 0xd5, 0xd5, 0xa9, 0x86, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0x70,
+    0x1a, 0x47, 0x61, 0x0c, 0x4a, 0x61, 0x16, 0x16, 0x2f, 0xc1, 0x4a, 0x4a, 0x93, 0x25, 0x3c, 0xff,
+    0xff, 0x0e, 0xf9, 0xa8, 0xfc, 0x17, 0x85, 0x17, 0x34, 0x7c, 0xfe, 0x7d, 0x44, 0xfe, 0x4b, 0x4b,
+    0xed, 0x3a, 0x09, 0xa9, 0x3f, 0xbb, 0x44, 0xba, 0xfe, 0x4c, 0xba, 0xf2, 0xde, 0xe2, 0xc2, 0x61,
+    0xe0, 0x4a, 0x49, 0x09, 0x4b, 0x44, 0x44, 0x0e, 0x7d, 0xf2, 0x55, 0x1d, 0x1c, 0xbf, 0x60, 0x2b,
+    0x44, 0xff, 0xba, 0xf9, 0xa8, 0x54, 0x17, 0x17, 0x1a, 0x33, 0xcd, 0x4c, 0xfe, 0x0e, 0xfe, 0xfe,
+    0x4c, 0x8a, 0xe9, 0x6a, 0xd5, 0x49, 0xbf, 0x25, 0x3c, 0xff, 0x7d, 0xfe, 0x0e, 0x44, 0x7d, 0xba,
+    0x7d, 0x44, 0xff, 0xfe, 0xfe, 0xc3, 0x17, 0x3a, 0x8e, 0xd6, 0x61, 0x90, 0x5e, 0x5e, 0x5e, 0x5e,
+    0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0xbf, 0x61, 0x2f, 0x93, 0x93, 0x61, 0xd5, 0xd5, 0xa9, 0x86, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0x70,
+    0x1a, 0x08, 0x2f, 0x4a, 0x5e, 0x74, 0x16, 0x16, 0x74, 0xc2, 0x5e, 0x4a, 0xf0, 0x8f, 0xbe, 0x20,
+    0x7a, 0x17, 0x84, 0x99, 0xdb, 0x31, 0x6d, 0xe2, 0x46, 0x31, 0xa0, 0x4b, 0x4c, 0xff, 0xff, 0xff,
+    0xca, 0xf6, 0x8f, 0xf0, 0xe0, 0xe3, 0x79, 0xfe, 0x4b, 0x4b, 0xff, 0x44, 0x36, 0xa3, 0xae, 0xdf,
+    0x3e, 0x4a, 0xf0, 0x14, 0x79, 0xff, 0x4c, 0x4c, 0xff, 0x63, 0x84, 0xb4, 0x6f, 0xbf, 0x6a, 0x41,
+    0x18, 0x2e, 0x85, 0x85, 0x99, 0xdc, 0x46, 0xb5, 0x60, 0x46, 0x31, 0x2b, 0x3c, 0x4c, 0xfe, 0x0e,
+    0x7d, 0x7a, 0xf6, 0xe2, 0xd5, 0x0d, 0xbf, 0x25, 0x3c, 0xfe, 0xfe, 0x79, 0x4b, 0xfe, 0xba, 0xff,
+    0x18, 0xa8, 0x85, 0x54, 0x36, 0x36, 0x17, 0x2c, 0x8f, 0x16, 0x61, 0x90, 0x5e, 0x5e, 0x61, 0x2f,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0xbf, 0xd5, 0x74, 0x2f, 0x93, 0x2f, 0xd6, 0xd5, 0xa9, 0x86, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xd4,
+    0x1a, 0x08, 0xd6, 0x4a, 0xc1, 0x74, 0x16, 0xd6, 0xc2, 0xdf, 0x6f, 0xc1, 0x4a, 0x69, 0x3b, 0x89,
+    0x17, 0x53, 0xa4, 0x5a, 0x6a, 0xc1, 0x4a, 0x0c, 0x5e, 0x6a, 0x86, 0x3c, 0x4c, 0xba, 0x7d, 0x7d,
+    0x6b, 0x1d, 0x6a, 0x5e, 0xc1, 0x5a, 0xc3, 0x79, 0x79, 0x79, 0x4c, 0xff, 0x0b, 0x30, 0xa5, 0xc1,
+    0x5f, 0x61, 0x1c, 0xbe, 0x4b, 0x4c, 0x4b, 0x4b, 0xfe, 0x38, 0x98, 0x3f, 0x5e, 0xd5, 0x6a, 0x8e,
+    0x99, 0x1a, 0x1d, 0xa4, 0x6e, 0x1c, 0x4a, 0x0f, 0xef, 0xc1, 0x8e, 0x97, 0x3c, 0x4c, 0xff, 0x44,
+    0x7d, 0x6c, 0xee, 0x25, 0x6f, 0x0d, 0x5e, 0x25, 0x3c, 0xfe, 0x4c, 0x3c, 0x3d, 0x4c, 0xfe, 0x18,
+    0x1b, 0x17, 0x36, 0x72, 0xa4, 0x7f, 0xdc, 0x6e, 0x8e, 0xd6, 0x90, 0x5e, 0xbf, 0x90, 0x2f, 0x3e,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0x61, 0x74, 0x15, 0x2f, 0x93, 0x74, 0xd6, 0xd5, 0xa9, 0x86, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xd4,
+    0x1a, 0x3a, 0x69, 0x61, 0x2f, 0x15, 0xd6, 0x61, 0x74, 0x15, 0xd6, 0xc1, 0x4a, 0xc1, 0x6a, 0x5a,
+    0x3f, 0x3f, 0x8e, 0x16, 0x93, 0x4a, 0x4a, 0xef, 0x93, 0x8f, 0x40, 0x3d, 0xfe, 0x44, 0xf2, 0xba,
+    0x0b, 0xed, 0x69, 0x4a, 0x90, 0x8e, 0x40, 0x3c, 0x4c, 0x4c, 0x4c, 0x4b, 0x4b, 0xde, 0x8f, 0x49,
+    0x5f, 0x32, 0x47, 0x9a, 0xfe, 0xff, 0x4c, 0xfe, 0xff, 0x54, 0xee, 0x2f, 0xc1, 0xe1, 0x8e, 0x69,
+    0x8f, 0x6d, 0x6d, 0x24, 0x60, 0x61, 0x4a, 0x0c, 0x49, 0x74, 0x25, 0xfa, 0x79, 0x0e, 0x44, 0x7d,
+    0x7d, 0x0b, 0x8b, 0x8e, 0x93, 0x4a, 0x93, 0x5a, 0xaa, 0xff, 0x4c, 0x3d, 0x3d, 0xfe, 0x0e, 0xb2,
+    0x1a, 0x82, 0x08, 0x25, 0x25, 0x8f, 0x8f, 0x32, 0x32, 0x74, 0x90, 0x49, 0x90, 0x6f, 0x15, 0x32,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+    0xd5, 0xd6, 0x15, 0x2f, 0x2f, 0x15, 0x16, 0xd5, 0x6a, 0x86, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xd4,
+    0x1a, 0x3a, 0x32, 0x74, 0x15, 0x15, 0x74, 0x61, 0x2f, 0x5f, 0x32, 0xdf, 0x4a, 0xef, 0x50, 0xce,
+    0x6f, 0xdf, 0x16, 0x6a, 0x3f, 0x3f, 0x8e, 0x8f, 0x08, 0xd2, 0xd8, 0x4c, 0x44, 0x44, 0x44, 0x7d,
+    0x0b, 0x8b, 0x15, 0x4a, 0x61, 0xe2, 0xe4, 0xc0, 0x4c, 0x44, 0xfe, 0x4c, 0x4c, 0x34, 0x5a, 0x0c,
+    0x3e, 0x25, 0x8d, 0x4b, 0xff, 0x44, 0xff, 0x7d, 0x63, 0x85, 0xb4, 0x93, 0x93, 0x6a, 0x8e, 0xce,
+    0x4a, 0x93, 0x15, 0x8f, 0x24, 0x8f, 0x8f, 0x8f, 0x47, 0xec, 0xd3, 0xcd, 0xfe, 0xff, 0xff, 0xba,
+    0x44, 0x29, 0x8b, 0x8e, 0x93, 0x4a, 0x93, 0x2c, 0x3d, 0x7d, 0xba, 0x4c, 0x4c, 0x44, 0x42, 0x84,
+    0x80, 0x8f, 0x1c, 0xd5, 0xd5, 0xdf, 0x3e, 0x5f, 0x3e, 0x2f, 0x90, 0x5e, 0x90, 0x61, 0x69, 0x32,
+    0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0xd5, 0x16, 0x69, 0x2f, 0x2f, 0x3e, 0x16, 0x16, 0x6a, 0x86, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xd4,
+    0x1a, 0x3a, 0x8e, 0x16, 0x16, 0x15, 0x61, 0x93, 0x1f, 0x69, 0x8e, 0x2a, 0xc1, 0xef, 0xef, 0xdf,
+    0xa9, 0xcf, 0x13, 0xfb, 0xbe, 0x1e, 0xc4, 0x3c, 0x3c, 0x4c, 0xfe, 0x7d, 0x44, 0xff, 0xfe, 0xfe,
+    0x10, 0x4e, 0x3e, 0x93, 0xa9, 0xe2, 0x25, 0xa0, 0xff, 0x7d, 0xfe, 0xfe, 0xff, 0x4d, 0x30, 0xf0,
+    0x2f, 0x6e, 0xa0, 0xfe, 0x44, 0x7d, 0x44, 0x7d, 0x42, 0x17, 0x8f, 0x93, 0x93, 0x60, 0x6a, 0x2f,
+    0xef, 0x1f, 0xcf, 0x13, 0xfb, 0x21, 0xc3, 0x3c, 0x3c, 0x4b, 0xfe, 0x44, 0x44, 0x44, 0xff, 0xfe,
+    0xff, 0x29, 0x8b, 0x8f, 0x2f, 0x4a, 0x93, 0x5d, 0x3d, 0xba, 0x7d, 0xff, 0xfe, 0xff, 0xa7, 0xb2,
+    0x5f, 0x5b, 0xf0, 0x4a, 0x5e, 0xf0, 0x2f, 0x3e, 0x15, 0x2f, 0x6f, 0x5e, 0x90, 0x74, 0x32, 0x8e,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0xd5, 0x16, 0x69, 0x15, 0x2f, 0x3e, 0x69, 0x16, 0x6a, 0x97, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xd4,
+    0x1a, 0x3a, 0x8e, 0x16, 0x16, 0x15, 0x74, 0x6f, 0x1f, 0xa5, 0x3f, 0x6a, 0x2f, 0xc1, 0xdf, 0x87,
+    0xbd, 0x1e, 0xab, 0x4b, 0xfe, 0xff, 0xff, 0x0e, 0xff, 0x44, 0x44, 0x44, 0x44, 0xfe, 0x4b, 0x4b,
+    0x10, 0x99, 0x24, 0x15, 0xa9, 0xa9, 0xe2, 0xfa, 0xff, 0x7d, 0xfe, 0x0e, 0x44, 0x19, 0x4f, 0x6a,
+    0x1f, 0x59, 0xaa, 0xff, 0x44, 0x44, 0x44, 0x7d, 0x55, 0x1d, 0x3f, 0x4a, 0x93, 0x6a, 0x6a, 0x2a,
+    0xcf, 0x41, 0x21, 0x3d, 0xfe, 0xff, 0xff, 0x44, 0xff, 0x7d, 0x7d, 0x44, 0x44, 0xff, 0x0e, 0x4c,
+    0x44, 0x0b, 0x4e, 0x25, 0x16, 0x5e, 0x2f, 0x3a, 0x3d, 0x7d, 0x44, 0xff, 0x0e, 0xfe, 0x55, 0xad,
+    0xdf, 0x6f, 0x4a, 0x0d, 0x0c, 0x4a, 0xc1, 0xdf, 0x69, 0x15, 0x2f, 0x6f, 0x61, 0x74, 0x32, 0x8e,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0xa9, 0x16, 0x32, 0x3e, 0x15, 0x3e, 0x32, 0x16, 0x6a, 0x97, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xf3,
+    0x1a, 0xeb, 0x8e, 0x74, 0x74, 0x15, 0xd6, 0x2f, 0x74, 0x32, 0xcf, 0x6a, 0x2a, 0x32, 0x13, 0xbe,
+    0xfe, 0xff, 0xba, 0x7d, 0x7d, 0xf2, 0x44, 0xff, 0x0e, 0xfe, 0xff, 0x44, 0x44, 0xff, 0xfe, 0x79,
+    0x64, 0x4f, 0x59, 0x69, 0xa9, 0xd5, 0xa9, 0xd1, 0x79, 0x44, 0xff, 0xfe, 0x7d, 0x44, 0x33, 0x04,
+    0x1f, 0xe4, 0x3d, 0xfe, 0xff, 0xff, 0x44, 0x62, 0x84, 0x82, 0xe0, 0x4a, 0x93, 0x16, 0x8f, 0x65,
+    0xaa, 0xab, 0xfe, 0x44, 0xf1, 0xf2, 0x44, 0x7d, 0xff, 0xff, 0xff, 0x44, 0x7d, 0xff, 0xff, 0xff,
+    0x44, 0x0b, 0x89, 0x3a, 0x6a, 0x61, 0x6f, 0x3a, 0x3c, 0x44, 0x44, 0xfe, 0xfe, 0xfe, 0xdd, 0xac,
+    0x74, 0x61, 0x4a, 0x4a, 0xef, 0x4a, 0x1f, 0x15, 0x16, 0x69, 0x74, 0x2f, 0x2f, 0x15, 0x32, 0x6a,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0xa9, 0x32, 0x32, 0x3e, 0x3e, 0x32, 0x32, 0x16, 0x8e, 0x97, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xf3,
+    0x17, 0xec, 0x8e, 0x2f, 0x2f, 0x15, 0x16, 0xd6, 0x15, 0x3f, 0x6a, 0x69, 0x60, 0x08, 0x1e, 0x4b,
+    0xba, 0xba, 0xba, 0xba, 0xf2, 0xff, 0xfe, 0x79, 0x79, 0x4b, 0x4c, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xb7, 0x8a, 0x5a, 0x15, 0x61, 0xf0, 0xc2, 0x3a, 0x21, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x67, 0xe6,
+    0xa5, 0xbd, 0x4b, 0xff, 0xff, 0xff, 0xff, 0x76, 0x98, 0x47, 0xe0, 0x1f, 0x93, 0x6a, 0xd0, 0x1e,
+    0xfe, 0xff, 0xba, 0xf1, 0xba, 0xba, 0xff, 0x4b, 0x3c, 0x3d, 0x4b, 0x79, 0xff, 0xff, 0x44, 0x7d,
+    0x44, 0x0b, 0x89, 0xec, 0x8f, 0x61, 0x6f, 0x25, 0x3c, 0x44, 0x44, 0xfe, 0xfe, 0x4b, 0x33, 0x26,
+    0x60, 0x16, 0x2f, 0x93, 0x93, 0x2f, 0x16, 0x6a, 0x6a, 0x6a, 0x69, 0x15, 0x2f, 0x15, 0x16, 0x6a,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x16, 0x32, 0x32, 0x3e, 0x3e, 0x32, 0x32, 0x16, 0x8e, 0x97, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xf5,
+    0x17, 0xec, 0x32, 0x6f, 0x6f, 0x15, 0x6a, 0x69, 0x16, 0x6a, 0x2a, 0x32, 0x09, 0xfb, 0xfe, 0xf1,
+    0xff, 0x19, 0x44, 0xf2, 0x10, 0x34, 0x17, 0x17, 0x85, 0x85, 0x75, 0x4c, 0xff, 0x44, 0x44, 0x44,
+    0x4d, 0xde, 0x3a, 0x1c, 0x4a, 0x4a, 0x93, 0x24, 0xfa, 0x3d, 0xff, 0xff, 0xfe, 0xfe, 0x9a, 0xb3,
+    0x5a, 0x1e, 0x4c, 0xff, 0xff, 0xff, 0xf3, 0x54, 0x7f, 0x3f, 0xe0, 0x5f, 0xe0, 0x8f, 0xbc, 0xfe,
+    0xff, 0xff, 0xf2, 0x7d, 0xf2, 0x43, 0xb3, 0x1a, 0x17, 0x85, 0x85, 0x7a, 0x4b, 0xfe, 0xff, 0xff,
+    0xff, 0x67, 0x4f, 0xeb, 0x8f, 0x61, 0x5e, 0x8f, 0x3c, 0x44, 0x44, 0xff, 0x4c, 0x4b, 0x8a, 0x26,
+    0x25, 0x8e, 0x32, 0x3e, 0x1f, 0x3e, 0x8e, 0x6a, 0x3f, 0x6a, 0x32, 0x3e, 0x15, 0x15, 0x16, 0x16,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x16, 0x32, 0x32, 0x3e, 0x3e, 0x32, 0x32, 0x16, 0x8e, 0x97, 0x4c, 0x7d, 0x44, 0x4c, 0xfe, 0xf5,
+    0x17, 0xec, 0x32, 0x5e, 0x93, 0x15, 0x6a, 0x6a, 0x6a, 0x69, 0x16, 0x60, 0x24, 0xaa, 0x44, 0xf1,
+    0x3d, 0x4c, 0x4b, 0xa8, 0x84, 0x51, 0xc9, 0x72, 0xd3, 0x0a, 0xcd, 0xfe, 0x0e, 0x44, 0x44, 0x7d,
+    0x10, 0xdd, 0x09, 0xd5, 0xef, 0x4a, 0xef, 0x3f, 0xa1, 0x3d, 0x4c, 0x44, 0x4c, 0x4b, 0x4b, 0xb3,
+    0x28, 0x3c, 0xff, 0x44, 0x7d, 0x44, 0x7b, 0x85, 0xa3, 0x3f, 0x32, 0x24, 0x8e, 0x08, 0x3c, 0xba,
+    0x4c, 0x79, 0xff, 0x44, 0x52, 0x84, 0x51, 0xe6, 0x72, 0xd3, 0x78, 0xd7, 0x4b, 0x4b, 0xfe, 0xfe,
+    0x4c, 0x67, 0x4f, 0x81, 0x24, 0x93, 0x4a, 0x8f, 0xaa, 0x44, 0xba, 0x44, 0xff, 0x4c, 0xfd, 0xf7,
+    0xa6, 0x25, 0x8f, 0xe0, 0xe0, 0x32, 0x8e, 0x25, 0x8f, 0x8f, 0x32, 0x3e, 0x3e, 0x15, 0x16, 0xa9,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x16, 0x6a, 0x8f, 0x8f, 0x8f, 0x16, 0x2f, 0x2f, 0x8f, 0x97, 0x79, 0xff, 0x44, 0x7d, 0xfe, 0xc6,
+    0x85, 0xec, 0xdf, 0x4a, 0x4a, 0xe1, 0x47, 0x8f, 0xc1, 0x9e, 0x4a, 0x32, 0x27, 0x79, 0xff, 0x44,
+    0x44, 0xff, 0x7c, 0x85, 0x30, 0x6d, 0x3f, 0x1c, 0x1c, 0x25, 0x14, 0xaa, 0x4b, 0x44, 0xf2, 0xf1,
+    0x4d, 0x4f, 0x32, 0x4a, 0x61, 0xe2, 0x6d, 0x8f, 0x59, 0xbe, 0x4c, 0xba, 0xba, 0x44, 0x4c, 0x6c,
+    0x7b, 0x3d, 0xab, 0xfe, 0xba, 0xf1, 0x76, 0x99, 0x32, 0x3f, 0x6d, 0x24, 0x24, 0xe4, 0x3d, 0xba,
+    0x9a, 0x3c, 0x79, 0x94, 0x84, 0xc9, 0xa4, 0x5f, 0x93, 0x1f, 0x6d, 0xfb, 0x79, 0xff, 0x44, 0xff,
+    0x44, 0x27, 0x8b, 0x3a, 0x5a, 0x32, 0x93, 0x8e, 0xaa, 0xff, 0xfe, 0x3d, 0xff, 0x44, 0xb3, 0x26,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0xd6, 0x32, 0x8f, 0x8f, 0x8f, 0x69, 0x2f, 0x74, 0x24, 0x97, 0x4b, 0x44, 0xba, 0x44, 0xfe, 0xc6,
+    0x85, 0xa2, 0x8f, 0x1f, 0x15, 0x6d, 0x3b, 0xa3, 0x6a, 0xf0, 0xc1, 0x24, 0x28, 0x4b, 0xff, 0xff,
+    0xf2, 0x7d, 0x7c, 0x98, 0x3a, 0xa5, 0x2a, 0x60, 0x6d, 0xec, 0x96, 0x79, 0xfe, 0xff, 0x44, 0xba,
+    0x64, 0x4f, 0x32, 0xf0, 0x74, 0x8f, 0x8f, 0x8e, 0x24, 0x40, 0x4c, 0x7d, 0xba, 0x44, 0xfe, 0x20,
+    0x94, 0x4b, 0x3d, 0xfe, 0xba, 0xf2, 0x85, 0x9c, 0x69, 0x32, 0x8f, 0x8f, 0x24, 0xe4, 0x4b, 0xba,
+    0xfe, 0x0e, 0xff, 0x63, 0x1b, 0x48, 0xcf, 0xef, 0x50, 0x58, 0xec, 0xcd, 0xfe, 0xff, 0xff, 0x0e,
+    0x44, 0x29, 0x8b, 0x2c, 0x5a, 0x69, 0x93, 0x8f, 0xaa, 0xff, 0xff, 0x4c, 0xff, 0x7d, 0x51, 0xf7,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x15, 0x32, 0x24, 0x6d, 0x24, 0x32, 0x15, 0x69, 0x6d, 0xbc, 0x4b, 0x44, 0xba, 0x7d, 0xff, 0x18,
+    0x1b, 0xac, 0x48, 0x5a, 0xa3, 0xec, 0xa2, 0xd3, 0xeb, 0x6d, 0x8f, 0x5a, 0xe3, 0x3d, 0x4c, 0x44,
+    0xf1, 0x7d, 0xab, 0x4f, 0x5a, 0x8e, 0xcf, 0x46, 0xe3, 0xd7, 0x4b, 0xff, 0x0e, 0xff, 0xfe, 0x4c,
+    0xf8, 0xde, 0x6d, 0x2f, 0x15, 0x8f, 0x8f, 0xa5, 0x8e, 0xeb, 0x3c, 0x44, 0xba, 0x44, 0xfe, 0xfe,
+    0x44, 0xfe, 0x4c, 0xff, 0xf1, 0x62, 0x84, 0x5a, 0x69, 0xe0, 0x24, 0x8f, 0x24, 0xe4, 0x3d, 0x7d,
+    0x7d, 0xba, 0x44, 0xfe, 0x99, 0x3b, 0x32, 0x1f, 0x58, 0xd0, 0xfa, 0x4c, 0xff, 0x44, 0x44, 0xfe,
+    0xba, 0xcb, 0x8b, 0x2c, 0x6e, 0xe0, 0x93, 0x6d, 0x3c, 0x7d, 0x44, 0xfe, 0x44, 0x7d, 0x51, 0xf6,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x15, 0x32, 0x24, 0x6d, 0x24, 0x8e, 0x69, 0x32, 0x6e, 0xbc, 0x4c, 0x44, 0xba, 0xf2, 0x44, 0xfe,
+    0x3d, 0x4b, 0x3d, 0x3c, 0xaa, 0x3c, 0x3c, 0x3d, 0x3d, 0x9a, 0xfb, 0xa4, 0xe3, 0x3c, 0x4c, 0x44,
+    0x7d, 0x44, 0x4c, 0x9f, 0x28, 0xd2, 0x48, 0x8d, 0xa0, 0x4b, 0x4b, 0xfe, 0xff, 0xfe, 0x4c, 0x4c,
+    0xf8, 0xde, 0x3a, 0x5f, 0x69, 0x8e, 0x3f, 0xe0, 0x5f, 0x5a, 0xa0, 0xff, 0x7d, 0x44, 0x44, 0xff,
+    0xf2, 0x7d, 0xfe, 0xff, 0x44, 0x52, 0x98, 0x6d, 0x2f, 0x15, 0x8e, 0x24, 0x24, 0x3b, 0xaa, 0xff,
+    0x44, 0x44, 0xff, 0x0e, 0x20, 0x27, 0xd3, 0xec, 0x28, 0x2b, 0xab, 0x4c, 0xff, 0x0e, 0xfe, 0xfe,
+    0xf1, 0x68, 0x4e, 0x3a, 0x6e, 0x15, 0x2f, 0x6d, 0xab, 0x7d, 0x44, 0x44, 0x44, 0x44, 0x51, 0xf6,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+    0x15, 0x32, 0x24, 0x6d, 0x24, 0x8e, 0x32, 0x24, 0xe9, 0x96, 0x4c, 0x44, 0xba, 0x7d, 0x44, 0xff,
+    0x4c, 0x4c, 0x19, 0xfe, 0x4c, 0x4c, 0x4c, 0xff, 0xff, 0x0e, 0xd8, 0x1d, 0xeb, 0x2b, 0x4c, 0x44,
+    0xff, 0x0e, 0xfe, 0x4c, 0x4b, 0x4b, 0x4b, 0x3d, 0x4c, 0x4b, 0x4c, 0xfe, 0x0e, 0xff, 0xff, 0xff,
+    0xf8, 0xfc, 0xe8, 0x8e, 0x32, 0x24, 0x32, 0x1f, 0x3e, 0x8f, 0x8d, 0x4c, 0x7d, 0x7d, 0x44, 0xff,
+    0xf1, 0x7d, 0x0e, 0xfe, 0x7d, 0x84, 0x30, 0x24, 0x93, 0x5f, 0x8e, 0x24, 0x8f, 0x5a, 0xa0, 0x4c,
+    0xfe, 0x0e, 0x0e, 0xff, 0xff, 0xfe, 0x4c, 0x4b, 0x4b, 0x3c, 0x4c, 0xfe, 0xfe, 0xff, 0x0e, 0xfe,
+    0xf1, 0x68, 0x4e, 0x3a, 0x6e, 0x69, 0x2f, 0x5a, 0x3c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x51, 0xf6,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+    0x3e, 0x32, 0x24, 0x6d, 0x6d, 0x24, 0x32, 0x24, 0x2c, 0xbc, 0x4b, 0x44, 0xba, 0x44, 0xff, 0xfe,
+    0x4c, 0xff, 0x7d, 0x7d, 0x44, 0xff, 0xfe, 0x44, 0xf1, 0x7d, 0x7c, 0x99, 0x81, 0x28, 0x3c, 0xff,
+    0xfe, 0xff, 0x44, 0xff, 0xba, 0xff, 0x44, 0xff, 0xff, 0xff, 0x0e, 0x63, 0x0e, 0xff, 0xff, 0xff,
+    0xf8, 0xfd, 0xa4, 0x24, 0x24, 0x24, 0x32, 0x2f, 0x2f, 0x8e, 0xec, 0x3c, 0xfe, 0xff, 0xff, 0xff,
+    0xf1, 0x44, 0xfe, 0x4c, 0x68, 0x84, 0x48, 0x3f, 0xdf, 0x5f, 0x8e, 0x24, 0x8f, 0x6d, 0xfa, 0x3c,
+    0x44, 0x44, 0x44, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xfe, 0xfe, 0x0e, 0x63, 0x44, 0xff, 0x44,
+    0xf2, 0x0b, 0x4e, 0xeb, 0x5a, 0x32, 0x15, 0x5a, 0x3d, 0x44, 0x7d, 0x44, 0x44, 0xff, 0x33, 0x31,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+    0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x3e, 0x32, 0x24, 0x6d, 0x6d, 0x24, 0x24, 0x24, 0x3a, 0xfa, 0xab, 0x4c, 0xff, 0xff, 0xfe, 0x4b,
+    0x4b, 0xff, 0x44, 0x7d, 0x44, 0xff, 0xff, 0x7d, 0xba, 0x7d, 0x68, 0x98, 0xe9, 0x81, 0x9f, 0x3d,
+    0xfe, 0xff, 0xff, 0xba, 0x44, 0xba, 0x7d, 0xf2, 0x7d, 0x44, 0x2d, 0x37, 0xff, 0x79, 0x4c, 0x4c,
+    0x6c, 0x8a, 0xeb, 0x59, 0x8f, 0x24, 0x32, 0xe0, 0x1f, 0xe1, 0x3a, 0xa0, 0x79, 0x4c, 0x4c, 0x4c,
+    0xf1, 0x7d, 0x4c, 0x3d, 0xe5, 0xde, 0xeb, 0xa5, 0xe0, 0x32, 0x8f, 0x24, 0x8e, 0x8f, 0x3b, 0x96,
+    0xf2, 0xba, 0x44, 0xff, 0x0e, 0xfe, 0xff, 0xff, 0xff, 0x19, 0xfe, 0xa8, 0x37, 0xff, 0x7d, 0x44,
+    0x44, 0x6b, 0x8b, 0x3b, 0x59, 0x8e, 0xe0, 0x5a, 0x3c, 0xff, 0xff, 0xfe, 0xfe, 0x4b, 0xde, 0x31,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x32, 0x8e, 0x24, 0x6d, 0x6d, 0x24, 0x24, 0x6d, 0x5a, 0xe3, 0x2b, 0x3d, 0x4c, 0x4b, 0x3d, 0x3d,
+    0x3d, 0x4c, 0xfe, 0x44, 0xfe, 0x4b, 0x4c, 0xfe, 0x44, 0x0e, 0x7a, 0x99, 0x2c, 0xe7, 0x72, 0x29,
+    0x79, 0x4b, 0xfe, 0x44, 0x7d, 0xf1, 0x7d, 0x44, 0x94, 0xfc, 0x84, 0x6b, 0x9a, 0x4b, 0xfe, 0x18,
+    0xc9, 0x99, 0x3b, 0x59, 0x24, 0x24, 0x24, 0x32, 0x69, 0xa5, 0x47, 0xe3, 0xbb, 0x9a, 0xab, 0x3d,
+    0xff, 0x4c, 0x21, 0x27, 0x17, 0x30, 0xe9, 0x24, 0x32, 0xa5, 0x6e, 0x6e, 0xb5, 0x8f, 0xa3, 0xec,
+    0x64, 0xff, 0x4c, 0x4c, 0xfe, 0x44, 0x44, 0x44, 0x44, 0xf4, 0xfc, 0x85, 0x07, 0x3c, 0xfe, 0x44,
+    0x18, 0xc9, 0x4e, 0x08, 0x59, 0x8f, 0x32, 0x6e, 0xbc, 0xc6, 0x3d, 0x3d, 0x9a, 0xcd, 0x1a, 0x31,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x8e, 0x24, 0x6d, 0x6d, 0x6d, 0x24, 0x24, 0x24, 0x59, 0x3b, 0xf7, 0x99, 0x85, 0x85, 0x85, 0x85,
+    0x85, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84, 0x84, 0x17, 0x9c, 0x59, 0x08, 0xeb, 0x72,
+    0xdb, 0xd3, 0xcd, 0xf5, 0x7d, 0xf1, 0xf9, 0x2e, 0x84, 0x98, 0x30, 0xd2, 0x57, 0x17, 0x84, 0x84,
+    0x1a, 0x53, 0x2c, 0x6e, 0x24, 0x24, 0x59, 0x24, 0x6a, 0x8e, 0x25, 0xec, 0xf7, 0x99, 0x85, 0x85,
+    0x84, 0x85, 0x85, 0x1a, 0xed, 0x82, 0x08, 0x24, 0x24, 0x6d, 0x6e, 0x6d, 0x24, 0x8e, 0x6d, 0x5a,
+    0xd2, 0x30, 0xca, 0x9f, 0x18, 0x7d, 0xf1, 0x62, 0x2d, 0x84, 0x1a, 0xf6, 0xe3, 0x26, 0x85, 0x84,
+    0x85, 0x1a, 0x9c, 0x5a, 0x5a, 0x24, 0x3f, 0x59, 0x48, 0x89, 0x17, 0x17, 0x85, 0x85, 0x99, 0x82,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+    0x24, 0x24, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x24, 0x24, 0x5a, 0xeb, 0x48, 0x72, 0xd2, 0xec, 0xec,
+    0xd3, 0xd3, 0xd2, 0xd2, 0xd2, 0xd2, 0xd3, 0xd3, 0xd3, 0x48, 0x3a, 0x08, 0x6e, 0x59, 0xe9, 0xe8,
+    0x3a, 0xf7, 0x35, 0x1b, 0x84, 0x84, 0x85, 0x1a, 0x53, 0xa3, 0x47, 0x6e, 0xe9, 0xd3, 0x0a, 0x6b,
+    0xa3, 0x3a, 0x6e, 0x59, 0x24, 0x6e, 0x6e, 0x59, 0x24, 0xa5, 0x24, 0x08, 0xec, 0xd2, 0xc8, 0xa1,
+    0xd2, 0xec, 0x81, 0xe9, 0x03, 0x3b, 0x2c, 0x24, 0x6d, 0x6e, 0x5a, 0x6e, 0x24, 0x8e, 0x8e, 0x24,
+    0x6e, 0x59, 0x82, 0x53, 0x1a, 0x84, 0x84, 0x84, 0xfc, 0x35, 0x81, 0x59, 0x46, 0x08, 0x48, 0x78,
+    0xd2, 0x82, 0x5a, 0x08, 0x59, 0x24, 0x8f, 0x6e, 0xeb, 0xeb, 0xeb, 0x81, 0x48, 0x72, 0x48, 0xeb,
+    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x24, 0x8f, 0x6d, 0x5a, 0x08, 0x3b, 0x3a, 0xe9, 0xe9,
+    0x48, 0xeb, 0x5a, 0x5a, 0x5a, 0x3a, 0x3a, 0x3a, 0xa3, 0x6d, 0x6d, 0x6d, 0x59, 0x5a, 0x6e, 0x6e,
+    0xec, 0xec, 0xec, 0x3b, 0x3b, 0xa4, 0xe9, 0x2c, 0xa3, 0x59, 0x59, 0x6e, 0x6e, 0x5a, 0x2c, 0x3a,
+    0x8f, 0x6d, 0x59, 0x6e, 0x6e, 0x59, 0x59, 0xe7, 0x08, 0x8f, 0x24, 0x24, 0xe9, 0x03, 0x2c, 0x59,
+    0xe9, 0x59, 0x59, 0x6e, 0x5a, 0x5a, 0x5a, 0x6e, 0x5a, 0x5a, 0x5a, 0x6e, 0x24, 0x8e, 0x8e, 0x8e,
+    0xa4, 0x3b, 0x6e, 0xb5, 0x24, 0x5a, 0xeb, 0xd2, 0xd2, 0xd2, 0x3b, 0x6e, 0x24, 0x8f, 0x24, 0x59,
+    0x08, 0x6e, 0x6e, 0x6e, 0x59, 0x59, 0x24, 0x24, 0x59, 0x6e, 0x08, 0x5a, 0x3a, 0x3b, 0x3b, 0xa4,
+    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x6d, 0x6d, 0x6d, 0x59, 0x59, 0x6d, 0x6d, 0x6d, 0x24, 0x24, 0x6d, 0x59, 0x59, 0x6e, 0x6e, 0x08,
+    0xe8, 0x5a, 0x24, 0x8e, 0x24, 0x6d, 0x5a, 0x6d, 0x8f, 0x6a, 0x8e, 0x6d, 0x5a, 0x6e, 0x24, 0xb5,
+    0x48, 0xa4, 0xa3, 0x24, 0x32, 0x5f, 0x3e, 0x32, 0x8f, 0x6e, 0x5a, 0x5a, 0x6d, 0x24, 0xa5, 0xe0,
+    0x32, 0x24, 0x6e, 0x6e, 0x59, 0x24, 0x5a, 0x3b, 0xe9, 0x6d, 0x24, 0x24, 0x6e, 0x08, 0x6e, 0x24,
+    0x8f, 0x6d, 0x24, 0x6d, 0x59, 0x59, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x6d, 0x24, 0x24, 0x24,
+    0xd2, 0xeb, 0x24, 0xe0, 0x50, 0x50, 0xe0, 0x24, 0x2c, 0xe8, 0x5a, 0x59, 0x24, 0x58, 0x32, 0x5f,
+    0x59, 0x59, 0x59, 0x59, 0x6e, 0x6e, 0x6d, 0x6d, 0x6e, 0x6d, 0x24, 0x59, 0x59, 0xe9, 0x2c, 0x08,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x6e, 0x8f, 0x6d, 0x24, 0x6d, 0x6e, 0x59,
+    0x5a, 0x59, 0x24, 0x32, 0x24, 0x6d, 0x6d, 0x6d, 0x24, 0x32, 0x24, 0x59, 0x5a, 0x59, 0x24, 0x6a,
+    0x2c, 0x08, 0x8f, 0x32, 0x58, 0xe0, 0x3e, 0x32, 0x32, 0x8f, 0x6d, 0x24, 0x24, 0x24, 0x6a, 0x32,
+    0x5f, 0x8f, 0xe7, 0x5a, 0x59, 0x6d, 0x5a, 0x81, 0x03, 0x59, 0x24, 0x24, 0x59, 0xe9, 0x59, 0x24,
+    0x24, 0x24, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x5a, 0x5a, 0x59, 0x59, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d,
+    0x6e, 0x24, 0x32, 0x3e, 0xe0, 0x58, 0x32, 0x6e, 0x6e, 0x6e, 0x24, 0x24, 0x32, 0x5f, 0x5f, 0x58,
+    0x6d, 0x6e, 0x6e, 0x59, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 0x59, 0x5a, 0x5a,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x59, 0x59, 0x59, 0x6e, 0x5a, 0x5a, 0x5a, 0x5a, 0x6e, 0x59, 0x6d, 0x8f, 0x6e, 0x6e, 0x59, 0x59,
+    0x6e, 0x59, 0x24, 0x24, 0x6d, 0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0x6e, 0x2c, 0x2c, 0x59, 0x24, 0x8e,
+    0x24, 0x24, 0x59, 0x6e, 0x6e, 0x59, 0x59, 0x24, 0x24, 0xa5, 0x32, 0x3f, 0x8f, 0x59, 0x59, 0x59,
+    0x58, 0x59, 0x03, 0xe8, 0x6e, 0x8f, 0x6e, 0xa4, 0x81, 0x59, 0x24, 0x24, 0x5a, 0x2c, 0x5a, 0x8f,
+    0x24, 0x6e, 0x6e, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x24, 0x24, 0x6d, 0x59, 0x5a, 0x5a, 0x5a,
+    0x15, 0xe0, 0x32, 0x8f, 0x5a, 0x3b, 0x3b, 0xa4, 0xe9, 0x59, 0x24, 0x32, 0x32, 0xb5, 0x24, 0x6e,
+    0x59, 0x59, 0x59, 0x24, 0x24, 0x24, 0x24, 0x59, 0x6d, 0x59, 0x5a, 0x2c, 0x6e, 0x59, 0x6d, 0x6e,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x59, 0x59, 0x59, 0x59, 0x5a, 0xe7, 0x2c, 0x2c, 0x2c, 0x59, 0x59, 0x59, 0x6d, 0x59, 0x5a, 0x2c,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0x2c, 0x2c, 0x2c, 0xe7, 0xe8, 0x03, 0x81, 0x6e, 0x24, 0xb5,
+    0x24, 0x24, 0x59, 0x2c, 0x81, 0x81, 0xe8, 0xe8, 0x5a, 0x6e, 0x59, 0x24, 0x59, 0x2c, 0x3b, 0x73,
+    0x24, 0x2c, 0xeb, 0xeb, 0x6d, 0x24, 0x6d, 0x3b, 0x03, 0x59, 0x24, 0x24, 0x6e, 0xe8, 0x5a, 0x6d,
+    0x6e, 0x2c, 0xe8, 0x2c, 0xe9, 0x59, 0x6e, 0x6e, 0x59, 0x24, 0x24, 0x24, 0x6e, 0xe8, 0x81, 0x81,
+    0x24, 0x24, 0x6e, 0xe8, 0x04, 0xd2, 0xec, 0x04, 0x5a, 0x6e, 0x8f, 0x24, 0x59, 0x08, 0xeb, 0x48,
+    0x3b, 0xeb, 0x2c, 0x59, 0x24, 0x24, 0x6e, 0x6e, 0x6e, 0x59, 0xe8, 0x3b, 0x08, 0x59, 0x24, 0x6d,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+    0x59, 0x59, 0x59, 0x59, 0x5a, 0xe7, 0xe8, 0xe8, 0xe9, 0x5a, 0x6e, 0x59, 0x59, 0x59, 0xe7, 0xe8,
+    0x59, 0x59, 0x5a, 0xe7, 0xe7, 0x2c, 0xe8, 0xe8, 0x03, 0xeb, 0xeb, 0x04, 0xe8, 0x2c, 0x6e, 0x24,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe8, 0x03, 0x03, 0x81, 0x81, 0xeb, 0xeb, 0x04, 0xe7, 0xe7, 0xe7,
+    0x24, 0xe7, 0x22, 0xeb, 0x6e, 0x8e, 0x6d, 0xe8, 0x03, 0x59, 0x24, 0x24, 0x59, 0xeb, 0x3a, 0x6d,
+    0x5a, 0xe9, 0xa4, 0x81, 0x2c, 0x5a, 0x59, 0x59, 0x24, 0x32, 0x32, 0x24, 0x6e, 0x81, 0xeb, 0xeb,
+    0x48, 0xd2, 0xc8, 0x81, 0xeb, 0xe8, 0x59, 0x59, 0x6d, 0x24, 0x59, 0x2c, 0x81, 0x48, 0x72, 0x78,
+    0x81, 0xa4, 0xe9, 0x6d, 0x24, 0x24, 0x24, 0x59, 0x6e, 0x2c, 0x81, 0xa4, 0xe9, 0x59, 0x24, 0x24,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5a, 0xe7, 0xe7, 0x2c, 0x2c, 0x2c,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x5a, 0x5a, 0x5a, 0x5a, 0x59,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x5a, 0x5a, 0x2c, 0x5a, 0x5a, 0xe7, 0x5a, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x2c, 0x2c, 0x2c, 0x2c,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0xe8, 0xe8, 0xe8, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0xe7, 0xe7,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x2c, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8,
+    0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0xe8, 0xe8, 0xe8, 0xe8,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d, 0x5d,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x81, 0x81, 0x81, 0x81, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0xea,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x81, 0xc7, 0xc7, 0xc7, 0xc8, 0xc8,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x73, 0xc7, 0xc7, 0xc7, 0xc7, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x04, 0x04, 0xea, 0xea, 0xea,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xc7, 0xc7, 0xc7, 0xc8, 0xc8, 0xc8,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x23, 0x73, 0xc7, 0xc7, 0xc8, 0xc8, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xea, 0xea, 0xea, 0xea,
+    0xc7, 0xc7, 0x04, 0x04, 0x04, 0xea, 0xea, 0xea, 0xea, 0x04, 0xc7, 0xc7, 0xc7, 0xc8, 0xc8, 0xc8,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0x73, 0x73, 0x23, 0xc7, 0xc7, 0xc8, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xea, 0xea, 0x73, 0x73,
+    0xc8, 0x83, 0xc7, 0x81, 0xea, 0x39, 0x04, 0xea, 0xea, 0xea, 0x73, 0xc7, 0xc7, 0xc8, 0xc8, 0xc8,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+    0x73, 0x73, 0x73, 0x73, 0xc7, 0xc7, 0x81, 0x81, 0x81, 0x81, 0x81, 0xa4, 0x73, 0x73, 0x83, 0x73,
+    0xc8, 0x22, 0xc7, 0xc8, 0xeb, 0xea, 0x39, 0x04, 0xea, 0xea, 0x39, 0x73, 0x73, 0x23, 0x23, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x23, 0x73, 0x73, 0x73, 0xc7, 0xc7, 0x04, 0x04, 0xeb, 0xa4, 0x81, 0xeb, 0xc7, 0xc8, 0x39, 0x23,
+    0xa1, 0x45, 0x83, 0x83, 0xc8, 0xc7, 0x39, 0x39, 0x39, 0x39, 0x39, 0x73, 0x23, 0x23, 0x23, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x23, 0x23, 0x23, 0x23, 0x73, 0xc7, 0xc7, 0xc7, 0xc7, 0x83, 0xc8, 0xc8, 0x83, 0x22, 0x22, 0xa1,
+    0x78, 0xda, 0x77, 0x00, 0x01, 0xc8, 0xc8, 0x39, 0x73, 0x73, 0x23, 0x23, 0x23, 0x22, 0x22, 0x45,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x45, 0x23, 0x23, 0x23, 0x23, 0x23, 0xc7, 0xc7, 0xc7, 0x22, 0x22, 0x01, 0x00, 0x77, 0x77, 0xa2,
+    0x28, 0x06, 0x05, 0xa2, 0x77, 0x71, 0xa1, 0x45, 0x22, 0x22, 0x22, 0x22, 0x45, 0x45, 0x45, 0x02,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+    0x02, 0x45, 0x45, 0x45, 0x22, 0x23, 0x23, 0x23, 0x45, 0x45, 0x71, 0x77, 0xa2, 0x05, 0x06, 0xd7,
+    0x2b, 0x0a, 0xca, 0x06, 0x06, 0x71, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0xd9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xda, 0x77, 0x02, 0x02, 0x01, 0x45, 0x45, 0x45, 0x01, 0x02, 0xd9, 0xda, 0x06, 0xca, 0x0a, 0xc4,
+    0x3d, 0xbb, 0x0a, 0x06, 0x05, 0x05, 0xda, 0xd9, 0x02, 0x02, 0x02, 0x02, 0xd9, 0xd9, 0xd9, 0x77,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xda, 0xda, 0xda, 0xd9, 0x02, 0x02, 0x02, 0x02, 0xd9, 0x71, 0x05, 0x06, 0x06, 0x27, 0xbb, 0x3d,
+    0x3c, 0x3d, 0x21, 0xcb, 0x27, 0x05, 0x71, 0x05, 0x77, 0xd9, 0xd9, 0xd9, 0x77, 0xda, 0xda, 0xda,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x06, 0x05, 0xda, 0x77, 0xd9, 0xd9, 0xd9, 0xd9, 0x77, 0x71, 0x78, 0x0a, 0xcb, 0xc0, 0x3d, 0x3c
+};
+
+const tIndexedImage lavar = { image_data_lavar, 160, 80,
+    8, palette_lavar };
+
+#endif /* IDX_LAVAR_H_ */
@@ -0,0 +1,325 @@
+/*******************************************************************************
+* indexed image (gerado por tools/imgconv.py, nao editar)
+* name: voltar
+* size: 160x60, 4 bits per pixel, 16 cores
+*******************************************************************************/
+
+#ifndef IDX_VOLTAR_H_
+#define IDX_VOLTAR_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+static const uint8_t palette_voltar[48] = {
+    0x99, 0x99, 0x99, 0x97, 0x97, 0x97, 0x92, 0x92, 0x92, 0xfd, 0xfd, 0xfd, 0x9b, 0x9b, 0x9b, 0xa2,
+    0xa2, 0xa2, 0x09, 0x09, 0x09, 0x78, 0x78, 0x78, 0x2b, 0x2b, 0x2b, 0x45, 0x45, 0x45, 0xb0, 0xb0,
+    0xb0, 0xc4, 0xc4, 0xc4, 0x50, 0x50, 0x50, 0x60, 0x60, 0x60, 0xdc, 0xdc, 0xdc, 0xed, 0xed, 0xed
+};
+
+static const uint8_t image_data_voltar[4800] = {
+    0x33, 0xea, 0x50, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0xae, 0x33,
+    0x3b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x05, 0xb3,
+    0xe5, 0x24, 0x11, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x42, 0x5f,
+    0xa1, 0x05, 0x11, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x11, 0x50, 0x4b,
+    0x54, 0x01, 0x10, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x42, 0x21, 0x45,
+    0x00, 0x11, 0x41, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x21, 0x40,
+    0x11, 0x45, 0x41, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x54, 0x40,
+    0x41, 0x11, 0x24, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x12, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x00, 0x42, 0x24, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x44, 0x50, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x10, 0x41, 0x20, 0x01, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x11, 0x12, 0x44, 0x04, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x44, 0x00, 0x44, 0x11, 0x10, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x54, 0x02, 0x41, 0x04, 0x54, 0x01, 0x21, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x45, 0xff, 0x33, 0xea, 0x05, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x41, 0x45, 0x33, 0x33, 0x31, 0x72, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x11, 0x0a, 0xf3, 0x33, 0x3b, 0x52, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xe3, 0x33, 0x3b, 0x25, 0x21, 0x41, 0x51, 0x44, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x04, 0x44, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc1, 0x00, 0x41, 0x00, 0x00, 0x14, 0x10,
+    0x04, 0x01, 0x01, 0x14, 0x10, 0x40, 0x10, 0x44, 0x04, 0x40, 0x11, 0x01, 0x10, 0x44, 0x01, 0x00,
+    0x00, 0x01, 0x04, 0x01, 0x51, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x4a, 0x33, 0x33, 0x3e, 0xc5, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x2a, 0x33, 0x33, 0x32, 0xc1, 0x42, 0x02, 0x02, 0x22, 0x14, 0x44, 0x00,
+    0x00, 0x00, 0x01, 0x11, 0x04, 0x05, 0x33, 0x33, 0x37, 0x94, 0x50, 0x40, 0x42, 0x14, 0x42, 0x21,
+    0x11, 0x00, 0x40, 0x12, 0x00, 0x11, 0x00, 0x12, 0x11, 0x14, 0x44, 0x45, 0x40, 0x11, 0x10, 0x01,
+    0x11, 0x04, 0x02, 0x14, 0x21, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x45, 0x33, 0x33, 0x33, 0x94, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2e, 0x33, 0x33, 0x39, 0x92, 0x42, 0x55, 0x44, 0x55, 0x40, 0x10, 0x04,
+    0x00, 0x04, 0x44, 0x44, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc4, 0x12, 0x05, 0xe3, 0x33, 0xfa, 0x51,
+    0x54, 0x01, 0x10, 0x40, 0x40, 0x04, 0x44, 0x44, 0x01, 0x04, 0x41, 0x22, 0x01, 0x10, 0x45, 0x44,
+    0x50, 0x21, 0x45, 0x40, 0x45, 0x40, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x14, 0xe3, 0x33, 0x33, 0x17, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x43, 0x33, 0x33, 0xf6, 0x74, 0x02, 0x41, 0x21, 0x11, 0x01, 0x10, 0x01,
+    0x00, 0x00, 0x00, 0x04, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc4, 0x01, 0x5a, 0x33, 0x33, 0x37, 0x74,
+    0x22, 0x04, 0x04, 0x41, 0x00, 0x04, 0x12, 0x14, 0x54, 0x11, 0x04, 0x55, 0x00, 0x40, 0x11, 0x10,
+    0x24, 0x51, 0x21, 0x01, 0x21, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x25, 0xa3, 0x33, 0x33, 0xf9, 0x00,
+    0x00, 0x00, 0x00, 0x11, 0x53, 0x33, 0x33, 0x26, 0x20, 0x44, 0x02, 0x04, 0x44, 0x41, 0x10, 0x44,
+    0x44, 0x44, 0x00, 0x12, 0x04, 0x05, 0x33, 0x33, 0x37, 0x91, 0x44, 0x4a, 0x33, 0x33, 0x37, 0xc2,
+    0x44, 0x54, 0x10, 0x01, 0x40, 0x44, 0x01, 0x04, 0x20, 0x40, 0x00, 0x12, 0x44, 0x00, 0x00, 0x45,
+    0x21, 0x00, 0x04, 0x01, 0x42, 0x45, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x25, 0x43, 0x33, 0x33, 0x39, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0xb3, 0x33, 0x33, 0x89, 0x02, 0x04, 0x04, 0x42, 0x21, 0x00, 0x04, 0x02,
+    0x00, 0x10, 0x44, 0x40, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc5, 0x42, 0x2a, 0x33, 0x33, 0x37, 0xc5,
+    0x24, 0x02, 0x00, 0x00, 0x01, 0x10, 0x45, 0x41, 0x14, 0x41, 0x10, 0x44, 0x11, 0x04, 0x54, 0x12,
+    0x50, 0x00, 0x01, 0x14, 0x51, 0x20, 0x10, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x1e, 0x33, 0x33, 0x32, 0x74,
+    0x00, 0x00, 0x00, 0x44, 0xf3, 0x33, 0x3e, 0x67, 0x50, 0x12, 0x21, 0x05, 0xbe, 0xf3, 0x33, 0xfe,
+    0xba, 0x42, 0x20, 0x00, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc2, 0x20, 0x4a, 0x33, 0x33, 0x37, 0xc0,
+    0x15, 0x02, 0x55, 0x10, 0x25, 0xab, 0xef, 0x33, 0x3f, 0xeb, 0x51, 0x24, 0x00, 0x01, 0x11, 0x04,
+    0x20, 0x42, 0x0a, 0xe3, 0x3f, 0xb0, 0x45, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x40, 0x01, 0x4b, 0x33, 0x33, 0x3e, 0x91,
+    0x00, 0x00, 0x04, 0x55, 0x33, 0x33, 0x32, 0x61, 0x20, 0x40, 0x05, 0xb3, 0x33, 0x33, 0x33, 0x33,
+    0x3f, 0xb5, 0x00, 0x00, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc2, 0xa3, 0x33, 0x33, 0x3f, 0x33, 0x33,
+    0x33, 0xb1, 0x00, 0x25, 0xef, 0x33, 0x33, 0x33, 0x33, 0x33, 0xfa, 0x01, 0x04, 0x41, 0x1a, 0xe3,
+    0x3f, 0xb4, 0xaf, 0x33, 0x33, 0xa7, 0x25, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x94,
+    0x01, 0x41, 0x41, 0x1b, 0x33, 0x33, 0x38, 0x90, 0x41, 0x41, 0x5e, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x3f, 0x20, 0x01, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc4, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x5d, 0x40, 0x0f, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x33, 0x14, 0x42, 0x41, 0x1a, 0x33,
+    0x33, 0x57, 0xf3, 0x33, 0x33, 0xa8, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0x33, 0x33, 0x77,
+    0x41, 0x00, 0x10, 0x4f, 0x33, 0x33, 0xe6, 0x70, 0x42, 0x00, 0xe3, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0xb2, 0x40, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc0, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0xa8, 0x00, 0xa3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf7, 0x40, 0x40, 0x05, 0x33,
+    0xf3, 0xab, 0x33, 0x33, 0x33, 0xa8, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x33, 0x33, 0xec,
+    0x42, 0x14, 0x00, 0x53, 0x33, 0x33, 0x26, 0x04, 0x01, 0x4b, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x35, 0x24, 0x04, 0x05, 0x33, 0x33, 0x37, 0x91, 0xb3, 0xf3, 0x33, 0x3f, 0x33, 0x33,
+    0x33, 0x18, 0x42, 0xa3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3d, 0x20, 0x00, 0x45, 0x33,
+    0x33, 0xe3, 0x33, 0x33, 0x33, 0x28, 0x45, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x33, 0x33, 0x39,
+    0x04, 0x10, 0x41, 0xb3, 0x33, 0x33, 0x8c, 0x00, 0x04, 0x53, 0x33, 0x33, 0x3f, 0xd6, 0x68, 0x7f,
+    0x33, 0x33, 0x3e, 0xd4, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc2, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x3f, 0xd8, 0x25, 0xa3, 0x33, 0xe2, 0x86, 0x66, 0x8b, 0x33, 0x33, 0x35, 0xd1, 0x11, 0x45, 0x33,
+    0x33, 0x33, 0x33, 0xd6, 0x8d, 0x89, 0x20, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x33, 0x33, 0x37,
+    0x75, 0x02, 0x42, 0xf3, 0x33, 0x3e, 0x67, 0x52, 0x50, 0xa3, 0x33, 0x33, 0xe8, 0x6d, 0x22, 0x77,
+    0xf3, 0x33, 0x33, 0xd2, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc5, 0x57, 0x68, 0x33, 0x33, 0x37, 0x66,
+    0x66, 0x6d, 0x42, 0x2f, 0xb9, 0x66, 0xc7, 0x24, 0x17, 0xf3, 0xf3, 0x3b, 0x92, 0x01, 0x0a, 0x33,
+    0x33, 0x33, 0x3c, 0x6d, 0x22, 0xd7, 0x44, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x33, 0x33, 0x3b,
+    0xc1, 0x41, 0x44, 0x33, 0x33, 0x37, 0x62, 0x04, 0x01, 0xff, 0x33, 0x33, 0x96, 0x24, 0x15, 0x42,
+    0xb3, 0x33, 0x33, 0x2d, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc2, 0x25, 0x25, 0x33, 0x33, 0x37, 0xc4,
+    0x45, 0x21, 0x04, 0x21, 0x68, 0x70, 0x41, 0x21, 0x10, 0xe3, 0x33, 0x3e, 0x80, 0x40, 0x0a, 0x33,
+    0x33, 0x33, 0x26, 0xd1, 0x04, 0x45, 0x42, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x33, 0x33, 0x33,
+    0x92, 0x44, 0x4b, 0x33, 0x33, 0x38, 0xc4, 0x25, 0x24, 0x33, 0x33, 0x3f, 0x6c, 0x51, 0x44, 0x25,
+    0x53, 0x33, 0x33, 0xe9, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc5, 0x04, 0x4a, 0xf3, 0x33, 0x37, 0xc4,
+    0x20, 0x51, 0x14, 0x40, 0x02, 0x20, 0x44, 0x44, 0x41, 0xe3, 0x33, 0x3f, 0x64, 0x01, 0x45, 0x33,
+    0x33, 0xf3, 0x69, 0x52, 0x01, 0x01, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xe3, 0x33, 0x33,
+    0xd2, 0x11, 0x1e, 0x33, 0x33, 0xb6, 0x74, 0x01, 0x45, 0x33, 0x33, 0x35, 0x64, 0x25, 0x20, 0x40,
+    0x03, 0x33, 0x33, 0x38, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc1, 0x02, 0x1a, 0x33, 0x33, 0x37, 0xc0,
+    0x51, 0x01, 0x05, 0x24, 0x44, 0xab, 0xef, 0x33, 0x33, 0x33, 0x33, 0x3e, 0x64, 0x21, 0x45, 0x33,
+    0x33, 0x32, 0x62, 0x10, 0x14, 0x14, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xa3, 0x33, 0x33,
+    0xbc, 0x21, 0x43, 0x33, 0x33, 0x76, 0x11, 0x40, 0x1a, 0x33, 0x33, 0x37, 0x84, 0x40, 0x24, 0x01,
+    0x03, 0x33, 0x33, 0x36, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc0, 0x40, 0x4a, 0x33, 0x33, 0x3d, 0xc4,
+    0x42, 0x40, 0x14, 0x24, 0xaf, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x60, 0x00, 0x05, 0x33,
+    0x33, 0x37, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x5f, 0x33, 0x33,
+    0xf9, 0x50, 0xa3, 0x33, 0x33, 0x8c, 0x04, 0x24, 0x4a, 0x33, 0x33, 0x37, 0xc2, 0x14, 0x04, 0x00,
+    0x0f, 0x33, 0x33, 0x36, 0x20, 0x0a, 0x33, 0x33, 0x37, 0xc0, 0x40, 0x4a, 0x33, 0x33, 0x37, 0xc0,
+    0x01, 0x41, 0x01, 0x5b, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x33, 0x3f, 0x60, 0x00, 0x05, 0x33,
+    0x33, 0x37, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x33, 0x33,
+    0x3d, 0x22, 0xe3, 0x33, 0x3e, 0x62, 0x44, 0x24, 0x4b, 0x33, 0x33, 0x37, 0xc2, 0x44, 0x10, 0x01,
+    0x0e, 0x33, 0x33, 0x36, 0x21, 0x1a, 0x33, 0x33, 0x37, 0xc0, 0x40, 0x4a, 0x33, 0x33, 0x37, 0xc0,
+    0x14, 0x02, 0x52, 0xbf, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x33, 0x33, 0x3f, 0x60, 0x00, 0x05, 0x33,
+    0x33, 0x37, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x33, 0x33,
+    0x3a, 0xd1, 0x33, 0x33, 0x37, 0x61, 0x01, 0x00, 0x0a, 0x33, 0x33, 0x32, 0xc0, 0x14, 0x10, 0x00,
+    0x1f, 0x33, 0x33, 0x36, 0x21, 0x15, 0x33, 0x33, 0x37, 0xc0, 0x40, 0x4a, 0x33, 0x33, 0x37, 0xc0,
+    0x14, 0x41, 0x50, 0xe3, 0x33, 0x33, 0xad, 0x86, 0x66, 0x43, 0x33, 0x3e, 0x60, 0x00, 0x05, 0x33,
+    0x33, 0x37, 0xc0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0xf3, 0x33,
+    0x33, 0x9a, 0x33, 0x33, 0x38, 0xd1, 0x10, 0x40, 0x0a, 0x33, 0x33, 0x3a, 0x95, 0x24, 0x40, 0x14,
+    0x13, 0x33, 0x33, 0xe6, 0x10, 0x05, 0x33, 0x33, 0x37, 0xc0, 0x40, 0x4a, 0x33, 0x33, 0x3d, 0xc0,
+    0x01, 0x40, 0x05, 0x33, 0x33, 0x3a, 0x68, 0xd7, 0x24, 0xe3, 0x33, 0xf3, 0x60, 0x00, 0x05, 0x33,
+    0x33, 0x37, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xe3, 0x33,
+    0x33, 0xce, 0x33, 0x33, 0xb6, 0x21, 0x15, 0x20, 0x05, 0x33, 0x33, 0x3e, 0x84, 0x44, 0x14, 0x01,
+    0xa3, 0x33, 0x33, 0xa6, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc0, 0x40, 0x4a, 0x33, 0x33, 0x37, 0xc0,
+    0x42, 0x44, 0x1a, 0x33, 0xf3, 0x38, 0x82, 0x05, 0x42, 0xe3, 0x33, 0x3e, 0x60, 0x00, 0x05, 0x33,
+    0x33, 0x37, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xa3, 0x33,
+    0x3f, 0x5f, 0x33, 0x33, 0x78, 0x11, 0x04, 0x10, 0x04, 0xf3, 0x33, 0x33, 0xc2, 0x51, 0x20, 0x44,
+    0xe3, 0x33, 0x33, 0xd8, 0x04, 0x05, 0x33, 0x33, 0x37, 0xc0, 0x40, 0x4a, 0x33, 0x33, 0x32, 0xc1,
+    0x41, 0x44, 0x1b, 0x33, 0x33, 0x38, 0x74, 0x12, 0x25, 0xe3, 0x33, 0x3f, 0x60, 0x00, 0x05, 0x33,
+    0x33, 0x37, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x23, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x8c, 0x42, 0x42, 0x40, 0x00, 0xe3, 0x33, 0x33, 0xb7, 0x22, 0x51, 0x4a,
+    0x33, 0x33, 0x33, 0x8c, 0x10, 0x05, 0x33, 0x33, 0x37, 0xc0, 0x40, 0x4a, 0x33, 0x33, 0x3a, 0xc1,
+    0x04, 0x40, 0x1b, 0x33, 0x33, 0x3d, 0x72, 0x50, 0x1e, 0x33, 0x33, 0x3e, 0x60, 0x00, 0x05, 0x33,
+    0x33, 0x37, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1e, 0x33,
+    0x33, 0x33, 0x33, 0x3b, 0x62, 0x04, 0x00, 0x04, 0x52, 0xb3, 0x33, 0x33, 0x3e, 0xa5, 0x45, 0xb3,
+    0x33, 0x33, 0x3a, 0x62, 0x41, 0x1a, 0x33, 0x33, 0x37, 0xc1, 0x40, 0x25, 0x33, 0x33, 0x33, 0x75,
+    0x5b, 0xa0, 0x0a, 0x33, 0x33, 0x33, 0x44, 0x5a, 0xf3, 0x33, 0x33, 0x3f, 0x61, 0x10, 0x15, 0x33,
+    0x33, 0x37, 0xc5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x14, 0x0a, 0x33,
+    0x33, 0x33, 0x33, 0x3d, 0x82, 0x00, 0x14, 0x10, 0x02, 0x5e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x38, 0x81, 0x01, 0x15, 0x33, 0x33, 0x37, 0xc2, 0x14, 0x41, 0xf3, 0x33, 0x33, 0x33,
+    0x33, 0xa7, 0x01, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3f, 0x60, 0x44, 0x05, 0x33,
+    0x33, 0x37, 0xc2, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x04, 0x01, 0xf3,
+    0x33, 0x33, 0xf3, 0x36, 0xd0, 0x00, 0x15, 0x10, 0x54, 0x25, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0xd6, 0x74, 0x00, 0x4a, 0x33, 0x33, 0x37, 0x94, 0x41, 0x00, 0xe3, 0x33, 0x33, 0x33,
+    0x33, 0xa9, 0x11, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x33, 0xff, 0x33, 0x3f, 0x60, 0x10, 0x45, 0x33,
+    0x33, 0x37, 0xc5, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, 0xe3,
+    0x33, 0x33, 0x33, 0xa6, 0x24, 0x00, 0x15, 0x24, 0x25, 0x11, 0x5f, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x37, 0x6d, 0x51, 0x40, 0x15, 0x33, 0x33, 0x37, 0xd1, 0x24, 0x42, 0x53, 0x33, 0x33, 0x33,
+    0x33, 0x58, 0x44, 0x5e, 0x33, 0x33, 0x33, 0x33, 0x33, 0xcb, 0x33, 0x3e, 0x64, 0x02, 0x4a, 0x33,
+    0x33, 0x37, 0xc2, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x24, 0xab,
+    0x33, 0x33, 0x3e, 0x88, 0x00, 0x00, 0x14, 0x24, 0x20, 0x52, 0x42, 0xb3, 0x33, 0x33, 0x33, 0x33,
+    0x3b, 0x96, 0xd0, 0x11, 0x25, 0x50, 0xef, 0x33, 0xb9, 0x92, 0x44, 0x25, 0x45, 0x33, 0xf3, 0x33,
+    0x33, 0x79, 0x20, 0x44, 0xbf, 0x33, 0x33, 0x33, 0xe8, 0x6b, 0xf3, 0x35, 0x62, 0x45, 0x02, 0xef,
+    0x33, 0xe9, 0xc1, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x25, 0x21,
+    0x86, 0x66, 0x66, 0x67, 0x41, 0x00, 0x00, 0x14, 0x51, 0x15, 0x20, 0x7c, 0x7b, 0xff, 0xff, 0xb7,
+    0x96, 0x87, 0x24, 0x24, 0x42, 0x25, 0x18, 0x66, 0x66, 0x74, 0x24, 0x24, 0x05, 0x72, 0xef, 0x3f,
+    0xbd, 0x6c, 0x44, 0x24, 0x2d, 0xae, 0x3f, 0xe7, 0x66, 0x22, 0x96, 0x66, 0x84, 0x52, 0x15, 0x28,
+    0x66, 0x66, 0x75, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x05, 0x11,
+    0x52, 0x05, 0x01, 0x50, 0x00, 0x10, 0x40, 0x00, 0x11, 0x02, 0x54, 0x40, 0x7c, 0x86, 0x66, 0x68,
+    0x97, 0x14, 0x51, 0x40, 0x15, 0x51, 0x12, 0x11, 0x02, 0x14, 0x00, 0x00, 0x04, 0x22, 0x88, 0x66,
+    0x68, 0xd1, 0x15, 0x14, 0x12, 0x78, 0x86, 0x66, 0xc0, 0x25, 0x24, 0x51, 0x04, 0x10, 0x40, 0x41,
+    0x14, 0x41, 0x40, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x01, 0x02, 0x51,
+    0x15, 0x10, 0x51, 0x10, 0x14, 0x11, 0x40, 0x41, 0x44, 0x00, 0x10, 0x04, 0x10, 0x02, 0x14, 0x41,
+    0x51, 0x41, 0x24, 0x41, 0x00, 0x24, 0x40, 0x44, 0x25, 0x11, 0x41, 0x52, 0x01, 0x44, 0x01, 0x41,
+    0x00, 0x01, 0x02, 0x00, 0x44, 0x14, 0x24, 0x44, 0x52, 0x42, 0x44, 0x00, 0x42, 0x04, 0x00, 0x10,
+    0x40, 0x25, 0x12, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0x44, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x04, 0x45,
+    0xa0, 0x14, 0x21, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x44, 0x2b,
+    0xe5, 0x21, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x55, 0x22, 0x5f,
+    0x3b, 0x50, 0x12, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x20, 0x25, 0xb3,
+    0x33, 0xeb, 0x54, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x45, 0xaf, 0x33
+};
+
+const tIndexedImage voltar = { image_data_voltar, 160, 60,
+    4, palette_voltar };
+
+#endif /* IDX_VOLTAR_H_ */
@@ -0,0 +1,126 @@
+/*
+ * assets.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include "assets.h"
+
+/* Inicio e fim da regiao "assets" (flash.ld) */
+extern const uint8_t _sassets[];
+extern const uint8_t _eassets[];
+
+static const tAssetHeader *gs_header;
+static const tAssetEntry *gs_table;
+
+static inline const uint8_t *asset_data(const tAssetEntry *e)
+{
+	return _sassets + e->offset;
+}
+
+/* A paleta fica no inicio dos dados, com os indices alinhados em 4 depois dela */
+static inline const uint8_t *asset_after_palette(const tAssetEntry *e)
+{
+	return asset_data(e) + ((e->colors * 3 + 3) & ~3u);
+}
+
+/**
+ * \brief Valida o pacote gravado na regiao de assets.
+ *
+ * \return false se a regiao estiver vazia, for de outra versao ou nao tiver
+ * todos os ids com que o firmware foi compilado.
+ */
+bool assets_init(void)
+{
+	const tAssetHeader *h = (const tAssetHeader *)_sassets;
+
+	gs_header = NULL;
+	gs_table = NULL;
+
+	if (h->magic != ASSETS_MAGIC || h->version != ASSETS_VERSION) {
+		return false;
+	}
+	if (h->count < ASSETS_COUNT || h->size > (uint32_t)(_eassets - _sassets)) {
+		return false;
+	}
+
+	gs_header = h;
+	gs_table = (const tAssetEntry *)(h + 1);
+	return true;
+}
+
+/**
+ * \brief Entrada do asset \a id, ou NULL se nao existir.
+ */
+const tAssetEntry *assets_get(uint16_t id)
+{
+	if (gs_table == NULL || id >= gs_header->count) {
+		return NULL;
+	}
+	return &gs_table[id];
+}
+
+/**
+ * \brief Preenche \a img com a imagem indexada \a id (dados direto na flash).
+ */
+bool assets_image(uint16_t id, tIndexedImage *img)
+{
+	const tAssetEntry *e = assets_get(id);
+
+	if (e == NULL || e->type != ASSET_TYPE_IMAGE) {
+		return false;
+	}
+	img->data = asset_after_palette(e);
+	img->width = e->width;
+	img->height = e->height;
+	img->bpp = e->bpp;
+	img->palette = asset_data(e);
+	return true;
+}
+
+/**
+ * \brief Paleta RGB888 do asset \a id: uma paleta avulsa (tema) ou a de uma
+ * imagem ou fonte.
+ */
+const uint8_t *assets_palette(uint16_t id)
+{
+	const tAssetEntry *e = assets_get(id);
+
+	if (e == NULL || e->colors == 0) {
+		return NULL;
+	}
+	return asset_data(e);
+}
+
+/**
+ * \brief Preenche \a img com o glifo do caractere \a c da fonte \a font.
+ *
+ * \return false se o caractere nao estiver na fonte.
+ */
+bool assets_glyph(uint16_t font, char c, tIndexedImage *img)
+{
+	const tAssetEntry *e = assets_get(font);
+	const uint8_t *p;
+	const tAssetGlyph *g;
+	uint8_t first, last;
+
+	if (e == NULL || e->type != ASSET_TYPE_FONT) {
+		return false;
+	}
+
+	p = asset_after_palette(e);
+	first = p[0];
+	last = p[1];
+	if ((uint8_t)c < first || (uint8_t)c > last) {
+		return false;
+	}
+
+	g = (const tAssetGlyph *)(p + 4) + ((uint8_t)c - first);
+	img->data = _sassets + g->offset;
+	img->width = g->width;
+	img->height = g->height;
+	img->bpp = e->bpp;
+	img->palette = asset_data(e);
+	return true;
+}
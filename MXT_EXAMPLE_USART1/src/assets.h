@@ -0,0 +1,60 @@
+/*
+ * assets.h
+ *
+ * Created: 18/10/2026
+ *
+ * Pacote de assets (imagens e fontes) gravado na regiao de flash "assets"
+ * (flash.ld), separada do firmware: pode ser regravado sozinho, desde que
+ * mantenha os mesmos ids (assets_id.h).
+ *
+ * O pacote e gerado por tools/asset_pack.py a partir de assets.list; o
+ * formato esta descrito nesse script. O id e o indice na tabela do pacote.
+ */
+
+
+#ifndef ASSETS_H_
+#define ASSETS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "tfont.h"
+#include "assets_id.h"
+
+#define ASSETS_MAGIC        0x4b415057   // "WPAK"
+#define ASSETS_VERSION      1
+
+#define ASSET_TYPE_IMAGE    0
+#define ASSET_TYPE_PALETTE  1
+#define ASSET_TYPE_FONT     2
+
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t count;        // entradas na tabela
+	uint32_t size;         // bytes do pacote inteiro
+	uint32_t reserved;
+} tAssetHeader;
+
+typedef struct {
+	uint32_t offset;       // a partir do inicio do pacote
+	uint32_t size;
+	uint16_t width;
+	uint16_t height;
+	uint8_t type;          // ASSET_TYPE_*
+	uint8_t bpp;
+	uint16_t colors;       // entradas da paleta
+} tAssetEntry;
+
+typedef struct {
+	uint32_t offset;
+	uint16_t width;
+	uint16_t height;
+} tAssetGlyph;
+
+bool assets_init(void);
+const tAssetEntry *assets_get(uint16_t id);
+bool assets_image(uint16_t id, tIndexedImage *img);
+const uint8_t *assets_palette(uint16_t id);
+bool assets_glyph(uint16_t font, char c, tIndexedImage *img);
+
+#endif /* ASSETS_H_ */
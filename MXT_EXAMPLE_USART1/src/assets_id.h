@@ -0,0 +1,53 @@
+/*
+ * assets_id.h
+ *
+ * Gerado por tools/asset_pack.py, nao editar.
+ */
+
+#ifndef ASSETS_ID_H_
+#define ASSETS_ID_H_
+
+#define ASSETS_PACK_SIZE    488640
+#define ASSETS_COUNT        39
+
+#define ASSET_FONT_SOURCECODEPRO_28    0
+#define ASSET_FONT_CALIBRI_36          1
+#define ASSET_FONT_ARIAL_72            2
+#define ASSET_ICON_TIME                3
+#define ASSET_ICON_DAY                 4
+#define ASSET_ICON_ZANVIL              5
+#define ASSET_ICON_WATER               6
+#define ASSET_ICON_VORTEX              7
+#define ASSET_ICON_GEAR                8
+#define ASSET_ICON_REP                 9
+#define ASSET_ICON_LOCK                10
+#define ASSET_ICON_LOCK_RED            11
+#define ASSET_ICON_LOCK_GREEN          12
+#define ASSET_ICON_UNLOCKED            13
+#define ASSET_BUTTON_LAVAR             14
+#define ASSET_BUTTON_MODO              15
+#define ASSET_BUTTON_CONFIGURAR        16
+#define ASSET_BUTTON_VOLTAR            17
+#define ASSET_BUTTON_CANCELAR          18
+#define ASSET_ANIMA_D0                 19
+#define ASSET_ANIMA_D1                 20
+#define ASSET_ANIMA_D2                 21
+#define ASSET_ANIMA_D3                 22
+#define ASSET_ANIMA_D4                 23
+#define ASSET_ANIMA_D5                 24
+#define ASSET_ANIMA_D6                 25
+#define ASSET_ANIMA_D7                 26
+#define ASSET_ANIMA_D8                 27
+#define ASSET_ANIMA_D9                 28
+#define ASSET_ANIMA_D10                29
+#define ASSET_ANIMA_D11                30
+#define ASSET_ANIMA_D12                31
+#define ASSET_ANIMA_D13                32
+#define ASSET_ANIMA_D14                33
+#define ASSET_ANIMA_D15                34
+#define ASSET_ANIMA_D16                35
+#define ASSET_ANIMA_D17                36
+#define ASSET_ANIMA_D18                37
+#define ASSET_ANIMA_D19                38
+
+#endif /* ASSETS_ID_H_ */
@@ -0,0 +1,122 @@
+/*
+ * boot.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include "boot.h"
+#include "timebase.h"
+#include "prof.h"
+
+static const boot_task_t *gs_tasks;
+static int gs_count;
+static uint64_t gs_first_pixel = UINT64_MAX;
+static uint64_t gs_first_touch = UINT64_MAX;
+
+/**
+ * \brief Roda as tarefas ate todas terminarem, intercalando os passos.
+ *
+ * Sem tarefa pronta, espera ate o proximo wake_us. Com uma dependencia que
+ * nunca termina (ciclo na tabela) desiste e avisa pela console.
+ */
+void boot_run(boot_task_t *tasks, int count)
+{
+	uint32_t all = count < BOOT_TASKS_MAX ? (1u << count) - 1 : UINT32_MAX;
+	uint32_t done = 0;
+
+	gs_tasks = tasks;
+	gs_count = count;
+
+	while (done != all) {
+		uint64_t now = now_us();
+		uint64_t next = UINT64_MAX;
+		boot_task_t *t = NULL;
+		uint32_t wait;
+		int i;
+
+		for (i = 0; i < count; i++) {
+			boot_task_t *c = &tasks[i];
+
+			if ((done & BOOT_DEP(i)) || (c->deps & done) != c->deps) {
+				continue;
+			}
+			if (c->wake_us <= now) {
+				t = c;
+				break;
+			}
+			next = Min(next, c->wake_us);
+		}
+
+		if (t == NULL) {
+			if (next == UINT64_MAX) {
+				printf("boot: dependencia sem saida\n\r");
+				return;
+			}
+			delay_us((uint32_t)(next - now));
+			continue;
+		}
+
+		if (t->steps++ == 0) {
+			t->start_us = now;
+		}
+		wait = t->step(t);
+		now = now_us();
+		if (wait == BOOT_DONE) {
+			t->done_us = now;
+			done |= BOOT_DEP(i);
+		} else {
+			t->wake_us = now + wait;
+		}
+	}
+}
+
+/**
+ * \brief Marca o primeiro desenho na tela; as chamadas seguintes nao contam.
+ */
+void boot_first_pixel(void)
+{
+	if (gs_first_pixel == UINT64_MAX) {
+		gs_first_pixel = now_us();
+		PROF_RECORD_US(boot_pixel, gs_first_pixel);
+	}
+}
+
+/**
+ * \brief Marca o primeiro toque lido do maXTouch.
+ */
+void boot_first_touch(void)
+{
+	if (gs_first_touch == UINT64_MAX) {
+		gs_first_touch = now_us();
+		PROF_RECORD_US(boot_touch, gs_first_touch);
+	}
+}
+
+static void print_ms(const char *label, uint64_t us)
+{
+	if (us == UINT64_MAX) {
+		printf("  %-23s          -\n\r", label);
+	} else {
+		printf("  %-23s %6lu.%03lu ms\n\r", label,
+				(unsigned long)(us / 1000), (unsigned long)(us % 1000));
+	}
+}
+
+void boot_dump(void)
+{
+	int i;
+
+	printf("\n\rboot            inicio ms     fim ms  passos\n\r");
+	for (i = 0; i < gs_count; i++) {
+		const boot_task_t *t = &gs_tasks[i];
+
+		printf("  %-12s %6lu.%03lu %6lu.%03lu %7lu\n\r", t->name,
+				(unsigned long)(t->start_us / 1000), (unsigned long)(t->start_us % 1000),
+				(unsigned long)(t->done_us / 1000), (unsigned long)(t->done_us % 1000),
+				(unsigned long)t->steps);
+	}
+	print_ms("primeiro pixel", gs_first_pixel);
+	print_ms("primeiro toque", gs_first_touch);
+}
@@ -0,0 +1,57 @@
+/*
+ * boot.h
+ *
+ * Created: 18/10/2026
+ *
+ * Sequenciador do boot: cada dispositivo sobe numa tarefa que e uma maquina
+ * de estados retomavel. Um passo faz o que da sem esperar e devolve quanto
+ * tempo o dispositivo precisa antes do proximo (reset do LCD, reset do
+ * maXTouch...); nesse meio tempo boot_run() roda os passos das outras
+ * tarefas, entao as esperas se sobrepoem em vez de somar.
+ *
+ *     static boot_task_t tasks[] = {
+ *         [BOOT_LCD]  = BOOT_TASK("lcd", lcd_step, 0, NULL),
+ *         [BOOT_TELA] = BOOT_TASK("tela", tela_step, BOOT_DEP(BOOT_LCD), p),
+ *     };
+ *     boot_run(tasks, 2);
+ *
+ * Uma tarefa so comeca quando as de deps terminaram; entre as prontas, a
+ * primeira da tabela tem a vez. boot_run() volta quando todas terminaram.
+ *
+ * Os marcos do boot (primeiro pixel e primeiro toque, contados do
+ * timebase_init()) vao para as zonas boot_pixel e boot_touch do profiling
+ * ('p' pela serial); boot_dump() imprime a linha do tempo das tarefas ('b').
+ */
+
+
+#ifndef BOOT_H_
+#define BOOT_H_
+
+#include <stdint.h>
+
+#define BOOT_DONE           UINT32_MAX
+#define BOOT_DEP(i)         (1u << (i))
+#define BOOT_TASKS_MAX      32
+
+typedef struct boot_task boot_task_t;
+
+struct boot_task {
+	const char *name;
+	uint32_t (*step)(boot_task_t *t);   // us ate o proximo passo, ou BOOT_DONE
+	uint32_t deps;                      // BOOT_DEP() das que vem antes
+	void *arg;
+	uint32_t state;                     // da tarefa; 0 no primeiro passo
+	uint32_t steps;
+	uint64_t wake_us;
+	uint64_t start_us;
+	uint64_t done_us;
+};
+
+#define BOOT_TASK(nm, fn, dp, a)    { (nm), (fn), (dp), (a), 0, 0, 0, 0, 0 }
+
+void boot_run(boot_task_t *tasks, int count);
+void boot_first_pixel(void);
+void boot_first_touch(void);
+void boot_dump(void);
+
+#endif /* BOOT_H_ */
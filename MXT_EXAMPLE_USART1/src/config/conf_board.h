@@ -36,6 +36,9 @@
 /* Enable ICache and DCache */
 #define CONF_BOARD_ENABLE_CACHE
 
+/* Enable ITCM/DTCM (32 KB each) and load the .itcm/.dtcm sections, see tcm.h */
+#define CONF_BOARD_ENABLE_TCM_AT_INIT
+
 #define CONF_BOARD_UART_CONSOLE
 
 #define CONF_BOARD_MAXTOUCH_XPRO
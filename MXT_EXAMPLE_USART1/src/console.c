@@ -0,0 +1,305 @@
+/*
+ * console.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "conf_board.h"
+#include "conf_uart_serial.h"
+#include "console.h"
+#include "tcm.h"
+#include "prof.h"
+
+/* USART da console (CONSOLE_UART no same70_xplained.h) */
+#define CONSOLE_USART           USART1
+#define CONSOLE_USART_IRQn      USART1_IRQn
+#define CONSOLE_Handler         USART1_Handler
+
+#define RING_MASK               (CONSOLE_TX_SIZE - 1)
+
+/* Recepcao: poucos bytes bastam para os comandos de uma letra */
+#define RX_SIZE                 16
+#define RX_MASK                 (RX_SIZE - 1)
+
+/*
+ * Indices livres (contam bytes desde o boot, sem mascara):
+ *  gs_tail    proximo byte a enviar (so a interrupcao da USART altera)
+ *  gs_commit  fim dos dados completos, visiveis para a interrupcao
+ *  gs_head    fim do espaco reservado pelos produtores
+ * e tail <= commit <= head.
+ *
+ * Produtores numa CPU so se aninham em ordem de pilha (uma interrupcao
+ * termina antes de quem ela interrompeu voltar), entao quando o ultimo
+ * produtor ativo sai tudo que foi reservado ja foi copiado, e ele publica
+ * commit = head. Quem espera espaco (CONSOLE_OVERFLOW_BLOCK) sai da contagem
+ * durante a espera, senao nada do que as interrupcoes escrevem e publicado.
+ */
+static TCM_BSS uint8_t gs_ring[CONSOLE_TX_SIZE];
+static volatile uint32_t gs_head;
+static volatile uint32_t gs_commit;
+static volatile uint32_t gs_tail;
+static volatile uint32_t gs_writers;
+
+/* Bytes recebidos pela interrupcao de RXRDY, que tambem tira o core do WFI */
+static uint8_t gs_rx[RX_SIZE];
+static volatile uint32_t gs_rx_head;
+static volatile uint32_t gs_rx_tail;
+
+static volatile int gs_policy = CONSOLE_OVERFLOW_DROP;
+static volatile bool gs_ready;
+static console_stats_t gs_stats;
+
+/*
+ * Nao pode esperar a interrupcao da USART: dentro de uma interrupcao ou com
+ * as interrupcoes mascaradas (cpu_irq_save, PRIMASK; ou BASEPRI), quando o
+ * TXRDY nunca roda e a espera nao termina.
+ */
+static inline bool cannot_wait(void)
+{
+	return __get_IPSR() != 0 || __get_PRIMASK() != 0 || __get_BASEPRI() != 0;
+}
+
+static inline void stat_add(volatile uint32_t *p, uint32_t n)
+{
+	__atomic_fetch_add(p, n, __ATOMIC_RELAXED);
+}
+
+/* Reserva len bytes; false se nao cabem */
+static bool reserve(uint32_t len, uint32_t *start)
+{
+	uint32_t head = __atomic_load_n(&gs_head, __ATOMIC_RELAXED);
+
+	do {
+		if (head + len - gs_tail > CONSOLE_TX_SIZE) {
+			return false;
+		}
+	} while (!__atomic_compare_exchange_n(&gs_head, &head, head + len, true,
+			__ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+	*start = head;
+	return true;
+}
+
+/* Avanca commit ate head, sem nunca voltar */
+static void publish(void)
+{
+	uint32_t commit = __atomic_load_n(&gs_commit, __ATOMIC_RELAXED);
+	uint32_t head;
+
+	do {
+		head = __atomic_load_n(&gs_head, __ATOMIC_ACQUIRE);
+		if ((int32_t)(head - commit) <= 0) {
+			return;
+		}
+	} while (!__atomic_compare_exchange_n(&gs_commit, &commit, head, true,
+			__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+static void kick(void)
+{
+	if (gs_ready) {
+		usart_enable_interrupt(CONSOLE_USART, US_IER_TXRDY);
+	}
+}
+
+/**
+ * \brief Liga a transmissao por interrupcao. A USART ja deve estar
+ * configurada (stdio_serial_init); o que foi escrito antes e enviado agora.
+ */
+void console_init(void)
+{
+	usart_disable_interrupt(CONSOLE_USART, US_IDR_TXRDY);
+	NVIC_DisableIRQ(CONSOLE_USART_IRQn);
+	NVIC_ClearPendingIRQ(CONSOLE_USART_IRQn);
+	NVIC_SetPriority(CONSOLE_USART_IRQn, CONSOLE_IRQ_PRIORITY);
+	NVIC_EnableIRQ(CONSOLE_USART_IRQn);
+	usart_enable_interrupt(CONSOLE_USART, US_IER_RXRDY);
+
+	gs_ready = true;
+	if (gs_commit != gs_tail) {
+		kick();
+	}
+}
+
+/**
+ * \brief Enfileira \a len bytes para a serial, de qualquer contexto.
+ *
+ * \return len, ou 0 se a mensagem foi descartada.
+ */
+TCM_CODE int console_write(const char *data, size_t len)
+{
+	uint32_t start, used, pos, first, high;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	for (;;) {
+		__atomic_fetch_add(&gs_writers, 1, __ATOMIC_ACQUIRE);
+		if (reserve(len, &start)) {
+			break;
+		}
+		/* esperando, fora da contagem: o que as interrupcoes reservarem
+		 * enquanto isso e publicado por elas e a serial nao para no commit */
+		if (__atomic_sub_fetch(&gs_writers, 1, __ATOMIC_RELEASE) == 0) {
+			publish();
+		}
+		if (gs_policy != CONSOLE_OVERFLOW_BLOCK || cannot_wait() || !gs_ready ||
+				len > CONSOLE_TX_SIZE) {
+			stat_add(&gs_stats.dropped, len);
+			stat_add(&gs_stats.dropped_msgs, 1);
+			return 0;
+		}
+		/* espera a interrupcao abrir espaco */
+		kick();
+	}
+
+	pos = start & RING_MASK;
+	first = Min((uint32_t)len, CONSOLE_TX_SIZE - pos);
+	memcpy(&gs_ring[pos], data, first);
+	memcpy(&gs_ring[0], data + first, len - first);
+
+	if (__atomic_sub_fetch(&gs_writers, 1, __ATOMIC_RELEASE) == 0) {
+		publish();
+	}
+
+	stat_add(&gs_stats.written, len);
+	/* produtores de interrupcoes tambem atualizam o pico */
+	used = start + len - gs_tail;
+	high = __atomic_load_n(&gs_stats.high_water, __ATOMIC_RELAXED);
+	while (used > high && !__atomic_compare_exchange_n(&gs_stats.high_water, &high,
+			used, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+	}
+
+	kick();
+	return (int)len;
+}
+
+/**
+ * \brief CONSOLE_OVERFLOW_DROP (padrao) ou CONSOLE_OVERFLOW_BLOCK.
+ */
+void console_set_overflow(int policy)
+{
+	gs_policy = policy;
+}
+
+/**
+ * \brief Espera o anel esvaziar (fora de interrupcao), por exemplo antes de
+ * um reset.
+ */
+void console_flush(void)
+{
+	if (cannot_wait() || !gs_ready) {
+		return;
+	}
+	while (gs_tail != gs_commit) {
+	}
+	while (!usart_is_tx_empty(CONSOLE_USART)) {
+	}
+}
+
+/**
+ * \brief true enquanto ha bytes no anel ou no shifter da USART (o idle nao
+ * para o MCK nesse caso).
+ */
+bool console_tx_busy(void)
+{
+	return gs_tail != gs_commit || !usart_is_tx_empty(CONSOLE_USART);
+}
+
+/**
+ * \brief Refaz o baud da USART para um MCK novo (governador de clock,
+ * perf.c). Chamada com as interrupcoes desligadas: espera o byte que esta
+ * saindo terminar com o baud antigo.
+ */
+void console_set_mck(uint32_t mck)
+{
+	while (!usart_is_tx_empty(CONSOLE_USART)) {
+	}
+	usart_set_async_baudrate(CONSOLE_USART, USART_SERIAL_EXAMPLE_BAUDRATE, mck);
+}
+
+void console_get_stats(console_stats_t *stats)
+{
+	*stats = gs_stats;
+}
+
+/**
+ * \brief Le um byte recebido pela console, sem esperar.
+ *
+ * \return O byte, ou -1 se nada chegou.
+ */
+int console_getc(void)
+{
+	uint32_t tail = gs_rx_tail;
+	int c;
+
+	if (tail == gs_rx_head) {
+		return -1;
+	}
+	c = gs_rx[tail & RX_MASK];
+	gs_rx_tail = tail + 1;
+	return c;
+}
+
+bool console_rx_pending(void)
+{
+	return gs_rx_tail != gs_rx_head;
+}
+
+/**
+ * \brief Bytes recebidos desde o console_init(), com volta; so serve para
+ * ver se chegou algo desde a ultima leitura (idle.c).
+ */
+uint32_t console_rx_count(void)
+{
+	return gs_rx_head;
+}
+
+TCM_CODE void CONSOLE_Handler(void)
+{
+	uint32_t tail = gs_tail;
+	uint32_t status;
+	PROF_BEGIN(isr_usart);
+
+	status = usart_get_status(CONSOLE_USART);
+	if (status & US_CSR_RXRDY) {
+		uint32_t c, head = gs_rx_head;
+
+		usart_read(CONSOLE_USART, &c);
+		/* anel cheio: descarta o byte novo */
+		if (head - gs_rx_tail < RX_SIZE) {
+			gs_rx[head & RX_MASK] = (uint8_t)c;
+			gs_rx_head = head + 1;
+		}
+	}
+
+	if (status & US_CSR_TXRDY) {
+		if (tail == __atomic_load_n(&gs_commit, __ATOMIC_ACQUIRE)) {
+			usart_disable_interrupt(CONSOLE_USART, US_IDR_TXRDY);
+		} else {
+			usart_write(CONSOLE_USART, gs_ring[tail & RING_MASK]);
+			__atomic_store_n(&gs_tail, tail + 1, __ATOMIC_RELEASE);
+		}
+	}
+
+	PROF_END(isr_usart);
+}
+
+/*
+ * printf/puts: substitui o _write fraco do ASF (write.c), que escrevia byte
+ * a byte esperando a USART.
+ */
+int _write(int file, const char *ptr, int len);
+
+int _write(int file, const char *ptr, int len)
+{
+	if ((file != 1) && (file != 2) && (file != 3)) {
+		return -1;
+	}
+	console_write(ptr, len);
+	/* mensagens descartadas contam como escritas, para a libc nao repetir */
+	return len;
+}
@@ -0,0 +1,55 @@
+/*
+ * console.h
+ *
+ * Created: 18/10/2026
+ *
+ * Saida da serial de console sem bloqueio.
+ *
+ * Quem escreve (main, interrupcoes, printf via _write) so copia os bytes
+ * para um anel; a interrupcao de TXRDY da USART esvazia o anel em segundo
+ * plano. A reserva de espaco e lock-free (LDREX/STREX), entao escrever de
+ * dentro de uma interrupcao custa um memcpy e nunca espera a serial.
+ *
+ * A recepcao tambem e por interrupcao (RXRDY), para um comando pela serial
+ * acordar o main loop quando ele esta dormindo no WFI. No WAIT a USART fica
+ * sem clock e nao recebe nada: o idle (idle.h) so usa o WAIT com a serial
+ * quieta ha IDLE_QUIET_US.
+ */
+
+
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Tamanho do anel de transmissao, potencia de 2 */
+#define CONSOLE_TX_SIZE         2048
+
+/* Prioridade da interrupcao da USART (0 = mais alta) */
+#define CONSOLE_IRQ_PRIORITY    7
+
+/* O que fazer quando a mensagem nao cabe no anel */
+#define CONSOLE_OVERFLOW_DROP   0   // descarta a mensagem inteira e conta
+#define CONSOLE_OVERFLOW_BLOCK  1   // espera a serial (so fora de interrupcao e sem mascara)
+
+typedef struct {
+	uint32_t written;          // bytes aceitos
+	uint32_t dropped;          // bytes descartados por falta de espaco
+	uint32_t dropped_msgs;     // mensagens descartadas
+	uint32_t high_water;       // maior ocupacao do anel
+} console_stats_t;
+
+void console_init(void);
+int console_write(const char *data, size_t len);
+void console_set_overflow(int policy);
+void console_flush(void);
+bool console_tx_busy(void);
+void console_set_mck(uint32_t mck);
+void console_get_stats(console_stats_t *stats);
+int console_getc(void);
+bool console_rx_pending(void);
+uint32_t console_rx_count(void);
+
+#endif /* CONSOLE_H_ */
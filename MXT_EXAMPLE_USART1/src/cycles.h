@@ -0,0 +1,48 @@
+/*
+ * cycles.h
+ *
+ * Created: 18/10/2026
+ *
+ * Contador de ciclos da CPU (DWT->CYCCNT), usado para medir tempo com
+ * resolucao de um ciclo. Volta a zero a cada 2^32 ciclos (~14 s a 300 MHz);
+ * diferencas sem sinal continuam certas dentro desse intervalo.
+ *
+ * No build de host (host/) o contador e o relogio virtual do simulador, em
+ * ciclos de 300 MHz.
+ */
+
+
+#ifndef CYCLES_H_
+#define CYCLES_H_
+
+#include <asf.h>
+
+#if defined(__arm__)
+static inline void cycles_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+		DWT->CYCCNT = 0;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	}
+}
+
+static inline uint32_t cycles_now(void)
+{
+	return DWT->CYCCNT;
+}
+#else
+uint32_t sim_cycles(void);
+
+static inline void cycles_init(void)
+{
+}
+
+static inline uint32_t cycles_now(void)
+{
+	return sim_cycles();
+}
+#endif
+
+#endif /* CYCLES_H_ */
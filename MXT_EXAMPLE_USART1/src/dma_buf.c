@@ -0,0 +1,179 @@
+/*
+ * dma_buf.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include "dma_buf.h"
+
+/* Mesma regiao que o ASF reserva para MPU_NOCACHE_SRAM_REGION */
+#define DMA_BUF_MPU_REGION      11
+
+#define DTCM_BASE_ADDR          0x20000000u
+#define DTCM_SIZE               0x00008000u
+
+/* Pool nao-cacheavel (flash.ld) e inicio da parte livre para dma_buf_alloc() */
+extern uint8_t _snocache[];
+extern uint8_t _enocache[];
+extern uint8_t _snocache_free[];
+
+static uint8_t *gs_next;
+
+#ifdef DMA_BUF_DEBUG
+static uint32_t gs_errors;
+#endif
+
+/**
+ * \brief Mapeia o pool de DMA como memoria normal nao-cacheavel.
+ *
+ * Usa uma regiao da MPU sobre o mapa padrao (PRIVDEFENA), entao o resto da
+ * memoria continua com os atributos padrao. Chamar depois do board_init().
+ */
+void dma_buf_init(void)
+{
+	uint32_t size = (uint32_t)(_enocache - _snocache);
+
+	__DMB();
+	mpu_set_region((uint32_t)(uintptr_t)_snocache | MPU_REGION_VALID | DMA_BUF_MPU_REGION,
+			MPU_AP_FULL_ACCESS |
+			MPU_REGION_EXECUTE_NEVER |
+			INNER_OUTER_NORMAL_NOCACHE_TYPE(SHAREABLE) |
+			mpu_cal_mpu_region_size(size) |
+			MPU_REGION_ENABLE);
+	mpu_enable(MPU_ENABLE | MPU_PRIVDEFENA);
+	__DSB();
+	__ISB();
+
+	/* Linhas do pool que ja estavam no cache nao podem ser escritas depois */
+	SCB_CleanInvalidateDCache();
+
+	gs_next = _snocache_free;
+}
+
+/**
+ * \brief Reserva \a size bytes do pool nao-cacheavel, alinhados em linha.
+ *
+ * Para buffers alocados na inicializacao; nao ha liberacao.
+ *
+ * \return NULL se o pool acabou.
+ */
+void *dma_buf_alloc(size_t size)
+{
+	uint8_t *p = gs_next;
+
+	size = DMA_BUF_ROUND(size);
+	if (p == NULL || size > (size_t)(_enocache - p)) {
+		return NULL;
+	}
+	gs_next = p + size;
+	return p;
+}
+
+/** \brief Bytes ainda livres no pool. */
+size_t dma_buf_available(void)
+{
+	return gs_next ? (size_t)(_enocache - gs_next) : 0;
+}
+
+/** \brief true se [addr, addr + size) nao passa pelo D-cache (pool ou DTCM). */
+bool dma_buf_is_coherent(const void *addr, size_t size)
+{
+	uintptr_t a = (uintptr_t)addr;
+
+	if (a >= (uintptr_t)_snocache && a + size <= (uintptr_t)_enocache) {
+		return true;
+	}
+	return a >= DTCM_BASE_ADDR && a + size <= DTCM_BASE_ADDR + DTCM_SIZE;
+}
+
+/*
+ * Operacoes por endereco, uma linha de cache por vez. O CMSIS desta versao
+ * chama o registrador DCIMVAC (0x25C) de DCIMVAU.
+ */
+#define DCACHE_BY_ADDR(reg, addr, size) do {                                   \
+		uintptr_t _a = (uintptr_t)(addr) & ~(uintptr_t)(DMA_BUF_LINE - 1);     \
+		uintptr_t _e = (uintptr_t)(addr) + (size);                             \
+		__DSB();                                                               \
+		for (; _a < _e; _a += DMA_BUF_LINE) {                                  \
+			SCB->reg = _a;                                                     \
+		}                                                                      \
+		__DSB();                                                               \
+		__ISB();                                                               \
+	} while (0)
+
+/**
+ * \brief Grava na memoria as linhas do buffer que estao no cache. Chamar
+ * antes de o DMA ler o buffer.
+ */
+void dma_buf_clean(const void *addr, size_t size)
+{
+	if (size == 0 || dma_buf_is_coherent(addr, size)) {
+		return;
+	}
+	(void)dma_buf_check(addr, size, DMA_BUF_TO_DEVICE);
+	DCACHE_BY_ADDR(DCCMVAC, addr, size);
+}
+
+/**
+ * \brief Descarta as linhas do buffer no cache. Chamar depois de o DMA
+ * escrever no buffer e antes de a CPU ler.
+ *
+ * Linhas parciais nas pontas tambem sao descartadas, por isso buffers
+ * cacheaveis de recepcao devem ser DMA_BUF_ALIGNED e de tamanho multiplo
+ * de DMA_BUF_LINE.
+ */
+void dma_buf_invalidate(void *addr, size_t size)
+{
+	if (size == 0 || dma_buf_is_coherent(addr, size)) {
+		return;
+	}
+	(void)dma_buf_check(addr, size, DMA_BUF_FROM_DEVICE);
+	DCACHE_BY_ADDR(DCIMVAU, addr, size);
+}
+
+/** \brief Clean seguido de invalidate, para buffers usados nos dois sentidos. */
+void dma_buf_clean_invalidate(void *addr, size_t size)
+{
+	if (size == 0 || dma_buf_is_coherent(addr, size)) {
+		return;
+	}
+	(void)dma_buf_check(addr, size, DMA_BUF_FROM_DEVICE);
+	DCACHE_BY_ADDR(DCCIMVAC, addr, size);
+}
+
+#ifdef DMA_BUF_DEBUG
+
+/**
+ * \brief Verifica um buffer antes de entregar ao DMA.
+ *
+ * Buffers coerentes sempre passam. Cacheaveis precisam comecar e terminar
+ * em limite de linha; senao o invalidate (ou o proprio cache ao despejar a
+ * linha) corrompe dados vizinhos.
+ *
+ * \return false, e conta um erro, se o buffer nao for seguro.
+ */
+bool dma_buf_check(const void *addr, size_t size, int dir)
+{
+	uintptr_t a = (uintptr_t)addr;
+
+	if (dma_buf_is_coherent(addr, size)) {
+		return true;
+	}
+	if ((a | size) & (DMA_BUF_LINE - 1)) {
+		gs_errors++;
+		printf("dma_buf: buffer %s cacheavel desalinhado %p+%u\n\r",
+				dir == DMA_BUF_FROM_DEVICE ? "RX" : "TX", addr, (unsigned)size);
+		return false;
+	}
+	return true;
+}
+
+/** \brief Quantidade de buffers recusados por dma_buf_check(). */
+uint32_t dma_buf_errors(void)
+{
+	return gs_errors;
+}
+
+#endif /* DMA_BUF_DEBUG */
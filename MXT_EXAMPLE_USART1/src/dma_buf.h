@@ -0,0 +1,67 @@
+/*
+ * dma_buf.h
+ *
+ * Created: 18/10/2026
+ *
+ * Buffers de DMA coerentes com o D-cache.
+ *
+ * Com CONF_BOARD_ENABLE_CACHE a CPU le e escreve a SRAM pelo D-cache
+ * (write-back), mas o XDMAC acessa a memoria direto. Todo buffer usado por
+ * DMA deve ser:
+ *  - do pool nao-cacheavel (DMA_BUF_NOCACHE ou dma_buf_alloc()), mapeado
+ *    pela MPU em dma_buf_init(); ou da DTCM (TCM_BSS), que nao passa pelo
+ *    cache; ou
+ *  - um buffer comum alinhado em linhas de cache (DMA_BUF_ALIGNED, tamanho
+ *    multiplo de DMA_BUF_LINE), com dma_buf_clean() antes de o DMA ler a
+ *    memoria e dma_buf_invalidate() depois de o DMA escrever nela.
+ *
+ * Com DMA_BUF_DEBUG, dma_buf_clean(), dma_buf_invalidate() e
+ * dma_buf_clean_invalidate() passam cada buffer cacheavel por
+ * dma_buf_check(), que acusa os desalinhados (teriam a linha vizinha
+ * corrompida pelo invalidate). Drivers que usam so buffers coerentes podem
+ * chama-lo direto ao montar a transferencia.
+ */
+
+
+#ifndef DMA_BUF_H_
+#define DMA_BUF_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Descomente para verificar os buffers passados ao DMA */
+//#define DMA_BUF_DEBUG
+
+/** Linha do D-cache do Cortex-M7 */
+#define DMA_BUF_LINE            32
+
+#define DMA_BUF_ROUND(size)     (((size) + DMA_BUF_LINE - 1) & ~(DMA_BUF_LINE - 1))
+
+/** Buffer estatico no pool nao-cacheavel (sem valor inicial) */
+#define DMA_BUF_NOCACHE         __attribute__((section(".nocache"), aligned(DMA_BUF_LINE)))
+/** Buffer comum cacheavel, alinhado para clean/invalidate */
+#define DMA_BUF_ALIGNED         __attribute__((aligned(DMA_BUF_LINE)))
+
+/* Sentido da transferencia, para dma_buf_check() */
+#define DMA_BUF_TO_DEVICE       0   // DMA le a memoria (TX)
+#define DMA_BUF_FROM_DEVICE     1   // DMA escreve na memoria (RX)
+
+void dma_buf_init(void);
+void *dma_buf_alloc(size_t size);
+size_t dma_buf_available(void);
+bool dma_buf_is_coherent(const void *addr, size_t size);
+
+void dma_buf_clean(const void *addr, size_t size);
+void dma_buf_invalidate(void *addr, size_t size);
+void dma_buf_clean_invalidate(void *addr, size_t size);
+
+#ifdef DMA_BUF_DEBUG
+bool dma_buf_check(const void *addr, size_t size, int dir);
+uint32_t dma_buf_errors(void);
+#else
+#define dma_buf_check(addr, size, dir)   (true)
+#define dma_buf_errors()                 (0)
+#endif
+
+#endif /* DMA_BUF_H_ */
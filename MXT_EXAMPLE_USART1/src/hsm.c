@@ -0,0 +1,252 @@
+/*
+ * hsm.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include <string.h>
+#include "hsm.h"
+#include "trace.h"
+
+#define QUEUE_MASK      (HSM_QUEUE_SIZE - 1)
+
+static uint8_t parent(const hsm_def_t *d, uint8_t s)
+{
+	return d->states[s].parent;
+}
+
+/* \a a e \a b ou esta acima dele */
+static bool contains(const hsm_def_t *d, uint8_t a, uint8_t b)
+{
+	for (; b != HSM_NONE; b = parent(d, b)) {
+		if (b == a) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Ancestral mais baixo de \a from que nao e exitado pela transicao */
+static uint8_t domain(const hsm_def_t *d, uint8_t from, uint8_t to)
+{
+	if (from == to) {
+		return parent(d, from);
+	}
+	for (; from != HSM_NONE; from = parent(d, from)) {
+		if (contains(d, from, to)) {
+			return from;
+		}
+	}
+	return HSM_NONE;
+}
+
+/**
+ * \brief Gera o indice denso de \a def a partir das linhas.
+ *
+ * \return false se a tabela estiver mal formada: estado ou evento fora da
+ * faixa, arvore mais funda que HSM_DEPTH_MAX (ou com ciclo), linhas do
+ * mesmo par separadas.
+ */
+bool hsm_build(const hsm_def_t *def)
+{
+	uint32_t s, e, r, depth;
+
+	memset(def->index, HSM_NONE, (size_t)def->nstates * def->nevents);
+	hsm_reset_hits(def);
+
+	for (s = 0; s < def->nstates; s++) {
+		uint8_t p = def->states[s].parent;
+
+		for (depth = 0; p != HSM_NONE; depth++, p = parent(def, p)) {
+			if (p >= def->nstates || depth >= HSM_DEPTH_MAX - 1) {
+				return false;
+			}
+		}
+	}
+
+	/* a primeira linha de cada par; as alternativas vem logo depois */
+	for (r = 0; r < def->nrows; r++) {
+		const hsm_row_t *row = &def->rows[r];
+		uint8_t *slot = &def->index[row->from * def->nevents + row->event];
+
+		if (row->from >= def->nstates || row->event >= def->nevents ||
+		    (row->to != HSM_NONE && row->to >= def->nstates)) {
+			return false;
+		}
+		if (*slot == HSM_NONE) {
+			*slot = (uint8_t)r;
+		} else if (row[-1].from != row->from || row[-1].event != row->event) {
+			return false;
+		}
+	}
+
+	/* heranca: o que o estado nao trata vem do ancestral mais proximo */
+	for (s = 0; s < def->nstates; s++) {
+		for (e = 0; e < def->nevents; e++) {
+			uint8_t *slot = &def->index[s * def->nevents + e];
+			uint8_t p = parent(def, s);
+
+			for (; *slot == HSM_NONE && p != HSM_NONE; p = parent(def, p)) {
+				*slot = def->index[p * def->nevents + e];
+			}
+		}
+	}
+	return true;
+}
+
+/* Comeca em \a state sem rodar entradas: quem chama ja desenhou */
+void hsm_init(hsm_t *m, const hsm_def_t *def, uint8_t state)
+{
+	m->def = def;
+	m->state = state;
+}
+
+static void take(hsm_t *m, uint8_t r, uint32_t arg)
+{
+	const hsm_def_t *d = m->def;
+	const hsm_row_t *row = &d->rows[r];
+	uint8_t path[HSM_DEPTH_MAX];
+	uint8_t dom, s, n = 0;
+
+	if (d->hits != NULL) {
+		d->hits[r]++;
+	}
+	TRACE(HSM, m->state, row->event, row->to);
+
+	if (row->to == HSM_NONE) {
+		if (row->action != NULL) {
+			row->action(arg);
+		}
+		return;
+	}
+
+	dom = domain(d, row->from, row->to);
+	for (s = m->state; s != dom; s = parent(d, s)) {
+		if (d->states[s].exit != NULL) {
+			d->states[s].exit(arg);
+		}
+	}
+	if (row->action != NULL) {
+		row->action(arg);
+	}
+	for (s = row->to; s != dom; s = parent(d, s)) {
+		path[n++] = s;
+	}
+	while (n > 0) {
+		s = path[--n];
+		if (d->states[s].entry != NULL) {
+			d->states[s].entry(arg);
+		}
+	}
+	for (s = row->to; d->states[s].initial != HSM_NONE; ) {
+		s = d->states[s].initial;
+		if (d->states[s].entry != NULL) {
+			d->states[s].entry(arg);
+		}
+	}
+	m->state = s;
+}
+
+/**
+ * \brief Trata \a event no estado atual de \a m.
+ *
+ * \return false se nenhum estado ate o topo trata o evento (ou as guardas
+ * recusaram); nada muda.
+ */
+bool hsm_dispatch(hsm_t *m, uint8_t event, uint32_t arg)
+{
+	const hsm_def_t *d = m->def;
+	uint8_t r;
+
+	if (event >= d->nevents) {
+		return false;
+	}
+	r = d->index[m->state * d->nevents + event];
+	while (r != HSM_NONE) {
+		uint8_t from = d->rows[r].from;
+
+		for (; r < d->nrows && d->rows[r].from == from && d->rows[r].event == event; r++) {
+			if (d->rows[r].guard == NULL || d->rows[r].guard(arg)) {
+				take(m, r, arg);
+				return true;
+			}
+		}
+		/* nenhuma guarda passou: o evento sobe para o pai */
+		from = parent(d, from);
+		r = from == HSM_NONE ? HSM_NONE : d->index[from * d->nevents + event];
+	}
+	return false;
+}
+
+/* O estado atual e \a state ou esta dentro dele */
+bool hsm_in(const hsm_t *m, uint8_t state)
+{
+	return contains(m->def, state, m->state);
+}
+
+uint8_t hsm_state(const hsm_t *m)
+{
+	return m->state;
+}
+
+void hsm_reset_hits(const hsm_def_t *def)
+{
+	if (def->hits != NULL) {
+		memset(def->hits, 0, def->nrows * sizeof(def->hits[0]));
+	}
+}
+
+/* A tabela com as vezes que cada linha foi tomada: as com 0 nunca foram */
+void hsm_dump(const hsm_def_t *def)
+{
+	uint32_t r, used = 0;
+
+	for (r = 0; r < def->nrows; r++) {
+		const hsm_row_t *row = &def->rows[r];
+
+		used += def->hits != NULL && def->hits[r] != 0;
+		printf("  %-12s %-14s %c-> %-12s %5lu\n\r", def->states[row->from].name,
+				def->events[row->event], row->guard != NULL ? '?' : ' ',
+				row->to == HSM_NONE ? "(interna)" : def->states[row->to].name,
+				(unsigned long)(def->hits != NULL ? def->hits[r] : 0));
+	}
+	printf("transicoes: %lu de %lu tomadas\n\r", (unsigned long)used,
+			(unsigned long)def->nrows);
+}
+
+/* ---- fila de eventos ---- */
+
+/* Das interrupcoes ou do main loop; false com a fila cheia */
+bool hsm_post(hsm_queue_t *q, uint8_t event, uint32_t arg)
+{
+	irqflags_t flags = cpu_irq_save();
+	bool ok = q->head - q->tail < HSM_QUEUE_SIZE;
+
+	if (ok) {
+		q->msg[q->head & QUEUE_MASK].event = event;
+		q->msg[q->head & QUEUE_MASK].arg = arg;
+		q->head++;
+	} else {
+		q->dropped++;
+	}
+	cpu_irq_restore(flags);
+	return ok;
+}
+
+/* So do main loop */
+bool hsm_take(hsm_queue_t *q, hsm_msg_t *msg)
+{
+	if (q->tail == q->head) {
+		return false;
+	}
+	*msg = q->msg[q->tail & QUEUE_MASK];
+	q->tail++;
+	return true;
+}
+
+bool hsm_pending(const hsm_queue_t *q)
+{
+	return q->tail != q->head;
+}
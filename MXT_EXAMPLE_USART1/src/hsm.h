@@ -0,0 +1,98 @@
+/*
+ * hsm.h
+ *
+ * Created: 18/10/2026
+ *
+ * Maquina de estados hierarquica dirigida por tabela.
+ *
+ * Os estados formam uma arvore (hsm_state_t.parent); cada um pode ter acao
+ * de entrada e de saida. As transicoes sao linhas compactas "estado, evento
+ * [guarda] -> alvo / acao"; hsm_build() gera delas um indice denso
+ * [estado][evento] ja com a heranca resolvida: se um estado nao trata o
+ * evento vale a linha do pai, do avo... Despachar e uma consulta no indice;
+ * linhas seguidas do mesmo par sao alternativas testadas em ordem pelas
+ * guardas, e se nenhuma passa o evento sobe para o pai de quem as declarou.
+ *
+ * Numa transicao sai-se do estado atual ate o dominio dela (o ancestral
+ * comum da origem e do alvo; alvo abaixo da origem nao sai da origem, alvo
+ * igual a origem sai e entra de novo), roda a acao e entra-se ate o alvo,
+ * descendo pelos filhos iniciais se ele tiver. Alvo HSM_NONE e transicao
+ * interna: so a acao.
+ *
+ * A mesma definicao pode ter varias instancias (hsm_t), uma por regiao
+ * ortogonal, cada uma numa subarvore; um evento e despachado para todas.
+ * hsm_queue_t leva eventos das interrupcoes para o main loop, que e quem
+ * despacha (as acoes desenham).
+ */
+
+
+#ifndef HSM_H_
+#define HSM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define HSM_NONE            0xFF
+#define HSM_DEPTH_MAX       4
+#define HSM_QUEUE_SIZE      16      // potencia de 2
+
+typedef void (*hsm_action_t)(uint32_t arg);
+typedef bool (*hsm_guard_t)(uint32_t arg);
+
+typedef struct {
+	const char *name;
+	uint8_t parent;             // HSM_NONE no topo
+	uint8_t initial;            // filho em que se entra, HSM_NONE nas folhas
+	hsm_action_t entry;
+	hsm_action_t exit;
+} hsm_state_t;
+
+typedef struct {
+	uint8_t from;
+	uint8_t event;
+	uint8_t to;                 // HSM_NONE: transicao interna
+	hsm_guard_t guard;          // NULL: sempre
+	hsm_action_t action;
+} hsm_row_t;
+
+typedef struct {
+	const hsm_state_t *states;
+	const hsm_row_t *rows;
+	const char *const *events;  // nomes, para o dump
+	uint8_t nstates;
+	uint8_t nrows;
+	uint8_t nevents;
+	uint8_t *index;             // nstates * nevents, preenchido por hsm_build()
+	uint16_t *hits;             // nrows: vezes que cada linha foi tomada
+} hsm_def_t;
+
+typedef struct {
+	const hsm_def_t *def;
+	uint8_t state;              // sempre uma folha
+} hsm_t;
+
+typedef struct {
+	uint8_t event;
+	uint32_t arg;
+} hsm_msg_t;
+
+typedef struct {
+	volatile uint32_t head;
+	volatile uint32_t tail;
+	hsm_msg_t msg[HSM_QUEUE_SIZE];
+	uint32_t dropped;
+} hsm_queue_t;
+
+bool hsm_build(const hsm_def_t *def);
+void hsm_init(hsm_t *m, const hsm_def_t *def, uint8_t state);
+bool hsm_dispatch(hsm_t *m, uint8_t event, uint32_t arg);
+bool hsm_in(const hsm_t *m, uint8_t state);
+uint8_t hsm_state(const hsm_t *m);
+void hsm_reset_hits(const hsm_def_t *def);
+void hsm_dump(const hsm_def_t *def);
+
+bool hsm_post(hsm_queue_t *q, uint8_t event, uint32_t arg);
+bool hsm_take(hsm_queue_t *q, hsm_msg_t *msg);
+bool hsm_pending(const hsm_queue_t *q);
+
+#endif /* HSM_H_ */
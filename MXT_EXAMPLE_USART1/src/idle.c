@@ -0,0 +1,431 @@
+/*
+ * idle.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include "idle.h"
+#include "console.h"
+#include "perf.h"
+#include "timebase.h"
+#include "timer.h"
+
+/* Fast startup: WKUP2 = PA2 (CHG), WKUP7 = PA11 (botao), alarme do RTT */
+#define IDLE_FAST_STARTUP   (PMC_FSMR_FSTT2 | PMC_FSMR_FSTT7 | PMC_FSMR_RTTAL)
+#define IDLE_FAST_POLARITY  (PMC_FSPR_FSTP2 | PMC_FSPR_FSTP7)
+
+/* Botao da porta, o mesmo pino do WKUP7 */
+#define IDLE_BUT_PIO        PIOA
+#define IDLE_BUT_MASK       PIO_PA11
+
+#define RTT_HZ              (32768 / IDLE_RTT_PRESCALER)
+
+static Pio *gs_chg_pio;
+static uint32_t gs_chg_mask;
+
+/* Dormiu e nenhuma fonte se apresentou ainda */
+static volatile bool gs_woke;
+static uint32_t gs_wake_cycles;
+static volatile bool gs_touch_pending;
+
+/* Ultimo sinal de alguem mexendo: serial, toque ou botao */
+static volatile bool gs_touched;
+static uint32_t gs_rx_seen;
+static uint64_t gs_quiet_from;
+
+static uint32_t gs_t_reset;
+static uint32_t gs_sleeps[IDLE_MODE_COUNT];
+static uint64_t gs_slept[IDLE_MODE_COUNT];      // ticks do RTT
+static uint32_t gs_wakes[IDLE_WAKE_COUNT];
+static uint32_t gs_holds[IDLE_HOLD_COUNT];
+static uint32_t gs_touch_count;
+static uint32_t gs_touch_min;
+static uint32_t gs_touch_max;
+static uint64_t gs_touch_total;
+
+static const char *const gs_wake_names[IDLE_WAKE_COUNT] = {
+	"chg", "botao", "timer", "outras"
+};
+
+static const char *const gs_hold_names[IDLE_HOLD_COUNT] = {
+	"mexendo", "botao", "irq"
+};
+
+/* O RTT conta no clock lento: le ate duas leituras iguais */
+static uint32_t rtt_now(void)
+{
+	uint32_t v;
+
+	do {
+		v = RTT->RTT_VR;
+	} while (v != RTT->RTT_VR);
+	return v;
+}
+
+static uint64_t rtt_to_us(uint64_t ticks)
+{
+	return ticks * 1000000u / RTT_HZ;
+}
+
+/* Interrupcao habilitada e pendente no NVIC (PRIMASK as segura) */
+static bool irq_pending(void)
+{
+	int i;
+
+	for (i = 0; i < (PERIPH_COUNT_IRQn + 31) / 32; i++) {
+		if (NVIC->ISPR[i] & NVIC->ISER[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Alarme do RTT em \a ticks: acorda do WAIT no proximo timer de software */
+static void rtt_alarm(uint32_t ticks)
+{
+	RTT->RTT_MR &= ~RTT_MR_ALMIEN;
+	/* como no rtt_write_alarm_time() do ASF: ALMV e o valor anterior */
+	RTT->RTT_AR = RTT_AR_ALMV(ticks - 1);
+	(void)RTT->RTT_SR;
+	RTT->RTT_MR |= RTT_MR_ALMIEN;
+}
+
+/*
+ * Soma a base de tempo o que o RTT mediu a mais que ela desde \a rtt0 e
+ * \a us0. O quanto o TC1 conta parado depende de quais clocks ficam ligados
+ * no WAIT; a diferenca cobre os dois casos.
+ */
+static void resync(uint32_t rtt0, uint64_t us0)
+{
+	uint64_t slept = rtt_to_us(rtt_now() - rtt0);
+	uint64_t elapsed = now_us() - us0;
+
+	if (slept > elapsed) {
+		timebase_adjust(slept - elapsed);
+	}
+}
+
+/*
+ * WAIT com as interrupcoes desligadas do comeco ao fim, nos passos do
+ * pmc_sleep(SAM_PM_SMODE_WAIT_FAST) do ASF (sleep.c) menos o
+ * cpu_irq_enable() antes do WAITMODE: MCK no RC rapido e sem PLL, WAIT, e os
+ * clocks de volta. O fast startup acorda sem precisar atender a
+ * interrupcao; ela roda quando o main loop religar.
+ *
+ * \return false se uma interrupcao ficou pendente enquanto os clocks eram
+ * trocados: o WAIT nao acordaria por ela, entao volta sem dormir.
+ */
+static bool wait_mode(void)
+{
+	uint32_t mor = PMC->CKGR_MOR;
+	uint32_t mckr = PMC->PMC_MCKR;
+	uint32_t pllar = PMC->CKGR_PLLAR;
+	uint32_t fmr = EFC->EEFC_FMR;
+	uint32_t m;
+	bool slept = false;
+
+	/* MCK no RC rapido, prescaler 1, PLLA desligado; o cristal fica */
+	PMC->CKGR_MOR = CKGR_MOR_KEY_PASSWD | mor | CKGR_MOR_MOSCRCEN;
+	m = mckr;
+	if ((m & PMC_MCKR_CSS_Msk) > PMC_MCKR_CSS_MAIN_CLK) {
+		m = (m & ~PMC_MCKR_CSS_Msk) | PMC_MCKR_CSS_MAIN_CLK;
+		PMC->PMC_MCKR = m;
+		while (!(PMC->PMC_SR & PMC_SR_MCKRDY));
+	}
+	if (m & PMC_MCKR_PRES_Msk) {
+		m &= ~PMC_MCKR_PRES_Msk;
+		PMC->PMC_MCKR = m;
+		while (!(PMC->PMC_SR & PMC_SR_MCKRDY));
+	}
+	pmc_disable_pllack();
+	while (!(PMC->PMC_SR & PMC_SR_MOSCRCS));
+	PMC->CKGR_MOR = (PMC->CKGR_MOR & ~CKGR_MOR_MOSCSEL) | CKGR_MOR_KEY_PASSWD;
+	while (!(PMC->PMC_SR & PMC_SR_MOSCSELS));
+	EFC->EEFC_FMR = fmr & ~EEFC_FMR_FWS_Msk;
+
+	/* o que chegou durante a troca; daqui ao WAITMODE sao poucas instrucoes */
+	if (!irq_pending()) {
+		pmc_enable_waitmode();
+		slept = true;
+	}
+
+	/* cristal de volta no MAINCK, PLLA, prescaler, wait states e CSS */
+	if (!(PMC->CKGR_MOR & CKGR_MOR_MOSCSEL)) {
+		PMC->CKGR_MOR |= CKGR_MOR_KEY_PASSWD | CKGR_MOR_MOSCSEL;
+		while (!(PMC->PMC_SR & PMC_SR_MOSCSELS));
+	}
+	PMC->CKGR_MOR = (PMC->CKGR_MOR & ~CKGR_MOR_MOSCRCEN & ~CKGR_MOR_MOSCRCF_Msk) |
+			CKGR_MOR_KEY_PASSWD;
+	if (pllar & CKGR_PLLAR_MULA_Msk) {
+		PMC->CKGR_PLLAR = CKGR_PLLAR_ONE | pllar;
+		while (!(PMC->PMC_SR & PMC_SR_LOCKA));
+	}
+	PMC->PMC_MCKR = (PMC->PMC_MCKR & ~PMC_MCKR_PRES_Msk) | (mckr & PMC_MCKR_PRES_Msk);
+	while (!(PMC->PMC_SR & PMC_SR_MCKRDY));
+	EFC->EEFC_FMR = fmr;
+	PMC->PMC_MCKR = mckr;
+	while (!(PMC->PMC_SR & PMC_SR_MCKRDY));
+
+	return slept;
+}
+
+/* Alguem mexeu ha menos de IDLE_QUIET_US: a serial tem que continuar
+ * recebendo */
+static bool busy(void)
+{
+	uint32_t rx = console_rx_count();
+
+	if (rx != gs_rx_seen || gs_touched) {
+		gs_rx_seen = rx;
+		gs_touched = false;
+		gs_quiet_from = now_us();
+	}
+	return now_us() - gs_quiet_from < IDLE_QUIET_US;
+}
+
+static void chg_handler(uint32_t id, uint32_t mask)
+{
+	UNUSED(id);
+	UNUSED(mask);
+	/* so tira o core do WFI; a mensagem e lida pelo main loop */
+	idle_wake(IDLE_WAKE_CHG);
+}
+
+void idle_init(void)
+{
+	uint32_t chg_id = pio_get_pin_group_id(MAXTOUCH_XPRO_CHG_PIO);
+
+	gs_chg_pio = pio_get_pin_group(MAXTOUCH_XPRO_CHG_PIO);
+	gs_chg_mask = pio_get_pin_group_mask(MAXTOUCH_XPRO_CHG_PIO);
+
+	/* RTT como base de tempo do sono, reiniciado do zero */
+	RTT->RTT_MR = RTT_MR_RTPRES(IDLE_RTT_PRESCALER) | RTT_MR_RTTRST;
+
+	/* Acordar do WAIT: CHG e botao em nivel baixo, alarme do RTT */
+	PMC->PMC_FSPR &= ~IDLE_FAST_POLARITY;
+	pmc_set_fast_startup_input(IDLE_FAST_STARTUP);
+
+	/* A descida do CHG vira interrupcao, para acordar tambem do WFI */
+	pmc_enable_periph_clk(chg_id);
+	pio_handler_set(gs_chg_pio, chg_id, gs_chg_mask, PIO_IT_FALL_EDGE, chg_handler);
+	pio_enable_interrupt(gs_chg_pio, gs_chg_mask);
+	NVIC_EnableIRQ((IRQn_Type)chg_id);
+
+	idle_reset();
+}
+
+/**
+ * \brief Dorme ate a proxima interrupcao.
+ *
+ * Chamada pelo main loop com as interrupcoes desligadas, depois de ver que
+ * nao ha nada pendente, e volta com elas ainda desligadas: a interrupcao
+ * que acordou so roda quando o main loop religa. Assim um evento que chega
+ * entre o teste e o sono nao e perdido: o WFI acorda com ela pendente e o
+ * WAIT nem entra (wait_mode()).
+ */
+void idle_enter(void)
+{
+#ifdef IDLE_ENABLE
+	int mode = IDLE_MODE_WFI;
+	uint32_t alarm = 0;
+	uint32_t t0;
+
+	if (gs_woke) {
+		gs_wakes[IDLE_WAKE_OTHER]++;
+	}
+	gs_woke = true;
+
+#ifdef IDLE_WAIT_ENABLE
+	if (!console_tx_busy() && !irq_pending()) {
+		uint64_t at, now;
+
+		if (!timer_next(&at)) {
+			mode = IDLE_MODE_WAIT;
+		} else if (at > (now = now_us()) + IDLE_WAIT_MIN_US) {
+			/* arredonda para baixo: acorda antes e espera o resto no WFI */
+			alarm = (uint32_t)((at - now) * RTT_HZ / 1000000);
+			mode = IDLE_MODE_WAIT;
+		}
+	}
+	if (mode == IDLE_MODE_WAIT) {
+		if (busy()) {
+			gs_holds[IDLE_HOLD_QUIET]++;
+			mode = IDLE_MODE_WFI;
+		} else if (!pio_get(IDLE_BUT_PIO, PIO_INPUT, IDLE_BUT_MASK)) {
+			/* o WKUP7 e por nivel: segurado, o WAIT nao dormiria */
+			gs_holds[IDLE_HOLD_BUTTON]++;
+			mode = IDLE_MODE_WFI;
+		}
+	}
+#endif
+
+	t0 = rtt_now();
+	if (mode == IDLE_MODE_WAIT) {
+		uint64_t us0 = now_us();
+
+		if (alarm) {
+			rtt_alarm(t0 + alarm);
+		}
+		if (wait_mode()) {
+			/* a base de tempo antes de qualquer interrupcao rodar */
+			resync(t0, us0);
+			if (alarm && (RTT->RTT_SR & RTT_SR_ALMS)) {
+				idle_wake(IDLE_WAKE_TIMER);
+			}
+			/* sem o MCK o PIO pode nao ter visto a borda do CHG */
+			if (gs_woke && !pio_get(gs_chg_pio, PIO_INPUT, gs_chg_mask)) {
+				idle_wake(IDLE_WAKE_CHG);
+			}
+		} else {
+			gs_holds[IDLE_HOLD_IRQ]++;
+			mode = IDLE_MODE_WFI;
+		}
+		if (alarm) {
+			RTT->RTT_MR &= ~RTT_MR_ALMIEN;
+		}
+	}
+	if (mode == IDLE_MODE_WFI) {
+		SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+		__DSB();
+		__WFI();
+	}
+	gs_wake_cycles = perf_cycles();
+	gs_sleeps[mode]++;
+	gs_slept[mode] += rtt_now() - t0;
+#endif
+}
+
+/**
+ * \brief Informa, de uma interrupcao, a fonte que acordou o main loop. So a
+ * primeira depois de um sono conta.
+ */
+void idle_wake(int source)
+{
+	if (!gs_woke) {
+		return;
+	}
+	gs_woke = false;
+	gs_wakes[source]++;
+	if (source == IDLE_WAKE_CHG || source == IDLE_WAKE_BUTTON) {
+		gs_touched = true;
+	}
+	if (source == IDLE_WAKE_CHG) {
+		gs_touch_pending = true;
+	}
+}
+
+/**
+ * \brief Chamada pelo main loop depois de tratar as mensagens do maXTouch:
+ * fecha a medida de latencia se o ultimo acordar foi pelo CHG.
+ */
+void idle_touch_processed(void)
+{
+	uint32_t dt;
+
+	if (!gs_touch_pending) {
+		return;
+	}
+	gs_touch_pending = false;
+	dt = perf_cycles() - gs_wake_cycles;
+
+	if (dt < gs_touch_min) {
+		gs_touch_min = dt;
+	}
+	if (dt > gs_touch_max) {
+		gs_touch_max = dt;
+	}
+	gs_touch_count++;
+	gs_touch_total += dt;
+}
+
+void idle_get_stats(idle_stats_t *stats)
+{
+	irqflags_t flags = cpu_irq_save();
+	int i;
+
+	for (i = 0; i < IDLE_MODE_COUNT; i++) {
+		stats->sleeps[i] = gs_sleeps[i];
+		stats->slept_us[i] = rtt_to_us(gs_slept[i]);
+	}
+	for (i = 0; i < IDLE_WAKE_COUNT; i++) {
+		stats->wakes[i] = gs_wakes[i];
+	}
+	for (i = 0; i < IDLE_HOLD_COUNT; i++) {
+		stats->holds[i] = gs_holds[i];
+	}
+	/* o RTT de 32 bits volta a zero a cada ~4.5 dias */
+	stats->total_us = rtt_to_us(rtt_now() - gs_t_reset);
+	stats->touch_count = gs_touch_count;
+	stats->touch_min = gs_touch_min;
+	stats->touch_max = gs_touch_max;
+	stats->touch_total = gs_touch_total;
+
+	cpu_irq_restore(flags);
+}
+
+void idle_reset(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	int i;
+
+	for (i = 0; i < IDLE_MODE_COUNT; i++) {
+		gs_sleeps[i] = 0;
+		gs_slept[i] = 0;
+	}
+	for (i = 0; i < IDLE_WAKE_COUNT; i++) {
+		gs_wakes[i] = 0;
+	}
+	for (i = 0; i < IDLE_HOLD_COUNT; i++) {
+		gs_holds[i] = 0;
+	}
+	gs_touch_count = 0;
+	gs_touch_min = UINT32_MAX;
+	gs_touch_max = 0;
+	gs_touch_total = 0;
+	gs_t_reset = rtt_now();
+
+	cpu_irq_restore(flags);
+}
+
+/* Ciclos de perf_cycles(), no clock nominal */
+static unsigned long cycles_to_us(uint64_t c)
+{
+	return (unsigned long)(c / (sysclk_get_cpu_hz() / 1000000));
+}
+
+void idle_dump(void)
+{
+	static const char *const mode_names[IDLE_MODE_COUNT] = { "wfi", "wait" };
+	idle_stats_t s;
+	uint64_t slept = 0;
+	int i;
+
+	idle_get_stats(&s);
+	for (i = 0; i < IDLE_MODE_COUNT; i++) {
+		slept += s.slept_us[i];
+	}
+
+	printf("\n\ridle: %lu ms, dormindo %lu ms (%lu%%)\n\r",
+			(unsigned long)(s.total_us / 1000), (unsigned long)(slept / 1000),
+			s.total_us ? (unsigned long)(slept * 100 / s.total_us) : 0ul);
+	for (i = 0; i < IDLE_MODE_COUNT; i++) {
+		printf("  %-5s %8lu sonos %10lu ms\n\r", mode_names[i],
+				(unsigned long)s.sleeps[i], (unsigned long)(s.slept_us[i] / 1000));
+	}
+	printf("acordadas:");
+	for (i = 0; i < IDLE_WAKE_COUNT; i++) {
+		printf(" %s %lu", gs_wake_names[i], (unsigned long)s.wakes[i]);
+	}
+	printf("\n\rwait -> wfi:");
+	for (i = 0; i < IDLE_HOLD_COUNT; i++) {
+		printf(" %s %lu", gs_hold_names[i], (unsigned long)s.holds[i]);
+	}
+	printf("\n\r");
+	if (s.touch_count) {
+		printf("acordar -> toque: %lu  min %lu us  media %lu us  max %lu us\n\r",
+				(unsigned long)s.touch_count, cycles_to_us(s.touch_min),
+				cycles_to_us(s.touch_total / s.touch_count), cycles_to_us(s.touch_max));
+	}
+}
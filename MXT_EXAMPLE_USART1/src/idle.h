@@ -0,0 +1,100 @@
+/*
+ * idle.h
+ *
+ * Created: 18/10/2026
+ *
+ * Idle sem tick: quando o main loop nao tem nada pendente ele chama
+ * idle_enter(), que dorme no modo mais fundo seguro naquele momento:
+ *
+ *  WAIT_FAST  clocks parados; acordam so as entradas de fast startup: CHG
+ *             do maXTouch (WKUP2), botao da porta (WKUP7) e alarme do RTT,
+ *             programado no proximo timer de software (timer.h). Usado
+ *             quando a console nao esta transmitindo, nao ha interrupcao
+ *             pendente, o proximo timer esta a mais de IDLE_WAIT_MIN_US, o
+ *             botao esta solto e ninguem mexeu ha IDLE_QUIET_US.
+ *  WFI        o core para e qualquer interrupcao acorda.
+ *
+ * O WAIT e feito aqui e nao pelo pmc_sleep() do ASF, que liga as
+ * interrupcoes antes de entrar: as interrupcoes ficam desligadas do teste do
+ * main loop ate os clocks voltarem, nenhuma roda no clock lento e uma que
+ * fica pendente depois do teste cancela o WAIT (vira WFI). O tempo dormido e
+ * medido pelo RTT, que roda no clock lento tambem no WAIT; o que a base de
+ * tempo (timebase.h) perdeu e somado a ela antes de religar as interrupcoes.
+ *
+ * No WAIT a USART da console nao tem clock e nao recebe: um comando pela
+ * serial so e lido se o main loop estiver no WFI. Por isso um byte recebido,
+ * um toque ou o botao seguram o WFI por IDLE_QUIET_US; com tudo quieto ha
+ * mais tempo, a primeira tecla e perdida (toque na tela antes de digitar).
+ * O botao (WKUP7) acorda pelo nivel baixo: segurado, todo WAIT voltaria na
+ * hora, entao ele tambem segura o WFI.
+ *
+ * 'i' pela serial imprime tempo por modo, acordadas por fonte, os WAITs
+ * trocados por WFI e por que, e a latencia entre acordar pelo CHG e o toque
+ * ter sido processado.
+ */
+
+
+#ifndef IDLE_H_
+#define IDLE_H_
+
+#include <stdint.h>
+
+/* Comente para o main loop nunca dormir */
+#define IDLE_ENABLE
+
+/* Comente para usar so o WFI (por exemplo com o debugger, que perde o core
+ * no WAIT) */
+#define IDLE_WAIT_ENABLE
+
+/* Prescaler do RTT: 32768 / 3 = ~10.9 kHz, 91.6 us por tick */
+#define IDLE_RTT_PRESCALER  3
+
+/* Timer mais perto que isso: WFI (sair do WAIT leva centenas de us) */
+#define IDLE_WAIT_MIN_US    2000
+
+/* Depois de um byte pela serial, um toque ou o botao: so WFI por esse tempo */
+#define IDLE_QUIET_US       60000000
+
+enum {
+	IDLE_WAKE_CHG,      // maXTouch tem mensagem
+	IDLE_WAKE_BUTTON,   // botao da porta
+	IDLE_WAKE_TIMER,    // timer de software (alarme da base de tempo ou do RTT)
+	IDLE_WAKE_OTHER,    // outra interrupcao (console, ...)
+	IDLE_WAKE_COUNT
+};
+
+/* Por que um WAIT virou WFI */
+enum {
+	IDLE_HOLD_QUIET,    // serial, toque ou botao ha menos de IDLE_QUIET_US
+	IDLE_HOLD_BUTTON,   // botao segurado
+	IDLE_HOLD_IRQ,      // interrupcao pendente depois de trocar os clocks
+	IDLE_HOLD_COUNT
+};
+
+enum {
+	IDLE_MODE_WFI,
+	IDLE_MODE_WAIT,
+	IDLE_MODE_COUNT
+};
+
+typedef struct {
+	uint32_t sleeps[IDLE_MODE_COUNT];
+	uint64_t slept_us[IDLE_MODE_COUNT];
+	uint64_t total_us;          // desde o ultimo idle_reset()
+	uint32_t wakes[IDLE_WAKE_COUNT];
+	uint32_t holds[IDLE_HOLD_COUNT];
+	uint32_t touch_count;       // latencias acordar -> toque processado
+	uint32_t touch_min;         // ciclos
+	uint32_t touch_max;
+	uint64_t touch_total;
+} idle_stats_t;
+
+void idle_init(void);
+void idle_enter(void);
+void idle_wake(int source);
+void idle_touch_processed(void);
+void idle_get_stats(idle_stats_t *stats);
+void idle_reset(void);
+void idle_dump(void);
+
+#endif /* IDLE_H_ */
@@ -92,61 +92,34 @@
 #include "conf_example.h"
 #include "conf_uart_serial.h"
 #include "tfont.h"
-#include "sourcecodepro_28.h"
-#include "calibri_36.h"
-#include "arial_72.h"
 #include "math.h"
 
-#include "Icons/WashH/time.h"
-#include "Icons/WashH/vortex.h"
-#include "Icons/WashH/water.h"
-#include "Icons/WashH/zanvil.h"
-#include "Icons/WashH/gear.h"
-#include "Icons/WashH/day.h"
-#include "Icons/WashH/rep.h"
-
-#include "Icons/WashH/lockedGray.h"
-#include "Icons/WashH/LockedGreen.h"
-#include "Icons/WashH/lockedRed.h"
-#include "Icons/WashH/unlocked.h"
-
-
-
-#include "Icons/buttonH/lavar.h"
-#include "Icons/buttonH/modo.h"
-#include "Icons/buttonH/configurar.h"
-#include "Icons/buttonH/voltar.h"
-#include "Icons/buttonH/cancelar.h"
-
-
-
-#include "Anima/D0.h"
-#include "Anima/D1.h"
-#include "Anima/D2.h"
-#include "Anima/D3.h"
-#include "Anima/D4.h"
-#include "Anima/D5.h"
-#include "Anima/D6.h"
-#include "Anima/D7.h"
-#include "Anima/D8.h"
-#include "Anima/D9.h"
-#include "Anima/D10.h"
-#include "Anima/D11.h"
-#include "Anima/D12.h"
-#include "Anima/D13.h"
-#include "Anima/D14.h"
-#include "Anima/D15.h"
-#include "Anima/D16.h"
-#include "Anima/D17.h"
-#include "Anima/D18.h"
-#include "Anima/D19.h"
-
-
+#include "assets.h"
 #include "maquina1.h"
+#include "sprite.h"
+#include "tcm.h"
+#include "dma_buf.h"
+#include "console.h"
+#include "trace.h"
+#include "prof.h"
+#include "idle.h"
+#include "perf.h"
+#include "timebase.h"
+#include "timer.h"
+#include "pace.h"
+#include "boot.h"
+#include "spi_bench.h"
+#include "touch_cal.h"
+#include "touch_filter.h"
+#include "touch_track.h"
+#include "touch_power.h"
+#include "touch_replay.h"
+#include "hsm.h"
+#include "mem.h"
+#include "ui.h"
 
 
 #define MAX_ENTRIES        3
-#define STRING_LENGTH     70
 
 #define USART_TX_MAX_LENGTH     0xff
 
@@ -170,25 +143,37 @@
 
 #define UNLOCK_PRESS_SECONDS   3
 
-struct ili9488_opt_t g_ili9488_display_opt;
+#define SECOND_US              1000000
+#define ANIM_PERIOD_US         100000   // 10 Hz
+#define BUT_DEBOUNCE_US        20000
+
+#define ARRAY_SIZE(a)          ((int)(sizeof(a) / sizeof((a)[0])))
 
-int f_modo = 0;
-int f_lock = 0;
-int f_config = 0;
-volatile int f_start = 0;
-volatile int f_draw_config = 0;
-volatile int f_draw_start = 0;
-volatile int f_draw_menu = 0;
+/* Tarefas do boot (boot.h) */
+enum {
+    BOOT_LCD,
+    BOOT_MXT,
+    BOOT_TELA,
+    BOOT_COUNT
+};
+
+#define LOCK_ICON_X       10
+#define LOCK_ICON_Y       (398+10)
+#define LOCK_ICON_SIZE    61
+
+struct ili9488_opt_t g_ili9488_display_opt;
 
-volatile int f_pressing_lock = 0;
 volatile int lock_counter = 0;
 volatile int f_door_is_open = 0;
-volatile int f_draw_door_is_open = 0;
-volatile int f_draw_ready_unlock = 0;
 
 volatile int tempo_sec = 0;
 
-volatile int security_flag=0;
+static t_ciclo *p_current;
+
+/* Interface (ui.h): as duas regioes e a fila de eventos */
+static hsm_t gs_tela;
+static hsm_t gs_trava;
+static hsm_queue_t gs_ui_queue;     // das interrupcoes e do mxt_handler
 
 const char *enxague_tempos[] = {"0", "15", "30", "45"};
 const char *enxague_vezes[] = {"0", "1", "2", "3"};
@@ -207,9 +192,10 @@ int pesado = 0;
 int bolhas = 0;
 
 volatile int anim_counter = 0;
-volatile int f_draw_anim = 0;
 
-const tImage* AnimaList[18]= {&D0,&D1,&D2,&D3,&D4,&D5,&D6,&D7,&D8,&D9,&D10,&D11,&D12,&D13,&D14,&D15,&D16,&D17};
+const uint16_t AnimaList[18]= {ASSET_ANIMA_D0,ASSET_ANIMA_D1,ASSET_ANIMA_D2,ASSET_ANIMA_D3,ASSET_ANIMA_D4,ASSET_ANIMA_D5,
+                               ASSET_ANIMA_D6,ASSET_ANIMA_D7,ASSET_ANIMA_D8,ASSET_ANIMA_D9,ASSET_ANIMA_D10,ASSET_ANIMA_D11,
+                               ASSET_ANIMA_D12,ASSET_ANIMA_D13,ASSET_ANIMA_D14,ASSET_ANIMA_D15,ASSET_ANIMA_D16,ASSET_ANIMA_D17};
 
 /**
  * Inicializa ordem do menu
@@ -238,29 +224,51 @@ t_ciclo *initMenuOrder() {
     return(&c_diario);
 }
 
-static void configure_lcd(void) {
-    /* Initialize display parameter */
-    g_ili9488_display_opt.ul_width = ILI9488_LCD_WIDTH;
-    g_ili9488_display_opt.ul_height = ILI9488_LCD_HEIGHT;
-    g_ili9488_display_opt.foreground_color = COLOR_CONVERT(COLOR_WHITE);
-    g_ili9488_display_opt.background_color = COLOR_CONVERT(COLOR_WHITE);
+/* Tarefa de boot do LCD: ili9488_init() em passos, sem as esperas */
+static uint32_t lcd_boot_step(boot_task_t *t) {
+    uint32_t wait;
+
+    if (t->state == 0) {
+        /* Initialize display parameter */
+        g_ili9488_display_opt.ul_width = ILI9488_LCD_WIDTH;
+        g_ili9488_display_opt.ul_height = ILI9488_LCD_HEIGHT;
+        g_ili9488_display_opt.foreground_color = COLOR_CONVERT(COLOR_WHITE);
+        g_ili9488_display_opt.background_color = COLOR_CONVERT(COLOR_WHITE);
+    }
 
-    /* Initialize LCD */
-    ili9488_init(&g_ili9488_display_opt);
+    wait = ili9488_init_step(&g_ili9488_display_opt, &t->state);
+    if (wait == ILI9488_INIT_FAIL) {
+        printf("LCD nao respondeu (id do ILI9488)\n\r");
+        return BOOT_DONE;
+    }
+    return wait == ILI9488_INIT_DONE ? BOOT_DONE : wait;
 }
 
-void font_draw_text(tFont *font, const char *text, int x, int y, int spacing) {
-    char *p = text;
-    while(*p != NULL) {
-        char letter = *p;
-        int letter_offset = letter - font->start_char;
-        if(letter <= font->end_char) {
-            tChar *current_char = font->chars + letter_offset;
-            ili9488_draw_pixmap(x, y, current_char->image->width, current_char->image->height, current_char->image->data);
-            x += current_char->image->width + spacing;
+void font_draw_text(uint16_t font, const char *text, int x, int y, int spacing) {
+    tIndexedImage glyph;
+    const char *p = text;
+    PROF_BEGIN(font);
+
+    while(*p != '\0') {
+        if(assets_glyph(font, *p, &glyph)) {
+            sprite_draw_indexed(x, y, &glyph, NULL);
+            x += glyph.width + spacing;
         }
         p++;
     }
+    PROF_END(font);
+}
+
+/**
+ * Desenha a imagem \a id do pacote de assets em (x, y), com a propria
+ * paleta ou com \a palette.
+ */
+void draw_asset(int x, int y, uint16_t id, const uint8_t *palette) {
+    tIndexedImage img;
+
+    if (assets_image(id, &img)) {
+        sprite_draw_indexed(x, y, &img, palette);
+    }
 }
 
 /**
@@ -269,10 +277,14 @@ void font_draw_text(tFont *font, const char *text, int x, int y, int spacing) {
  * This function writes a set of predefined, optimal maXTouch configuration data
  * to the maXTouch Xplained Pro.
  *
- * \param device Pointer to mxt_device struct
+ * Tarefa de boot (boot.h): o primeiro passo manda o soft reset e volta; o
+ * LCD sobe enquanto o maXTouch reinicia.
+ *
+ * \param t tarefa, com o mxt_device struct em arg
  */
-static void mxt_init(struct mxt_device *device)
+static uint32_t mxt_boot_step(boot_task_t *t)
 {
+    struct mxt_device *device = t->arg;
     enum status_code status;
 
     /* T8 configuration object data */
@@ -312,32 +324,29 @@ static void mxt_init(struct mxt_device *device)
         .chip  = MAXTOUCH_TWI_ADDRESS,
     };
 
-    status = (enum status_code)twihs_master_setup(MAXTOUCH_TWI_INTERFACE, &twi_opt);
-    Assert(status == STATUS_OK);
+    if (t->state++ == 0) {
+        status = (enum status_code)twihs_master_setup(MAXTOUCH_TWI_INTERFACE, &twi_opt);
+        Assert(status == STATUS_OK);
 
-    /* Initialize the maXTouch device */
-    status = mxt_init_device(device, MAXTOUCH_TWI_INTERFACE,
-                             MAXTOUCH_TWI_ADDRESS, MAXTOUCH_XPRO_CHG_PIO);
-    Assert(status == STATUS_OK);
+        /* Initialize the maXTouch device */
+        status = mxt_init_device(device, MAXTOUCH_TWI_INTERFACE,
+                                 MAXTOUCH_TWI_ADDRESS, MAXTOUCH_XPRO_CHG_PIO);
+        Assert(status == STATUS_OK);
+        UNUSED(status);
 
-    /* Issue soft reset of maXTouch device by writing a non-zero value to
-     * the reset register */
-    mxt_write_config_reg(device, mxt_get_object_address(device,
-                         MXT_GEN_COMMANDPROCESSOR_T6, 0)
-                         + MXT_GEN_COMMANDPROCESSOR_RESET, 0x01);
+        /* Issue soft reset of maXTouch device by writing a non-zero value to
+         * the reset register */
+        mxt_write_config_reg(device, mxt_get_object_address(device,
+                             MXT_GEN_COMMANDPROCESSOR_T6, 0)
+                             + MXT_GEN_COMMANDPROCESSOR_RESET, 0x01);
 
-    /* Wait for the reset of the device to complete */
-    delay_ms(MXT_RESET_TIME);
+        /* Wait for the reset of the device to complete */
+        return MXT_RESET_TIME * 1000;
+    }
 
-    /* Write data to configuration registers in T7 configuration object */
-    mxt_write_config_reg(device, mxt_get_object_address(device,
-                         MXT_GEN_POWERCONFIG_T7, 0) + 0, 0x20);
-    mxt_write_config_reg(device, mxt_get_object_address(device,
-                         MXT_GEN_POWERCONFIG_T7, 0) + 1, 0x10);
-    mxt_write_config_reg(device, mxt_get_object_address(device,
-                         MXT_GEN_POWERCONFIG_T7, 0) + 2, 0x4b);
-    mxt_write_config_reg(device, mxt_get_object_address(device,
-                         MXT_GEN_POWERCONFIG_T7, 0) + 3, 0x84);
+    /* T7 configuration object: acquisition rate follows the UI
+     * (touch_power.h) */
+    touch_power_init(device);
 
     /* Write predefined configuration data to configuration objects */
     mxt_write_config_object(device, mxt_get_object_address(device,
@@ -354,28 +363,36 @@ static void mxt_init(struct mxt_device *device)
     mxt_write_config_reg(device, mxt_get_object_address(device,
                          MXT_GEN_COMMANDPROCESSOR_T6, 0)
                          + MXT_GEN_COMMANDPROCESSOR_CALIBRATE, 0x01);
-}
 
-void draw_screen(void) {
-    ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-    ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH-1, ILI9488_LCD_HEIGHT-1);
+    return BOOT_DONE;
 }
 
-uint32_t convert_axis_system_x(uint32_t touch_y) {
-    // entrada: 4096 - 0 (sistema de coordenadas atual)
-    // saida: 0 - 320
-    return ILI9488_LCD_WIDTH - ILI9488_LCD_WIDTH*touch_y/4096;
-}
+/* "hh:mm:ss" sem sprintf, a cada segundo da contagem; vale so nesta volta
+ * do main loop (arena do quadro, mem.h) */
+static TCM_CODE const char *format_hms(int sec) {
+    int v[3] = { sec / 3600 % 100, sec % 3600 / 60, sec % 60 };
+    char *s = mem_arena_alloc(&g_frame_arena, sizeof("hh:mm:ss"));
+    const char *hms = s;
+    int i;
 
-uint32_t convert_axis_system_y(uint32_t touch_x) {
-    // entrada: 0 - 4096 (sistema de coordenadas atual)
-    // saida: 0 - 320
-    return ILI9488_LCD_HEIGHT*touch_x/4096;
+    if (s == NULL) {
+        return "";
+    }
+    for (i = 0; i < 3; i++) {
+        *s++ = '0' + v[i] / 10;
+        *s++ = '0' + v[i] % 10;
+        *s++ = i < 2 ? ':' : '\0';
+    }
+    return hms;
 }
 
-int get_next_from_list(int list_of_ints[4], int current_index) {
+void draw_screen(void) {
+    perf_boost();
+    ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
+    ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH-1, ILI9488_LCD_HEIGHT-1);
+}
 
-    int size = sizeof(list_of_ints);
+int get_next_from_list(const int *list_of_ints, int size, int current_index) {
 
     if (current_index + 1 < size) {
         return current_index + 1;
@@ -392,10 +409,6 @@ char *bool_to_string(int booly) {
 void open_door(void) {
     pio_clear(LED_PIO, LED_PIO_IDX_MASK); // acende
     f_door_is_open = 1;
-    if(f_start) {
-        security_flag=1;
-
-    }
 }
 
 void close_door(void) {
@@ -403,13 +416,42 @@ void close_door(void) {
     f_door_is_open = 0;
 }
 
-void but_callback(void)
+static TCM_CODE void door_toggle(void)
 {
     if (f_door_is_open) {
         close_door();
     } else {
         open_door();
     }
+    TRACE(DOOR, f_door_is_open);
+    hsm_post(&gs_ui_queue, f_door_is_open ? UI_EV_DOOR_OPEN : UI_EV_DOOR_CLOSE, 0);
+}
+
+/* Fim do debounce: a borda de subida so conta com o botao ainda solto */
+static TCM_CODE void but_debounce(sw_timer_t *t)
+{
+    UNUSED(t);
+    if (pio_get(BUT_PIO, PIO_INPUT, BUT_PIO_IDX_MASK)) {
+        door_toggle();
+    }
+}
+
+static sw_timer_t gs_but_timer = TIMER_INIT(but_debounce);
+
+static TCM_CODE void but_debounce_start(void)
+{
+    /* cada repique recomeca a espera */
+    timer_start(&gs_but_timer, BUT_DEBOUNCE_US, 0);
+}
+
+TCM_CODE void but_callback(uint32_t id, uint32_t mask)
+{
+    UNUSED(id);
+    UNUSED(mask);
+    PROF_BEGIN(isr_button);
+    idle_wake(IDLE_WAKE_BUTTON);
+    but_debounce_start();
+    PROF_END(isr_button);
 }
 
 void fill_config_struct() {
@@ -422,349 +464,433 @@ void fill_config_struct() {
 }
 
 void draw_config_enxague(void) {
-    font_draw_text(&sourcecodepro_28, "ENXAGUE", 20, 30+calibri_height+config_spacing, 1);
-    font_draw_text(&calibri_36, "Tempo:", 20, 30+calibri_height+config_spacing+source_font_height, 1);
-    font_draw_text(&calibri_36, "Vezes:", 20, 30+calibri_height*2+config_spacing+source_font_height, 1);
-    font_draw_text(&calibri_36, enxague_tempos[enx_t_i], ILI9488_LCD_WIDTH/2, 30+calibri_height+config_spacing+source_font_height, 1);
-    font_draw_text(&calibri_36, enxague_vezes[enx_v_i], ILI9488_LCD_WIDTH/2, 30+calibri_height*2+config_spacing+source_font_height, 1);
+    font_draw_text(ASSET_FONT_SOURCECODEPRO_28, "ENXAGUE", 20, 30+calibri_height+config_spacing, 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, "Tempo:", 20, 30+calibri_height+config_spacing+source_font_height, 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, "Vezes:", 20, 30+calibri_height*2+config_spacing+source_font_height, 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, enxague_tempos[enx_t_i], ILI9488_LCD_WIDTH/2, 30+calibri_height+config_spacing+source_font_height, 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, enxague_vezes[enx_v_i], ILI9488_LCD_WIDTH/2, 30+calibri_height*2+config_spacing+source_font_height, 1);
     ili9488_set_foreground_color(COLOR_CONVERT(COLOR_GRAY));
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH-70,30+calibri_height+config_spacing+source_font_height
-                        ,rep.width,rep.height,rep.data);
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH-70,30+calibri_height*2+config_spacing+source_font_height
-                        ,rep.width,rep.height,rep.data);
+    draw_asset(ILI9488_LCD_WIDTH-70,30+calibri_height+config_spacing+source_font_height
+                        , ASSET_ICON_REP, NULL);
+    draw_asset(ILI9488_LCD_WIDTH-70,30+calibri_height*2+config_spacing+source_font_height
+                        , ASSET_ICON_REP, NULL);
 }
 
 void draw_config_centrifuga(void) {
-    font_draw_text(&sourcecodepro_28, "CENTRIFUGA", 20, 30+calibri_height+config_spacing+(config_text_group_height+config_spacing), 1);
-    font_draw_text(&calibri_36, "RPM:", 20, 30+calibri_height+config_spacing+source_font_height+(config_text_group_height+config_spacing), 1);
-    font_draw_text(&calibri_36, "Tempo:", 20, 30+calibri_height*2+config_spacing+source_font_height+(config_text_group_height+config_spacing), 1);
-    font_draw_text(&calibri_36, centrifuga_RPM[cen_r_i], ILI9488_LCD_WIDTH/2, 30+calibri_height+config_spacing+source_font_height+(config_text_group_height+config_spacing), 1);
-    font_draw_text(&calibri_36, centrifuga_tempos[cen_t_i], ILI9488_LCD_WIDTH/2, 30+calibri_height*2+config_spacing+source_font_height+(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_SOURCECODEPRO_28, "CENTRIFUGA", 20, 30+calibri_height+config_spacing+(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, "RPM:", 20, 30+calibri_height+config_spacing+source_font_height+(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, "Tempo:", 20, 30+calibri_height*2+config_spacing+source_font_height+(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, centrifuga_RPM[cen_r_i], ILI9488_LCD_WIDTH/2, 30+calibri_height+config_spacing+source_font_height+(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, centrifuga_tempos[cen_t_i], ILI9488_LCD_WIDTH/2, 30+calibri_height*2+config_spacing+source_font_height+(config_text_group_height+config_spacing), 1);
     ili9488_set_foreground_color(COLOR_CONVERT(COLOR_GRAY));
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH-70,30+calibri_height+config_spacing+source_font_height+(config_text_group_height+config_spacing)
-                        ,rep.width,rep.height,rep.data);
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH-70,30+calibri_height*2+config_spacing+source_font_height+(config_text_group_height+config_spacing)
-                        ,rep.width,rep.height,rep.data);
+    draw_asset(ILI9488_LCD_WIDTH-70,30+calibri_height+config_spacing+source_font_height+(config_text_group_height+config_spacing)
+                        , ASSET_ICON_REP, NULL);
+    draw_asset(ILI9488_LCD_WIDTH-70,30+calibri_height*2+config_spacing+source_font_height+(config_text_group_height+config_spacing)
+                        , ASSET_ICON_REP, NULL);
 }
 
 void draw_config_adicionais(void) {
-    font_draw_text(&sourcecodepro_28, "ADICIONAIS", 20, 30+calibri_height+config_spacing+2*(config_text_group_height+config_spacing), 1);
-    font_draw_text(&calibri_36, "Pesado:", 20, 30+calibri_height+config_spacing+source_font_height+2*(config_text_group_height+config_spacing), 1);
-    font_draw_text(&calibri_36, "Bolhas:", 20, 30+calibri_height*2+config_spacing+source_font_height+2*(config_text_group_height+config_spacing), 1);
-    font_draw_text(&calibri_36, bool_to_string(pesado), ILI9488_LCD_WIDTH/2, 30+calibri_height+config_spacing+source_font_height+2*(config_text_group_height+config_spacing), 1);
-    font_draw_text(&calibri_36, bool_to_string(bolhas), ILI9488_LCD_WIDTH/2, 30+calibri_height*2+config_spacing+source_font_height+2*(config_text_group_height+config_spacing), 1);
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH-70,30+calibri_height+config_spacing+source_font_height+2*(config_text_group_height+config_spacing)
-                        ,rep.width,rep.height,rep.data);
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH-70,30+calibri_height*2+config_spacing+source_font_height+2*(config_text_group_height+config_spacing)
-                        ,rep.width,rep.height,rep.data);
+    font_draw_text(ASSET_FONT_SOURCECODEPRO_28, "ADICIONAIS", 20, 30+calibri_height+config_spacing+2*(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, "Pesado:", 20, 30+calibri_height+config_spacing+source_font_height+2*(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, "Bolhas:", 20, 30+calibri_height*2+config_spacing+source_font_height+2*(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, bool_to_string(pesado), ILI9488_LCD_WIDTH/2, 30+calibri_height+config_spacing+source_font_height+2*(config_text_group_height+config_spacing), 1);
+    font_draw_text(ASSET_FONT_CALIBRI_36, bool_to_string(bolhas), ILI9488_LCD_WIDTH/2, 30+calibri_height*2+config_spacing+source_font_height+2*(config_text_group_height+config_spacing), 1);
+    draw_asset(ILI9488_LCD_WIDTH-70,30+calibri_height+config_spacing+source_font_height+2*(config_text_group_height+config_spacing)
+                        , ASSET_ICON_REP, NULL);
+    draw_asset(ILI9488_LCD_WIDTH-70,30+calibri_height*2+config_spacing+source_font_height+2*(config_text_group_height+config_spacing)
+                        , ASSET_ICON_REP, NULL);
 }
 
-void TC1_Handler(void) {
-    volatile uint32_t ul_dummy;
+/* Cadeado: conta os segundos com o dedo em cima, a 1 Hz */
+static TCM_CODE void lock_tick(sw_timer_t *t) {
+    UNUSED(t);
+
+    if (++lock_counter == UNLOCK_PRESS_SECONDS) {
+        hsm_post(&gs_ui_queue, UI_EV_LOCK_HELD, 0);
+    }
+}
 
-    ul_dummy = tc_get_status(TC0, 1);
+static sw_timer_t gs_lock_timer = TIMER_INIT(lock_tick);
 
-    UNUSED(ul_dummy);
+/* Animacao da lavagem (10 Hz) e contagem regressiva (1 Hz): os timers so
+ * contam, o main loop desenha (pace.h) */
+static pace_t gs_anim_pace = PACE_INIT("anim");
+static pace_t gs_countdown_pace = PACE_INIT("contagem");
 
-    if (f_pressing_lock) {
-        lock_counter += 1;
+/**
+ * Desenha o icone do cadeado sobre o quadrado cinza numa unica
+ * transferencia para o LCD.
+ */
+void draw_lock_icon(uint16_t icon, uint16_t palette) {
+    const tBackground bg = { .image = NULL, .color = COLOR_GRAY };
+    tIndexedImage img;
+    tSprite sprite = { .format = SPRITE_FORMAT_INDEXED, .indexed = &img, .palette = assets_palette(palette) };
+
+    if (!assets_image(icon, &img)) {
+        return;
     }
 
-    if (lock_counter == UNLOCK_PRESS_SECONDS) {
-        f_draw_ready_unlock = 1;
+    sprite_draw(LOCK_ICON_X, LOCK_ICON_Y, LOCK_ICON_SIZE, LOCK_ICON_SIZE, &bg, &sprite, 0, 0);
+}
+
+/* Cadeado do estado atual da trava, para as telas desenhadas por inteiro */
+static void draw_lock_state(void) {
+    switch (hsm_state(&gs_trava)) {
+    case UI_LOCK_IDLE:
+        draw_lock_icon(ASSET_ICON_LOCK, ASSET_ICON_LOCK);
+        break;
+    case UI_LOCK_HOLD:
+        draw_lock_icon(ASSET_ICON_LOCK, ASSET_ICON_LOCK_RED);
+        break;
+    case UI_LOCK_READY:
+        draw_lock_icon(ASSET_ICON_LOCK, ASSET_ICON_LOCK_GREEN);
+        break;
+    default:
+        draw_lock_icon(ASSET_ICON_UNLOCKED, ASSET_ICON_UNLOCKED);
+        break;
     }
 }
 
-void TC0_Handler(void) {
-    volatile uint32_t ul_dummy;
+/* Conteudo da tela do menu com o ciclo \a p, sobre o fundo de draw_screen() */
+static void draw_menu(t_ciclo *p) {
+    draw_asset(ILI9488_LCD_WIDTH/2-64, 20, p->icon, NULL);
 
-    ul_dummy = tc_get_status(TC0, 0);
+    font_draw_text(ASSET_FONT_CALIBRI_36, mem_arena_printf(&g_frame_arena, "Modo: %s", p->nome),
+                   20, 128+30, 1);
+    int tempo_min = p->enxagueTempo * p->enxagueQnt + p->centrifugacaoTempo;
+    font_draw_text(ASSET_FONT_CALIBRI_36, mem_arena_printf(&g_frame_arena, "%d horas e %02d mins",
+                   tempo_min/60, tempo_min%60), 20, 128+30+40, 1);
 
-    /* Avoid compiler warning */
-    UNUSED(ul_dummy);
-    if (anim_counter>17)
-    {
-        anim_counter = 0;
-    }
+    draw_asset(ILI9488_LCD_WIDTH/2-80, 198+50, ASSET_BUTTON_LAVAR, NULL);
+
+    draw_asset(ILI9488_LCD_WIDTH/2-80, 328+10, ASSET_BUTTON_MODO, NULL);
 
-    f_draw_anim = 1;
+    draw_asset(ILI9488_LCD_WIDTH/2-80, 398+10, ASSET_BUTTON_CONFIGURAR, NULL);
 
+    draw_lock_state();
 }
 
-void TC_init(Tc * TC, int ID_TC, int TC_CHANNEL, int freq) {
-    uint32_t ul_div;
-    uint32_t ul_tcclks;
-    uint32_t ul_sysclk = sysclk_get_cpu_hz();
+/* Tarefa de boot da primeira tela, assim que o LCD fica pronto: fundo e
+ * conteudo em passos separados, para o maXTouch ter a vez entre eles */
+static uint32_t tela_boot_step(boot_task_t *t) {
+    if (t->state++ == 0) {
+        boot_first_pixel();
+        draw_screen();
+        return 0;
+    }
+    draw_menu(t->arg);
+    return BOOT_DONE;
+}
+
+/* ---- interface: acoes dos estados e das transicoes (hsm.h) ---- */
+
+static void menu_entry(uint32_t arg) {
+    UNUSED(arg);
+    draw_screen();
+    draw_menu(p_current);
+}
 
-    uint32_t channel = 1;
+static void door_open_entry(uint32_t arg) {
+    UNUSED(arg);
+    font_draw_text(ASSET_FONT_CALIBRI_36, "PORTA ABERTA!", 20, 30, 1);
+}
 
-    /* Configura o PMC */
-    /* O TimerCounter ? meio confuso
-    o uC possui 3 TCs, cada TC possui 3 canais
-    TC0 : ID_TC0, ID_TC1, ID_TC2
-    TC1 : ID_TC3, ID_TC4, ID_TC5
-    TC2 : ID_TC6, ID_TC7, ID_TC8
-    */
-    pmc_enable_periph_clk(ID_TC);
+/* Proximo ciclo: so o icone e o texto do menu mudam */
+static void next_mode(uint32_t arg) {
+    UNUSED(arg);
+    p_current = p_current->next;
 
-    /** Configura o TC para operar em  4Mhz e interrup?c?o no RC compare */
-    tc_find_mck_divisor(freq, ul_sysclk, &ul_div, &ul_tcclks, ul_sysclk);
-    tc_init(TC, TC_CHANNEL, ul_tcclks | TC_CMR_CPCTRG);
-    tc_write_rc(TC, TC_CHANNEL, (ul_sysclk / ul_div) / freq);
+    draw_asset(ILI9488_LCD_WIDTH/2-64, 20, p_current->icon, NULL);
 
-    /* Configura e ativa interrup?c?o no TC canal 0 */
-    /* Interrup??o no C */
-    NVIC_EnableIRQ((IRQn_Type) ID_TC);
-    tc_enable_interrupt(TC, TC_CHANNEL, TC_IER_CPCS);
+    ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
+    ili9488_draw_filled_rectangle(0, 128+30, ILI9488_LCD_WIDTH, 128+30+40+38);
 
-    /* Inicializa o canal 0 do TC */
-    tc_start(TC, TC_CHANNEL);
+    font_draw_text(ASSET_FONT_CALIBRI_36, mem_arena_printf(&g_frame_arena, "Modo: %s", p_current->nome),
+                   20, 128+30, 1);
+    int tempo_min = p_current->enxagueTempo * p_current->enxagueQnt + p_current->centrifugacaoTempo;
+    font_draw_text(ASSET_FONT_CALIBRI_36, mem_arena_printf(&g_frame_arena, "%d horas e %02d mins",
+                   tempo_min/60, tempo_min%60), 20, 128+30+40, 1);
 }
 
-void check_lock(uint32_t tx, uint32_t ty,uint32_t status) {
-    if (tx >= 10 && tx <= 70) {
-        if (ty >= 398+10 && ty <= 398+10+60) {
-            if(!f_lock && status==TOUCH_PRESS_STATUS) {
-                f_lock = 1;
-                ili9488_draw_pixmap(10,398+10,lockedRed.width,lockedRed.height,lockedGray.data);
-            }
-            if(f_lock) {
-                if (status == TOUCH_PRESS_STATUS) {
-                    f_pressing_lock = 1;
-                    TC_init(TC0, ID_TC1, 1, 1);
-                    ili9488_draw_pixmap(10,398+10,lockedRed.width,lockedRed.height,lockedRed.data);
-                }
-                else {
-                    if (f_pressing_lock && lock_counter > 2) {
-                        tc_stop(TC0, 1);
-                        anim_counter = 0;
-                        f_lock = 0;
-                        f_pressing_lock = 0;
-                        lock_counter = 0;
-                        ili9488_draw_pixmap(10,398+10,unlocked.width,unlocked.height,unlocked.data);
-                    }
-                }
-            }
+static void config_entry(uint32_t arg) {
+    UNUSED(arg);
+    draw_screen();
 
-        }
-    }
+    font_draw_text(ASSET_FONT_CALIBRI_36, "Configuracao", 20, 30, 1);
 
-    if (status == TOUCH_RELEASE_STATUS) {
-        if (f_lock) {
-            if (f_pressing_lock) {
-                f_pressing_lock = 0;
-                lock_counter = 0;
-                ili9488_draw_pixmap(10,398+10,lockedGray.width,lockedGray.height,lockedGray.data);
-            }
-        }
+    draw_config_enxague();
+    draw_config_centrifuga();
+    draw_config_adicionais();
+
+    draw_lock_state();
+
+    draw_asset(ILI9488_LCD_WIDTH/2-80, 398+10, ASSET_BUTTON_VOLTAR, NULL);
+}
+
+/* Linhas da configuracao, na ordem da tela */
+enum {
+    OPT_ENXAGUE_TEMPO,
+    OPT_ENXAGUE_VEZES,
+    OPT_CENTRIFUGA_RPM,
+    OPT_CENTRIFUGA_TEMPO,
+    OPT_PESADO,
+    OPT_BOLHAS
+};
+
+static void config_option(uint32_t opt) {
+    switch (opt) {
+    case OPT_ENXAGUE_TEMPO:
+        enx_t_i = get_next_from_list(enxague_tempos_int, ARRAY_SIZE(enxague_tempos_int), enx_t_i);
+        break;
+    case OPT_ENXAGUE_VEZES:
+        enx_v_i = get_next_from_list(enxague_vezes_int, ARRAY_SIZE(enxague_vezes_int), enx_v_i);
+        break;
+    case OPT_CENTRIFUGA_RPM:
+        cen_r_i = get_next_from_list(centrifuga_RPM_int, ARRAY_SIZE(centrifuga_RPM_int), cen_r_i);
+        break;
+    case OPT_CENTRIFUGA_TEMPO:
+        cen_t_i = get_next_from_list(centrifuga_tempos_int, ARRAY_SIZE(centrifuga_tempos_int), cen_t_i);
+        break;
+    case OPT_PESADO:
+        pesado = !pesado;
+        break;
+    case OPT_BOLHAS:
+        bolhas = !bolhas;
+        break;
+    default:
+        break;
     }
 }
 
+static void config_save(uint32_t arg) {
+    UNUSED(arg);
+    fill_config_struct();
+}
 
-void update_screen (uint32_t tx, uint32_t ty, uint32_t status) {
+static bool door_closed(uint32_t arg) {
+    UNUSED(arg);
+    return !f_door_is_open;
+}
 
+static void running_entry(uint32_t arg) {
+    UNUSED(arg);
+    draw_screen();
 
+    draw_asset(ILI9488_LCD_WIDTH/2-63, 20, AnimaList[0], NULL);
+    font_draw_text(ASSET_FONT_CALIBRI_36, p_current->nome, 20, 128+60, 1);
+    tempo_sec = (p_current->enxagueTempo * p_current->enxagueQnt + p_current->centrifugacaoTempo) * 60;
+    font_draw_text(ASSET_FONT_CALIBRI_36, format_hms(tempo_sec), 20, 128+60+40, 1);
 
-    check_lock(tx,ty,status);
+    draw_asset(ILI9488_LCD_WIDTH/2-80,398+10, ASSET_BUTTON_CANCELAR, NULL);
 
-    if (!f_lock && status == TOUCH_PRESS_STATUS) {
-        if (tx >= ILI9488_LCD_WIDTH/2-80 && tx <= ILI9488_LCD_WIDTH/2+80 && !f_start && !f_config) {
-            if (ty >= 198+50 && ty <= 198+50+80) {
-                f_draw_start = 1;
-                if (f_door_is_open) {
-                    f_draw_door_is_open = 1;
-                }
-            } else if (ty > 328+10 && ty < 328+10+60) {
-                f_modo = 1;
-            } else if (ty > 398+10 && ty < 398+10+60) {
-                f_draw_config = 1;
-                f_config = 1;
-            }
-        }
+    draw_lock_state();
 
-        else if (tx >= ILI9488_LCD_WIDTH/2-80 && tx <= ILI9488_LCD_WIDTH/2+80 && f_start) {
-            if (ty > 398+10 && ty < 398+10+60) {
-                f_draw_menu = 1;
-                f_start = 0;
-            }
-        }
+    pace_start(&gs_countdown_pace, SECOND_US);
+    pace_start(&gs_anim_pace, ANIM_PERIOD_US);
+}
 
-        else if (f_config) {
-            if (tx >= ILI9488_LCD_WIDTH/2-80 && tx <= ILI9488_LCD_WIDTH/2+80) {
-                if (ty > 398+10 && ty < 398+10+60) {
-                    f_draw_menu = 1;
-                    f_config = 0;
+static void running_exit(uint32_t arg) {
+    UNUSED(arg);
+    pace_stop(&gs_anim_pace);
+    pace_stop(&gs_countdown_pace);
+}
 
-                    fill_config_struct();
-                }
-            }
+static void unlocked_entry(uint32_t arg) {
+    UNUSED(arg);
+    draw_lock_icon(ASSET_ICON_UNLOCKED, ASSET_ICON_UNLOCKED);
+}
 
-            else if (tx >= ILI9488_LCD_WIDTH-70 && tx <= ILI9488_LCD_WIDTH-10) {
+static void lock_idle_entry(uint32_t arg) {
+    UNUSED(arg);
+    draw_lock_icon(ASSET_ICON_LOCK, ASSET_ICON_LOCK);
+}
 
-                int y_base = 30+calibri_height+config_spacing+source_font_height;
+static void lock_hold_entry(uint32_t arg) {
+    UNUSED(arg);
+    lock_counter = 0;
+    timer_start(&gs_lock_timer, SECOND_US, SECOND_US);
+    draw_lock_icon(ASSET_ICON_LOCK, ASSET_ICON_LOCK_RED);
+}
 
-                if (ty >= y_base && ty <= y_base+36) {
-                    enx_t_i = get_next_from_list(enxague_tempos_int, enx_t_i);
-                    f_draw_config = 1;
-                }
-                else if (ty >= y_base+calibri_height && ty <= y_base+calibri_height+36) {
-                    enx_v_i = get_next_from_list(enxague_vezes_int, enx_v_i);
-                    f_draw_config = 1;
-                }
+static void lock_hold_exit(uint32_t arg) {
+    UNUSED(arg);
+    timer_stop(&gs_lock_timer);
+    lock_counter = 0;
+}
 
-                else if (ty >= y_base+(config_text_group_height+config_spacing) && ty <= y_base+(config_text_group_height+config_spacing)+36) {
-                    cen_r_i = get_next_from_list(centrifuga_RPM_int, cen_r_i);
-                    f_draw_config = 1;
-                }
-                else if (ty >= y_base+calibri_height+(config_text_group_height+config_spacing) && ty <= y_base+calibri_height+(config_text_group_height+config_spacing)+36) {
-                    cen_t_i = get_next_from_list(centrifuga_tempos_int, cen_t_i);
-                    f_draw_config = 1;
-                }
+static void lock_ready_entry(uint32_t arg) {
+    UNUSED(arg);
+    draw_lock_icon(ASSET_ICON_LOCK, ASSET_ICON_LOCK_GREEN);
+}
 
-                else if (ty >= y_base+2*(config_text_group_height+config_spacing) && ty <= y_base+2*(config_text_group_height+config_spacing)+36) {
-                    pesado = !pesado;
-                    f_draw_config = 1;
-                }
-                else if (ty >= y_base+calibri_height+2*(config_text_group_height+config_spacing) && ty <= y_base+calibri_height+2*(config_text_group_height+config_spacing)+36) {
-                    bolhas = !bolhas;
-                    f_draw_config = 1;
-                }
+static void unlock(uint32_t arg) {
+    UNUSED(arg);
+    anim_counter = 0;
+}
 
-            }
+/* Estados, transicoes e gs_ui, sobre as acoes acima */
+#include "ui_table.h"
+
+/* Um evento vai para as duas regioes; true se alguma tomou uma transicao
+ * (todas as desta tabela desenham) */
+static bool ui_dispatch(uint8_t event, uint32_t arg) {
+    bool lock = hsm_dispatch(&gs_trava, event, arg);
+    bool screen = hsm_dispatch(&gs_tela, event, arg);
+
+    return lock || screen;
+}
+
+#define CENTER_X0   (ILI9488_LCD_WIDTH/2-80)
+#define CENTER_X1   (ILI9488_LCD_WIDTH/2+80)
+#define OPTION_X0   (ILI9488_LCD_WIDTH-70)
+#define OPTION_X1   (ILI9488_LCD_WIDTH-10)
+
+/* Topo da linha \a l do grupo \a g da configuracao */
+#define OPTION_Y(g, l)  (30+calibri_height+config_spacing+source_font_height+ \
+                         (l)*calibri_height+(g)*(config_text_group_height+config_spacing))
+
+/* Botoes de cada tela (e das telas dentro dela), limites inclusivos */
+typedef struct {
+    uint8_t screen;
+    uint16_t x0, y0, x1, y1;
+    uint8_t event;
+    uint8_t arg;
+} ui_button_t;
+
+static const ui_button_t gs_ui_buttons[] = {
+    { UI_MENU,    CENTER_X0, 198+50,         CENTER_X1, 198+50+80,         UI_EV_START,  0 },
+    { UI_MENU,    CENTER_X0, 328+10+1,       CENTER_X1, 328+10+60-1,       UI_EV_MODE,   0 },
+    { UI_MENU,    CENTER_X0, 398+10+1,       CENTER_X1, 398+10+60-1,       UI_EV_CONFIG, 0 },
+    { UI_RUNNING, CENTER_X0, 398+10+1,       CENTER_X1, 398+10+60-1,       UI_EV_CANCEL, 0 },
+    { UI_CONFIG,  CENTER_X0, 398+10+1,       CENTER_X1, 398+10+60-1,       UI_EV_BACK,   0 },
+    { UI_CONFIG,  OPTION_X0, OPTION_Y(0, 0), OPTION_X1, OPTION_Y(0, 0)+36, UI_EV_OPTION, OPT_ENXAGUE_TEMPO },
+    { UI_CONFIG,  OPTION_X0, OPTION_Y(0, 1), OPTION_X1, OPTION_Y(0, 1)+36, UI_EV_OPTION, OPT_ENXAGUE_VEZES },
+    { UI_CONFIG,  OPTION_X0, OPTION_Y(1, 0), OPTION_X1, OPTION_Y(1, 0)+36, UI_EV_OPTION, OPT_CENTRIFUGA_RPM },
+    { UI_CONFIG,  OPTION_X0, OPTION_Y(1, 1), OPTION_X1, OPTION_Y(1, 1)+36, UI_EV_OPTION, OPT_CENTRIFUGA_TEMPO },
+    { UI_CONFIG,  OPTION_X0, OPTION_Y(2, 0), OPTION_X1, OPTION_Y(2, 0)+36, UI_EV_OPTION, OPT_PESADO },
+    { UI_CONFIG,  OPTION_X0, OPTION_Y(2, 1), OPTION_X1, OPTION_Y(2, 1)+36, UI_EV_OPTION, OPT_BOLHAS },
+};
+
+/* Toque do dedo principal, traduzido em eventos da interface; true se a
+ * tela mudou por causa dele */
+bool update_screen (uint32_t tx, uint32_t ty, uint32_t status) {
+    bool on_lock = tx >= LOCK_ICON_X && tx <= LOCK_ICON_X+60 &&
+                   ty >= LOCK_ICON_Y && ty <= LOCK_ICON_Y+60;
+    bool drew = false;
+    uint32_t i;
+
+    if (status == TOUCH_PRESS_STATUS && on_lock) {
+        drew = ui_dispatch(UI_EV_LOCK_PRESS, 0);
+    } else if (status == TOUCH_RELEASE_STATUS) {
+        drew = ui_dispatch(on_lock ? UI_EV_LOCK_RELEASE : UI_EV_RELEASE, 0);
+    }
+
+    /* travado, so o cadeado responde */
+    if (status != TOUCH_PRESS_STATUS || hsm_in(&gs_trava, UI_LOCKED)) {
+        return drew;
+    }
+    for (i = 0; i < sizeof(gs_ui_buttons) / sizeof(gs_ui_buttons[0]); i++) {
+        const ui_button_t *b = &gs_ui_buttons[i];
+
+        if (hsm_in(&gs_tela, b->screen) && tx >= b->x0 && tx <= b->x1 &&
+            ty >= b->y0 && ty <= b->y1) {
+            drew |= ui_dispatch(b->event, b->arg);
+            break;
         }
+    }
+    return drew;
+}
+
+/* Do main loop: os eventos na fila, na ordem em que chegaram */
+static void ui_run(void) {
+    hsm_msg_t msg;
 
+    while (hsm_take(&gs_ui_queue, &msg)) {
+        if (msg.event == UI_EV_TOUCH) {
+            if (update_screen(msg.arg & 0xFFF, (msg.arg >> 12) & 0xFFF, msg.arg >> 24)) {
+                touch_replay_drawn();
+            }
+        } else {
+            ui_dispatch(msg.event, msg.arg);
+        }
     }
+}
 
+/* Toque esperando: do maXTouch ou de uma sessao repetida (touch_replay.h) */
+static bool touch_pending(struct mxt_device *device)
+{
+    return mxt_is_message_pending(device) || touch_replay_pending();
 }
 
-void mxt_handler(struct mxt_device *device)
+TCM_CODE void mxt_handler(struct mxt_device *device)
 {
-    /* USART tx buffer initialized to 0 */
-    char tx_buf[STRING_LENGTH * MAX_ENTRIES] = {0};
     uint8_t i = 0; /* Iterator */
 
     /* Temporary touch event data struct */
     struct mxt_touch_event touch_event;
+    touch_delta_t delta;
+    PROF_BEGIN(mxt);
 
-    /* Collect touch events and put the data in a string,
+    /* Collect touch events and trace them,
      * maximum 2 events at the time */
     do {
-        /* Temporary buffer for each new touch event line */
-        char buf[STRING_LENGTH];
+        uint64_t t_event;
 
         /* Read next next touch event in the queue, discard if read fails */
-        if (mxt_read_touch_event(device, &touch_event) != STATUS_OK) {
+        if (touch_replay_read(&touch_event, &t_event)) {
+            /* evento de uma sessao gravada, no instante gravado */
+        } else if (mxt_read_touch_event(device, &touch_event) != STATUS_OK) {
             continue;
+        } else {
+            t_event = now_us();
+            touch_replay_log(&touch_event);
         }
 
-        // eixos trocados (quando na vertical LCD)
-        uint32_t conv_x = convert_axis_system_x(touch_event.y);
-        uint32_t conv_y = convert_axis_system_y(touch_event.x);
+        /* eixos trocados e calibracao (touch_cal.h) */
+        uint32_t conv_x, conv_y;
+        touch_cal_map(touch_event.x, touch_event.y, &conv_x, &conv_y);
 
-        /* Format a new entry in the data string that will be sent over USART */
-        sprintf(buf, "Nr: %1d, X:%4d, Y:%4d, Status:0x%2x conv X:%3d Y:%3d\n\r",
-                touch_event.id, touch_event.x, touch_event.y,
-                touch_event.status, conv_x, conv_y);
+        boot_first_touch();
+
+        /* Registro binario na console (tools/trace_decode.py) */
+        TRACE(TOUCH, touch_event.id, touch_event.x, touch_event.y,
+              touch_event.status, conv_x, conv_y);
 
         /*printf("%s: %d", "Stuff", touch_event.status);*/
-        if (touch_event.status == TOUCH_RELEASE_STATUS) {
-            update_screen(conv_x, conv_y, TOUCH_RELEASE_STATUS);
-        } else if (touch_event.status == TOUCH_PRESS_STATUS) {
-            update_screen(conv_x, conv_y, TOUCH_PRESS_STATUS);
+        if (touch_cal_running()) {
+            /* calibrando: os toques so marcam os alvos */
+            if (touch_event.status == TOUCH_PRESS_STATUS) {
+                /* o alvo seguinte, ou a tela de volta ainda nesta volta */
+                touch_replay_input(t_event);
+                touch_replay_drawn();
+                if (touch_cal_sample(touch_event.x, touch_event.y) != TOUCH_CAL_NEXT) {
+                    touch_cal_dump();
+                    hsm_post(&gs_ui_queue, UI_EV_REDRAW, 0);
+                }
+            }
+        } else if (!touch_filter_run(touch_event.id, touch_event.status, &conv_x, &conv_y)) {
+            /* tremor: movimento dentro da zona morta (touch_filter.h) */
+        } else if (!touch_track_update(touch_event.id, touch_event.status,
+                                       conv_x, conv_y, &delta) || !delta.primary) {
+            /* so o dedo principal aperta botoes (touch_track.h) */
+        } else if (delta.kind == TOUCH_TRACK_UP) {
+            touch_replay_input(t_event);
+            hsm_post(&gs_ui_queue, UI_EV_TOUCH,
+                     UI_TOUCH_ARG(conv_x, conv_y, TOUCH_RELEASE_STATUS));
+        } else if (delta.kind == TOUCH_TRACK_DOWN) {
+            touch_replay_input(t_event);
+            hsm_post(&gs_ui_queue, UI_EV_TOUCH,
+                     UI_TOUCH_ARG(conv_x, conv_y, TOUCH_PRESS_STATUS));
         }
-
-        /* Add the new string to the string buffer */
-        /*strcat(tx_buf, buf);*/
         i++;
 
         /* Check if there is still messages in the queue and
          * if we have reached the maximum numbers of events */
-    } while ((mxt_is_message_pending(device)) & (i < MAX_ENTRIES));
-
-    /* If there is any entries in the buffer, send them over USART */
-    if (i > 0) {
-        usart_serial_write_packet(USART_SERIAL_EXAMPLE, (uint8_t *)tx_buf, strlen(tx_buf));
-    }
-}
-
-void RTC_init() {
-    /* Configura o PMC */
-    pmc_enable_periph_clk(ID_RTC);
-
-    /* Default RTC configuration, 24-hour mode */
-    rtc_set_hour_mode(RTC, 0);
-
-    /* Configura data e hora manualmente */
-    rtc_set_date(RTC, 0, 0, 0, 0);
-    rtc_set_time(RTC, 0, 0, 0);
-
-    /* Configure RTC interrupts */
-    NVIC_DisableIRQ(RTC_IRQn);
-    NVIC_ClearPendingIRQ(RTC_IRQn);
-    NVIC_SetPriority(RTC_IRQn, 5);
-    NVIC_EnableIRQ(RTC_IRQn);
-
-    /* Ativa interrupcao via alarme */
-    rtc_enable_interrupt(RTC, RTC_IER_ALREN);
-
-}
-
-void RTC_Handler(void)
-{
-    uint32_t ul_status = rtc_get_status(RTC);
-
-    /*
-    *  Verifica por qual motivo entrou
-    *  na interrupcao, se foi por segundo
-    *  ou Alarm
-    */
-    if ((ul_status & RTC_SR_SEC) == RTC_SR_SEC) {
-        rtc_clear_status(RTC, RTC_SCCR_SECCLR);
-    }
-
-    /* Time or date alarm */
-    if ((ul_status & RTC_SR_ALARM) == RTC_SR_ALARM) {
-        rtc_clear_status(RTC, RTC_SCCR_ALRCLR);
-
-        static int seconds_passed = 0;
-
-        if (f_start) {
-            rtc_set_date_alarm(RTC, 1, 0, 1, 0);
-            int hora, min, sec;
-            rtc_get_time(RTC, &hora, &min, &sec);
-            if (sec >= 59) {
-                if (min >= 59) {
-                    rtc_set_time_alarm(RTC, 1, 0, hora+1, 0, 1, 0);
-                } else {
-                    rtc_set_time_alarm(RTC, 1, hora, 1, min+1, 1, 0);
-                }
-                seconds_passed = 0;
-            } else {
-                rtc_set_time_alarm(RTC, 1, hora, 1, min, 1, sec+1);
-                seconds_passed += 1;
-            }
-
-            if (tempo_sec - seconds_passed >= 0) {
-                char string[32];
-                tempo_sec -= 1;
-                sprintf(string, "%02d:%02d:%02d", tempo_sec/3600, tempo_sec%3600/60, tempo_sec%3600%60);
-                font_draw_text(&calibri_36, string, 20, 128+60+40, 1);
-            } else {
-                f_draw_menu = 1;
-                f_start = 0;
-
-                seconds_passed = 0;
-            }
-
-        }
-
-    }
-
-    rtc_clear_status(RTC, RTC_SCCR_ACKCLR);
-    rtc_clear_status(RTC, RTC_SCCR_TIMCLR);
-    rtc_clear_status(RTC, RTC_SCCR_CALCLR);
-    rtc_clear_status(RTC, RTC_SCCR_TDERRCLR);
+    } while ((touch_pending(device)) & (i < MAX_ENTRIES));
 
+    /* alguem mexendo: maXTouch no ritmo rapido */
+    touch_power_activity();
+    PROF_END(mxt);
 }
 
 void io_init(void)
@@ -778,8 +904,8 @@ void io_init(void)
     pmc_enable_periph_clk(BUT_PIO_ID);
 
     // Configura PIO para lidar com o pino do botão como entrada
-    // com pull-up
-    pio_configure(BUT_PIO, PIO_INPUT, BUT_PIO_IDX_MASK, PIO_PULLUP | PIO_DEBOUNCE);
+    // com pull-up; o debounce e por software (but_debounce)
+    pio_configure(BUT_PIO, PIO_INPUT, BUT_PIO_IDX_MASK, PIO_PULLUP);
 
     // Configura interrupção no pino referente ao botao e associa
     // função de callback caso uma interrupção for gerada
@@ -799,10 +925,21 @@ void io_init(void)
     NVIC_SetPriority(BUT_PIO_ID, 4);
 }
 
+/* Algo para o main loop fazer? (chamada com as interrupcoes desligadas) */
+static bool main_pending(struct mxt_device *device)
+{
+    return touch_pending(device) || console_rx_pending() ||
+           hsm_pending(&gs_ui_queue) ||
+           pace_pending(&gs_anim_pace) || pace_pending(&gs_countdown_pace) ||
+           touch_power_pending();
+}
+
 int main(void)
 {
 
-    t_ciclo *p_current = initMenuOrder();
+    p_current = initMenuOrder();
+
+    const touch_filter_cfg_t touch_filter_cfg = TOUCH_FILTER_CFG_DEFAULT;
 
     struct mxt_device device;
 
@@ -814,177 +951,176 @@ int main(void)
         .stopbits     = USART_SERIAL_STOP_BIT
     };
 
+    /* LCD e maXTouch sobem juntos; a primeira tela sai assim que o LCD
+     * fica pronto (boot.h) */
+    boot_task_t boot_tasks[BOOT_COUNT] = {
+        [BOOT_LCD]  = BOOT_TASK("lcd", lcd_boot_step, 0, NULL),
+        [BOOT_MXT]  = BOOT_TASK("mxt", mxt_boot_step, 0, &device),
+        [BOOT_TELA] = BOOT_TASK("tela", tela_boot_step, BOOT_DEP(BOOT_LCD), p_current),
+    };
+
     sysclk_init(); /* Initialize system clocks */
     board_init();  /* Initialize board */
+    timebase_init(); /* Zero dos tempos do boot */
+    timer_init();
+    dma_buf_init(); /* Pool de buffers de DMA nao-cacheavel */
 
     io_init();
 
-    configure_lcd();
-    draw_screen();
-
-    /* Initialize the mXT touch device */
-    mxt_init(&device);
-
     /* Initialize stdio on USART */
     stdio_serial_init(USART_SERIAL_EXAMPLE, &usart_serial_options);
+    console_init();
+    trace_init();
+    prof_init();
+    touch_cal_init(); /* Calibracao do toque guardada nos GPBR */
+    touch_filter_init(&touch_filter_cfg);
+
+    /* Interface no menu, destravada: a primeira tela e do boot */
+    if (!hsm_build(&gs_ui)) {
+        printf("Tabela da interface mal formada\n\r");
+    }
+    hsm_init(&gs_tela, &gs_ui, UI_MENU);
+    hsm_init(&gs_trava, &gs_ui, UI_UNLOCKED);
 
-    RTC_init();
-
-    close_door();
-
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-64, 20, 128, 128, p_current->icon->data);
-
-    char string[32];
-    sprintf(string, "Modo: %s", p_current->nome);
-    font_draw_text(&calibri_36, string, 20, 128+30, 1);
-    int tempo_min = p_current->enxagueTempo * p_current->enxagueQnt + p_current->centrifugacaoTempo;
-    sprintf(string, "%d horas e %02d mins", tempo_min/60, tempo_min%60);
-    font_draw_text(&calibri_36, string, 20, 128+30+40, 1);
+    /* Pacote de imagens e fontes na regiao de flash de assets */
+    if (!assets_init()) {
+        printf("Pacote de assets ausente ou incompativel\n\r");
+    }
 
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-80, 198+50, lavar.width, lavar.height, lavar.data);
+    boot_run(boot_tasks, BOOT_COUNT);
 
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-80, 328+10, modo.width, modo.height, modo.data);
+    idle_init();
+    perf_init();
 
-    ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-80, 398+10, configurar.width, configurar.height, configurar.data);
+#if defined(TCM_BENCH) || defined(SPI_BENCH)
+    /* os testes desenham por cima da primeira tela */
+    tcm_bench_run();
+    spi_bench_run();
+    draw_screen();
+    draw_menu(p_current);
+#endif
 
-    ili9488_draw_pixmap(10,398+10,unlocked.width,unlocked.height,unlocked.data);
+    close_door();
 
     while(1) {
 
-        if (mxt_is_message_pending(&device)) {
+        if (touch_pending(&device)) {
             mxt_handler(&device);
+            idle_touch_processed();
         }
 
-        if (f_draw_ready_unlock) {
-            ili9488_draw_pixmap(10,398+10, LockedGreen.width, LockedGreen.height, LockedGreen.data);
-
-            f_draw_ready_unlock = 0;
-        }
-
-        if (f_modo) {
-            p_current = p_current->next;
-
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-64, 20, 128, 128, p_current->icon->data);
-
-            ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-            ili9488_draw_filled_rectangle(0, 128+30, ILI9488_LCD_WIDTH, 128+30+40+38);
-
-            sprintf(string, "Modo: %s", p_current->nome);
-            font_draw_text(&calibri_36, string, 20, 128+30, 1);
-            int tempo_min = p_current->enxagueTempo * p_current->enxagueQnt + p_current->centrifugacaoTempo;
-            sprintf(string, "%d horas e %02d mins", tempo_min/60, tempo_min%60);
-            font_draw_text(&calibri_36, string, 20, 128+30+40, 1);
-
-            if (f_door_is_open && f_draw_start) {
-                f_draw_door_is_open = 1;
+        /* Comandos de profiling pela serial */
+        switch (console_getc()) {
+        case 'p':
+            prof_dump();
+            break;
+        case 'i':
+            idle_dump();
+            break;
+        case 'g':
+            perf_next_policy();
+            perf_dump();
+            break;
+        case 'b':
+            boot_dump();
+            break;
+        case 'c':
+            /* calibracao do toque, so a partir do menu */
+            if (hsm_state(&gs_tela) == UI_MENU && !hsm_in(&gs_trava, UI_LOCKED) &&
+                !touch_cal_running()) {
+                touch_cal_start();
             }
-
-            f_modo = 0;
-        }
-
-        if(security_flag) {
-            f_start=0;
-            f_draw_menu=1;
-            security_flag=0;
-        }
-        if (f_draw_config) {
-
-            draw_screen();
-
-            font_draw_text(&calibri_36, "Configuracao", 20, 30, 1);
-
-            draw_config_enxague();
-            draw_config_centrifuga();
-            draw_config_adicionais();
-
-            ili9488_set_foreground_color(COLOR_CONVERT(COLOR_GRAY));
-            ili9488_draw_filled_rectangle(10, 398+10, 70, 398+10+60);
-            ili9488_draw_pixmap(10,398+10,unlocked.width,unlocked.height,unlocked.data);
-
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-80, 398+10,voltar.width,voltar.height,voltar.data);
-
-            f_draw_config = 0;
-        }
-
-        if (f_draw_start && !f_door_is_open) {
-
-            draw_screen();
-
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-63,20,AnimaList[0]->width,AnimaList[0]->height,AnimaList[0]->data);
-            sprintf(string, "%s", p_current->nome);
-            font_draw_text(&calibri_36, string, 20, 128+60, 1);
-            tempo_sec = (p_current->enxagueTempo * p_current->enxagueQnt + p_current->centrifugacaoTempo) * 60;
-            sprintf(string, "%02d:%02d:%02d", tempo_sec/3600, tempo_sec%3600/60, tempo_sec%3600%60);
-            font_draw_text(&calibri_36, string, 20, 128+60+40, 1);
-
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-80,398+10,cancelar.width,cancelar.height,cancelar.data);
-
-            ili9488_set_foreground_color(COLOR_CONVERT(COLOR_GRAY));
-            ili9488_draw_filled_rectangle(10, 398+10, 70, 398+10+60);
-            ili9488_draw_pixmap(10,398+10,unlocked.width,unlocked.height,unlocked.data);
-
-            rtc_set_date(RTC, 0, 0, 0, 0);
-            rtc_set_time(RTC, 0, 0, 0);
-
-            rtc_set_date_alarm(RTC, 0, 0, 0, 0);
-            rtc_set_time_alarm(RTC, 0, 0, 0, 0, 1, 1);
-            TC_init(TC0, ID_TC0, 0, 10);
-
-            f_start = 1;
-
-            f_draw_start = 0;
+            break;
+        case 'f':
+            pace_dump(&gs_anim_pace);
+            pace_dump(&gs_countdown_pace);
+            break;
+        case 't':
+            touch_filter_dump();
+            touch_track_dump();
+            touch_power_dump();
+            break;
+        case 'e':
+            /* gravacao da sessao de toques no trace */
+            touch_replay_record(!touch_replay_recording());
+            printf("\n\rgravacao de toques %s\n\r",
+                   touch_replay_recording() ? "ligada" : "desligada");
+            break;
+        case 'l':
+            touch_replay_dump();
+            break;
+        case 'm':
+            printf("\n\r");
+            mem_arena_dump(&g_frame_arena);
+            break;
+        case 'u':
+            printf("\n\rinterface: %s, %s\n\r", gs_ui_states[hsm_state(&gs_tela)].name,
+                   gs_ui_states[hsm_state(&gs_trava)].name);
+            hsm_dump(&gs_ui);
+            break;
+        case 'r':
+            prof_reset();
+            idle_reset();
+            perf_reset();
+            pace_reset(&gs_anim_pace);
+            pace_reset(&gs_countdown_pace);
+            touch_filter_reset_stats();
+            touch_track_reset_stats();
+            touch_power_reset_stats();
+            touch_replay_reset();
+            hsm_reset_hits(&gs_ui);
+            mem_arena_reset_stats(&g_frame_arena);
+            break;
+        default:
+            break;
         }
 
-        if (f_draw_menu) {
-
-            tc_stop(TC0,0);
-            draw_screen();
-
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-64, 20, 128, 128, p_current->icon->data);
-
-            sprintf(string, "Modo: %s", p_current->nome);
-            font_draw_text(&calibri_36, string, 20, 128+30, 1);
-            int tempo_min = p_current->enxagueTempo * p_current->enxagueQnt + p_current->centrifugacaoTempo;
-            sprintf(string, "%d horas e %02d mins", tempo_min/60, tempo_min%60);
-            font_draw_text(&calibri_36, string, 20, 128+30+40, 1);
-
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-80, 198+50, lavar.width, lavar.height, lavar.data);
-
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-80, 328+10, modo.width, modo.height, modo.data);
-
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-80, 398+10, configurar.width, configurar.height, configurar.data);
+        /* Eventos da interface: toques, porta, cadeado (hsm.h) */
+        ui_run();
 
-            ili9488_draw_pixmap(10,398+10,unlocked.width,unlocked.height,unlocked.data);
-
-            if (f_door_is_open && f_draw_start) {
-                f_draw_door_is_open = 1;
+        /* Contagem regressiva: segundos juntados num desenho so */
+        uint32_t ticks = pace_take(&gs_countdown_pace);
+        if (ticks && hsm_in(&gs_tela, UI_RUNNING)) {
+            if (tempo_sec > 0) {
+                tempo_sec = Max(tempo_sec - (int)ticks, 0);
+                TRACE(RTC_TICK, tempo_sec);
+                font_draw_text(ASSET_FONT_CALIBRI_36, format_hms(tempo_sec), 20, 128+60+40, 1);
+            } else {
+                ui_dispatch(UI_EV_DONE, 0);
             }
-
-            f_draw_menu = 0;
         }
 
-        if (f_draw_anim) {
+        /* Animacao: quadros atrasados sao pulados, nao enfileirados */
+        ticks = pace_take(&gs_anim_pace);
+        if (ticks) {
+            anim_counter = (anim_counter + ticks - 1) % 18;
 
-            tc_disable_interrupt(TC0, 0, TC_IER_CPCS);
-            tc_disable_interrupt(TC0, 1, TC_IER_CPCS);
-            rtc_disable_interrupt(RTC, RTC_IER_ALREN);
+            draw_asset(ILI9488_LCD_WIDTH/2-63, 20, AnimaList[anim_counter], NULL);
+            TRACE(ANIM, anim_counter);
 
-            ili9488_draw_pixmap(ILI9488_LCD_WIDTH/2-63,20,AnimaList[anim_counter]->width,AnimaList[anim_counter]->height,AnimaList[anim_counter]->data);
+            anim_counter = (anim_counter + 1) % 18;
+        }
 
-            tc_enable_interrupt(TC0, 0, TC_IER_CPCS);
-            tc_enable_interrupt(TC0, 1, TC_IER_CPCS);
-            rtc_enable_interrupt(RTC, RTC_IER_ALREN);
+        /* Fim da resposta aos toques desta volta (latencia, touch_replay.h) */
+        touch_replay_frame();
 
-            anim_counter = anim_counter + 1;
+        /* Todo envio do compositor desta volta ja terminou (cada
+         * sprite_draw volta depois do blit_end): textos e temporarios do
+         * desenho acabam aqui, e nao a cada envio (mem.h) */
+        mem_arena_reset(&g_frame_arena);
 
-            f_draw_anim = 0;
-        }
+        /* Ritmo do maXTouch pelo estado da tela */
+        touch_power_update(hsm_in(&gs_trava, UI_LOCKED) ? TOUCH_POWER_LOCKED :
+                           hsm_in(&gs_tela, UI_RUNNING) ? TOUCH_POWER_RUNNING :
+                           TOUCH_POWER_MENU);
 
-        if (f_draw_door_is_open) {
-            font_draw_text(&calibri_36, "PORTA ABERTA!", 20, 30, 1);
-            f_draw_door_is_open = 0;
+        /* Nada pendente: dorme ate a proxima interrupcao (idle.h) */
+        perf_relax();
+        cpu_irq_disable();
+        if (!main_pending(&device)) {
+            idle_enter();
         }
-
+        cpu_irq_enable();
     }
 
     return 0;
@@ -21,7 +21,7 @@ struct ciclo{
 	char bubblesOn;          // smart bubbles on (???)
 	t_ciclo *previous;
 	t_ciclo *next;
-	tImage *icon;
+	uint16_t icon;          // id no pacote de assets
 };
 
 t_ciclo c_rapido = {.nome = "Rapido",
@@ -31,7 +31,7 @@ t_ciclo c_rapido = {.nome = "Rapido",
 	.centrifugacaoTempo = 5,
 	.heavy = 0,
 	.bubblesOn = 1,
-	.icon = &time
+	.icon = ASSET_ICON_TIME
 };
 
 t_ciclo c_diario = {.nome = "Diario",
@@ -41,7 +41,7 @@ t_ciclo c_diario = {.nome = "Diario",
 	.centrifugacaoTempo = 8,
 	.heavy = 0,
 	.bubblesOn = 1,
-	.icon = &day
+	.icon = ASSET_ICON_DAY
 };
 
 t_ciclo c_pesado = {.nome = "Pesado",
@@ -51,7 +51,7 @@ t_ciclo c_pesado = {.nome = "Pesado",
 	.centrifugacaoTempo = 10,
 	.heavy = 1,
 	.bubblesOn = 1,
-	.icon = &zanvil
+	.icon = ASSET_ICON_ZANVIL
 };
 
 t_ciclo c_enxague = {.nome = "Enxague",
@@ -61,7 +61,7 @@ t_ciclo c_enxague = {.nome = "Enxague",
 	.centrifugacaoTempo = 0,
 	.heavy = 0,
 	.bubblesOn = 0,
-	.icon = &water
+	.icon = ASSET_ICON_WATER
 };
 
 t_ciclo c_centrifuga = {.nome = "Centrifuga",
@@ -71,7 +71,7 @@ t_ciclo c_centrifuga = {.nome = "Centrifuga",
 	.centrifugacaoTempo = 10,
 	.heavy = 0,
 	.bubblesOn = 0,
-	.icon = &vortex
+	.icon = ASSET_ICON_VORTEX
 };
 
 t_ciclo c_config = {.nome = "Config",
@@ -81,7 +81,7 @@ t_ciclo c_config = {.nome = "Config",
 	.centrifugacaoTempo = 0,
 	.heavy = 0,
 	.bubblesOn = 0,
-	.icon = &gear
+	.icon = ASSET_ICON_GEAR
 };
 
 
@@ -0,0 +1,164 @@
+/*
+ * mem.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include "mem.h"
+
+static uint8_t gs_frame_area[MEM_FRAME_SIZE] __attribute__((aligned(MEM_ALIGN)));
+
+mem_arena_t g_frame_arena = { "quadro", gs_frame_area, MEM_FRAME_SIZE, 0, 0, 0 };
+
+/* ---- pool ---- */
+
+/**
+ * \brief Um bloco de \a p, de um liberado ou de um nunca usado.
+ *
+ * \return NULL com o pool cheio.
+ */
+void *mem_pool_alloc(mem_pool_t *p)
+{
+	irqflags_t flags = cpu_irq_save();
+	void *block = p->free;
+
+	if (block != NULL) {
+		p->free = *(void **)block;
+	} else if (p->fresh < p->count) {
+		block = p->base + (uint32_t)p->fresh++ * p->block_size;
+	}
+	if (block != NULL) {
+		p->used++;
+		p->high = Max(p->high, p->used);
+	} else {
+		p->fails++;
+	}
+	cpu_irq_restore(flags);
+	return block;
+}
+
+/* Devolve \a block, que veio de mem_pool_alloc(\a p); NULL nao faz nada */
+void mem_pool_free(mem_pool_t *p, void *block)
+{
+	irqflags_t flags;
+
+	if (block == NULL) {
+		return;
+	}
+	flags = cpu_irq_save();
+	*(void **)block = p->free;
+	p->free = block;
+	p->used--;
+	cpu_irq_restore(flags);
+}
+
+/* \a block e o inicio de um bloco de \a p (para asserts) */
+bool mem_pool_owns(const mem_pool_t *p, const void *block)
+{
+	uintptr_t off = (uintptr_t)block - (uintptr_t)p->base;
+
+	return (uintptr_t)block >= (uintptr_t)p->base &&
+	       off < (uintptr_t)p->count * p->block_size && off % p->block_size == 0;
+}
+
+void mem_pool_get_stats(const mem_pool_t *p, mem_stats_t *out)
+{
+	out->size = p->count;
+	out->used = p->used;
+	out->high = p->high;
+	out->fails = p->fails;
+}
+
+void mem_pool_reset_stats(mem_pool_t *p)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	p->high = p->used;
+	p->fails = 0;
+	cpu_irq_restore(flags);
+}
+
+void mem_pool_dump(const mem_pool_t *p)
+{
+	printf("pool %s: %u de %u blocos de %u B, pico %u, %lu falhas\n\r",
+			p->name, (unsigned)p->used, (unsigned)p->count, (unsigned)p->block_size,
+			(unsigned)p->high, (unsigned long)p->fails);
+}
+
+/* ---- arena ---- */
+
+/**
+ * \brief \a size bytes de \a a, alinhados a MEM_ALIGN, validos ate o
+ * proximo mem_arena_reset().
+ *
+ * \return NULL se nao couber.
+ */
+void *mem_arena_alloc(mem_arena_t *a, size_t size)
+{
+	void *p;
+
+	size = MEM_ROUND(size);
+	if (size > a->size - a->used) {
+		a->fails++;
+		return NULL;
+	}
+	p = a->base + a->used;
+	a->used += size;
+	a->high = Max(a->high, a->used);
+	return p;
+}
+
+/**
+ * \brief Texto formatado em \a a, com o tamanho exato.
+ *
+ * Sem espaco conta uma falha e devolve "", para o desenho seguir sem o
+ * texto.
+ */
+char *mem_arena_printf(mem_arena_t *a, const char *fmt, ...)
+{
+	char *s = (char *)(a->base + a->used);
+	uint32_t room = a->size - a->used;
+	va_list ap;
+	int n;
+
+	va_start(ap, fmt);
+	n = vsnprintf(s, room, fmt, ap);
+	va_end(ap);
+	if (n < 0 || (uint32_t)n >= room) {
+		a->fails++;
+		return "";
+	}
+	a->used += MEM_ROUND((uint32_t)n + 1);
+	a->used = Min(a->used, a->size);
+	a->high = Max(a->high, a->used);
+	return s;
+}
+
+void mem_arena_reset(mem_arena_t *a)
+{
+	a->used = 0;
+}
+
+void mem_arena_get_stats(const mem_arena_t *a, mem_stats_t *out)
+{
+	out->size = a->size;
+	out->used = a->used;
+	out->high = a->high;
+	out->fails = a->fails;
+}
+
+void mem_arena_reset_stats(mem_arena_t *a)
+{
+	a->high = a->used;
+	a->fails = 0;
+}
+
+void mem_arena_dump(const mem_arena_t *a)
+{
+	printf("arena %s: %lu de %lu B, pico %lu, %lu falhas\n\r", a->name,
+			(unsigned long)a->used, (unsigned long)a->size,
+			(unsigned long)a->high, (unsigned long)a->fails);
+}
@@ -0,0 +1,102 @@
+/*
+ * mem.h
+ *
+ * Created: 18/10/2026
+ *
+ * Memoria sem malloc: pools de blocos fixos e arenas.
+ *
+ * Pool (mem_pool_t): N blocos do mesmo tamanho numa area estatica
+ * (MEM_POOL_DEFINE). Os livres formam uma lista ligada pelos proprios
+ * blocos e os nunca usados sao tirados do fim da area, entao nao ha
+ * inicializacao e alocar e liberar sao O(1). Alocar e liberar desligam as
+ * interrupcoes por poucas instrucoes: podem ser chamados de interrupcoes.
+ *
+ * Arena (mem_arena_t): alocacao por ponteiro que so avanca e volta tudo de
+ * uma vez com mem_arena_reset(). So do main loop. A arena do quadro
+ * (g_frame_arena) serve para textos e temporarios do desenho, que nao
+ * podem ser guardados de uma volta do main loop para a outra. Ela e zerada
+ * no fim da volta e nao a cada envio do compositor por faixas (sprite.h):
+ * sprite_draw() e sprite_draw_indexed() so voltam depois do
+ * ili9488_blit_end(), entao no fim da volta todos os envios dela ja
+ * aconteceram, e um mesmo texto da arena atravessa varios envios
+ * (font_draw_text() desenha cada glifo com um sprite_draw_indexed()).
+ *
+ * Os pools ainda nao tem usuario no firmware: a fila da interface
+ * (hsm_queue_t) guarda as mensagens por valor num anel e nao precisa de
+ * blocos. Por enquanto so o make mem-bench do host os exercita.
+ *
+ * Os dois contam uso atual, pico e falhas ('m' pela serial imprime os da
+ * arena do quadro).
+ */
+
+
+#ifndef MEM_H_
+#define MEM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define MEM_ALIGN               8
+#define MEM_ROUND(size)         (((size) + MEM_ALIGN - 1) & ~(size_t)(MEM_ALIGN - 1))
+#define MEM_FRAME_SIZE          512
+
+typedef struct {
+	const char *name;
+	uint8_t *base;
+	void *free;                 // lista de blocos liberados
+	uint16_t block_size;
+	uint16_t count;
+	uint16_t fresh;             // blocos do inicio da area ja entregues
+	uint16_t used;
+	uint16_t high;
+	uint32_t fails;
+} mem_pool_t;
+
+typedef struct {
+	const char *name;
+	uint8_t *base;
+	uint32_t size;
+	uint32_t used;
+	uint32_t high;
+	uint32_t fails;
+} mem_arena_t;
+
+typedef struct {
+	uint32_t size;              // blocos no pool, bytes na arena
+	uint32_t used;
+	uint32_t high;
+	uint32_t fails;
+} mem_stats_t;
+
+/** Pool \a var de \a n blocos de \a size bytes (arredondado a MEM_ALIGN) */
+#define MEM_POOL_DEFINE(var, name, size, n)                                    \
+	static uint8_t var##_area[(n) * MEM_ROUND(size)]                           \
+			__attribute__((aligned(MEM_ALIGN)));                               \
+	static mem_pool_t var = { (name), var##_area, NULL, MEM_ROUND(size), (n),  \
+			0, 0, 0, 0 }
+
+/** Arena \a var de \a size bytes */
+#define MEM_ARENA_DEFINE(var, name, size)                                      \
+	static uint8_t var##_area[MEM_ROUND(size)]                                 \
+			__attribute__((aligned(MEM_ALIGN)));                               \
+	static mem_arena_t var = { (name), var##_area, MEM_ROUND(size), 0, 0, 0 }
+
+extern mem_arena_t g_frame_arena;
+
+void *mem_pool_alloc(mem_pool_t *p);
+void mem_pool_free(mem_pool_t *p, void *block);
+bool mem_pool_owns(const mem_pool_t *p, const void *block);
+void mem_pool_get_stats(const mem_pool_t *p, mem_stats_t *out);
+void mem_pool_reset_stats(mem_pool_t *p);
+void mem_pool_dump(const mem_pool_t *p);
+
+void *mem_arena_alloc(mem_arena_t *a, size_t size);
+char *mem_arena_printf(mem_arena_t *a, const char *fmt, ...)
+		__attribute__((format(__printf__, 2, 3)));
+void mem_arena_reset(mem_arena_t *a);
+void mem_arena_get_stats(const mem_arena_t *a, mem_stats_t *out);
+void mem_arena_reset_stats(mem_arena_t *a);
+void mem_arena_dump(const mem_arena_t *a);
+
+#endif /* MEM_H_ */
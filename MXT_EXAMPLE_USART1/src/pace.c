@@ -0,0 +1,113 @@
+/*
+ * pace.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include "pace.h"
+#include "timebase.h"
+#include "tcm.h"
+
+/**
+ * \brief Callback do timer: conta os periodos passados e mede o desvio.
+ *
+ * O timer junta periodos perdidos numa chamada so; aqui eles voltam a
+ * contar, para a contagem regressiva nao perder segundos.
+ */
+TCM_CODE void pace_tick(sw_timer_t *t)
+{
+	pace_t *p = (pace_t *)t;
+	uint64_t now = now_us();
+	uint32_t dt = (uint32_t)(now - p->last_us);
+	uint32_t n = Max((dt + p->period_us / 2) / p->period_us, 1u);
+	uint32_t ideal = n * p->period_us;
+	uint32_t dev = dt > ideal ? dt - ideal : ideal - dt;
+
+	p->last_us = now;
+	p->stats.ticks += n;
+	p->stats.jitter_count++;
+	p->stats.jitter_total += dev;
+	if (dev > p->stats.jitter_max) {
+		p->stats.jitter_max = dev;
+	}
+	/* um escritor so: a escrita da palavra e atomica */
+	p->seq = p->seq + n;
+}
+
+/**
+ * \brief Comeca a contar ticks a cada \a period_us, sem nenhum pendente.
+ */
+void pace_start(pace_t *p, uint32_t period_us)
+{
+	timer_stop(&p->timer);
+	p->period_us = period_us;
+	p->shown = p->seq;
+	p->last_us = now_us();
+	timer_start(&p->timer, period_us, period_us);
+}
+
+/**
+ * \brief Para os ticks e descarta os que nao foram desenhados.
+ */
+void pace_stop(pace_t *p)
+{
+	timer_stop(&p->timer);
+	p->shown = p->seq;
+}
+
+bool pace_pending(const pace_t *p)
+{
+	return p->seq != p->shown;
+}
+
+/**
+ * \brief Ticks desde o ultimo pace_take() (0 se nenhum). Chamada so pelo
+ * main loop, que desenha uma vez o estado de todos eles.
+ */
+uint32_t pace_take(pace_t *p)
+{
+	uint32_t seq = p->seq;
+	uint32_t n = seq - p->shown;
+
+	if (n) {
+		p->shown = seq;
+		p->stats.frames++;
+		p->stats.dropped += n - 1;
+	}
+	return n;
+}
+
+void pace_get_stats(const pace_t *p, pace_stats_t *stats)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	*stats = p->stats;
+
+	cpu_irq_restore(flags);
+}
+
+void pace_reset(pace_t *p)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	p->stats = (pace_stats_t){ 0 };
+
+	cpu_irq_restore(flags);
+}
+
+void pace_dump(const pace_t *p)
+{
+	pace_stats_t s;
+
+	pace_get_stats(p, &s);
+	printf("\n\rpace %s: periodo %lu us, %lu ticks, %lu quadros, %lu pulados\n\r",
+			p->name, (unsigned long)p->period_us, (unsigned long)s.ticks,
+			(unsigned long)s.frames, (unsigned long)s.dropped);
+	if (s.jitter_count) {
+		printf("  jitter: media %lu us  max %lu us\n\r",
+				(unsigned long)(s.jitter_total / s.jitter_count),
+				(unsigned long)s.jitter_max);
+	}
+}
@@ -0,0 +1,58 @@
+/*
+ * pace.h
+ *
+ * Created: 18/10/2026
+ *
+ * Ritmo de quadros: um timer periodico (timer.h) so conta ticks e o main
+ * loop desenha o estado mais recente com pace_take(), que devolve quantos
+ * ticks passaram desde o ultimo desenho. Ticks que chegam durante um
+ * desenho longo se juntam num so: o quadro atrasado e pulado, nao
+ * enfileirado. Nada e desenhado na interrupcao, entao o main loop nao
+ * precisa segurar os timers enquanto desenha; o contador e uma palavra de
+ * 32 bits com um escritor so (a callback), lida sem desligar interrupcoes.
+ *
+ * Cada tick mede o intervalo desde o anterior: o desvio em relacao ao
+ * periodo e o jitter da interrupcao da base de tempo. pace_dump() imprime
+ * jitter, quadros desenhados e ticks juntados ('f' pela serial).
+ */
+
+
+#ifndef PACE_H_
+#define PACE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "timer.h"
+
+typedef struct {
+	uint32_t ticks;
+	uint32_t frames;            // pace_take() com ticks novos
+	uint32_t dropped;           // ticks juntados a outro (quadros pulados)
+	uint32_t jitter_count;
+	uint32_t jitter_max;        // us, |intervalo - periodo|
+	uint64_t jitter_total;
+} pace_stats_t;
+
+typedef struct {
+	sw_timer_t timer;           // primeiro campo: a callback recebe o pace
+	const char *name;
+	uint32_t period_us;
+	volatile uint32_t seq;      // ticks (so a callback escreve)
+	uint32_t shown;             // seq do ultimo pace_take() (so o main loop)
+	uint64_t last_us;
+	pace_stats_t stats;
+} pace_t;
+
+void pace_tick(sw_timer_t *t);
+
+#define PACE_INIT(nm)       { TIMER_INIT(pace_tick), (nm), 0, 0, 0, 0, { 0 } }
+
+void pace_start(pace_t *p, uint32_t period_us);
+void pace_stop(pace_t *p);
+bool pace_pending(const pace_t *p);
+uint32_t pace_take(pace_t *p);
+void pace_get_stats(const pace_t *p, pace_stats_t *stats);
+void pace_reset(pace_t *p);
+void pace_dump(const pace_t *p);
+
+#endif /* PACE_H_ */
@@ -0,0 +1,223 @@
+/*
+ * perf.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include "perf.h"
+#include "console.h"
+#include "trace.h"
+
+#if defined(__arm__)
+#include "conf_board.h"
+#include "conf_example.h"
+
+#if PERF_LOW_DIV == 2
+#define PERF_LOW_PRES       PMC_MCKR_PRES_CLK_2
+#elif PERF_LOW_DIV == 4
+#define PERF_LOW_PRES       PMC_MCKR_PRES_CLK_4
+#elif PERF_LOW_DIV == 8
+#define PERF_LOW_PRES       PMC_MCKR_PRES_CLK_8
+#elif PERF_LOW_DIV == 16
+#define PERF_LOW_PRES       PMC_MCKR_PRES_CLK_16
+#elif PERF_LOW_DIV == 32
+#define PERF_LOW_PRES       PMC_MCKR_PRES_CLK_32
+#elif PERF_LOW_DIV == 64
+#define PERF_LOW_PRES       PMC_MCKR_PRES_CLK_64
+#else
+#error "PERF_LOW_DIV invalido"
+#endif
+
+/* PRES do conf_clock.h, lido no boot */
+static uint32_t gs_high_pres;
+#endif
+
+static const char *const gs_policy_names[PERF_POLICY_COUNT] = {
+	"ondemand", "high", "low"
+};
+
+uint32_t g_perf_cycles_base;
+uint32_t g_perf_cycles_mark;
+uint32_t g_perf_cycles_shift;
+
+static volatile int gs_policy = PERF_POLICY_ONDEMAND;
+static volatile int gs_state = PERF_HIGH;
+static uint32_t gs_entries[PERF_STATE_COUNT];
+static uint32_t gs_boosts;
+static uint32_t gs_relax_busy;
+
+/*
+ * Troca o prescaler e refaz os divisores, tudo com as interrupcoes
+ * desligadas. Nenhuma transferencia de SPI ou TWIHS esta em andamento nos
+ * pontos em que o governador e chamado (fora de desenhos e de leituras do
+ * maXTouch); a console espera o byte em transmissao sair.
+ */
+static void set_state(int state)
+{
+	irqflags_t flags;
+
+	if (state == gs_state) {
+		return;
+	}
+
+	flags = cpu_irq_save();
+#if defined(__arm__)
+	{
+		uint32_t pres = state == PERF_HIGH ? gs_high_pres : PERF_LOW_PRES;
+		uint32_t mck = state == PERF_HIGH ? sysclk_get_peripheral_hz() :
+				sysclk_get_peripheral_hz() / PERF_LOW_DIV;
+
+		console_set_mck(mck);
+		g_perf_cycles_base = perf_cycles();
+		PMC->PMC_MCKR = (PMC->PMC_MCKR & ~PMC_MCKR_PRES_Msk) | pres;
+		while (!(PMC->PMC_SR & PMC_SR_MCKRDY)) {
+		}
+		g_perf_cycles_mark = cycles_now();
+		g_perf_cycles_shift = state == PERF_HIGH ? 0 : __builtin_ctz(PERF_LOW_DIV);
+
+		spi_set_baudrate_div(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS,
+				spi_calc_baudrate_div(ILI9488_SPI_BAUDRATE, mck));
+		twihs_set_speed(MAXTOUCH_TWI_INTERFACE, MXT_TWI_SPEED, mck);
+	}
+#endif
+	gs_state = state;
+	gs_entries[state]++;
+	/* o DWT passa a contar no clock novo (no host o clock nao muda) */
+	TRACE(CLOCK, (int32_t)perf_cpu_hz());
+	cpu_irq_restore(flags);
+}
+
+void perf_init(void)
+{
+#if defined(__arm__)
+	gs_high_pres = PMC->PMC_MCKR & PMC_MCKR_PRES_Msk;
+#endif
+	cycles_init();
+	g_perf_cycles_base = cycles_now();
+	g_perf_cycles_mark = g_perf_cycles_base;
+	g_perf_cycles_shift = 0;
+	gs_state = PERF_HIGH;
+	perf_reset();
+}
+
+/**
+ * \brief Pede o clock maximo para um desenho pesado. Barata quando ja esta
+ * em PERF_HIGH.
+ */
+void perf_boost(void)
+{
+#if defined(__arm__)
+	/* de uma interrupcao nao: o main loop pode estar no meio de uma
+	 * leitura do maXTouch */
+	if (__get_IPSR() != 0) {
+		return;
+	}
+#endif
+	gs_boosts++;
+	if (gs_policy == PERF_POLICY_ONDEMAND) {
+		set_state(PERF_HIGH);
+	}
+}
+
+/**
+ * \brief Volta ao clock baixo; chamada pelo main loop antes de dormir.
+ *
+ * Com bytes na console a troca fica para a proxima vez: o anel seria
+ * esvaziado com as interrupcoes desligadas.
+ */
+void perf_relax(void)
+{
+	if (gs_policy != PERF_POLICY_ONDEMAND || gs_state == PERF_LOW) {
+		return;
+	}
+	if (console_tx_busy()) {
+		gs_relax_busy++;
+		return;
+	}
+	set_state(PERF_LOW);
+}
+
+void perf_set_policy(int policy)
+{
+	if (policy < 0 || policy >= PERF_POLICY_COUNT) {
+		return;
+	}
+	gs_policy = policy;
+	set_state(policy == PERF_POLICY_LOW ? PERF_LOW : PERF_HIGH);
+}
+
+/**
+ * \brief Clock do processador no estado atual (no host, sempre o nominal).
+ */
+uint32_t perf_cpu_hz(void)
+{
+#if defined(__arm__)
+	if (gs_state == PERF_LOW) {
+		return sysclk_get_cpu_hz() / PERF_LOW_DIV;
+	}
+#endif
+	return sysclk_get_cpu_hz();
+}
+
+uint32_t perf_mck_hz(void)
+{
+#if defined(__arm__)
+	if (gs_state == PERF_LOW) {
+		return sysclk_get_peripheral_hz() / PERF_LOW_DIV;
+	}
+#endif
+	return sysclk_get_peripheral_hz();
+}
+
+void perf_get_stats(perf_stats_t *stats)
+{
+	irqflags_t flags = cpu_irq_save();
+	int i;
+
+	stats->policy = gs_policy;
+	stats->state = gs_state;
+	for (i = 0; i < PERF_STATE_COUNT; i++) {
+		stats->entries[i] = gs_entries[i];
+	}
+	stats->boosts = gs_boosts;
+	stats->relax_busy = gs_relax_busy;
+
+	cpu_irq_restore(flags);
+}
+
+void perf_reset(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	int i;
+
+	for (i = 0; i < PERF_STATE_COUNT; i++) {
+		gs_entries[i] = 0;
+	}
+	gs_boosts = 0;
+	gs_relax_busy = 0;
+
+	cpu_irq_restore(flags);
+}
+
+void perf_dump(void)
+{
+	perf_stats_t s;
+
+	perf_get_stats(&s);
+	printf("\n\rperf: politica %s, estado %s, %lu MHz\n\r",
+			gs_policy_names[s.policy], s.state == PERF_HIGH ? "high" : "low",
+			(unsigned long)(perf_cpu_hz() / 1000000));
+	printf("  trocas: high %lu low %lu  boosts %lu  relax adiados %lu\n\r",
+			(unsigned long)s.entries[PERF_HIGH], (unsigned long)s.entries[PERF_LOW],
+			(unsigned long)s.boosts, (unsigned long)s.relax_busy);
+}
+
+/**
+ * \brief Passa para a proxima politica (comando 'g' da serial).
+ */
+void perf_next_policy(void)
+{
+	perf_set_policy((gs_policy + 1) % PERF_POLICY_COUNT);
+}
@@ -0,0 +1,82 @@
+/*
+ * perf.h
+ *
+ * Created: 18/10/2026
+ *
+ * Governador de clock: dois estados de desempenho, trocados pelo prescaler
+ * do clock do processador (PMC_MCKR.PRES).
+ *
+ *  PERF_HIGH  clock do conf_clock.h (300 MHz no core, 150 MHz de MCK)
+ *  PERF_LOW   os dois divididos por PERF_LOW_DIV
+ *
+ * Na politica PERF_POLICY_ONDEMAND os desenhos pesados (sprite_draw,
+ * sprite_draw_indexed, draw_screen) chamam perf_boost() e o main loop chama
+ * perf_relax() antes de dormir: a tela parada fica em PERF_LOW. A cada troca
+ * os divisores que dependem do MCK (SCBR do SPI do LCD, TWIHS do maXTouch e
+ * baud da console) sao refeitos com as interrupcoes desligadas, entao
+ * nenhum periferico ve o clock novo com o divisor antigo. A base de tempo
+ * (timebase.h) conta o PCK6, que vem direto do MAINCK e nao muda.
+ *
+ * O DWT->CYCCNT conta no clock da CPU em vigor. perf_cycles() da os mesmos
+ * ciclos na escala do PERF_HIGH (um ciclo de PERF_LOW vale PERF_LOW_DIV),
+ * para as medidas em ciclos (prof.h, latencia do idle) convertidas com
+ * sysclk_get_cpu_hz() valerem nos dois estados, mesmo com uma troca no meio.
+ *
+ * 'g' pela serial troca a politica e imprime os contadores. No build de host
+ * o clock nao muda: so a politica e os contadores funcionam.
+ */
+
+
+#ifndef PERF_H_
+#define PERF_H_
+
+#include <stdint.h>
+#include "cycles.h"
+
+/* Divisor do PERF_LOW: 2, 4, 8, 16, 32 ou 64 */
+#define PERF_LOW_DIV        4
+
+enum {
+	PERF_LOW,
+	PERF_HIGH,
+	PERF_STATE_COUNT
+};
+
+enum {
+	PERF_POLICY_ONDEMAND,   // PERF_LOW parado, PERF_HIGH desenhando
+	PERF_POLICY_HIGH,       // sempre PERF_HIGH (como antes do governador)
+	PERF_POLICY_LOW,        // sempre PERF_LOW
+	PERF_POLICY_COUNT
+};
+
+typedef struct {
+	int policy;
+	int state;
+	uint32_t entries[PERF_STATE_COUNT];     // trocas para cada estado
+	uint32_t boosts;            // chamadas de perf_boost()
+	uint32_t relax_busy;        // perf_relax() adiados pela console ocupada
+} perf_stats_t;
+
+/* Escala de perf_cycles(), refeita por set_state() a cada troca */
+extern uint32_t g_perf_cycles_base;
+extern uint32_t g_perf_cycles_mark;
+extern uint32_t g_perf_cycles_shift;
+
+/** Ciclos no clock do PERF_HIGH; volta a zero como o CYCCNT */
+static inline uint32_t perf_cycles(void)
+{
+	return g_perf_cycles_base + ((cycles_now() - g_perf_cycles_mark) << g_perf_cycles_shift);
+}
+
+void perf_init(void);
+void perf_boost(void);
+void perf_relax(void);
+void perf_set_policy(int policy);
+void perf_next_policy(void);
+uint32_t perf_cpu_hz(void);
+uint32_t perf_mck_hz(void);
+void perf_get_stats(perf_stats_t *stats);
+void perf_reset(void);
+void perf_dump(void);
+
+#endif /* PERF_H_ */
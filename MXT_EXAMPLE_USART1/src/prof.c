@@ -0,0 +1,151 @@
+/*
+ * prof.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "prof.h"
+
+#if defined(__arm__)
+#include <asf.h>
+#include "console.h"
+#include "tcm.h"
+
+#define PROF_LOCK()         irqflags_t flags = cpu_irq_save()
+#define PROF_UNLOCK()       cpu_irq_restore(flags)
+#define PROF_UNIT           "ciclos"
+#define prof_unit_hz()      sysclk_get_cpu_hz()
+#else
+#define TCM_CODE
+#define PROF_LOCK()         do { } while (0)
+#define PROF_UNLOCK()       do { } while (0)
+#define PROF_UNIT           "ns"
+#define prof_unit_hz()      1000000000u
+#endif
+
+static prof_zone_t gs_zones[PROF_ZONE_COUNT];
+
+static const char *const gs_names[PROF_ZONE_COUNT] = {
+#define PROF_ZONE(name, desc) #name,
+#include "prof_zones.h"
+#undef PROF_ZONE
+};
+
+static const char *const gs_descs[PROF_ZONE_COUNT] = {
+#define PROF_ZONE(name, desc) desc,
+#include "prof_zones.h"
+#undef PROF_ZONE
+};
+
+void prof_init(void)
+{
+#if defined(__arm__)
+	cycles_init();
+#endif
+	prof_reset();
+}
+
+/**
+ * \brief Acumula uma medida de \a elapsed ciclos na zona.
+ *
+ * Chamada de interrupcoes e do main loop; a atualizacao e curta e fica com
+ * as interrupcoes desligadas para uma zona usada nos dois (font_draw_text)
+ * nao perder medidas.
+ */
+TCM_CODE void prof_record(int zone, uint32_t elapsed)
+{
+	prof_zone_t *z = &gs_zones[zone];
+	int bucket = elapsed ? 31 - __builtin_clz(elapsed) : 0;
+	PROF_LOCK();
+
+	if (elapsed < z->min) {
+		z->min = elapsed;
+	}
+	if (elapsed > z->max) {
+		z->max = elapsed;
+	}
+	z->count++;
+	z->total += elapsed;
+	z->hist[bucket]++;
+
+	PROF_UNLOCK();
+}
+
+/**
+ * \brief Acumula uma medida em microssegundos, convertida para a unidade do
+ * contador (satura em UINT32_MAX, ~14 s em ciclos).
+ */
+void prof_record_us(int zone, uint64_t us)
+{
+	uint64_t units = us * (prof_unit_hz() / 1000000u);
+
+	prof_record(zone, units > UINT32_MAX ? UINT32_MAX : (uint32_t)units);
+}
+
+void prof_reset(void)
+{
+	int i;
+	PROF_LOCK();
+
+	memset(gs_zones, 0, sizeof(gs_zones));
+	for (i = 0; i < PROF_ZONE_COUNT; i++) {
+		gs_zones[i].min = UINT32_MAX;
+	}
+
+	PROF_UNLOCK();
+}
+
+void prof_get(int zone, prof_zone_t *out)
+{
+	PROF_LOCK();
+	*out = gs_zones[zone];
+	PROF_UNLOCK();
+}
+
+/* Unidades do contador para microssegundos, com 3 casas */
+static void print_us(uint32_t units)
+{
+	uint32_t ns = (uint32_t)((uint64_t)units * 1000000000u / prof_unit_hz());
+
+	printf("%5lu.%03lu", (unsigned long)(ns / 1000), (unsigned long)(ns % 1000));
+}
+
+/**
+ * \brief Imprime as estatisticas de todas as zonas usadas (tempos em us,
+ * histograma em potencias de 2 de PROF_UNIT).
+ */
+void prof_dump(void)
+{
+	prof_zone_t z;
+	int i, b;
+
+#if defined(__arm__)
+	/* a tabela passa do tamanho do anel da console: espera em vez de cortar */
+	console_set_overflow(CONSOLE_OVERFLOW_BLOCK);
+#endif
+	printf("\n\rzona         chamadas     min us    media us     max us\n\r");
+	for (i = 0; i < PROF_ZONE_COUNT; i++) {
+		prof_get(i, &z);
+		if (z.count == 0) {
+			continue;
+		}
+		printf("%-12s %8lu ", gs_names[i], (unsigned long)z.count);
+		print_us(z.min);
+		printf("   ");
+		print_us((uint32_t)(z.total / z.count));
+		printf("  ");
+		print_us(z.max);
+		printf("  %s\n\r   " PROF_UNIT " <", gs_descs[i]);
+		for (b = 0; b < PROF_HIST_BUCKETS; b++) {
+			if (z.hist[b]) {
+				printf(" 2^%d:%lu", b + 1, (unsigned long)z.hist[b]);
+			}
+		}
+		printf("\n\r");
+	}
+#if defined(__arm__)
+	console_set_overflow(CONSOLE_OVERFLOW_DROP);
+#endif
+}
@@ -0,0 +1,88 @@
+/*
+ * prof.h
+ *
+ * Created: 18/10/2026
+ *
+ * Profiling por zonas com o contador de ciclos (DWT->CYCCNT, na escala do
+ * clock nominal: perf_cycles()).
+ *
+ *     PROF_BEGIN(blit);
+ *     ...
+ *     PROF_END(blit);
+ *
+ * Cada zona guarda contagem, minimo, maximo, soma (para a media) e um
+ * histograma log2 das duracoes: hist[i] conta as medidas em [2^i, 2^(i+1))
+ * ciclos. prof_dump() imprime tudo pela console; no main loop isso e
+ * pedido mandando 'p' pela serial ('r' zera as estatisticas).
+ *
+ * Fora do ARM (build de host) a mesma API mede nanossegundos com
+ * clock_gettime.
+ *
+ * Duracoes medidas de outro jeito (em us de now_us(), como os marcos do
+ * boot) entram com PROF_RECORD_US(zona, us).
+ */
+
+
+#ifndef PROF_H_
+#define PROF_H_
+
+#include <stdint.h>
+
+/* Comente para compilar sem as medidas (PROF_BEGIN/PROF_END somem) */
+#define PROF_ENABLE
+
+#define PROF_HIST_BUCKETS   32
+
+typedef struct {
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+	uint32_t hist[PROF_HIST_BUCKETS];
+} prof_zone_t;
+
+enum {
+#define PROF_ZONE(name, desc) PROF_ ## name,
+#include "prof_zones.h"
+#undef PROF_ZONE
+	PROF_ZONE_COUNT
+};
+
+#if defined(__arm__)
+#include "perf.h"
+
+/* Ciclos na escala do PERF_HIGH: o governador nao muda a unidade */
+static inline uint32_t prof_now(void)
+{
+	return perf_cycles();
+}
+#else
+#include <time.h>
+
+static inline uint32_t prof_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec);
+}
+#endif
+
+void prof_init(void);
+void prof_record(int zone, uint32_t elapsed);
+void prof_record_us(int zone, uint64_t us);
+void prof_reset(void);
+void prof_get(int zone, prof_zone_t *out);
+void prof_dump(void);
+
+#ifdef PROF_ENABLE
+#define PROF_BEGIN(zone)    uint32_t prof_t0_ ## zone = prof_now()
+#define PROF_END(zone)      prof_record(PROF_ ## zone, prof_now() - prof_t0_ ## zone)
+#define PROF_RECORD_US(zone, us)    prof_record_us(PROF_ ## zone, (us))
+#else
+#define PROF_BEGIN(zone)    do { } while (0)
+#define PROF_END(zone)      do { } while (0)
+#define PROF_RECORD_US(zone, us)    do { } while (0)
+#endif
+
+#endif /* PROF_H_ */
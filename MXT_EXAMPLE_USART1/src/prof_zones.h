@@ -0,0 +1,21 @@
+/*
+ * prof_zones.h
+ *
+ * Created: 18/10/2026
+ *
+ * Zonas de profiling: PROF_ZONE(nome, "descricao"). Usadas com
+ * PROF_BEGIN(nome) / PROF_END(nome) (prof.h).
+ */
+
+/* sem include guard: incluido mais de uma vez com PROF_ZONE diferente */
+
+PROF_ZONE(blit,       "sprite_draw/sprite_draw_indexed")
+PROF_ZONE(font,       "font_draw_text")
+PROF_ZONE(mxt,        "mxt_handler")
+PROF_ZONE(isr_timer,  "timer_run")
+PROF_ZONE(timer_op,   "timer_start/timer_stop")
+PROF_ZONE(isr_usart,  "USART1_Handler")
+PROF_ZONE(isr_button, "but_callback")
+PROF_ZONE(boot_pixel, "boot ate o primeiro pixel")
+PROF_ZONE(boot_touch, "boot ate o primeiro toque")
+PROF_ZONE(touch_filter, "touch_filter_run")
@@ -0,0 +1,90 @@
+/*
+ * spi_bench.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include <string.h>
+#include "spi_bench.h"
+
+#ifdef SPI_BENCH
+
+#include "conf_ili9488.h"
+#include "cycles.h"
+
+#define BENCH_ROWS       16
+#define BENCH_BYTES      (ILI9488_LCD_WIDTH * BENCH_ROWS * 3)
+#define BENCH_RUNS       16
+
+enum {
+	BENCH_PACKET,
+	BENCH_STREAM,
+	BENCH_REPEAT,
+};
+
+/* Faixa branca: a tela fica limpa onde o teste passou */
+static uint8_t gs_band[BENCH_BYTES];
+
+static void bench_spi(const char *name, int mode)
+{
+	static const uint8_t white[3] = { 0xFC, 0xFC, 0xFC };
+	uint32_t start, cycles;
+	uint64_t bytes = (uint64_t)BENCH_BYTES * BENCH_RUNS;
+	int i;
+
+	ili9488_blit_begin(0, 0, ILI9488_LCD_WIDTH, BENCH_ROWS);
+	pio_set_pin_high(LCD_SPI_CDS_PIO);
+
+	start = cycles_now();
+	for (i = 0; i < BENCH_RUNS; i++) {
+		switch (mode) {
+		case BENCH_PACKET:
+			spi_write_packet(BOARD_ILI9488_SPI, gs_band, BENCH_BYTES);
+			break;
+		case BENCH_STREAM:
+			spi_write_stream(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, gs_band, BENCH_BYTES);
+			break;
+		default:
+			spi_write_repeat(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, white, 3,
+					BENCH_BYTES / 3);
+			break;
+		}
+	}
+	/* spi_write_packet() volta com o ultimo byte ainda no registrador */
+	while (!spi_is_tx_empty(BOARD_ILI9488_SPI)) {
+	}
+	cycles = cycles_now() - start;
+
+	ili9488_blit_end();
+
+	printf("spi %-7s %8lu bytes/s  (%lu%% do barramento)\n\r", name,
+			(unsigned long)(bytes * sysclk_get_cpu_hz() / Max(cycles, 1u)),
+			(unsigned long)(bytes * 8 * 100 * sysclk_get_cpu_hz() /
+					((uint64_t)Max(cycles, 1u) * ILI9488_SPI_BAUDRATE)));
+}
+
+/**
+ * \brief Imprime a vazao de cada caminho de escrita do SPI na serial.
+ *
+ * Desenha uma faixa branca no topo da tela.
+ */
+void spi_bench_run(void)
+{
+	cycles_init();
+	memset(gs_band, 0xFC, sizeof(gs_band));
+
+	printf("spi limite  %8lu bytes/s\n\r", (unsigned long)(ILI9488_SPI_BAUDRATE / 8));
+	bench_spi("packet", BENCH_PACKET);
+	bench_spi("stream", BENCH_STREAM);
+	bench_spi("repeat", BENCH_REPEAT);
+}
+
+#else
+
+void spi_bench_run(void)
+{
+}
+
+#endif /* SPI_BENCH */
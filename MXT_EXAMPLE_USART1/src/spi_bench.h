@@ -0,0 +1,20 @@
+/*
+ * spi_bench.h
+ *
+ * Created: 18/10/2026
+ *
+ * Vazao do SPI do LCD, em bytes/s: spi_write_packet() do ASF contra
+ * spi_write_stream() e spi_write_repeat() (quadros de 16 bits), com o
+ * limite do barramento em ILI9488_SPI_BAUDRATE para comparar.
+ */
+
+
+#ifndef SPI_BENCH_H_
+//#define SPI_BENCH_H_
+
+/* Descomente para medir a vazao do SPI do LCD no boot */
+//#define SPI_BENCH
+
+void spi_bench_run(void);
+
+#endif /* SPI_BENCH_H_ */
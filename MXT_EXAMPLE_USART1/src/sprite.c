@@ -0,0 +1,265 @@
+/*
+ * sprite.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "sprite.h"
+#include "tcm.h"
+#include "prof.h"
+#include "perf.h"
+
+/* Buffer de composicao: 16 linhas da tela por vez */
+#define SPRITE_BAND_LINES   16
+#define SPRITE_BAND_SIZE    (ILI9488_LCD_WIDTH * LCD_DATA_COLOR_UNIT * SPRITE_BAND_LINES)
+
+/* Na DTCM: a CPU monta a faixa sem passar pelo D-cache */
+static TCM_BSS ili9488_color_t gs_band[SPRITE_BAND_SIZE];
+
+/* Imagens de 4 bpp: cada byte (dois pixels) vira 6 bytes de uma vez. A tabela
+ * e refeita so quando a paleta muda. */
+static TCM_BSS uint8_t gs_pair_lut[256][6];
+static const uint8_t *gs_pair_palette;
+
+/* (s * a + d * (255 - a)) / 255 com arredondamento, sem divisao */
+static inline uint8_t blend_channel(uint8_t s, uint8_t d, uint8_t a)
+{
+	uint32_t x = (uint32_t)s * a + (uint32_t)d * (255 - a) + 128;
+	return (uint8_t)((x + (x >> 8)) >> 8);
+}
+
+static TCM_CODE void fill_background_row(uint8_t *dst, int x, int y, int width,
+		const tBackground *bg)
+{
+	const tImage *img = bg->image;
+	uint8_t r = bg->color >> 16;
+	uint8_t g = bg->color >> 8;
+	uint8_t b = bg->color;
+	int i = 0;
+
+	if (img != NULL) {
+		int iy = y - bg->y;
+		int ix = x - bg->x;
+
+		if (iy >= 0 && iy < img->height) {
+			const uint8_t *src = img->data + (iy * img->width) * 3;
+
+			for (; i < width && ix + i < 0; i++) {
+				*dst++ = r; *dst++ = g; *dst++ = b;
+			}
+			if (i < width && ix + i < img->width) {
+				int n = Min(width - i, img->width - (ix + i));
+				memcpy(dst, src + (ix + i) * 3, n * 3);
+				dst += n * 3;
+				i += n;
+			}
+		}
+	}
+
+	for (; i < width; i++) {
+		*dst++ = r; *dst++ = g; *dst++ = b;
+	}
+}
+
+static TCM_CODE void build_pair_lut(const uint8_t *palette)
+{
+	int i;
+
+	if (gs_pair_palette == palette) {
+		return;
+	}
+	for (i = 0; i < 256; i++) {
+		memcpy(&gs_pair_lut[i][0], palette + (i >> 4) * 3, 3);
+		memcpy(&gs_pair_lut[i][3], palette + (i & 0x0f) * 3, 3);
+	}
+	gs_pair_palette = palette;
+}
+
+/* Expande os pixels [first, first + count) da linha row para RGB888 */
+static TCM_CODE void expand_indexed_row(uint8_t *dst, const tIndexedImage *img,
+		const uint8_t *palette, int row, int first, int count)
+{
+	const uint8_t *src;
+	const uint8_t *c;
+
+	if (img->bpp == 8) {
+		src = img->data + row * img->width + first;
+		while (count--) {
+			c = palette + *src++ * 3;
+			*dst++ = c[0]; *dst++ = c[1]; *dst++ = c[2];
+		}
+		return;
+	}
+
+	build_pair_lut(palette);
+	src = img->data + row * ((img->width + 1) / 2) + first / 2;
+	if ((first & 1) && count > 0) {
+		memcpy(dst, &gs_pair_lut[*src++][3], 3);
+		dst += 3;
+		count--;
+	}
+	for (; count >= 2; count -= 2, dst += 6) {
+		memcpy(dst, gs_pair_lut[*src++], 6);
+	}
+	if (count) {
+		memcpy(dst, gs_pair_lut[*src], 3);
+	}
+}
+
+static TCM_CODE void blend_sprite_row(uint8_t *dst, int width, const tSprite *sprite,
+		int row, int col)
+{
+	const tImage *img = sprite->image;
+	int img_w = sprite->format == SPRITE_FORMAT_INDEXED ? sprite->indexed->width : img->width;
+	int img_h = sprite->format == SPRITE_FORMAT_INDEXED ? sprite->indexed->height : img->height;
+	int i0 = Max(0, col);
+	int i1 = Min(width, col + img_w);
+	int i;
+
+	if (row < 0 || row >= img_h || i0 >= i1) {
+		return;
+	}
+
+	dst += i0 * 3;
+
+	switch (sprite->format) {
+	case SPRITE_FORMAT_OPAQUE:
+		memcpy(dst, img->data + (row * img->width + (i0 - col)) * 3, (i1 - i0) * 3);
+		break;
+
+	case SPRITE_FORMAT_KEYED: {
+		const uint8_t *src = img->data + (row * img->width + (i0 - col)) * 3;
+		uint8_t kr = sprite->key >> 16;
+		uint8_t kg = sprite->key >> 8;
+		uint8_t kb = sprite->key;
+
+		for (i = i0; i < i1; i++, src += 3, dst += 3) {
+			if (src[0] != kr || src[1] != kg || src[2] != kb) {
+				dst[0] = src[0];
+				dst[1] = src[1];
+				dst[2] = src[2];
+			}
+		}
+		break;
+	}
+
+	case SPRITE_FORMAT_RGBA: {
+		const uint8_t *src = img->data + (row * img->width + (i0 - col)) * 4;
+
+		for (i = i0; i < i1; i++, src += 4, dst += 3) {
+			uint8_t a = src[3];
+			if (a == 255) {
+				dst[0] = src[0];
+				dst[1] = src[1];
+				dst[2] = src[2];
+			} else if (a != 0) {
+				dst[0] = blend_channel(src[0], dst[0], a);
+				dst[1] = blend_channel(src[1], dst[1], a);
+				dst[2] = blend_channel(src[2], dst[2], a);
+			}
+		}
+		break;
+	}
+
+	case SPRITE_FORMAT_INDEXED:
+		expand_indexed_row(dst, sprite->indexed,
+				sprite->palette ? sprite->palette : sprite->indexed->palette,
+				row, i0 - col, i1 - i0);
+		break;
+
+	default:
+		break;
+	}
+}
+
+/**
+ * \brief Desenha o retangulo (x, y, width, height) com o sprite composto
+ * sobre o fundo.
+ *
+ * O retangulo e montado linha a linha no buffer de faixa e enviado numa unica
+ * escrita de memoria do LCD, entao a regiao passa pelo barramento uma vez so,
+ * em vez de um preenchimento seguido do icone.
+ *
+ * \param x, y, width, height Regiao da tela a ser redesenhada.
+ * \param bg Fundo da regiao.
+ * \param sprite Sprite a compor, ou NULL para desenhar so o fundo.
+ * \param sprite_x, sprite_y Posicao do sprite relativa a regiao.
+ */
+TCM_CODE void sprite_draw(int x, int y, int width, int height, const tBackground *bg,
+		const tSprite *sprite, int sprite_x, int sprite_y)
+{
+	int row_bytes = width * LCD_DATA_COLOR_UNIT;
+	int lines_per_band = SPRITE_BAND_SIZE / row_bytes;
+	int row = 0;
+
+	if (width <= 0 || height <= 0 || lines_per_band == 0) {
+		return;
+	}
+
+	perf_boost();
+	PROF_BEGIN(blit);
+	ili9488_blit_begin(x, y, width, height);
+
+	while (row < height) {
+		int lines = Min(lines_per_band, height - row);
+		uint8_t *dst = gs_band;
+		int l;
+
+		for (l = 0; l < lines; l++, row++, dst += row_bytes) {
+			fill_background_row(dst, x, y + row, width, bg);
+			if (sprite != NULL) {
+				blend_sprite_row(dst, width, sprite, row - sprite_y, sprite_x);
+			}
+		}
+
+		ili9488_blit_write(gs_band, lines * row_bytes);
+	}
+
+	ili9488_blit_end();
+	PROF_END(blit);
+}
+
+/**
+ * \brief Desenha uma imagem indexada em (x, y).
+ *
+ * Os indices sao expandidos pela paleta direto no buffer de faixa, que e
+ * enviado ao LCD; da flash so sao lidos bpp/8 bytes por pixel.
+ *
+ * \param img Imagem indexada.
+ * \param palette Paleta RGB888 a usar, ou NULL para a da imagem.
+ */
+TCM_CODE void sprite_draw_indexed(int x, int y, const tIndexedImage *img,
+		const uint8_t *palette)
+{
+	int row_bytes = img->width * LCD_DATA_COLOR_UNIT;
+	int lines_per_band = SPRITE_BAND_SIZE / row_bytes;
+	int row = 0;
+
+	if (palette == NULL) {
+		palette = img->palette;
+	}
+	if (img->width <= 0 || img->height <= 0 || lines_per_band == 0) {
+		return;
+	}
+
+	perf_boost();
+	PROF_BEGIN(blit);
+	ili9488_blit_begin(x, y, img->width, img->height);
+
+	while (row < img->height) {
+		int lines = Min(lines_per_band, img->height - row);
+		uint8_t *dst = gs_band;
+		int l;
+
+		for (l = 0; l < lines; l++, row++, dst += row_bytes) {
+			expand_indexed_row(dst, img, palette, row, 0, img->width);
+		}
+
+		ili9488_blit_write(gs_band, lines * row_bytes);
+	}
+
+	ili9488_blit_end();
+	PROF_END(blit);
+}
@@ -0,0 +1,50 @@
+/*
+ * sprite.h
+ *
+ * Created: 18/10/2026
+ *
+ * Sprites com transparencia (chave de cor ou canal alfa) compostos sobre
+ * um fundo (cor solida ou outra imagem) num buffer de faixa, e enviados ao
+ * LCD numa unica escrita de memoria.
+ *
+ * Imagens indexadas (tIndexedImage) sao expandidas pela paleta no mesmo
+ * buffer; trocar a paleta troca as cores sem outro bitmap.
+ */
+
+
+#ifndef SPRITE_H_
+#define SPRITE_H_
+
+#include <stdint.h>
+#include "tfont.h"
+
+/** RGB888, todo pixel e desenhado. */
+#define SPRITE_FORMAT_OPAQUE   0
+/** RGB888, pixels iguais a \ref tSprite::key sao transparentes. */
+#define SPRITE_FORMAT_KEYED    1
+/** RGBA8888, alfa por pixel (0 = transparente, 255 = opaco). */
+#define SPRITE_FORMAT_RGBA     2
+/** tIndexedImage (4 ou 8 bpp), expandida pela paleta; todo pixel e desenhado. */
+#define SPRITE_FORMAT_INDEXED  3
+
+typedef struct {
+	const tImage *image;
+	uint8_t format;        // SPRITE_FORMAT_*
+	uint32_t key;          // cor transparente (RGB888) em SPRITE_FORMAT_KEYED
+	const tIndexedImage *indexed;  // imagem em SPRITE_FORMAT_INDEXED
+	const uint8_t *palette;        // paleta usada no lugar de indexed->palette, ou NULL
+} tSprite;
+
+typedef struct {
+	const tImage *image;   // NULL para cor solida
+	uint32_t color;        // RGB888, usada fora da imagem ou quando image == NULL
+	int x;                 // posicao da imagem na tela
+	int y;
+} tBackground;
+
+void sprite_draw(int x, int y, int width, int height, const tBackground *bg,
+		const tSprite *sprite, int sprite_x, int sprite_y);
+void sprite_draw_indexed(int x, int y, const tIndexedImage *img,
+		const uint8_t *palette);
+
+#endif /* SPRITE_H_ */
@@ -0,0 +1,40 @@
+/*
+ * tcm.h
+ *
+ * Created: 18/10/2026
+ *
+ * Colocacao de codigo e dados nas memorias TCM do Cortex-M7.
+ *
+ * Com CONF_BOARD_ENABLE_TCM_AT_INIT (conf_board.h) o board_init() liga
+ * 32 KB de ITCM (0x00000000) e 32 KB de DTCM (0x20000000), copia a secao
+ * .itcm da flash para a ITCM e zera a secao .dtcm (ver flash.ld). Sem a
+ * opcao as macros nao fazem nada e tudo fica na flash/SRAM como antes, o
+ * que permite comparar as duas versoes com tcm_bench_run().
+ *
+ *  TCM_CODE  funcoes chamadas a cada pixel, linha ou interrupcao: rodam
+ *            sem esperas da flash e sem depender do I-cache.
+ *  TCM_BSS   buffers e filas sem valor inicial (zerados no boot): acesso
+ *            de um ciclo, fora do D-cache, entao DMA e CPU enxergam os
+ *            mesmos dados sem limpar/invalidar cache.
+ */
+
+
+#ifndef TCM_H_
+#define TCM_H_
+
+#include "conf_board.h"
+
+#ifdef CONF_BOARD_ENABLE_TCM_AT_INIT
+#define TCM_CODE    __attribute__((section(".itcm"), noinline))
+#define TCM_BSS     __attribute__((section(".dtcm")))
+#else
+#define TCM_CODE
+#define TCM_BSS
+#endif
+
+/* Descomente para medir latencia de interrupcao e vazao do blit no boot */
+//#define TCM_BENCH
+
+void tcm_bench_run(void);
+
+#endif /* TCM_H_ */
@@ -16,6 +16,16 @@ typedef struct {
 	int other;
 } tImage;
 
+/* Imagem indexada: bpp (4 ou 8) bits por pixel, linhas alinhadas em byte
+ * (4 bpp: pixel da esquerda no nibble alto) e paleta RGB888 de 2^bpp cores. */
+typedef struct {
+	const uint8_t *data;
+	int width;
+	int height;
+	int bpp;
+	const uint8_t *palette;
+} tIndexedImage;
+
  typedef struct {
 	 long int code;
 	 const tImage *image;
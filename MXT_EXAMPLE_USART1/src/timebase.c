@@ -0,0 +1,203 @@
+/*
+ * timebase.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include "timebase.h"
+#include "timer.h"
+#include "idle.h"
+#include "tcm.h"
+
+#define TB_TC           TC1
+#define TB_LO           0       // canal 0 do TC1 (ID_TC3): 16 bits de baixo
+#define TB_HI           1       // canal 1 do TC1 (ID_TC4): 16 bits do meio
+#define TB_LO_ID        ID_TC3
+#define TB_HI_ID        ID_TC4
+#define TB_LO_IRQn      TC3_IRQn
+#define TB_HI_IRQn      TC4_IRQn
+#define TB_LO_Handler   TC3_Handler
+#define TB_HI_Handler   TC4_Handler
+
+/* PCK6 = MAINCK / 12 = 1 MHz (o PRES divide por PRES + 1) */
+#define TB_PCK_PRES     (BOARD_FREQ_MAINCK_XTAL / 1000000 - 1)
+
+/* O TIOA0 sobe no meio da volta do canal 0 (RA) e desce no fim (RC) */
+#define TB_HALF         0x8000u
+
+/* O canal 1 ve a subida do TIOA0 alguns ciclos de MCK depois do RA: perto
+ * dele a leitura e repetida */
+#define TB_SYNC_US      2
+
+/* Prioridade do alarme (a do RTC que ele substitui); os estouros do canal 1
+ * nao podem ser preemptados entre a entrada e o incremento da epoca */
+#define TB_ALARM_PRIO   5
+#define TB_EPOCH_PRIO   0
+
+static volatile uint32_t gs_epoch;      // estouros do canal 1
+static int64_t gs_offset;               // zero no boot mais o tempo no WAIT
+static uint64_t gs_alarm = UINT64_MAX;  // em now_us()
+
+/* Contagem do TC em us; chamada com as interrupcoes desligadas */
+static TCM_CODE uint64_t hw_now(void)
+{
+	uint32_t hi, lo, e;
+
+	do {
+		hi = TB_TC->TC_CHANNEL[TB_HI].TC_CV;
+		lo = TB_TC->TC_CHANNEL[TB_LO].TC_CV;
+	} while (hi != TB_TC->TC_CHANNEL[TB_HI].TC_CV || lo - TB_HALF < TB_SYNC_US);
+
+	e = gs_epoch;
+	/* estouro do canal 1 ainda nao atendido */
+	if (hi < TB_HALF && NVIC_GetPendingIRQ(TB_HI_IRQn)) {
+		e++;
+	}
+	/* hi conta as passagens por TB_HALF: a da volta atual so conta da
+	 * metade em diante */
+	return ((((uint64_t)e << 16) | hi) - (lo >= TB_HALF)) << 16 | lo;
+}
+
+/* Programa o RB no alarme ou numa etapa a meia volta; interrupcoes
+ * desligadas */
+static TCM_CODE void program(void)
+{
+	uint64_t at = gs_alarm - gs_offset;
+	uint64_t now = hw_now();
+
+	if (at > now + TB_HALF) {
+		at = now + TB_HALF;
+	}
+	tc_write_rb(TB_TC, TB_LO, (uint32_t)at & 0xFFFF);
+	tc_enable_interrupt(TB_TC, TB_LO, TC_IER_CPBS);
+	/* o RB so dispara na igualdade: se ja passou, dispara agora */
+	if (hw_now() >= at) {
+		NVIC_SetPendingIRQ(TB_LO_IRQn);
+	}
+}
+
+/* Alarme vencido ou etapa */
+static TCM_CODE void alarm_expired(void)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	if (gs_alarm == UINT64_MAX) {
+		cpu_irq_restore(flags);
+		return;
+	}
+	if (hw_now() + gs_offset < gs_alarm) {
+		program();
+		cpu_irq_restore(flags);
+		return;
+	}
+	gs_alarm = UINT64_MAX;
+	tc_disable_interrupt(TB_TC, TB_LO, TC_IDR_CPBS);
+	cpu_irq_restore(flags);
+
+	timer_run();
+}
+
+TCM_CODE void TB_LO_Handler(void)
+{
+	volatile uint32_t ul_dummy = tc_get_status(TB_TC, TB_LO);
+
+	UNUSED(ul_dummy);
+	idle_wake(IDLE_WAKE_TIMER);
+	alarm_expired();
+}
+
+TCM_CODE void TB_HI_Handler(void)
+{
+	volatile uint32_t ul_dummy = tc_get_status(TB_TC, TB_HI);
+
+	UNUSED(ul_dummy);
+	gs_epoch++;
+}
+
+void timebase_init(void)
+{
+	irqflags_t flags;
+
+	pmc_switch_pck_to_mainck(PMC_PCK_6, PMC_PCK_PRES(TB_PCK_PRES));
+	pmc_enable_pck(PMC_PCK_6);
+	pmc_enable_periph_clk(TB_LO_ID);
+	pmc_enable_periph_clk(TB_HI_ID);
+
+	/* canal 0: 0..0xFFFF livre no PCK6 (TIMER_CLOCK1) */
+	tc_init(TB_TC, TB_LO, TC_CMR_TCCLKS_TIMER_CLOCK1 | TC_CMR_WAVE |
+			TC_CMR_WAVSEL_UP | TC_CMR_ACPA_SET | TC_CMR_ACPC_CLEAR);
+	tc_write_ra(TB_TC, TB_LO, TB_HALF);
+	tc_write_rc(TB_TC, TB_LO, 0);
+
+	/* canal 1: conta as subidas do TIOA0 */
+	tc_set_block_mode(TB_TC, TC_BMR_TC1XC1S_TIOA0);
+	tc_init(TB_TC, TB_HI, TC_CMR_TCCLKS_XC1);
+	tc_enable_interrupt(TB_TC, TB_HI, TC_IER_COVFS);
+
+	NVIC_ClearPendingIRQ(TB_LO_IRQn);
+	NVIC_SetPriority(TB_LO_IRQn, TB_ALARM_PRIO);
+	NVIC_EnableIRQ(TB_LO_IRQn);
+	NVIC_ClearPendingIRQ(TB_HI_IRQn);
+	NVIC_SetPriority(TB_HI_IRQn, TB_EPOCH_PRIO);
+	NVIC_EnableIRQ(TB_HI_IRQn);
+
+	tc_start(TB_TC, TB_HI);
+	tc_start(TB_TC, TB_LO);
+
+	flags = cpu_irq_save();
+	gs_offset = -(int64_t)hw_now();
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Microssegundos desde timebase_init().
+ */
+TCM_CODE uint64_t now_us(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	uint64_t t = hw_now() + gs_offset;
+
+	cpu_irq_restore(flags);
+	return t;
+}
+
+/**
+ * \brief Chama timer_run() quando now_us() chegar a \a at_us (na hora, se
+ * ja passou). Substitui o alarme anterior.
+ */
+TCM_CODE void timebase_arm(uint64_t at_us)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	gs_alarm = at_us;
+	program();
+
+	cpu_irq_restore(flags);
+}
+
+TCM_CODE void timebase_disarm(void)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	gs_alarm = UINT64_MAX;
+	tc_disable_interrupt(TB_TC, TB_LO, TC_IDR_CPBS);
+
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Adianta now_us() em \a us: o tempo que o TC perdeu durante o WAIT.
+ * Um alarme que venceu no sono dispara em seguida.
+ */
+void timebase_adjust(uint64_t us)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	gs_offset += (int64_t)us;
+	if (gs_alarm != UINT64_MAX) {
+		NVIC_SetPendingIRQ(TB_LO_IRQn);
+	}
+
+	cpu_irq_restore(flags);
+}
@@ -0,0 +1,37 @@
+/*
+ * timebase.h
+ *
+ * Created: 18/10/2026
+ *
+ * Base de tempo monotonica de 64 bits em microssegundos, zerada no boot.
+ *
+ * O TC1 conta o PCK6 (MAINCK / 12 = 1 MHz, fora do prescaler que o
+ * governador de clock troca): o canal 0 da os 16 bits de baixo e o TIOA0,
+ * que sobe a cada volta dele, e o clock do canal 1 (XC1), que da os 16 do
+ * meio. Os estouros do canal 1 sao contados na interrupcao dele. Ler e
+ * barato (dois registradores) e nada interrompe o core a cada tick.
+ *
+ * O RB do canal 0 e o alarme unico que a roda de timers (timer.h) programa
+ * no proximo vencimento; alarmes a mais de meia volta do canal 0 passam por
+ * etapas intermediarias.
+ *
+ * No WAIT o TC nao e confiavel: o idle soma com timebase_adjust() o que o
+ * RTT mediu a mais, entao now_us() continua monotonico mas com a resolucao
+ * do RTT (~92 us) a cada sono.
+ *
+ * No build de host now_us() e o relogio virtual do simulador (hal_sim.c).
+ */
+
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+#include <stdint.h>
+
+void timebase_init(void);
+uint64_t now_us(void);
+void timebase_arm(uint64_t at_us);
+void timebase_disarm(void);
+void timebase_adjust(uint64_t us);
+
+#endif /* TIMEBASE_H_ */
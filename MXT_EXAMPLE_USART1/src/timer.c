@@ -0,0 +1,325 @@
+/*
+ * timer.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include "timer.h"
+#include "timebase.h"
+#include "prof.h"
+#include "tcm.h"
+
+#define SLOT_MASK       (TIMER_SLOTS - 1)
+#define BUSY_WORDS      (TIMER_SLOTS / 32)
+
+/* Diferenca com sinal entre ticks (o contador de 32 bits da a volta) */
+#define TICK_DIFF(a, b) ((int32_t)((uint32_t)(a) - (uint32_t)(b)))
+
+/* Timers que vencem na volta atual, [gs_tick, gs_tick + TIMER_SLOTS): cada
+ * posicao tem so timers do mesmo tick */
+static sw_timer_t *gs_slot[TIMER_SLOTS];
+static uint32_t gs_busy[BUSY_WORDS];
+
+/* Timers mais longe, em ordem de vencimento */
+static sw_timer_t *gs_far;
+
+static int gs_count;
+
+/* Todos os ticks antes de gs_tick ja foram processados */
+static uint32_t gs_tick;
+
+/* Tick em que o alarme da base de tempo esta programado */
+static bool gs_armed;
+static uint32_t gs_armed_tick;
+
+static uint32_t now_tick(void)
+{
+	return (uint32_t)(now_us() / TIMER_TICK_US);
+}
+
+/* Instante de now_us() em que \a tick comeca. O tick tem 32 bits e da a
+ * volta a cada ~49,7 dias: o instante e montado a partir de agora, nao de
+ * tick * TIMER_TICK_US. Um tick ja passado da agora. */
+static uint64_t tick_us(uint32_t tick)
+{
+	uint64_t now = now_us();
+	int32_t d = TICK_DIFF(tick, (uint32_t)(now / TIMER_TICK_US));
+
+	if (d <= 0) {
+		return now;
+	}
+	return now - now % TIMER_TICK_US + (uint64_t)d * TIMER_TICK_US;
+}
+
+static void list_link(sw_timer_t **pp, sw_timer_t *t)
+{
+	t->next = *pp;
+	if (t->next != NULL) {
+		t->next->pprev = &t->next;
+	}
+	t->pprev = pp;
+	*pp = t;
+}
+
+static void wheel_insert(sw_timer_t *t)
+{
+	if (TICK_DIFF(t->expires, gs_tick) < TIMER_SLOTS) {
+		uint32_t slot = t->expires & SLOT_MASK;
+
+		list_link(&gs_slot[slot], t);
+		gs_busy[slot / 32] |= 1u << (slot % 32);
+	} else {
+		sw_timer_t **pp = &gs_far;
+
+		while (*pp != NULL && TICK_DIFF((*pp)->expires, t->expires) <= 0) {
+			pp = &(*pp)->next;
+		}
+		list_link(pp, t);
+	}
+	gs_count++;
+}
+
+static void wheel_remove(sw_timer_t *t)
+{
+	uint32_t slot = t->expires & SLOT_MASK;
+
+	*t->pprev = t->next;
+	if (t->next != NULL) {
+		t->next->pprev = t->pprev;
+	}
+	/* (vale tambem para quem estava na fila: a posicao ja estava vazia) */
+	if (gs_slot[slot] == NULL) {
+		gs_busy[slot / 32] &= ~(1u << (slot % 32));
+	}
+	t->pprev = NULL;
+	t->next = NULL;
+	gs_count--;
+}
+
+/* Distancia de \a tick ate a proxima posicao ocupada (0 = a propria), ou -1
+ * com a roda vazia */
+static int find_busy(uint32_t tick)
+{
+	uint32_t slot = tick & SLOT_MASK;
+	uint32_t w = slot / 32;
+	uint32_t bits = gs_busy[w] & (~0u << (slot % 32));
+	int i;
+
+	for (i = 0; i <= BUSY_WORDS; i++) {
+		if (bits != 0) {
+			uint32_t found = w * 32 + (uint32_t)__builtin_ctz(bits);
+			return (int)((found - slot) & SLOT_MASK);
+		}
+		w = (w + 1) % BUSY_WORDS;
+		bits = gs_busy[w];
+	}
+	return -1;
+}
+
+/* Passa para a roda os timers da fila que entraram na volta atual; a
+ * cada avanco de gs_tick */
+static void cascade(void)
+{
+	while (gs_far != NULL && TICK_DIFF(gs_far->expires, gs_tick) < TIMER_SLOTS) {
+		sw_timer_t *t = gs_far;
+
+		wheel_remove(t);
+		wheel_insert(t);
+	}
+}
+
+/* Proximo vencimento (tick); chamada com as interrupcoes desligadas. A fila
+ * so tem timers depois da volta atual, entao a roda ganha se tiver algum */
+static bool next_tick(uint32_t *tick)
+{
+	int d = find_busy(gs_tick);
+
+	if (d >= 0) {
+		*tick = gs_tick + (uint32_t)d;
+		return true;
+	}
+	if (gs_far != NULL) {
+		*tick = gs_far->expires;
+		return true;
+	}
+	return false;
+}
+
+/* Programa o alarme no proximo vencimento; interrupcoes desligadas */
+static void rearm(void)
+{
+	uint32_t tick;
+
+	if (!next_tick(&tick)) {
+		if (gs_armed) {
+			timebase_disarm();
+			gs_armed = false;
+		}
+		return;
+	}
+	if (!gs_armed || tick != gs_armed_tick) {
+		timebase_arm(tick_us(tick));
+		gs_armed = true;
+		gs_armed_tick = tick;
+	}
+}
+
+/* Tira da roda o proximo timer vencido ate \a now, ou NULL */
+static sw_timer_t *pop_expired(uint32_t now)
+{
+	while (TICK_DIFF(now, gs_tick) >= 0) {
+		int d = find_busy(gs_tick);
+		sw_timer_t *t;
+
+		if (d < 0 || TICK_DIFF(now, gs_tick + (uint32_t)d) < 0) {
+			/* roda vazia ate now: pula direto para o primeiro da fila */
+			if (d < 0 && gs_far != NULL && TICK_DIFF(now, gs_far->expires) >= 0) {
+				gs_tick = gs_far->expires;
+			} else {
+				gs_tick = now + 1;
+			}
+			cascade();
+			continue;
+		}
+		gs_tick += (uint32_t)d;
+		cascade();
+		t = gs_slot[gs_tick & SLOT_MASK];
+		wheel_remove(t);
+		return t;
+	}
+	return NULL;
+}
+
+void timer_init(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	int i;
+
+	for (i = 0; i < TIMER_SLOTS; i++) {
+		gs_slot[i] = NULL;
+	}
+	for (i = 0; i < BUSY_WORDS; i++) {
+		gs_busy[i] = 0;
+	}
+	gs_far = NULL;
+	gs_count = 0;
+	gs_tick = now_tick();
+	gs_armed = false;
+	timebase_disarm();
+
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Arma \a t para daqui a \a delay_us e, com \a period_us diferente
+ * de zero, a cada \a period_us depois disso. Um timer ja armado e rearmado.
+ *
+ * Os vencimentos caem na borda de um tick: a callback nunca roda antes de
+ * \a delay_us, e no maximo TIMER_TICK_US depois (mais a latencia da
+ * interrupcao).
+ */
+TCM_CODE void timer_start(sw_timer_t *t, uint32_t delay_us, uint32_t period_us)
+{
+	irqflags_t flags;
+	uint64_t at;
+
+	PROF_BEGIN(timer_op);
+	flags = cpu_irq_save();
+	at = now_us() + delay_us;
+
+	if (t->pprev != NULL) {
+		wheel_remove(t);
+	}
+	if (gs_count == 0) {
+		/* roda vazia: nao ha ticks atrasados para processar */
+		gs_tick = now_tick();
+	}
+	t->expires = (uint32_t)((at + TIMER_TICK_US - 1) / TIMER_TICK_US);
+	if (TICK_DIFF(t->expires, gs_tick) < 0) {
+		t->expires = gs_tick;
+	}
+	t->period = period_us ? Max((period_us + TIMER_TICK_US / 2) / TIMER_TICK_US, 1u) : 0;
+	wheel_insert(t);
+
+	/* so mexe no alarme se este vence antes do programado */
+	if (!gs_armed || TICK_DIFF(t->expires, gs_armed_tick) < 0) {
+		timebase_arm(tick_us(t->expires));
+		gs_armed = true;
+		gs_armed_tick = t->expires;
+	}
+
+	cpu_irq_restore(flags);
+	PROF_END(timer_op);
+}
+
+/**
+ * \brief Desarma \a t (nada acontece se nao estiver armado). O alarme fica
+ * como esta: se era o deste timer, dispara sem nada vencido e e
+ * reprogramado.
+ */
+TCM_CODE void timer_stop(sw_timer_t *t)
+{
+	irqflags_t flags;
+
+	PROF_BEGIN(timer_op);
+	flags = cpu_irq_save();
+	if (t->pprev != NULL) {
+		wheel_remove(t);
+	}
+	cpu_irq_restore(flags);
+	PROF_END(timer_op);
+}
+
+bool timer_active(const sw_timer_t *t)
+{
+	return t->pprev != NULL;
+}
+
+/**
+ * \brief Instante (us, now_us()) do proximo vencimento; false sem timers
+ * armados. Usada pelo idle para escolher o sono.
+ */
+bool timer_next(uint64_t *at_us)
+{
+	irqflags_t flags = cpu_irq_save();
+	uint32_t tick;
+	bool found = next_tick(&tick);
+
+	if (found) {
+		*at_us = tick_us(tick);
+	}
+	cpu_irq_restore(flags);
+	return found;
+}
+
+/**
+ * \brief Chama as callbacks vencidas e reprograma o alarme. Chamada pela
+ * base de tempo quando o alarme dispara.
+ */
+TCM_CODE void timer_run(void)
+{
+	irqflags_t flags;
+	sw_timer_t *t;
+
+	PROF_BEGIN(isr_timer);
+	flags = cpu_irq_save();
+	gs_armed = false;
+	while ((t = pop_expired(now_tick())) != NULL) {
+		if (t->period) {
+			uint32_t now = now_tick();
+
+			t->expires += t->period;
+			while (TICK_DIFF(t->expires, now) <= 0) {
+				t->expires += t->period;
+			}
+			wheel_insert(t);
+		}
+		cpu_irq_restore(flags);
+		t->fn(t);
+		flags = cpu_irq_save();
+	}
+	rearm();
+	cpu_irq_restore(flags);
+	PROF_END(isr_timer);
+}
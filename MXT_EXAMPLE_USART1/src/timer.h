@@ -0,0 +1,54 @@
+/*
+ * timer.h
+ *
+ * Created: 18/10/2026
+ *
+ * Timers de software sobre a base de tempo (timebase.h), donos do TC1
+ * desde o boot: nenhum uso reconfigura hardware. Os vencimentos da volta
+ * atual ficam numa roda de TIMER_SLOTS posicoes de TIMER_TICK_US, indexada
+ * pelo tick, com um bitmap de posicoes ocupadas; os mais longe ficam numa
+ * fila ordenada por vencimento e descem para a roda quando ela chega na
+ * volta deles. Assim cada posicao so tem timers do mesmo tick, o proximo
+ * vencimento e o primeiro bit ocupado (ou a cabeca da fila), e armar e
+ * parar na roda sao O(1); na fila, O(timers longe), que sao poucos.
+ *
+ * Um alarme so da base de tempo cobre todos os timers: ele e programado no
+ * proximo tick ocupado e, ao disparar, timer_run() chama as callbacks
+ * vencidas, no contexto da interrupcao da base de tempo. Os periodicos sao
+ * rearmados antes da callback, que pode parar o proprio timer; periodos
+ * perdidos (interrupcoes seguradas por muito tempo) viram uma chamada so.
+ *
+ * timer_start()/timer_stop() podem ser chamadas do main loop, de
+ * interrupcoes e das callbacks.
+ */
+
+
+#ifndef TIMER_H_
+#define TIMER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TIMER_TICK_US       1000
+#define TIMER_SLOTS         256     // potencia de 2, multiplo de 32
+
+typedef struct sw_timer sw_timer_t;
+
+struct sw_timer {
+	sw_timer_t *next;
+	sw_timer_t **pprev;         // NULL fora da roda
+	uint32_t expires;           // tick de vencimento
+	uint32_t period;            // ticks; 0 = uma vez so
+	void (*fn)(sw_timer_t *t);
+};
+
+#define TIMER_INIT(f)       { NULL, NULL, 0, 0, (f) }
+
+void timer_init(void);
+void timer_start(sw_timer_t *t, uint32_t delay_us, uint32_t period_us);
+void timer_stop(sw_timer_t *t);
+bool timer_active(const sw_timer_t *t);
+bool timer_next(uint64_t *at_us);
+void timer_run(void);
+
+#endif /* TIMER_H_ */
@@ -0,0 +1,351 @@
+/*
+ * touch_cal.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "touch_cal.h"
+#include "tcm.h"
+
+#define TOUCH_CAL_MAGIC     0x54434131u     // "TCA1"
+
+/* Limites dos coeficientes: com X, Y < 4096 a conta cabe em 32 bits */
+#define TOUCH_CAL_GAIN_MAX  TOUCH_CAL_ONE
+#define TOUCH_CAL_OFS_MAX   (1 << 28)
+
+/*
+ * Area minima (o dobro, em unidades do maXTouch ao quadrado) do triangulo
+ * dos tres toques. Os alvos cobrem ~0,48 * 4096^2; abaixo de 1/16 do
+ * painel os toques estao quase alinhados (ou foram no mesmo lugar) e o
+ * ruido de uma leitura vira um ganho enorme.
+ */
+#define TOUCH_CAL_DET_MIN   (4096 * 4096 / 16)
+
+/* Alvo: cruz de TARGET_ARM px para cada lado, TARGET_THICK de espessura */
+#define TARGET_ARM          12
+#define TARGET_THICK        1
+
+/* Nominal: x = W - W * Y / 4096, y = H * X / 4096 (eixos trocados) */
+static const touch_cal_t gs_nominal = {
+	.a = 0,
+	.b = -(ILI9488_LCD_WIDTH * TOUCH_CAL_ONE / 4096),
+	.c = ILI9488_LCD_WIDTH * TOUCH_CAL_ONE,
+	.d = ILI9488_LCD_HEIGHT * TOUCH_CAL_ONE / 4096,
+	.e = 0,
+	.f = 0,
+};
+
+/* Calibracao na orientacao nativa do LCD (a do ili9488_init) */
+static touch_cal_t gs_base;
+static bool gs_base_stored;
+
+/* Na orientacao atual, com o arredondamento somado em c e f */
+static touch_cal_t gs_active;
+static enum ili9488_display_direction gs_direction = LANDSCAPE;
+static int32_t gs_width = ILI9488_LCD_WIDTH;
+static int32_t gs_height = ILI9488_LCD_HEIGHT;
+
+static touch_cal_point_t gs_points[TOUCH_CAL_POINTS];
+static int gs_step = -1;
+
+/*
+ * PORTRAIT (MADCTL 0xE8, MV|MX|MY) gira a tela nativa de 90 graus:
+ * x' = H - 1 - y, y' = x.
+ */
+static void rotate(touch_cal_t *out, const touch_cal_t *in)
+{
+	touch_cal_t r = *in;
+
+	if (gs_direction == PORTRAIT) {
+		r.a = -in->d;
+		r.b = -in->e;
+		r.c = (ILI9488_LCD_HEIGHT - 1) * TOUCH_CAL_ONE - in->f;
+		r.d = in->a;
+		r.e = in->b;
+		r.f = in->c;
+	}
+	*out = r;
+}
+
+static void unrotate(touch_cal_t *out, const touch_cal_t *in)
+{
+	touch_cal_t r = *in;
+
+	if (gs_direction == PORTRAIT) {
+		r.a = in->d;
+		r.b = in->e;
+		r.c = in->f;
+		r.d = -in->a;
+		r.e = -in->b;
+		r.f = (ILI9488_LCD_HEIGHT - 1) * TOUCH_CAL_ONE - in->c;
+	}
+	*out = r;
+}
+
+static void update_active(void)
+{
+	rotate(&gs_active, &gs_base);
+	gs_active.c += TOUCH_CAL_ONE / 2;
+	gs_active.f += TOUCH_CAL_ONE / 2;
+}
+
+/* Soma de verificacao das palavras gravadas; GPBR zerado nao passa */
+static uint32_t gpbr_check(const uint32_t *w)
+{
+	uint32_t x = TOUCH_CAL_MAGIC;
+	int i;
+
+	for (i = 0; i < TOUCH_CAL_GPBR_WORDS - 1; i++) {
+		x = ((x << 5) | (x >> 27)) ^ w[i];
+	}
+	return x;
+}
+
+static void gpbr_save(const touch_cal_t *cal)
+{
+	const uint32_t w[TOUCH_CAL_GPBR_WORDS - 1] = {
+		(uint32_t)cal->a, (uint32_t)cal->b, (uint32_t)cal->c,
+		(uint32_t)cal->d, (uint32_t)cal->e, (uint32_t)cal->f,
+	};
+	int i;
+
+	for (i = 0; i < TOUCH_CAL_GPBR_WORDS - 1; i++) {
+		GPBR->SYS_GPBR[TOUCH_CAL_GPBR_FIRST + 1 + i] = w[i];
+	}
+	GPBR->SYS_GPBR[TOUCH_CAL_GPBR_FIRST] = gpbr_check(w);
+}
+
+static bool gpbr_load(touch_cal_t *cal)
+{
+	uint32_t w[TOUCH_CAL_GPBR_WORDS - 1];
+	int i;
+
+	for (i = 0; i < TOUCH_CAL_GPBR_WORDS - 1; i++) {
+		w[i] = GPBR->SYS_GPBR[TOUCH_CAL_GPBR_FIRST + 1 + i];
+	}
+	if (GPBR->SYS_GPBR[TOUCH_CAL_GPBR_FIRST] != gpbr_check(w)) {
+		return false;
+	}
+	cal->a = (int32_t)w[0];
+	cal->b = (int32_t)w[1];
+	cal->c = (int32_t)w[2];
+	cal->d = (int32_t)w[3];
+	cal->e = (int32_t)w[4];
+	cal->f = (int32_t)w[5];
+	return true;
+}
+
+/* -max <= v <= max, sem abs(): INT32_MIN dos GPBR nao tem modulo */
+static bool in_range(int32_t v, int32_t max)
+{
+	return v >= -max && v <= max;
+}
+
+static bool cal_valid(const touch_cal_t *cal)
+{
+	return in_range(cal->a, TOUCH_CAL_GAIN_MAX) && in_range(cal->b, TOUCH_CAL_GAIN_MAX) &&
+	       in_range(cal->d, TOUCH_CAL_GAIN_MAX) && in_range(cal->e, TOUCH_CAL_GAIN_MAX) &&
+	       in_range(cal->c, TOUCH_CAL_OFS_MAX) && in_range(cal->f, TOUCH_CAL_OFS_MAX);
+}
+
+/**
+ * \brief Carrega a calibracao dos GPBR, ou a nominal se nao houver uma
+ * valida (primeiro boot, falta de energia no backup).
+ */
+void touch_cal_init(void)
+{
+	gs_base_stored = gpbr_load(&gs_base) && cal_valid(&gs_base);
+	if (!gs_base_stored) {
+		gs_base = gs_nominal;
+	}
+	update_active();
+}
+
+/**
+ * \brief Coordenadas do maXTouch para pixels da tela, limitadas a ela.
+ */
+TCM_CODE void touch_cal_map(uint32_t raw_x, uint32_t raw_y, uint32_t *x, uint32_t *y)
+{
+	const touch_cal_t *k = &gs_active;
+	int32_t sx = (k->a * (int32_t)raw_x + k->b * (int32_t)raw_y + k->c) >> 16;
+	int32_t sy = (k->d * (int32_t)raw_x + k->e * (int32_t)raw_y + k->f) >> 16;
+
+	*x = (uint32_t)Min(Max(sx, 0), gs_width - 1);
+	*y = (uint32_t)Min(Max(sy, 0), gs_height - 1);
+}
+
+/* num / den em Q16, arredondado e saturado em +-INT32_MAX */
+static int32_t q16_div(int64_t num, int64_t den)
+{
+	int64_t n = num * TOUCH_CAL_ONE;
+	int64_t half = (den < 0 ? -den : den) / 2;
+
+	if (den < 0) {
+		n = -n;
+		den = -den;
+	}
+	n += n < 0 ? -half : half;
+	n /= den;
+	return (int32_t)Min(Max(n, -INT32_MAX), INT32_MAX);
+}
+
+/**
+ * \brief Coeficientes que levam as leituras de tres pontos aos alvos deles.
+ *
+ * \return false com os tres pontos (quase) alinhados ou um ganho fora do
+ * que o painel pode ter.
+ */
+bool touch_cal_solve(const touch_cal_point_t p[TOUCH_CAL_POINTS], touch_cal_t *out)
+{
+	int64_t dx0 = p[0].raw_x - p[2].raw_x, dx1 = p[1].raw_x - p[2].raw_x;
+	int64_t dy0 = p[0].raw_y - p[2].raw_y, dy1 = p[1].raw_y - p[2].raw_y;
+	int64_t det = dx0 * dy1 - dx1 * dy0;
+	touch_cal_t k;
+
+	if (det > -TOUCH_CAL_DET_MIN && det < TOUCH_CAL_DET_MIN) {
+		return false;
+	}
+
+	k.a = q16_div((int64_t)(p[0].x - p[2].x) * dy1 - (int64_t)(p[1].x - p[2].x) * dy0, det);
+	k.b = q16_div(dx0 * (p[1].x - p[2].x) - dx1 * (p[0].x - p[2].x), det);
+	k.c = q16_div((int64_t)p[0].raw_y * ((int64_t)p[2].raw_x * p[1].x - (int64_t)p[1].raw_x * p[2].x) +
+	              (int64_t)p[1].raw_y * ((int64_t)p[0].raw_x * p[2].x - (int64_t)p[2].raw_x * p[0].x) +
+	              (int64_t)p[2].raw_y * ((int64_t)p[1].raw_x * p[0].x - (int64_t)p[0].raw_x * p[1].x), det);
+
+	k.d = q16_div((int64_t)(p[0].y - p[2].y) * dy1 - (int64_t)(p[1].y - p[2].y) * dy0, det);
+	k.e = q16_div(dx0 * (p[1].y - p[2].y) - dx1 * (p[0].y - p[2].y), det);
+	k.f = q16_div((int64_t)p[0].raw_y * ((int64_t)p[2].raw_x * p[1].y - (int64_t)p[1].raw_x * p[2].y) +
+	              (int64_t)p[1].raw_y * ((int64_t)p[0].raw_x * p[2].y - (int64_t)p[2].raw_x * p[0].y) +
+	              (int64_t)p[2].raw_y * ((int64_t)p[1].raw_x * p[0].y - (int64_t)p[0].raw_x * p[1].y), det);
+
+	if (!cal_valid(&k)) {
+		return false;
+	}
+	*out = k;
+	return true;
+}
+
+/**
+ * \brief Passa a usar \a cal (na orientacao atual) e grava nos GPBR.
+ */
+void touch_cal_set(const touch_cal_t *cal)
+{
+	unrotate(&gs_base, cal);
+	gs_base_stored = true;
+	gpbr_save(&gs_base);
+	update_active();
+}
+
+/**
+ * \brief Orientacao do LCD e do toque juntas.
+ */
+void touch_cal_set_direction(enum ili9488_display_direction direction)
+{
+	ili9488_set_display_direction(direction);
+	gs_direction = direction;
+	gs_width = direction == PORTRAIT ? ILI9488_LCD_HEIGHT : ILI9488_LCD_WIDTH;
+	gs_height = direction == PORTRAIT ? ILI9488_LCD_WIDTH : ILI9488_LCD_HEIGHT;
+	update_active();
+}
+
+/**
+ * \brief Tamanho da tela na orientacao atual, o limite de touch_cal_map().
+ */
+void touch_cal_get_size(uint32_t *width, uint32_t *height)
+{
+	*width = (uint32_t)gs_width;
+	*height = (uint32_t)gs_height;
+}
+
+/* Alvos a 10% das bordas, em tres cantos de um triangulo grande */
+static void target_pos(int i, int32_t *x, int32_t *y)
+{
+	static const uint8_t tx[TOUCH_CAL_POINTS] = { 10, 90, 50 };
+	static const uint8_t ty[TOUCH_CAL_POINTS] = { 10, 50, 90 };
+
+	*x = gs_width * tx[i] / 100;
+	*y = gs_height * ty[i] / 100;
+}
+
+static void draw_target(int i, uint32_t color)
+{
+	int32_t x, y;
+
+	target_pos(i, &x, &y);
+	ili9488_set_foreground_color(COLOR_CONVERT(color));
+	ili9488_draw_filled_rectangle(x - TARGET_ARM, y - TARGET_THICK,
+	                              x + TARGET_ARM, y + TARGET_THICK);
+	ili9488_draw_filled_rectangle(x - TARGET_THICK, y - TARGET_ARM,
+	                              x + TARGET_THICK, y + TARGET_ARM);
+}
+
+/**
+ * \brief Limpa a tela e mostra o primeiro alvo; os toques seguintes vao
+ * para touch_cal_sample() ate a calibracao terminar.
+ */
+void touch_cal_start(void)
+{
+	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
+	ili9488_draw_filled_rectangle(0, 0, gs_width - 1, gs_height - 1);
+	gs_step = 0;
+	draw_target(0, COLOR_RED);
+}
+
+bool touch_cal_running(void)
+{
+	return gs_step >= 0;
+}
+
+/**
+ * \brief Leitura do maXTouch com o dedo no alvo atual (um press).
+ *
+ * Depois do terceiro alvo calcula e, se os pontos prestarem, passa a usar
+ * e grava a calibracao nova. A tela fica para quem chamou redesenhar.
+ */
+int touch_cal_sample(uint32_t raw_x, uint32_t raw_y)
+{
+	touch_cal_point_t *p = &gs_points[gs_step];
+	touch_cal_t cal;
+
+	target_pos(gs_step, &p->x, &p->y);
+	p->raw_x = (int32_t)raw_x;
+	p->raw_y = (int32_t)raw_y;
+	draw_target(gs_step, COLOR_WHITE);
+
+	if (++gs_step < TOUCH_CAL_POINTS) {
+		draw_target(gs_step, COLOR_RED);
+		return TOUCH_CAL_NEXT;
+	}
+
+	gs_step = -1;
+	if (!touch_cal_solve(gs_points, &cal)) {
+		printf("calibracao: pontos invalidos, mantida a anterior\n\r");
+		return TOUCH_CAL_FAIL;
+	}
+	touch_cal_set(&cal);
+	return TOUCH_CAL_DONE;
+}
+
+static void print_q16(const char *label, int32_t v)
+{
+	uint32_t m = (uint32_t)(v < 0 ? -(int64_t)v : v);
+
+	printf(" %s=%s%lu.%04lu", label, v < 0 ? "-" : "", (unsigned long)(m >> 16),
+	       (unsigned long)(((m & 0xFFFF) * 10000u) >> 16));
+}
+
+void touch_cal_dump(void)
+{
+	printf("\n\rtoque (%s):", gs_base_stored ? "calibrado" : "nominal");
+	print_q16("a", gs_base.a);
+	print_q16("b", gs_base.b);
+	print_q16("c", gs_base.c);
+	printf("\n\r     ");
+	print_q16("d", gs_base.d);
+	print_q16("e", gs_base.e);
+	print_q16("f", gs_base.f);
+	printf("\n\r");
+}
@@ -0,0 +1,72 @@
+/*
+ * touch_cal.h
+ *
+ * Created: 18/10/2026
+ *
+ * Calibracao do touch: uma transformacao afim das coordenadas do maXTouch
+ * (0..4095) para pixels do LCD,
+ *
+ *     x = (a * X + b * Y + c) >> 16
+ *     y = (d * X + e * Y + f) >> 16
+ *
+ * com os coeficientes em Q16. touch_cal_map() so multiplica, soma e
+ * desloca; a divisao fica no calculo dos coeficientes, feito uma vez a
+ * partir de tres toques em alvos conhecidos (touch_cal_start(), 'c' pela
+ * serial). A troca de eixos do painel (montado de lado em relacao ao LCD)
+ * e o espelhamento entram nos coeficientes, como qualquer rotacao ou
+ * desalinhamento.
+ *
+ * A calibracao fica nos registradores de backup (GPBR), que sobrevivem ao
+ * reset; sem uma calibracao valida la vale a nominal, que e a conta que o
+ * main.c fazia (convert_axis_system_x/y).
+ *
+ * touch_cal_set_direction() troca a orientacao do LCD
+ * (ili9488_set_display_direction) e compoe a rotacao nos coeficientes, entao
+ * o toque continua em coordenadas da tela.
+ */
+
+
+#ifndef TOUCH_CAL_H_
+#define TOUCH_CAL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ili9488.h"
+
+#define TOUCH_CAL_POINTS    3
+#define TOUCH_CAL_ONE       (1 << 16)   // 1.0 em Q16
+
+/* GPBR usados: a calibracao ocupa TOUCH_CAL_GPBR_WORDS a partir deste */
+#define TOUCH_CAL_GPBR_FIRST    0
+#define TOUCH_CAL_GPBR_WORDS    7
+
+typedef struct {
+	int32_t a, b, c;            // x da tela, Q16
+	int32_t d, e, f;            // y da tela, Q16
+} touch_cal_t;
+
+/* Um ponto de calibracao: o alvo na tela e o que o maXTouch leu nele */
+typedef struct {
+	int32_t x, y;
+	int32_t raw_x, raw_y;
+} touch_cal_point_t;
+
+enum {
+	TOUCH_CAL_NEXT,             // ponto aceito, esperando o proximo alvo
+	TOUCH_CAL_DONE,             // calibracao nova em uso e gravada
+	TOUCH_CAL_FAIL              // pontos ruins, continua a anterior
+};
+
+void touch_cal_init(void);
+void touch_cal_map(uint32_t raw_x, uint32_t raw_y, uint32_t *x, uint32_t *y);
+bool touch_cal_solve(const touch_cal_point_t pts[TOUCH_CAL_POINTS], touch_cal_t *out);
+void touch_cal_set(const touch_cal_t *cal);
+void touch_cal_set_direction(enum ili9488_display_direction direction);
+void touch_cal_get_size(uint32_t *width, uint32_t *height);
+
+void touch_cal_start(void);
+bool touch_cal_running(void);
+int touch_cal_sample(uint32_t raw_x, uint32_t raw_y);
+void touch_cal_dump(void);
+
+#endif /* TOUCH_CAL_H_ */
@@ -0,0 +1,208 @@
+/*
+ * touch_filter.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "touch_filter.h"
+#include "touch_cal.h"
+#include "timebase.h"
+#include "prof.h"
+#include "tcm.h"
+
+/* Intervalo entre leituras usado nas contas: o T8 le a ~100 Hz; um dedo
+ * parado por muito tempo nao vira um salto de velocidade */
+#define DT_MIN_US           1000
+#define DT_MAX_US           100000
+
+/* 1 euro: corte da derivada fixo em 1 Hz; tau = 1e6 / (2 pi fc) us */
+#define TAU_US_MHZ          159154943u      // tau_us = TAU_US_MHZ / fc_mhz
+#define DCUTOFF_MHZ         1000
+
+#define Q8(px)              ((int32_t)(px) << 8)
+
+typedef struct {
+	int32_t raw[3];             // ultimas leituras, Q8 (mediana)
+	int32_t pos;                // filtrada, Q8
+	int32_t vel;                // Q8 px/ms
+} axis_t;
+
+typedef struct {
+	bool down;
+	uint8_t n;                  // leituras desde o press (ate 3)
+	uint64_t t_us;
+	axis_t ax[2];
+	int32_t out[2];             // ultima posicao entregue, Q8
+} finger_t;
+
+static touch_filter_cfg_t gs_cfg = TOUCH_FILTER_CFG_DEFAULT;
+static finger_t gs_fingers[TOUCH_FILTER_FINGERS];
+static touch_filter_stats_t gs_stats;
+
+void touch_filter_init(const touch_filter_cfg_t *cfg)
+{
+	gs_cfg = *cfg;
+	memset(gs_fingers, 0, sizeof(gs_fingers));
+	touch_filter_reset_stats();
+}
+
+static TCM_CODE int32_t median3(int32_t a, int32_t b, int32_t c)
+{
+	return Max(Min(a, b), Min(Max(a, b), c));
+}
+
+/* alfa = dt / (dt + tau) em Q16, para um corte de fc_mhz */
+static TCM_CODE int32_t lowpass_alpha(uint32_t dt, uint32_t fc_mhz)
+{
+	uint32_t tau = TAU_US_MHZ / Max(fc_mhz, 1u);
+
+	return (int32_t)(((uint64_t)dt << 16) / (dt + tau));
+}
+
+/* Velocidade pela diferenca de leituras, suavizada com corte de 1 Hz */
+static TCM_CODE void track_velocity(axis_t *a, int32_t meas, uint32_t dt)
+{
+	int32_t v = (int32_t)((int64_t)(meas - a->pos) * 1000 / (int32_t)dt);
+
+	a->vel += (int32_t)(((int64_t)(v - a->vel) * lowpass_alpha(dt, DCUTOFF_MHZ)) >> 16);
+}
+
+static TCM_CODE void filter_axis(finger_t *f, axis_t *a, int32_t meas, uint32_t dt)
+{
+	int32_t pred, r;
+	uint32_t speed;
+
+	a->raw[2] = a->raw[1];
+	a->raw[1] = a->raw[0];
+	a->raw[0] = meas;
+
+	switch (gs_cfg.kind) {
+	case TOUCH_FILTER_MEDIAN3:
+		meas = f->n < 3 ? meas : median3(a->raw[0], a->raw[1], a->raw[2]);
+		track_velocity(a, meas, dt);
+		a->pos = meas;
+		break;
+
+	case TOUCH_FILTER_ONE_EURO:
+		track_velocity(a, meas, dt);
+		/* |vel| de 1/256 px/ms para px/s */
+		speed = (uint32_t)((a->vel < 0 ? -a->vel : a->vel) * 1000) >> 8;
+		a->pos += (int32_t)(((int64_t)(meas - a->pos) *
+				lowpass_alpha(dt, gs_cfg.fcmin_mhz + gs_cfg.beta_mhz * speed)) >> 16);
+		break;
+
+	case TOUCH_FILTER_ALPHA_BETA:
+		pred = a->pos + (int32_t)((int64_t)a->vel * (int32_t)dt / 1000);
+		r = meas - pred;
+		a->pos = pred + (int32_t)(((int64_t)r * gs_cfg.alpha_q16) >> 16);
+		a->vel += (int32_t)((((int64_t)r * gs_cfg.beta_q16) >> 16) * 1000 / (int32_t)dt);
+		break;
+
+	default:
+		a->pos = meas;
+		break;
+	}
+}
+
+/* Posicao entregue: a filtrada, extrapolada nos movimentos e limitada a
+ * tela (\a size px), como a calibracao entrega */
+static TCM_CODE int32_t output(const axis_t *a, bool move, uint32_t size)
+{
+	int32_t p = a->pos;
+
+	if (move && gs_cfg.predict_us) {
+		p += (int32_t)((int64_t)a->vel * gs_cfg.predict_us / 1000);
+	}
+	return Min(Max(p, 0), Q8(size - 1));
+}
+
+/**
+ * \brief Filtra um evento do dedo \a id, em pixels da tela.
+ *
+ * \param x, y entrada e saida: a posicao que a interface deve usar.
+ * \return false se o evento e um movimento dentro da zona morta e deve ser
+ * descartado.
+ */
+TCM_CODE bool touch_filter_run(uint8_t id, uint8_t status, uint32_t *x, uint32_t *y)
+{
+	int32_t meas[2] = { Q8(*x), Q8(*y) };
+	bool move = !(status & (TOUCH_FILTER_PRESS | TOUCH_FILTER_RELEASE));
+	uint64_t now = now_us();
+	finger_t *f;
+	uint32_t dt, width, height;
+	int i;
+
+	gs_stats.events++;
+	if (id >= TOUCH_FILTER_FINGERS) {
+		gs_stats.passed++;
+		return true;
+	}
+	PROF_BEGIN(touch_filter);
+
+	f = &gs_fingers[id];
+	if (status & TOUCH_FILTER_RELEASE) {
+		/* a soltura vale onde o dedo saiu (teste de acerto dos botoes) */
+		f->down = false;
+		gs_stats.passed++;
+		PROF_END(touch_filter);
+		return true;
+	}
+	if ((status & TOUCH_FILTER_PRESS) || !f->down) {
+		/* recomeca do zero: a primeira leitura vale como esta */
+		for (i = 0; i < 2; i++) {
+			axis_t *a = &f->ax[i];
+
+			a->raw[0] = a->raw[1] = a->raw[2] = a->pos = meas[i];
+			a->vel = 0;
+		}
+		f->n = 1;
+		f->down = true;
+	} else {
+		dt = (uint32_t)Min(Max(now - f->t_us, (uint64_t)DT_MIN_US), (uint64_t)DT_MAX_US);
+		f->n = Min(f->n + 1, 3);
+		for (i = 0; i < 2; i++) {
+			filter_axis(f, &f->ax[i], meas[i], dt);
+		}
+	}
+	f->t_us = now;
+
+	touch_cal_get_size(&width, &height);
+	meas[0] = output(&f->ax[0], move, width);
+	meas[1] = output(&f->ax[1], move, height);
+	if (move && Max(abs(meas[0] - f->out[0]), abs(meas[1] - f->out[1])) < gs_cfg.deadzone_q8) {
+		gs_stats.held++;
+		PROF_END(touch_filter);
+		return false;
+	}
+
+	f->out[0] = meas[0];
+	f->out[1] = meas[1];
+	*x = (uint32_t)(meas[0] + 128) >> 8;
+	*y = (uint32_t)(meas[1] + 128) >> 8;
+	gs_stats.passed++;
+	PROF_END(touch_filter);
+	return true;
+}
+
+void touch_filter_get_stats(touch_filter_stats_t *out)
+{
+	*out = gs_stats;
+}
+
+void touch_filter_reset_stats(void)
+{
+	memset(&gs_stats, 0, sizeof(gs_stats));
+}
+
+void touch_filter_dump(void)
+{
+	static const char *const kinds[] = { "nenhum", "mediana de 3", "1 euro", "alfa-beta" };
+
+	printf("\n\rfiltro de toque %s: %lu eventos, %lu entregues, %lu segurados\n\r",
+			kinds[gs_cfg.kind], (unsigned long)gs_stats.events,
+			(unsigned long)gs_stats.passed, (unsigned long)gs_stats.held);
+}
@@ -0,0 +1,87 @@
+/*
+ * touch_filter.h
+ *
+ * Created: 18/10/2026
+ *
+ * Filtro das coordenadas do toque, por dedo (id do T9), entre a calibracao
+ * (touch_cal.h) e a interface. Tira o tremor de um dedo parado e segura os
+ * eventos de movimento que nao andaram pelo menos deadzone: eles nao chegam
+ * a interface nem pedem redesenho.
+ *
+ *   MEDIAN3     mediana das tres ultimas leituras: some com picos isolados,
+ *               atrasa uma leitura
+ *   ONE_EURO    passa-baixa com corte que sobe com a velocidade (filtro
+ *               "1 euro", Casiez 2012): parado filtra muito, arrastando
+ *               quase nada
+ *   ALPHA_BETA  posicao e velocidade estimadas (alfa-beta); a velocidade e a
+ *               melhor para a extrapolacao
+ *
+ * Com predict_us os movimentos saem extrapolados pela velocidade estimada,
+ * para esconder o atraso do caminho toque -> tela num arraste, sem sair
+ * da tela. O toque (press) e a soltura (release) sempre passam com a
+ * posicao calibrada como veio: o teste de acerto dos botoes ve o mesmo
+ * ponto que sem o filtro.
+ *
+ * Tudo em ponto fixo (posicoes em 1/256 px, velocidades em 1/256 px/ms),
+ * sem lacos: o custo por evento e fixo, algumas multiplicacoes e no maximo
+ * quatro divisoes. Zona de profiling touch_filter; 't' pela serial imprime
+ * quantos eventos passaram.
+ */
+
+
+#ifndef TOUCH_FILTER_H_
+#define TOUCH_FILTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Dedos com estado proprio; ids acima passam sem filtro */
+#define TOUCH_FILTER_FINGERS    4
+
+/* Status do T9 (mxt_touch_event.status) */
+#define TOUCH_FILTER_DETECT     0x80
+#define TOUCH_FILTER_PRESS      0x40
+#define TOUCH_FILTER_RELEASE    0x20
+#define TOUCH_FILTER_MOVE       0x10
+
+typedef enum {
+	TOUCH_FILTER_NONE,
+	TOUCH_FILTER_MEDIAN3,
+	TOUCH_FILTER_ONE_EURO,
+	TOUCH_FILTER_ALPHA_BETA
+} touch_filter_kind_t;
+
+typedef struct {
+	touch_filter_kind_t kind;
+	uint16_t deadzone_q8;       // movimento minimo, 1/256 px (0 = todos passam)
+	uint16_t predict_us;        // extrapolacao dos movimentos (0 = desligada)
+	uint16_t fcmin_mhz;         // 1 euro: corte parado, mHz
+	uint16_t beta_mhz;          // 1 euro: mHz a mais por px/s
+	uint16_t alpha_q16;         // alfa-beta: ganhos em Q16
+	uint16_t beta_q16;
+} touch_filter_cfg_t;
+
+/* 1 euro com os valores do artigo para ponteiros em pixels, zona de 1 px */
+#define TOUCH_FILTER_CFG_DEFAULT { \
+	.kind = TOUCH_FILTER_ONE_EURO, \
+	.deadzone_q8 = 256, \
+	.predict_us = 0, \
+	.fcmin_mhz = 1000, \
+	.beta_mhz = 7, \
+	.alpha_q16 = 32768, \
+	.beta_q16 = 6554, \
+}
+
+typedef struct {
+	uint32_t events;            // eventos recebidos
+	uint32_t passed;            // entregues a interface
+	uint32_t held;              // movimentos segurados pela zona morta
+} touch_filter_stats_t;
+
+void touch_filter_init(const touch_filter_cfg_t *cfg);
+bool touch_filter_run(uint8_t id, uint8_t status, uint32_t *x, uint32_t *y);
+void touch_filter_get_stats(touch_filter_stats_t *out);
+void touch_filter_reset_stats(void);
+void touch_filter_dump(void);
+
+#endif /* TOUCH_FILTER_H_ */
@@ -0,0 +1,148 @@
+/*
+ * touch_power.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include <string.h>
+#include "touch_power.h"
+#include "timebase.h"
+#include "timer.h"
+#include "trace.h"
+
+/*
+ * T7: IDLEACQINT e ACTVACQINT em ms (0xFF seria varrer sem parar, 0 parar
+ * de ver toques), ACTV2IDLETO em 200 ms, CFG. ACTIVE e o que o boot
+ * escrevia antes deste modulo.
+ */
+static const uint8_t gs_t7[TOUCH_POWER_COUNT][TOUCH_POWER_T7_SIZE] = {
+	[TOUCH_POWER_ACTIVE]  = { 0x20, 0x10, 0x4b, 0x84 },    // 32 ms, 16 ms, 15 s
+	[TOUCH_POWER_MENU]    = { 0x40, 0x10, 0x19, 0x84 },    // 64 ms, 16 ms, 5 s
+	[TOUCH_POWER_RUNNING] = { 0x64, 0x20, 0x0a, 0x84 },    // 100 ms, 32 ms, 2 s
+	[TOUCH_POWER_LOCKED]  = { 0xc8, 0x20, 0x0a, 0x84 },    // 200 ms, 32 ms, 2 s
+};
+
+static const char *const gs_names[TOUCH_POWER_COUNT] = {
+	"ativo", "menu", "lavando", "travado"
+};
+
+static struct mxt_device *gs_device;
+static uint16_t gs_t7_addr;
+static uint8_t gs_shadow[TOUCH_POWER_T7_SIZE];  // o que esta no T7
+static touch_power_t gs_profile;
+static uint64_t gs_since_us;
+static volatile bool gs_dirty;
+static touch_power_stats_t gs_stats;
+
+/* Venceu o tempo sem toque: o main loop escolhe o perfil novo */
+static void active_expired(sw_timer_t *t)
+{
+	UNUSED(t);
+	gs_dirty = true;
+}
+
+static sw_timer_t gs_active_timer = TIMER_INIT(active_expired);
+
+/* Escreve no T7 so o que difere do que ja esta la */
+static void apply(touch_power_t profile)
+{
+	const uint8_t *t7 = gs_t7[profile];
+	uint64_t now = now_us();
+	int i;
+
+	for (i = 0; i < TOUCH_POWER_T7_SIZE; i++) {
+		if (t7[i] == gs_shadow[i]) {
+			gs_stats.skipped++;
+			continue;
+		}
+		mxt_write_config_reg(gs_device, gs_t7_addr + i, t7[i]);
+		gs_shadow[i] = t7[i];
+		gs_stats.writes++;
+	}
+
+	gs_stats.time_us[gs_profile] += now - gs_since_us;
+	gs_since_us = now;
+	gs_profile = profile;
+	gs_stats.changes++;
+	TRACE(TOUCH_POWER, profile);
+}
+
+/**
+ * \brief Escreve o T7 inteiro com o perfil ACTIVE (parte da configuracao
+ * do maXTouch no boot) e comeca a contar o tempo sem toque.
+ */
+void touch_power_init(struct mxt_device *device)
+{
+	int i;
+
+	gs_device = device;
+	gs_t7_addr = mxt_get_object_address(device, MXT_GEN_POWERCONFIG_T7, 0);
+	for (i = 0; i < TOUCH_POWER_T7_SIZE; i++) {
+		mxt_write_config_reg(device, gs_t7_addr + i, gs_t7[TOUCH_POWER_ACTIVE][i]);
+		gs_shadow[i] = gs_t7[TOUCH_POWER_ACTIVE][i];
+	}
+	gs_profile = TOUCH_POWER_ACTIVE;
+	gs_since_us = now_us();
+	timer_start(&gs_active_timer, TOUCH_POWER_ACTIVE_US, 0);
+}
+
+/**
+ * \brief Houve toque: ritmo rapido pelos proximos TOUCH_POWER_ACTIVE_US.
+ */
+void touch_power_activity(void)
+{
+	timer_start(&gs_active_timer, TOUCH_POWER_ACTIVE_US, 0);
+	if (gs_profile != TOUCH_POWER_ACTIVE) {
+		gs_dirty = true;
+	}
+}
+
+/**
+ * \brief Do main loop, com o perfil do estado atual da interface; troca o
+ * do maXTouch se for preciso.
+ */
+void touch_power_update(touch_power_t ui)
+{
+	touch_power_t want;
+
+	/* antes de olhar o timer: um vencimento daqui em diante fica pendente */
+	gs_dirty = false;
+	want = timer_active(&gs_active_timer) ? TOUCH_POWER_ACTIVE : ui;
+	if (gs_device != NULL && want != gs_profile) {
+		apply(want);
+	}
+}
+
+/* O timer venceu ou houve toque desde o ultimo touch_power_update() */
+bool touch_power_pending(void)
+{
+	return gs_dirty;
+}
+
+void touch_power_get_stats(touch_power_stats_t *out)
+{
+	*out = gs_stats;
+	out->time_us[gs_profile] += now_us() - gs_since_us;
+}
+
+void touch_power_reset_stats(void)
+{
+	memset(&gs_stats, 0, sizeof(gs_stats));
+	gs_since_us = now_us();
+}
+
+void touch_power_dump(void)
+{
+	touch_power_stats_t s;
+	int i;
+
+	touch_power_get_stats(&s);
+	printf("maXTouch %s: %lu trocas, %lu bytes no T7, %lu iguais\n\r",
+			gs_names[gs_profile], (unsigned long)s.changes,
+			(unsigned long)s.writes, (unsigned long)s.skipped);
+	for (i = 0; i < TOUCH_POWER_COUNT; i++) {
+		printf("  %-8s %8lu ms\n\r", gs_names[i], (unsigned long)(s.time_us[i] / 1000));
+	}
+}
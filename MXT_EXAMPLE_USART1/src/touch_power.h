@@ -0,0 +1,56 @@
+/*
+ * touch_power.h
+ *
+ * Created: 18/10/2026
+ *
+ * Ritmo de aquisicao do maXTouch conforme o uso: o T7 (power config) diz
+ * de quanto em quanto tempo o controlador varre a tela sem toque
+ * (IDLEACQINT) e com toque (ACTVACQINT), e depois de quanto tempo sem toque
+ * ele volta para o ritmo parado (ACTV2IDLETO).
+ *
+ *   ACTIVE   alguem mexeu ha menos de TOUCH_POWER_ACTIVE_US: o ritmo do boot
+ *   MENU     menu ou configuracao parados
+ *   RUNNING  lavando, tela destravada: ninguem vai tocar tao cedo
+ *   LOCKED   tela travada: so precisa ver o dedo no cadeado
+ *
+ * Cada toque (touch_power_activity()) rearma um timer (timer.h); quando ele
+ * vence o perfil cai para o do estado da interface, que o main loop passa
+ * em touch_power_update(). As escritas pelo TWI ficam no main loop e so
+ * vao os bytes do T7 que mudaram. O T8 (aquisicao) continua o do boot.
+ */
+
+
+#ifndef TOUCH_POWER_H_
+#define TOUCH_POWER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <asf.h>
+
+#define TOUCH_POWER_ACTIVE_US   10000000u   // 10 s sem toque
+#define TOUCH_POWER_T7_SIZE     4
+
+typedef enum {
+	TOUCH_POWER_ACTIVE,
+	TOUCH_POWER_MENU,
+	TOUCH_POWER_RUNNING,
+	TOUCH_POWER_LOCKED,
+	TOUCH_POWER_COUNT
+} touch_power_t;
+
+typedef struct {
+	uint32_t changes;           // trocas de perfil
+	uint32_t writes;            // bytes escritos no T7
+	uint32_t skipped;           // bytes iguais, nao escritos
+	uint64_t time_us[TOUCH_POWER_COUNT];
+} touch_power_stats_t;
+
+void touch_power_init(struct mxt_device *device);
+void touch_power_activity(void);
+void touch_power_update(touch_power_t ui);
+bool touch_power_pending(void);
+void touch_power_get_stats(touch_power_stats_t *out);
+void touch_power_reset_stats(void);
+void touch_power_dump(void);
+
+#endif /* TOUCH_POWER_H_ */
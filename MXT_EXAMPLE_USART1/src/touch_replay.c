@@ -0,0 +1,228 @@
+/*
+ * touch_replay.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include <string.h>
+#include "touch_replay.h"
+#include "timebase.h"
+#include "timer.h"
+#include "trace.h"
+
+/* ---- gravacao ---- */
+
+static bool gs_recording;
+static uint64_t gs_rec_last_us;
+
+void touch_replay_record(bool enable)
+{
+	gs_recording = enable;
+	gs_rec_last_us = 0;
+}
+
+bool touch_replay_recording(void)
+{
+	return gs_recording;
+}
+
+/**
+ * \brief Grava um evento cru do maXTouch no trace, se a gravacao estiver
+ * ligada. O primeiro da gravacao sai com intervalo 0.
+ */
+void touch_replay_log(const struct mxt_touch_event *ev)
+{
+	uint64_t now, dt;
+
+	if (!gs_recording) {
+		return;
+	}
+	now = now_us();
+	dt = gs_rec_last_us ? now - gs_rec_last_us : 0;
+	gs_rec_last_us = now;
+	TRACE(TOUCH_REC, (int32_t)Min(dt, (uint64_t)INT32_MAX), ev->id, ev->status,
+	      ev->x, ev->y);
+}
+
+/* ---- repeticao ---- */
+
+static const touch_rec_t *gs_recs;
+static uint32_t gs_count;
+static uint32_t gs_next;                // proximo a ser lido
+static volatile uint32_t gs_due;        // eventos que ja venceram
+static uint64_t gs_t0;
+
+/* Marca os eventos vencidos e arma o timer para o seguinte */
+static void replay_tick(sw_timer_t *t)
+{
+	uint64_t now = now_us();
+	uint32_t due = gs_due;
+
+	while (due < gs_count && gs_t0 + gs_recs[due].t_us <= now) {
+		due++;
+	}
+	gs_due = due;
+	if (due < gs_count) {
+		timer_start(t, (uint32_t)(gs_t0 + gs_recs[due].t_us - now), 0);
+	}
+}
+
+static sw_timer_t gs_replay_timer = TIMER_INIT(replay_tick);
+
+/**
+ * \brief Comeca a entregar \a recs a partir de agora; \a recs tem que
+ * continuar valido ate o fim.
+ */
+void touch_replay_start(const touch_rec_t *recs, uint32_t count)
+{
+	timer_stop(&gs_replay_timer);
+	gs_recs = recs;
+	gs_count = count;
+	gs_next = 0;
+	gs_due = 0;
+	gs_t0 = now_us();
+	replay_tick(&gs_replay_timer);
+}
+
+void touch_replay_stop(void)
+{
+	timer_stop(&gs_replay_timer);
+	gs_count = 0;
+	gs_next = 0;
+	gs_due = 0;
+}
+
+/* Ha um evento vencido esperando touch_replay_read() */
+bool touch_replay_pending(void)
+{
+	return gs_next < gs_due;
+}
+
+/**
+ * \brief Proximo evento vencido da sessao, com o instante em que ele
+ * deveria ter chegado.
+ */
+bool touch_replay_read(struct mxt_touch_event *ev, uint64_t *t_us)
+{
+	const touch_rec_t *r;
+
+	if (gs_next >= gs_due) {
+		return false;
+	}
+	r = &gs_recs[gs_next++];
+	memset(ev, 0, sizeof(*ev));
+	ev->id = r->id;
+	ev->status = r->status;
+	ev->x = r->x;
+	ev->y = r->y;
+	*t_us = gs_t0 + r->t_us;
+	return true;
+}
+
+/* ---- latencia ---- */
+
+static uint32_t gs_samples[TOUCH_REPLAY_SAMPLES];
+static uint32_t gs_nsamples;
+static uint64_t gs_input_us;
+static bool gs_input;
+static bool gs_drawn;
+
+/**
+ * \brief Um evento do instante \a t_us chegou a interface nesta volta do
+ * main loop. Com varios na mesma volta vale o mais antigo.
+ */
+void touch_replay_input(uint64_t t_us)
+{
+	if (!gs_input) {
+		gs_input = true;
+		gs_input_us = t_us;
+	}
+}
+
+/**
+ * \brief Quem tratou um toque desta volta mudou a tela por causa dele (a
+ * interface tomou uma transicao, a calibracao desenhou um alvo). Desenhos
+ * que nao vem de toques, como a animacao, nao chamam.
+ */
+void touch_replay_drawn(void)
+{
+	gs_drawn = gs_input;
+}
+
+/**
+ * \brief Fim da volta do main loop: se a entrada desta volta mudou a tela,
+ * a tela ficou pronta agora.
+ */
+void touch_replay_frame(void)
+{
+	if (gs_input && gs_drawn) {
+		uint64_t lat = now_us() - gs_input_us;
+
+		gs_samples[gs_nsamples++ % TOUCH_REPLAY_SAMPLES] =
+				(uint32_t)Min(lat, (uint64_t)UINT32_MAX);
+	}
+	gs_input = false;
+	gs_drawn = false;
+}
+
+/* Percentil pelo posto mais proximo, sobre as amostras ordenadas */
+static uint32_t percentile(const uint32_t *sorted, uint32_t n, uint32_t pct)
+{
+	uint32_t rank = (n * pct + 99) / 100;
+
+	return sorted[Max(rank, 1u) - 1];
+}
+
+void touch_replay_get_latency(touch_latency_t *out)
+{
+	uint32_t s[TOUCH_REPLAY_SAMPLES];
+	uint32_t n = Min(gs_nsamples, (uint32_t)TOUCH_REPLAY_SAMPLES);
+	uint32_t i, j;
+
+	memset(out, 0, sizeof(*out));
+	out->count = gs_nsamples;
+	if (n == 0) {
+		return;
+	}
+
+	/* poucas amostras e so no dump: insercao basta */
+	for (i = 0; i < n; i++) {
+		uint32_t v = gs_samples[i];
+
+		for (j = i; j > 0 && s[j - 1] > v; j--) {
+			s[j] = s[j - 1];
+		}
+		s[j] = v;
+	}
+	out->p50_us = percentile(s, n, 50);
+	out->p99_us = percentile(s, n, 99);
+	out->max_us = s[n - 1];
+}
+
+void touch_replay_reset(void)
+{
+	gs_nsamples = 0;
+	gs_input = false;
+	gs_drawn = false;
+}
+
+void touch_replay_dump(void)
+{
+	touch_latency_t l;
+
+	touch_replay_get_latency(&l);
+	printf("\n\rlatencia toque -> tela: %lu medidas", (unsigned long)l.count);
+	if (l.count) {
+		printf(", p50 %lu.%03lu ms  p99 %lu.%03lu ms  max %lu.%03lu ms",
+				(unsigned long)(l.p50_us / 1000), (unsigned long)(l.p50_us % 1000),
+				(unsigned long)(l.p99_us / 1000), (unsigned long)(l.p99_us % 1000),
+				(unsigned long)(l.max_us / 1000), (unsigned long)(l.max_us % 1000));
+	}
+	printf("\n\r");
+	if (gs_count) {
+		printf("  repeticao: %lu de %lu eventos\n\r", (unsigned long)gs_next,
+				(unsigned long)gs_count);
+	}
+}
@@ -0,0 +1,70 @@
+/*
+ * touch_replay.h
+ *
+ * Created: 18/10/2026
+ *
+ * Gravar e repetir sessoes de toque, e medir a latencia toque -> tela.
+ *
+ * Gravacao ('e' pela serial liga e desliga): cada evento lido do maXTouch,
+ * cru (antes da calibracao), vai para o trace da console como TOUCH_REC
+ * com os microssegundos desde o evento gravado anterior.
+ * tools/touch_session.py tira os TOUCH_REC de uma captura e escreve a
+ * sessao: uma linha "t_us id status x y" por evento, com t_us desde o
+ * primeiro, ou um vetor de touch_rec_t para compilar no firmware.
+ *
+ * Repeticao: touch_replay_start() entrega os eventos da sessao nos tempos
+ * gravados, por um timer (timer.h); o mxt_handler os le com
+ * touch_replay_read() antes dos do maXTouch, entao eles passam por tudo que
+ * um toque passa (calibracao, filtro, contatos, interface). No build de
+ * host o roteiro carrega uma sessao com "replay arquivo".
+ *
+ * Latencia: do instante do evento (o gravado, na repeticao) ate o fim da
+ * volta do main loop que desenhou a resposta. So contam eventos que chegam
+ * a interface e que quem os tratou diz que mudaram a tela
+ * (touch_replay_drawn()); a animacao e a contagem desenhadas na mesma volta
+ * nao contam. 'l' imprime p50, p99 e maximo das ultimas
+ * TOUCH_REPLAY_SAMPLES medidas.
+ */
+
+
+#ifndef TOUCH_REPLAY_H_
+#define TOUCH_REPLAY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <asf.h>
+
+#define TOUCH_REPLAY_SAMPLES    128
+
+/* Um evento da sessao, como o maXTouch reportou */
+typedef struct {
+	uint32_t t_us;              // desde o primeiro evento da sessao
+	uint8_t id;
+	uint8_t status;
+	uint16_t x, y;              // 0..4095
+} touch_rec_t;
+
+typedef struct {
+	uint32_t count;             // medidas desde o reset
+	uint32_t p50_us;
+	uint32_t p99_us;
+	uint32_t max_us;
+} touch_latency_t;
+
+void touch_replay_record(bool enable);
+bool touch_replay_recording(void);
+void touch_replay_log(const struct mxt_touch_event *ev);
+
+void touch_replay_start(const touch_rec_t *recs, uint32_t count);
+void touch_replay_stop(void);
+bool touch_replay_pending(void);
+bool touch_replay_read(struct mxt_touch_event *ev, uint64_t *t_us);
+
+void touch_replay_input(uint64_t t_us);
+void touch_replay_drawn(void);
+void touch_replay_frame(void);
+void touch_replay_get_latency(touch_latency_t *out);
+void touch_replay_reset(void);
+void touch_replay_dump(void);
+
+#endif /* TOUCH_REPLAY_H_ */
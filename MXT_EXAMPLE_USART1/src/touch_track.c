@@ -0,0 +1,110 @@
+/*
+ * touch_track.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include <stdio.h>
+#include <string.h>
+#include "touch_track.h"
+#include "touch_filter.h"
+#include "timebase.h"
+#include "trace.h"
+#include "tcm.h"
+
+static touch_contact_t gs_slots[TOUCH_TRACK_SLOTS];
+static uint8_t gs_down;         // bit por contato na tela
+static touch_track_stats_t gs_stats;
+
+static TCM_CODE uint8_t popcount8(uint8_t v)
+{
+	v = v - ((v >> 1) & 0x55);
+	v = (v & 0x33) + ((v >> 2) & 0x33);
+	return (v + (v >> 4)) & 0x0F;
+}
+
+/**
+ * \brief Atualiza o contato \a id com um evento do T9 (ja calibrado e
+ * filtrado) e descreve a mudanca em \a out.
+ *
+ * \return false se o evento nao muda nada (id fora da tabela, release de
+ * um dedo que nao estava na tela).
+ */
+TCM_CODE bool touch_track_update(uint8_t id, uint8_t status, uint32_t x, uint32_t y,
+		touch_delta_t *out)
+{
+	touch_contact_t *c;
+	uint8_t bit;
+
+	if (id >= TOUCH_TRACK_SLOTS) {
+		return false;
+	}
+	c = &gs_slots[id];
+	bit = (uint8_t)(1u << id);
+
+	if (status & TOUCH_FILTER_RELEASE) {
+		if (!(gs_down & bit)) {
+			return false;
+		}
+		out->kind = TOUCH_TRACK_UP;
+		c->state = TOUCH_TRACK_UP;
+		gs_down &= ~bit;
+	} else if ((status & TOUCH_FILTER_PRESS) || !(gs_down & bit)) {
+		if (gs_down & bit) {
+			gs_stats.lost++;
+		}
+		gs_down &= ~bit;
+		c->state = TOUCH_TRACK_DOWN;
+		c->primary = gs_down == 0;
+		c->start_us = now_us();
+		c->start_x = c->x = (uint16_t)x;
+		c->start_y = c->y = (uint16_t)y;
+		gs_down |= bit;
+
+		gs_stats.contacts++;
+		gs_stats.secondary += !c->primary;
+		gs_stats.max_down = Max(gs_stats.max_down, popcount8(gs_down));
+		out->kind = TOUCH_TRACK_DOWN;
+	} else {
+		out->kind = TOUCH_TRACK_MOVE;
+		c->state = TOUCH_TRACK_MOVE;
+	}
+
+	out->id = id;
+	out->primary = c->primary;
+	out->dx = (int16_t)((int32_t)x - c->x);
+	out->dy = (int16_t)((int32_t)y - c->y);
+	out->x = c->x = (uint16_t)x;
+	out->y = c->y = (uint16_t)y;
+	TRACE(CONTACT, out->id, out->kind, out->primary, out->dx, out->dy);
+	return true;
+}
+
+const touch_contact_t *touch_track_get(uint8_t id)
+{
+	return id < TOUCH_TRACK_SLOTS ? &gs_slots[id] : NULL;
+}
+
+/* Quantos dedos estao na tela */
+uint8_t touch_track_down(void)
+{
+	return popcount8(gs_down);
+}
+
+void touch_track_get_stats(touch_track_stats_t *out)
+{
+	*out = gs_stats;
+}
+
+void touch_track_reset_stats(void)
+{
+	memset(&gs_stats, 0, sizeof(gs_stats));
+}
+
+void touch_track_dump(void)
+{
+	printf("contatos: %lu, %lu secundarios, %lu sem release, ate %u juntos\n\r",
+			(unsigned long)gs_stats.contacts, (unsigned long)gs_stats.secondary,
+			(unsigned long)gs_stats.lost, (unsigned)gs_stats.max_down);
+}
@@ -0,0 +1,66 @@
+/*
+ * touch_track.h
+ *
+ * Created: 18/10/2026
+ *
+ * Contatos do toque: uma entrada por id do T9 (o report id menos o
+ * primeiro do T9, mxt_touch_event.id), com o estado do dedo, onde e
+ * quando ele encostou e onde esta. Cada evento vira um touch_delta_t
+ * pequeno (o que mudou desde o evento anterior do mesmo dedo), para as
+ * camadas de cima seguirem cada dedo sem guardar historico.
+ *
+ * O primeiro dedo a encostar com a tela livre e o principal; so ele
+ * aperta botoes. Um segundo dedo enquanto o principal esta na tela e
+ * seguido, mas touch_delta_t.primary vem falso. Se o principal sai antes,
+ * os outros continuam secundarios ate todos sairem.
+ */
+
+
+#ifndef TOUCH_TRACK_H_
+#define TOUCH_TRACK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ids do T9 seguidos (NUMTOUCH do T9 e 2); ids acima sao descartados */
+#define TOUCH_TRACK_SLOTS   4
+
+enum {
+	TOUCH_TRACK_UP,             // solto (estado) / soltou (delta)
+	TOUCH_TRACK_DOWN,           // encostou
+	TOUCH_TRACK_MOVE            // arrastando
+};
+
+typedef struct {
+	uint8_t state;              // TOUCH_TRACK_*
+	bool primary;
+	uint64_t start_us;
+	uint16_t start_x, start_y;
+	uint16_t x, y;
+} touch_contact_t;
+
+/* O que um evento mudou num contato */
+typedef struct {
+	uint8_t id;
+	uint8_t kind;               // TOUCH_TRACK_DOWN, _MOVE ou _UP
+	bool primary;
+	int16_t dx, dy;             // desde o evento anterior do contato
+	uint16_t x, y;
+} touch_delta_t;
+
+typedef struct {
+	uint32_t contacts;          // dedos que encostaram
+	uint32_t secondary;         // deles, os que nao eram o principal
+	uint32_t lost;              // press com o dedo ja na tela (release perdido)
+	uint8_t max_down;           // dedos na tela ao mesmo tempo
+} touch_track_stats_t;
+
+bool touch_track_update(uint8_t id, uint8_t status, uint32_t x, uint32_t y,
+		touch_delta_t *out);
+const touch_contact_t *touch_track_get(uint8_t id);
+uint8_t touch_track_down(void);
+void touch_track_get_stats(touch_track_stats_t *out);
+void touch_track_reset_stats(void);
+void touch_track_dump(void);
+
+#endif /* TOUCH_TRACK_H_ */
@@ -0,0 +1,87 @@
+/*
+ * trace.c
+ *
+ * Created: 18/10/2026
+ */
+
+#include <asf.h>
+#include "trace.h"
+#include "console.h"
+#include "tcm.h"
+#include "timebase.h"
+
+/* cabecalho + tempo + argumentos, 5 bytes por varint de 32 bits no pior caso */
+#define TRACE_RECORD_MAX    (1 + 5 + 5 * TRACE_MAX_ARGS)
+
+static const uint8_t gs_nargs[TRACE_EVENT_COUNT] = {
+#define TRACE_EVENT(name, nargs, fields) nargs,
+#include "trace_events.h"
+#undef TRACE_EVENT
+};
+
+/* now_us() do ultimo registro */
+static uint64_t gs_last;
+static volatile bool gs_enabled;
+
+static inline uint8_t *put_varint(uint8_t *p, uint32_t v)
+{
+	while (v >= 0x80) {
+		*p++ = (uint8_t)v | 0x80;
+		v >>= 7;
+	}
+	*p++ = (uint8_t)v;
+	return p;
+}
+
+void trace_init(void)
+{
+	gs_last = now_us();
+	gs_enabled = true;
+	TRACE(INIT, TRACE_TICK_HZ, 0);
+}
+
+void trace_enable(bool enable)
+{
+	gs_enabled = enable;
+}
+
+/**
+ * \brief Grava um registro na console.
+ *
+ * As interrupcoes ficam desligadas so durante a codificacao e a copia para o
+ * anel, para que os registros saiam na ordem dos tempos (o tempo e relativo
+ * ao registro anterior).
+ *
+ * \param id Evento (TRACE_*).
+ * \param args Argumentos; sao lidos tantos quantos o evento declara.
+ */
+TCM_CODE void trace_emit(uint8_t id, const int32_t *args)
+{
+	uint8_t buf[TRACE_RECORD_MAX];
+	uint8_t *p = buf;
+	uint64_t now;
+	uint32_t ticks;
+	irqflags_t flags;
+	int i;
+
+	if (!gs_enabled || id >= TRACE_EVENT_COUNT) {
+		return;
+	}
+
+	flags = cpu_irq_save();
+
+	now = now_us();
+	ticks = (uint32_t)Min(now - gs_last, (uint64_t)UINT32_MAX);
+	gs_last = now;
+
+	*p++ = 0x80 | id;
+	p = put_varint(p, ticks);
+	for (i = 0; i < gs_nargs[id]; i++) {
+		int32_t v = args[i];
+		p = put_varint(p, ((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+	}
+
+	console_write((const char *)buf, p - buf);
+
+	cpu_irq_restore(flags);
+}
@@ -0,0 +1,56 @@
+/*
+ * trace.h
+ *
+ * Created: 18/10/2026
+ *
+ * Trace binario de eventos pela console, no lugar de mensagens de texto
+ * formatadas com sprintf.
+ *
+ * Cada registro tem um byte de cabecalho (0x80 | id), o tempo desde o
+ * registro anterior em microssegundos e os
+ * argumentos, todos como varint (7 bits por byte, bit 7 = continua; os
+ * argumentos em zigzag para negativos pequenos ocuparem pouco). Um toque
+ * cabe em ~10 bytes e custa algumas dezenas de ciclos, contra ~60 bytes e
+ * um sprintf.
+ *
+ * Texto comum (printf) continua passando pela mesma serial: fora de um
+ * registro os bytes < 0x80 sao texto, e tools/trace_decode.py separa os
+ * dois e converte o trace para texto ou CSV.
+ *
+ * O tempo vem de now_us() (timebase.h), que nao depende do clock da CPU e
+ * que o idle corrige com o RTT depois de cada sono; o CYCCNT para no WFI e
+ * no WAIT e daria intervalos sem o tempo dormido. O evento INIT diz a
+ * unidade (TRACE_TICK_HZ).
+ */
+
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Unidade do tempo dos registros; 1 ms entre eventos cabe em 2 bytes */
+#define TRACE_TICK_HZ       1000000
+
+#define TRACE_MAX_ARGS      6
+
+enum {
+#define TRACE_EVENT(name, nargs, fields) TRACE_ ## name,
+#include "trace_events.h"
+#undef TRACE_EVENT
+	TRACE_EVENT_COUNT
+};
+
+void trace_init(void);
+void trace_enable(bool enable);
+void trace_emit(uint8_t id, const int32_t *args);
+
+/* TRACE(TOUCH, id, x, y, ...): os argumentos viram int32_t; faltando algum
+ * em relacao a trace_events.h o resto vai como 0 */
+#define TRACE(name, ...) \
+	trace_emit(TRACE_ ## name, (const int32_t[TRACE_MAX_ARGS]){ __VA_ARGS__ })
+#define TRACE0(name) \
+	trace_emit(TRACE_ ## name, (const int32_t[TRACE_MAX_ARGS]){ 0 })
+
+#endif /* TRACE_H_ */
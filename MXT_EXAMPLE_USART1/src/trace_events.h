@@ -0,0 +1,24 @@
+/*
+ * trace_events.h
+ *
+ * Created: 18/10/2026
+ *
+ * Lista dos eventos do trace binario: TRACE_EVENT(nome, argumentos, "campos").
+ * O id de cada evento e a sua posicao na lista; tools/trace_decode.py le
+ * este arquivo para nomear os eventos e os campos, entao novos eventos vao
+ * sempre no fim e "campos" tem um nome por argumento.
+ */
+
+/* sem include guard: incluido mais de uma vez com TRACE_EVENT diferente */
+
+TRACE_EVENT(INIT,       2, "tick_hz shift")
+TRACE_EVENT(MARK,       1, "value")
+TRACE_EVENT(TOUCH,      6, "id x y status conv_x conv_y")
+TRACE_EVENT(RTC_TICK,   1, "tempo_sec")
+TRACE_EVENT(ANIM,       1, "frame")
+TRACE_EVENT(DOOR,       1, "open")
+TRACE_EVENT(CLOCK,      1, "cpu_hz")
+TRACE_EVENT(CONTACT,    5, "id kind primary dx dy")
+TRACE_EVENT(TOUCH_POWER, 1, "profile")
+TRACE_EVENT(TOUCH_REC,   5, "dt_us id status x y")
+TRACE_EVENT(HSM,        3, "state event to")
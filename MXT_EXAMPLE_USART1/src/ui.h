@@ -0,0 +1,51 @@
+/*
+ * ui.h
+ *
+ * Created: 18/10/2026
+ *
+ * Estados e eventos da interface (hsm.h): uma definicao com duas regioes
+ * ortogonais, a tela e o cadeado, cada uma numa instancia no main.c. As
+ * transicoes estao em ui_table.h.
+ */
+
+
+#ifndef UI_H_
+#define UI_H_
+
+#include <stdint.h>
+
+enum {
+	UI_MENU,
+	UI_DOOR_OPEN,       // lavar pedido com a porta aberta; ainda no menu
+	UI_CONFIG,
+	UI_RUNNING,
+	UI_UNLOCKED,
+	UI_LOCKED,
+	UI_LOCK_IDLE,
+	UI_LOCK_HOLD,       // dedo no cadeado, contando os segundos
+	UI_LOCK_READY,      // segurou o bastante: soltar destrava
+	UI_STATE_COUNT
+};
+
+enum {
+	UI_EV_START,        // botao Lavar
+	UI_EV_MODE,
+	UI_EV_CONFIG,
+	UI_EV_BACK,
+	UI_EV_OPTION,       // arg: linha da configuracao (config_option)
+	UI_EV_CANCEL,
+	UI_EV_DONE,         // a contagem chegou a zero
+	UI_EV_DOOR_OPEN,
+	UI_EV_DOOR_CLOSE,
+	UI_EV_REDRAW,
+	UI_EV_LOCK_PRESS,
+	UI_EV_LOCK_RELEASE,
+	UI_EV_RELEASE,      // soltou fora do cadeado
+	UI_EV_LOCK_HELD,    // UNLOCK_PRESS_SECONDS com o dedo no cadeado
+	UI_EV_TOUCH,        // toque cru, traduzido por update_screen()
+	UI_EV_COUNT
+};
+
+#define UI_TOUCH_ARG(x, y, s)  ((uint32_t)(s) << 24 | (uint32_t)(y) << 12 | (uint32_t)(x))
+
+#endif /* UI_H_ */
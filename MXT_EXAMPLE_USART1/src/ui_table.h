@@ -0,0 +1,70 @@
+/*
+ * ui_table.h
+ *
+ * Created: 18/10/2026
+ *
+ * Tabela da interface (ui.h): estados, transicoes e a definicao gs_ui.
+ * Incluida por main.c depois das acoes e guardas que ela cita, e pelo
+ * host/ui_bench.c com acoes de teste dos mesmos nomes, que confere o
+ * despacho de cada par estado/evento.
+ */
+
+/* sem include guard: as acoes vem de quem inclui */
+
+static const hsm_state_t gs_ui_states[UI_STATE_COUNT] = {
+	/*                 nome          pai           inicial       entrada           saida */
+	[UI_MENU]       = { "menu",       HSM_NONE,     HSM_NONE,     menu_entry,       NULL },
+	[UI_DOOR_OPEN]  = { "porta",      UI_MENU,      HSM_NONE,     door_open_entry,  NULL },
+	[UI_CONFIG]     = { "config",     HSM_NONE,     HSM_NONE,     config_entry,     NULL },
+	[UI_RUNNING]    = { "lavando",    HSM_NONE,     HSM_NONE,     running_entry,    running_exit },
+	[UI_UNLOCKED]   = { "destravado", HSM_NONE,     HSM_NONE,     unlocked_entry,   NULL },
+	[UI_LOCKED]     = { "travado",    HSM_NONE,     UI_LOCK_IDLE, NULL,             NULL },
+	[UI_LOCK_IDLE]  = { "parado",     UI_LOCKED,    HSM_NONE,     lock_idle_entry,  NULL },
+	[UI_LOCK_HOLD]  = { "segurando",  UI_LOCKED,    HSM_NONE,     lock_hold_entry,  lock_hold_exit },
+	[UI_LOCK_READY] = { "pronto",     UI_LOCK_HOLD, HSM_NONE,     lock_ready_entry, NULL },
+};
+
+/* Quem nao trata um evento herda do pai: a porta aberta e um menu, e o
+ * pronto continua segurando (soltar fora do cadeado volta a travar) */
+static const hsm_row_t gs_ui_rows[] = {
+	/* de              evento               para           guarda       acao */
+	{ UI_MENU,       UI_EV_START,        UI_RUNNING,    door_closed, NULL },
+	{ UI_MENU,       UI_EV_START,        UI_DOOR_OPEN,  NULL,        NULL },
+	{ UI_MENU,       UI_EV_MODE,         HSM_NONE,      NULL,        next_mode },
+	{ UI_MENU,       UI_EV_CONFIG,       UI_CONFIG,     NULL,        NULL },
+	{ UI_MENU,       UI_EV_REDRAW,       UI_MENU,       NULL,        NULL },
+	{ UI_DOOR_OPEN,  UI_EV_MODE,         UI_DOOR_OPEN,  NULL,        next_mode },
+	{ UI_DOOR_OPEN,  UI_EV_DOOR_CLOSE,   UI_RUNNING,    NULL,        NULL },
+	{ UI_CONFIG,     UI_EV_OPTION,       UI_CONFIG,     NULL,        config_option },
+	{ UI_CONFIG,     UI_EV_BACK,         UI_MENU,       NULL,        config_save },
+	{ UI_RUNNING,    UI_EV_CANCEL,       UI_MENU,       NULL,        NULL },
+	{ UI_RUNNING,    UI_EV_DONE,         UI_MENU,       NULL,        NULL },
+	{ UI_RUNNING,    UI_EV_DOOR_OPEN,    UI_MENU,       NULL,        NULL },
+
+	{ UI_UNLOCKED,   UI_EV_LOCK_PRESS,   UI_LOCK_HOLD,  NULL,        NULL },
+	{ UI_LOCKED,     UI_EV_LOCK_PRESS,   UI_LOCK_HOLD,  NULL,        NULL },
+	{ UI_LOCK_HOLD,  UI_EV_LOCK_HELD,    UI_LOCK_READY, NULL,        NULL },
+	{ UI_LOCK_HOLD,  UI_EV_LOCK_RELEASE, UI_LOCK_IDLE,  NULL,        NULL },
+	{ UI_LOCK_HOLD,  UI_EV_RELEASE,      UI_LOCK_IDLE,  NULL,        NULL },
+	{ UI_LOCK_READY, UI_EV_LOCK_RELEASE, UI_UNLOCKED,   NULL,        unlock },
+};
+
+static const char *const gs_ui_events[UI_EV_COUNT] = {
+	"lavar", "modo", "configurar", "voltar", "opcao", "cancelar", "fim",
+	"porta_abre", "porta_fecha", "redesenha", "cadeado", "cadeado_solta",
+	"solta", "cadeado_3s", "toque"
+};
+
+static uint8_t gs_ui_index[UI_STATE_COUNT * UI_EV_COUNT];
+static uint16_t gs_ui_hits[sizeof(gs_ui_rows) / sizeof(gs_ui_rows[0])];
+
+static const hsm_def_t gs_ui = {
+	.states  = gs_ui_states,
+	.rows    = gs_ui_rows,
+	.events  = gs_ui_events,
+	.nstates = UI_STATE_COUNT,
+	.nrows   = sizeof(gs_ui_rows) / sizeof(gs_ui_rows[0]),
+	.nevents = UI_EV_COUNT,
+	.index   = gs_ui_index,
+	.hits    = gs_ui_hits,
+};
@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""
+Monta o pacote de assets (imagens e fontes) gravado na regiao de flash
+"assets" (ver flash.ld e src/assets.h).
+
+Uso:
+    asset_pack.py [--bin assets.bin] [--ids assets_id.h] assets.list
+
+A lista tem uma linha por asset, caminhos relativos ao arquivo da lista:
+
+    # id              tipo     bpp  arquivo                 [tema=arquivo ...]
+    ANIMA_D0          image    8    Anima/D0.h
+    ICON_LOCK         indexed  -    Icons/WashI/lock.h
+    FONT_CALIBRI_36   font     4    calibri_36.h
+
+    image    header RGB888 do lcd-image-converter, quantizado para bpp (4/8);
+             temas (NOME=outra.h) viram paletas <ID>_<NOME>
+    indexed  header ja indexado gerado por imgconv.py; as paletas de tema
+             (palette_<nome>_<tema>) viram paletas <ID>_<TEMA>
+    font     fonte do lcd-image-converter, todos os glifos com uma paleta
+
+Formato (little-endian):
+
+    cabecalho   magic "WPAK", versao u16, quantidade u16, tamanho u32, 0 u32
+    tabela      quantidade x {offset u32, tamanho u32, largura u16,
+                altura u16, tipo u8, bpp u8, cores u16}
+    dados       cada asset alinhado em 32 bytes (linha de cache)
+
+    imagem      paleta (cores x RGB888), alinhada em 4, seguida dos indices
+                (linhas alinhadas em byte, 4 bpp com o pixel da esquerda no
+                nibble alto)
+    paleta      cores x RGB888
+    fonte       paleta, alinhada em 4, primeiro u8, ultimo u8, 0 u16 e um
+                glifo por caractere {offset u32, largura u16, altura u16};
+                os indices de cada glifo ficam alinhados em 4
+
+O id de cada asset e a sua posicao na tabela, entao a busca no firmware e
+um acesso direto. Gera tambem assets_id.h com os ids.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import imgconv  # noqa: E402
+
+MAGIC = b'WPAK'
+VERSION = 1
+HEADER = struct.Struct('<4sHHII')
+ENTRY = struct.Struct('<IIHHBBH')
+GLYPH = struct.Struct('<IHH')
+
+TYPE_IMAGE = 0
+TYPE_PALETTE = 1
+TYPE_FONT = 2
+
+DATA_ALIGN = 32
+
+
+def align(n, a):
+    return (n + a - 1) & ~(a - 1)
+
+
+def c_bytes(text, name):
+    m = re.search(r'const uint8_t %s\[\d+\] = \{(.*?)\};' % re.escape(name), text, re.S)
+    if m is None:
+        raise ValueError('array %s nao encontrado' % name)
+    return bytes(int(x, 16) for x in re.findall(r'0x([0-9a-fA-F]{2})', m.group(1)))
+
+
+def palette_bytes(palette):
+    return bytes(ch for c in palette for ch in c)
+
+
+class Asset(object):
+    def __init__(self, ident, kind, width, height, bpp, colors, payload):
+        self.ident = ident
+        self.kind = kind
+        self.width = width
+        self.height = height
+        self.bpp = bpp
+        self.colors = colors
+        self.payload = payload      # funcao(offset) -> bytes
+
+
+def image_payload(palette, data):
+    pal = palette_bytes(palette)
+    return lambda offset: pal + bytes(align(len(pal), 4) - len(pal)) + data
+
+
+def load_image(ident, bpp, path, themes):
+    img = imgconv.load_header(path)
+    others = [imgconv.load_header(p) for _, p in themes]
+    palettes, indices = imgconv.quantize([img] + others, bpp)
+    data = imgconv.pack(indices, img.width, bpp)
+    out = [Asset(ident, TYPE_IMAGE, img.width, img.height, bpp, len(palettes[0]),
+                 image_payload(palettes[0], data))]
+    for (name, _), pal in zip(themes, palettes[1:]):
+        pb = palette_bytes(pal)
+        out.append(Asset('%s_%s' % (ident, name.upper()), TYPE_PALETTE, 0, 0, 0,
+                         len(pal), lambda offset, pb=pb: pb))
+    return out
+
+
+def load_indexed(ident, path):
+    text = open(path).read()
+    m = re.search(r'const tIndexedImage (\w+) = \{ (\w+), (\d+), (\d+),\s*(\d+), (\w+) \};', text)
+    if m is None:
+        raise ValueError('%s: tIndexedImage nao encontrado' % path)
+    name, data_name = m.group(1), m.group(2)
+    width, height, bpp = int(m.group(3)), int(m.group(4)), int(m.group(5))
+    pal = c_bytes(text, m.group(6))
+    data = c_bytes(text, data_name)
+    palette = [tuple(pal[i:i + 3]) for i in range(0, len(pal), 3)]
+    out = [Asset(ident, TYPE_IMAGE, width, height, bpp, len(palette),
+                 image_payload(palette, data))]
+    for theme in re.findall(r'const uint8_t palette_%s_(\w+)\[' % name, text):
+        pb = c_bytes(text, 'palette_%s_%s' % (name, theme))
+        out.append(Asset('%s_%s' % (ident, theme.upper()), TYPE_PALETTE, 0, 0, 0,
+                         len(pb) // 3, lambda offset, pb=pb: pb))
+    return out
+
+
+def load_font(ident, bpp, path):
+    text = open(path).read()
+    m = re.search(r"const tFont \w+ = \{ \d+, \w+, '(.)', '(.)' \};", text)
+    if m is None:
+        raise ValueError('%s: tFont nao encontrado' % path)
+    first, last = ord(m.group(1)), ord(m.group(2))
+
+    glyphs = {}
+    for name, data_name, w, h in re.findall(
+            r'static const tImage (\w+) = \{ (\w+),\s*(\d+), (\d+)', text):
+        code = int(name.rsplit('_0x', 1)[1], 16)
+        w, h = int(w), int(h)
+        data = c_bytes(text, data_name)
+        glyphs[code] = imgconv.Image(name, w, h,
+                                     [tuple(data[i:i + 3]) for i in range(0, w * h * 3, 3)])
+    missing = [c for c in range(first, last + 1) if c not in glyphs]
+    if missing:
+        raise ValueError('%s: glifos ausentes %s' % (path, missing))
+
+    # Uma paleta para a fonte inteira: quantiza todos os glifos como uma imagem so
+    codes = list(range(first, last + 1))
+    allpx = imgconv.Image(ident, 1, 0, [p for c in codes for p in glyphs[c].pixels])
+    (palette,), indices = imgconv.quantize([allpx], bpp)
+
+    packed = []
+    pos = 0
+    for c in codes:
+        g = glyphs[c]
+        n = g.width * g.height
+        packed.append((g, imgconv.pack(indices[pos:pos + n], g.width, bpp)))
+        pos += n
+
+    def payload(offset):
+        pal = palette_bytes(palette)
+        out = bytearray(pal + bytes(align(len(pal), 4) - len(pal)))
+        out += struct.pack('<BBH', first, last, 0)
+        table = len(out)
+        out += bytes(GLYPH.size * len(packed))
+        for i, (g, data) in enumerate(packed):
+            out += bytes(align(len(out), 4) - len(out))
+            GLYPH.pack_into(out, table + i * GLYPH.size, offset + len(out), g.width, g.height)
+            out += data
+        return bytes(out)
+
+    return [Asset(ident, TYPE_FONT, max(g.width for g in glyphs.values()),
+                  max(g.height for g in glyphs.values()), bpp, len(palette), payload)]
+
+
+def load_list(path):
+    base = os.path.dirname(os.path.abspath(path))
+    assets = []
+    for lineno, line in enumerate(open(path), 1):
+        line = line.split('#', 1)[0].split()
+        if not line:
+            continue
+        if len(line) < 4:
+            raise SystemExit('%s:%d: esperado "id tipo bpp arquivo"' % (path, lineno))
+        ident, kind, bpp, src = line[:4]
+        src = os.path.join(base, src)
+        themes = [t.split('=', 1) for t in line[4:]]
+        themes = [(n, os.path.join(base, p)) for n, p in themes]
+        if kind == 'image':
+            assets += load_image(ident, int(bpp), src, themes)
+        elif kind == 'indexed':
+            assets += load_indexed(ident, src)
+        elif kind == 'font':
+            assets += load_font(ident, int(bpp), src)
+        else:
+            raise SystemExit('%s:%d: tipo desconhecido %s' % (path, lineno, kind))
+    return assets
+
+
+def build(assets):
+    table_end = HEADER.size + ENTRY.size * len(assets)
+    blob = bytearray(align(table_end, DATA_ALIGN))
+    for i, a in enumerate(assets):
+        offset = len(blob)
+        data = a.payload(offset)
+        blob += data
+        blob += bytes(align(len(blob), DATA_ALIGN) - len(blob))
+        ENTRY.pack_into(blob, HEADER.size + i * ENTRY.size, offset, len(data),
+                        a.width, a.height, a.kind, a.bpp, a.colors)
+    HEADER.pack_into(blob, 0, MAGIC, VERSION, len(assets), len(blob), 0)
+    return bytes(blob)
+
+
+def write_ids(path, assets, size):
+    out = ['/*',
+           ' * assets_id.h',
+           ' *',
+           ' * Gerado por tools/asset_pack.py, nao editar.',
+           ' */',
+           '',
+           '#ifndef ASSETS_ID_H_',
+           '#define ASSETS_ID_H_',
+           '',
+           '#define ASSETS_PACK_SIZE    %d' % size,
+           '#define ASSETS_COUNT        %d' % len(assets),
+           '']
+    for i, a in enumerate(assets):
+        out.append('#define ASSET_%-24s %d' % (a.ident, i))
+    out += ['', '#endif /* ASSETS_ID_H_ */', '']
+    open(path, 'w').write('\n'.join(out))
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument('--bin', default='assets.bin')
+    ap.add_argument('--ids', default='assets_id.h')
+    ap.add_argument('list')
+    args = ap.parse_args(argv)
+
+    assets = load_list(args.list)
+    names = [a.ident for a in assets]
+    dup = set(n for n in names if names.count(n) > 1)
+    if dup:
+        raise SystemExit('ids repetidos: %s' % ', '.join(sorted(dup)))
+
+    blob = build(assets)
+    open(args.bin, 'wb').write(blob)
+    write_ids(args.ids, assets, len(blob))
+
+    kinds = {TYPE_IMAGE: 'image', TYPE_PALETTE: 'palette', TYPE_FONT: 'font'}
+    for i, a in enumerate(assets):
+        e = ENTRY.unpack_from(blob, HEADER.size + i * ENTRY.size)
+        print('%3d %-26s %-7s %4dx%-4d %2d bpp %8d bytes' % (
+            i, a.ident, kinds[a.kind], a.width, a.height, a.bpp, e[1]))
+    print('%d assets, %d bytes' % (len(assets), len(blob)))
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""
+Converte as imagens RGB888 geradas pelo lcd-image-converter (Icons/*/*.h)
+para o formato indexado (tIndexedImage, 4 ou 8 bits por pixel com paleta).
+
+Uso:
+    imgconv.py [--bpp 4|8] [--out DIR] [--theme NOME=outra.h ...] imagem.h ...
+
+Para cada imagem gera DIR/<nome>.h com os indices empacotados e a paleta, e
+imprime um relatorio de tamanho em flash e de bytes lidos por quadro.
+
+--theme gera uma paleta extra para o mesmo bitmap. A imagem base e as dos
+temas (mesmo tamanho e desenho) sao quantizadas juntas, entao cada indice
+tem uma cor coerente em todas elas e estados como cadeado
+cinza/vermelho/verde viram uma troca de paleta.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Velocidade do SPI do LCD (conf_ili9488.h) e do barramento de flash usada
+# na estimativa de vazao.
+SPI_BAUDRATE = 20000000
+
+
+class Image(object):
+    def __init__(self, name, width, height, pixels):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.pixels = pixels        # lista de tuplas (r, g, b)
+
+
+def load_header(path):
+    """Le um header RGB888 do lcd-image-converter."""
+    text = open(path).read()
+    m = re.search(r'static const uint8_t (\w+)\[\d+\] = \{(.*?)\};', text, re.S)
+    if m is None:
+        raise ValueError('%s: array de imagem nao encontrado' % path)
+    data = bytes(int(x, 16) for x in re.findall(r'0x([0-9a-fA-F]{2})', m.group(2)))
+    m = re.search(r'const tImage (\w+) = \{ \w+, (\d+), (\d+)', text)
+    if m is None:
+        raise ValueError('%s: tImage nao encontrado' % path)
+    name, width, height = m.group(1), int(m.group(2)), int(m.group(3))
+    if len(data) < width * height * 3:
+        raise ValueError('%s: dados menores que %dx%d' % (path, width, height))
+    pixels = [tuple(data[i:i + 3]) for i in range(0, width * height * 3, 3)]
+    return Image(name, width, height, pixels)
+
+
+def median_cut(colors, count):
+    """Reduz {cor: ocorrencias} para no maximo count cores (median cut).
+
+    As cores podem ter qualquer numero de canais, o que permite quantizar
+    varias imagens juntas (um vetor com os canais de todas elas).
+    """
+    dims = len(next(iter(colors)))
+    boxes = [list(colors.items())]
+    while len(boxes) < count:
+        best, best_range, best_ch = None, -1, 0
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            for ch in range(dims):
+                vals = [c[ch] for c, _ in box]
+                r = max(vals) - min(vals)
+                if r > best_range:
+                    best, best_range, best_ch = i, r, ch
+        if best is None:
+            break
+        box = sorted(boxes.pop(best), key=lambda e: e[0][best_ch])
+        total = sum(n for _, n in box)
+        acc, cut = 0, 1
+        for cut, (_, n) in enumerate(box, 1):
+            acc += n
+            if acc * 2 >= total:
+                break
+        cut = min(max(cut, 1), len(box) - 1)
+        boxes += [box[:cut], box[cut:]]
+    palette = []
+    for box in boxes:
+        total = sum(n for _, n in box)
+        palette.append(tuple((sum(c[ch] * n for c, n in box) + total // 2) // total
+                             for ch in range(dims)))
+    return palette
+
+
+def quantize(images, bpp):
+    """Quantiza uma ou mais imagens do mesmo tamanho com um unico bitmap.
+
+    Retorna (paletas, indices): uma paleta de no maximo 2^bpp cores por
+    imagem, todas indexadas pelo mesmo bitmap.
+    """
+    vectors = [sum(px, ()) for px in zip(*(img.pixels for img in images))]
+    colors = {}
+    for v in vectors:
+        colors[v] = colors.get(v, 0) + 1
+    if len(colors) <= (1 << bpp):
+        joint = sorted(colors, key=lambda c: -colors[c])
+    else:
+        joint = median_cut(colors, 1 << bpp)
+    cache = {}
+    indices = []
+    for v in vectors:
+        i = cache.get(v)
+        if i is None:
+            i = min(range(len(joint)),
+                    key=lambda k: sum((a - b) ** 2 for a, b in zip(v, joint[k])))
+            cache[v] = i
+        indices.append(i)
+    palettes = [[c[3 * n:3 * n + 3] for c in joint] for n in range(len(images))]
+    return palettes, indices
+
+
+def pack(indices, width, bpp):
+    """Empacota os indices; cada linha comeca num byte novo."""
+    out = bytearray()
+    for row in range(0, len(indices), width):
+        line = indices[row:row + width]
+        if bpp == 8:
+            out += bytes(line)
+        else:
+            for i in range(0, width, 2):
+                hi = line[i]
+                lo = line[i + 1] if i + 1 < width else 0
+                out.append((hi << 4) | lo)
+    return bytes(out)
+
+
+def psnr(a, b):
+    import math
+    se = sum((x - y) ** 2 for p, q in zip(a, b) for x, y in zip(p, q))
+    if se == 0:
+        return float('inf')
+    return 10 * math.log10(255.0 ** 2 * len(a) * 3 / se)
+
+
+def c_array(data, indent='    ', per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join('0x%02x' % b for b in data[i:i + per_line]))
+    return ',\n'.join(lines)
+
+
+def write_header(path, img, bpp, palette, data, themes):
+    guard = 'IDX_%s_H_' % img.name.upper()
+    pal_bytes = [ch for c in palette for ch in c]
+    out = []
+    out.append('/*******************************************************************************')
+    out.append('* indexed image (gerado por tools/imgconv.py, nao editar)')
+    out.append('* name: %s' % img.name)
+    out.append('* size: %dx%d, %d bits per pixel, %d cores' % (img.width, img.height, bpp, len(palette)))
+    out.append('*******************************************************************************/')
+    out.append('')
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('#include "tfont.h"')
+    out.append('')
+    out.append('static const uint8_t palette_%s[%d] = {' % (img.name, len(pal_bytes)))
+    out.append(c_array(pal_bytes))
+    out.append('};')
+    out.append('')
+    for theme, tpal in themes:
+        tbytes = [ch for c in tpal for ch in c]
+        out.append('static const uint8_t palette_%s_%s[%d] = {' % (img.name, theme, len(tbytes)))
+        out.append(c_array(tbytes))
+        out.append('};')
+        out.append('')
+    out.append('static const uint8_t image_data_%s[%d] = {' % (img.name, len(data)))
+    out.append(c_array(data))
+    out.append('};')
+    out.append('')
+    out.append('const tIndexedImage %s = { image_data_%s, %d, %d,' % (img.name, img.name, img.width, img.height))
+    out.append('    %d, palette_%s };' % (bpp, img.name))
+    out.append('')
+    out.append('#endif /* %s */' % guard)
+    out.append('')
+    open(path, 'w').write('\n'.join(out))
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument('--bpp', type=int, choices=(4, 8), default=8)
+    ap.add_argument('--out', default='.')
+    ap.add_argument('--name', help='nome da imagem gerada (padrao: o do tImage)')
+    ap.add_argument('--theme', action='append', default=[], metavar='NOME=ARQ.h')
+    ap.add_argument('images', nargs='+')
+    args = ap.parse_args(argv)
+
+    if (args.theme or args.name) and len(args.images) != 1:
+        ap.error('--theme e --name exigem uma unica imagem')
+
+    print('%-12s %9s %9s %6s %7s %9s %9s' % ('imagem', 'rgb888', 'indexada', 'razao',
+                                             'psnr', 'flash/px', 'spi ms'))
+    total_rgb = total_idx = 0
+    for path in args.images:
+        img = load_header(path)
+        if args.name:
+            img.name = args.name
+        others = []
+        for t in args.theme:
+            tname, tpath = t.split('=', 1)
+            other = load_header(tpath)
+            if (other.width, other.height) != (img.width, img.height):
+                raise SystemExit('%s: tamanho diferente de %s' % (tpath, path))
+            others.append((tname, other))
+
+        palettes, indices = quantize([img] + [o for _, o in others], args.bpp)
+        palette = palettes[0]
+        data = pack(indices, img.width, args.bpp)
+
+        themes = []
+        for (tname, other), tpal in zip(others, palettes[1:]):
+            themes.append((tname, tpal))
+            print('  tema %-8s psnr %.1f dB' % (tname, psnr([tpal[i] for i in indices], other.pixels)))
+
+        write_header(os.path.join(args.out, img.name + '.h'), img, args.bpp, palette, data, themes)
+
+        rgb = img.width * img.height * 3
+        idx = len(data) + len(palette) * 3
+        total_rgb += rgb
+        total_idx += idx
+        # O SPI continua recebendo 3 bytes/pixel; o que cai e a leitura da flash.
+        spi_ms = img.width * img.height * 3 * 8 * 1000.0 / SPI_BAUDRATE
+        print('%-12s %9d %9d %5.1fx %7.1f %9.2f %9.2f' % (
+            img.name, rgb, idx, float(rgb) / idx,
+            psnr([palette[i] for i in indices], img.pixels),
+            float(len(data)) / (img.width * img.height), spi_ms))
+
+    if len(args.images) > 1:
+        print('%-12s %9d %9d %5.1fx' % ('total', total_rgb, total_idx, float(total_rgb) / total_idx))
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+"""
+Refaz as telas do LCD a partir do registro do SPI gravado pelo build de host
+(sim -s spi.log) e mede o trafego.
+
+Uso:
+    spi_replay.py [--baud N] [--png DIR] [--expect ARQ | --save-expect ARQ]
+                  [--commands] spi.log
+
+Formato do registro (ver host/sim.h), little-endian:
+
+    cabecalho   "SPIL", versao u16, 0 u16, baud u32
+    registros   tipo u8 e conteudo:
+      0 comando     varint n, n bytes enviados com D/C baixo
+      1 dado        varint n, n bytes enviados com D/C alto
+      2 leitura     varint n, n bytes recebidos do LCD
+      3 marca       hash u32 da tela, n u8, nome
+
+Os bytes passam por um modelo do ILI9488 independente do simulador (janela
+CASET/PASET, RAMWR e RAMWR continue, COLMOD de 16 ou 18 bits). Em cada marca
+o hash FNV-1a da tela refeita tem que bater com o que o simulador gravou:
+se nao bater, o registro ou o modelo perderam alguma coisa.
+
+Para cada trecho entre marcas sai o total de bytes, comandos, janelas,
+pixels e o tempo de fio no baud do registro (ILI9488_SPI_BAUDRATE) ou no de
+--baud. Com --expect os hashes sao comparados com os de um arquivo
+"nome hash" por linha (gerado com --save-expect), o que faz do registro um
+teste de regressao para otimizacoes de desenho: os bytes podem mudar, as
+telas nao. Sai com status 1 em qualquer divergencia.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = b'SPIL'
+HEADER = struct.Struct('<4sHHI')
+
+REC_CMD = 0
+REC_DATA = 1
+REC_READ = 2
+REC_MARK = 3
+
+W = 320
+H = 480
+
+CMD_SWRESET = 0x01
+CMD_CASET = 0x2A
+CMD_PASET = 0x2B
+CMD_RAMWR = 0x2C
+CMD_COLMOD = 0x3A
+CMD_RAMWRC = 0x3C
+
+CMD_NAMES = {
+    0x00: 'NOP', 0x01: 'SWRESET', 0x11: 'SLPOUT', 0x13: 'NORON', 0x28: 'DISPOFF',
+    0x29: 'DISPON', 0x2A: 'CASET', 0x2B: 'PASET', 0x2C: 'RAMWR', 0x36: 'MADCTL',
+    0x3A: 'COLMOD', 0x3C: 'RAMWRC', 0x51: 'WRDISBV', 0xC9: 'CABC9', 0xD3: 'RDID4',
+    0xFB: 'SPIRD',
+}
+
+MASK6 = bytes(b & 0xFC for b in range(256))
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xffffffff
+    return h
+
+
+def save_png(path, fb):
+    row = W * 3
+    raw = b''.join(b'\x00' + bytes(fb[y * row:(y + 1) * row]) for y in range(H))
+
+    def chunk(kind, data):
+        c = zlib.crc32(kind + data) & 0xffffffff
+        return struct.pack('>I', len(data)) + kind + data + struct.pack('>I', c)
+
+    with open(path, 'wb') as f:
+        f.write(b'\x89PNG\r\n\x1a\n')
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', W, H, 8, 2, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(raw, 6)))
+        f.write(chunk(b'IEND', b''))
+
+
+class Stats(object):
+    def __init__(self):
+        self.bytes = 0
+        self.commands = 0
+        self.params = 0
+        self.pixel_bytes = 0
+        self.read_bytes = 0
+        self.windows = 0
+        self.pixels = 0
+        self.dc_toggles = 0
+        self.by_command = {}
+
+    def add(self, other):
+        for k, v in vars(other).items():
+            if k == 'by_command':
+                for c, n in v.items():
+                    self.by_command[c] = self.by_command.get(c, 0) + n
+            else:
+                setattr(self, k, getattr(self, k) + v)
+
+
+class Panel(object):
+    """ILI9488 em modo SPI, so o que muda a imagem."""
+
+    def __init__(self):
+        self.fb = bytearray(W * H * 3)
+        self.cmd = None
+        self.params = bytearray()
+        self.sc, self.ec, self.sp, self.ep = 0, W - 1, 0, H - 1
+        self.x0 = self.x1 = self.y0 = self.y1 = 0
+        self.cx = self.cy = 0
+        self.bpp = 3
+        self.pending = bytearray()
+
+    def command(self, cmd, st):
+        st.commands += 1
+        st.by_command[cmd] = st.by_command.get(cmd, 0) + 1
+        self.cmd = cmd
+        self.params = bytearray()
+        if cmd == CMD_SWRESET:
+            self.bpp = 3
+            self.sc, self.ec, self.sp, self.ep = 0, W - 1, 0, H - 1
+        elif cmd == CMD_RAMWR:
+            x0, x1 = min(self.sc, W - 1), min(self.ec, W - 1)
+            y0, y1 = min(self.sp, H - 1), min(self.ep, H - 1)
+            self.x0, self.x1 = min(x0, x1), max(x0, x1)
+            self.y0, self.y1 = min(y0, y1), max(y0, y1)
+            self.cx, self.cy = self.x0, self.y0
+            self.pending = bytearray()
+            st.windows += 1
+        elif cmd == CMD_RAMWRC:
+            self.pending = bytearray()
+
+    def data(self, buf, st):
+        if self.cmd in (CMD_RAMWR, CMD_RAMWRC):
+            st.pixel_bytes += len(buf)
+            self.pixels(buf, st)
+            return
+        st.params += len(buf)
+        self.params += buf
+        if self.cmd in (CMD_CASET, CMD_PASET) and len(self.params) >= 4:
+            s, e = struct.unpack('>HH', bytes(self.params[:4]))
+            if self.cmd == CMD_CASET:
+                self.sc, self.ec = s, e
+            else:
+                self.sp, self.ep = s, e
+        elif self.cmd == CMD_COLMOD and self.params:
+            self.bpp = 2 if (self.params[-1] & 0x07) == 0x05 else 3
+
+    def pixels(self, buf, st):
+        data = self.pending + buf
+        n = len(data) // self.bpp
+        self.pending = data[n * self.bpp:]
+        if self.bpp == 3:
+            rgb = bytes(data[:n * 3]).translate(MASK6)
+        else:
+            out = bytearray()
+            for i in range(0, n * 2, 2):
+                c = (data[i] << 8) | data[i + 1]
+                r, g, b = c >> 11, (c >> 5) & 0x3f, c & 0x1f
+                out += bytes((((r << 1) | (r >> 4)) << 2, g << 2, ((b << 1) | (b >> 4)) << 2))
+            rgb = bytes(out)
+        st.pixels += n
+        pos = 0
+        while pos < n:
+            run = min(n - pos, self.x1 - self.cx + 1)
+            o = (self.cy * W + self.cx) * 3
+            self.fb[o:o + run * 3] = rgb[pos * 3:(pos + run) * 3]
+            pos += run
+            self.cx += run
+            if self.cx > self.x1:
+                self.cx = self.x0
+                self.cy += 1
+                if self.cy > self.y1:
+                    self.cy = self.y0
+
+
+def read_varint(f):
+    value = shift = 0
+    while True:
+        b = f.read(1)
+        if not b:
+            raise EOFError
+        value |= (b[0] & 0x7f) << shift
+        if b[0] < 0x80:
+            return value
+        shift += 7
+
+
+def replay(f):
+    """Gera (nome, hash gravado, hash refeito, Stats do trecho, Panel)."""
+    panel = Panel()
+    st = Stats()
+    last = None
+    while True:
+        t = f.read(1)
+        if not t:
+            break
+        t = t[0]
+        if t == REC_MARK:
+            recorded, n = struct.unpack('<IB', f.read(5))
+            name = f.read(n).decode('utf-8', 'replace')
+            yield name, recorded, fnv1a(panel.fb), st, panel
+            st = Stats()
+            last = None
+            continue
+        if t not in (REC_CMD, REC_DATA, REC_READ):
+            raise ValueError('registro desconhecido %d na posicao %d' % (t, f.tell() - 1))
+        n = read_varint(f)
+        buf = f.read(n)
+        if len(buf) != n:
+            raise EOFError
+        st.bytes += n
+        if last is not None and t != last:
+            st.dc_toggles += 1
+        last = t
+        if t == REC_CMD:
+            for c in buf:
+                panel.command(c, st)
+        elif t == REC_DATA:
+            panel.data(buf, st)
+        else:
+            st.read_bytes += n
+
+
+def load_expect(path):
+    out = []
+    for line in open(path):
+        line = line.split('#', 1)[0].split()
+        if line:
+            out.append((line[0], int(line[1], 16)))
+    return out
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument('--baud', type=int, help='baud do SPI (padrao: o do registro)')
+    ap.add_argument('--png', metavar='DIR', help='grava cada marca como DIR/<nome>.png')
+    ap.add_argument('--expect', metavar='ARQ', help='hashes esperados, "nome hash" por linha')
+    ap.add_argument('--save-expect', metavar='ARQ', help='grava os hashes refeitos em ARQ')
+    ap.add_argument('--commands', action='store_true', help='contagem por comando')
+    ap.add_argument('log')
+    args = ap.parse_args(argv)
+
+    f = open(args.log, 'rb')
+    hdr = f.read(HEADER.size)
+    if len(hdr) != HEADER.size or hdr[:4] != MAGIC:
+        raise SystemExit('%s: nao e um registro do SPI' % args.log)
+    _, version, _, baud = HEADER.unpack(hdr)
+    if version != 1:
+        raise SystemExit('%s: versao %d nao suportada' % (args.log, version))
+    if args.baud:
+        baud = args.baud
+    if args.png:
+        os.makedirs(args.png, exist_ok=True)
+
+    expect = load_expect(args.expect) if args.expect and os.path.exists(args.expect) else None
+    if args.expect and expect is None:
+        sys.stderr.write('%s: nao existe, sem comparacao (make bench-accept)\n' % args.expect)
+
+    def ms(n):
+        return n * 8e3 / baud
+
+    print('%-22s %10s %7s %6s %8s %9s %6s  %-8s' % (
+        'marca', 'bytes', 'cmds', 'jan', 'pixels', 'fio ms', 'extra', 'hash'))
+    total = Stats()
+    marks = []
+    errors = 0
+    try:
+        for name, recorded, got, st, panel in replay(f):
+            total.add(st)
+            status = 'ok'
+            if got != recorded:
+                status = 'DIVERGE (simulador %08x)' % recorded
+                errors += 1
+            if expect is not None:
+                i = len(marks)
+                if i >= len(expect) or expect[i][0] != name:
+                    status += ' fora do esperado'
+                    errors += 1
+                elif expect[i][1] != got:
+                    status += ' MUDOU (esperado %08x)' % expect[i][1]
+                    errors += 1
+            marks.append((name, got))
+            overhead = st.bytes - st.pixel_bytes
+            print('%-22s %10d %7d %6d %8d %9.3f %5.1f%%  %08x %s' % (
+                name, st.bytes, st.commands, st.windows, st.pixels, ms(st.bytes),
+                100.0 * overhead / st.bytes if st.bytes else 0.0, got, status))
+            if args.png:
+                save_png(os.path.join(args.png, os.path.splitext(name)[0] + '.png'), panel.fb)
+    except EOFError:
+        sys.stderr.write('%s: registro truncado\n' % args.log)
+        errors += 1
+    except ValueError as e:
+        sys.stderr.write('%s: %s\n' % (args.log, e))
+        errors += 1
+
+    if expect is not None and len(marks) < len(expect):
+        sys.stderr.write('%d marcas esperadas, %d no registro\n' % (len(expect), len(marks)))
+        errors += 1
+
+    print('%-22s %10d %7d %6d %8d %9.3f %5.1f%%' % (
+        'total', total.bytes, total.commands, total.windows, total.pixels, ms(total.bytes),
+        100.0 * (total.bytes - total.pixel_bytes) / total.bytes if total.bytes else 0.0))
+    print('  pixels %d B, parametros %d B, leituras %d B, %d trocas de D/C, %.1f MHz' % (
+        total.pixel_bytes, total.params, total.read_bytes, total.dc_toggles, baud / 1e6))
+    if args.commands:
+        for c, n in sorted(total.by_command.items(), key=lambda kv: -kv[1]):
+            print('  0x%02x %-8s %8d' % (c, CMD_NAMES.get(c, ''), n))
+
+    if args.save_expect:
+        with open(args.save_expect, 'w') as out:
+            for name, h in marks:
+                out.write('%s %08x\n' % (name, h))
+
+    if errors:
+        sys.stderr.write('%s: %d divergencias\n' % (args.log, errors))
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
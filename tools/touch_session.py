@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""
+Tira uma sessao de toques gravada (src/touch_replay.h) de uma captura do
+trace da console.
+
+Uso:
+    touch_session.py [--events trace_events.h] [--c NOME] [-o saida]
+                     captura.bin|-
+
+Com 'e' pela serial o firmware manda cada evento do maXTouch como TOUCH_REC
+(intervalo desde o anterior, id, status, x, y crus). Cada gravacao
+(do aviso "gravacao de toques ligada" em diante) vira uma sessao; sai a
+ultima da captura.
+
+Saida padrao, um evento por linha, que o build de host le com
+"replay arquivo" no roteiro:
+
+    # t_us id status x y
+    0 0 192 1043 2120
+
+Com --c sai um vetor de touch_rec_t chamado NOME, para compilar no firmware
+e passar para touch_replay_start().
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from trace_decode import DEFAULT_EVENTS, Decoder, load_events  # noqa: E402
+
+
+def sessions(data, events):
+    """Lista de sessoes, cada uma uma lista de (t_us, id, status, x, y)."""
+    out = []
+    t = 0
+    for item in Decoder(events).feed(data):
+        if item[0] == 'text':
+            if 'gravacao de toques ligada' in item[1]:
+                out.append([])
+                t = 0
+            continue
+        if item[2].name != 'TOUCH_REC':
+            continue
+        dt, ident, status, x, y = item[3]
+        if not out:
+            out.append([])
+        t += dt
+        out[-1].append((t, ident & 0xff, status & 0xff, x & 0xffff, y & 0xffff))
+    return out
+
+
+def write_text(f, recs):
+    f.write('# t_us id status x y\n')
+    for r in recs:
+        f.write('%d %d %d %d %d\n' % r)
+
+
+def write_c(f, recs, name):
+    f.write('/* gerado por tools/touch_session.py */\n')
+    f.write('static const touch_rec_t %s[%d] = {\n' % (name, len(recs)))
+    for r in recs:
+        f.write('\t{ %9d, %d, 0x%02x, %4d, %4d },\n' % r)
+    f.write('};\n')
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument('--events', default=DEFAULT_EVENTS)
+    ap.add_argument('--c', metavar='NOME', help='vetor de touch_rec_t em C')
+    ap.add_argument('-o', '--output', help='arquivo de saida (padrao: saida padrao)')
+    ap.add_argument('input')
+    args = ap.parse_args(argv)
+
+    src = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb')
+    found = sessions(src.read(), load_events(args.events))
+    found = [s for s in found if s]
+    if not found:
+        raise SystemExit('%s: nenhum TOUCH_REC (gravacao ligada com e?)' % args.input)
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    if args.c:
+        write_c(out, found[-1], args.c)
+    else:
+        write_text(out, found[-1])
+    sys.stderr.write('%d eventos, %.3f s\n' % (len(found[-1]), found[-1][-1][0] / 1e6))
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
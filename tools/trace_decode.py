@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""
+Decodifica o trace binario da console (src/trace.h) para texto ou CSV.
+
+Uso:
+    trace_decode.py [--events trace_events.h] [--csv] [--event NOME]
+                    [--baud 115200] captura.bin|/dev/ttyACM0|-
+
+A entrada pode ser uma captura da serial, a propria porta (precisa do
+pyserial) ou - para a entrada padrao.
+
+Formato do registro (ver src/trace.h):
+
+    cabecalho   0x80 | id
+    tempo       varint, ticks de 2^shift / tick_hz s desde o registro anterior
+    argumentos  varint em zigzag, quantos o evento declara
+
+Bytes < 0x80 fora de um registro sao texto comum (printf) e saem como
+estao no modo texto; no CSV sao ignorados. A unidade do tempo (tick_hz e
+shift) vem do evento INIT, emitido no boot; antes dele supoe-se 1 MHz e
+shift 0, os microssegundos de now_us(). O evento CLOCK (governador,
+src/perf.c) so informa o clock da CPU: nao muda a unidade.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+DEFAULT_EVENTS = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              '..', 'MXT_EXAMPLE_USART1', 'src', 'trace_events.h')
+
+
+class Event(object):
+    def __init__(self, ident, name, fields):
+        self.ident = ident
+        self.name = name
+        self.fields = fields
+
+
+def load_events(path):
+    events = []
+    for m in re.finditer(r'^TRACE_EVENT\((\w+),\s*(\d+),\s*"([^"]*)"\)', open(path).read(), re.M):
+        fields = m.group(3).split()
+        if len(fields) != int(m.group(2)):
+            raise SystemExit('%s: %s declara %s argumentos e %d campos' % (
+                path, m.group(1), m.group(2), len(fields)))
+        events.append(Event(len(events), m.group(1), fields))
+    if not events:
+        raise SystemExit('%s: nenhum TRACE_EVENT' % path)
+    return events
+
+
+def read_varint(data, pos):
+    """Retorna (valor, nova posicao) ou (None, pos) se os dados acabaram."""
+    value = shift = 0
+    while pos < len(data):
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7f) << shift
+        if b < 0x80:
+            return value, pos
+        shift += 7
+        if shift > 28:
+            raise ValueError('varint maior que 32 bits')
+    return None, pos
+
+
+def unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+class Decoder(object):
+    def __init__(self, events):
+        self.events = events
+        self.tick_hz = 1000000
+        self.shift = 0
+        self.time_us = 0.0
+        self.buf = bytearray()
+        self.errors = 0
+
+    def feed(self, data):
+        """Gera ('text', str) e ('event', tempo_us, Event, valores)."""
+        self.buf += data
+        pos = 0
+        text = bytearray()
+        while pos < len(self.buf):
+            b = self.buf[pos]
+            if b < 0x80:
+                text.append(b)
+                pos += 1
+                continue
+            ident = b & 0x7f
+            if ident >= len(self.events):
+                # id desconhecido: perde o sincronismo ate o proximo cabecalho
+                self.errors += 1
+                pos += 1
+                continue
+            ev = self.events[ident]
+            try:
+                p = pos + 1
+                ticks, p = read_varint(self.buf, p)
+                values = []
+                for _ in ev.fields:
+                    if ticks is None:
+                        break
+                    v, p = read_varint(self.buf, p)
+                    if v is None:
+                        ticks = None
+                        break
+                    values.append(unzigzag(v))
+            except ValueError:
+                self.errors += 1
+                pos += 1
+                continue
+            if ticks is None:
+                break       # registro incompleto, espera mais dados
+            if text:
+                yield ('text', text.decode('latin-1'))
+                text = bytearray()
+            pos = p
+            self.time_us += (ticks << self.shift) * 1e6 / self.tick_hz
+            if ev.name == 'INIT':
+                self.tick_hz, self.shift = values[0] & 0xffffffff, values[1]
+                self.time_us = 0.0
+            yield ('event', self.time_us, ev, values)
+        if text:
+            yield ('text', text.decode('latin-1'))
+        del self.buf[:pos]
+
+
+def open_input(path, baud):
+    if path == '-':
+        return sys.stdin.buffer
+    if path.startswith('/dev/') and not os.path.isfile(path):
+        try:
+            import serial
+        except ImportError:
+            raise SystemExit('pyserial nao instalado; capture a porta para um arquivo')
+        return serial.Serial(path, baud, timeout=0.1)
+    return open(path, 'rb')
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument('--events', default=DEFAULT_EVENTS)
+    ap.add_argument('--csv', action='store_true', help='um evento por linha, em CSV')
+    ap.add_argument('--event', help='so este evento (no CSV o cabecalho usa os campos dele)')
+    ap.add_argument('--baud', type=int, default=115200)
+    ap.add_argument('input')
+    args = ap.parse_args(argv)
+
+    events = load_events(args.events)
+    only = None
+    if args.event:
+        only = [e for e in events if e.name == args.event.upper()]
+        if not only:
+            ap.error('evento desconhecido: %s' % args.event)
+        only = only[0]
+
+    out = sys.stdout
+    if args.csv:
+        fields = only.fields if only else ['a%d' % i for i in range(max(len(e.fields) for e in events))]
+        out.write(','.join(['time_us', 'event'] + fields) + '\n')
+
+    dec = Decoder(events)
+    src = open_input(args.input, args.baud)
+    last = 0.0
+    try:
+        while True:
+            data = src.read(4096)
+            if not data:
+                if hasattr(src, 'in_waiting'):
+                    continue    # porta serial: timeout sem dados
+                break
+            for item in dec.feed(data):
+                if item[0] == 'text':
+                    if not args.csv and only is None:
+                        out.write(item[1])
+                    continue
+                _, t, ev, values = item
+                if only is not None and ev is not only:
+                    continue
+                if args.csv:
+                    out.write(','.join(['%.3f' % t, ev.name] + [str(v) for v in values]) + '\n')
+                else:
+                    out.write('%14.3f us %+12.3f  %-10s %s\n' % (
+                        t, t - last, ev.name,
+                        ' '.join('%s=%d' % fv for fv in zip(ev.fields, values))))
+                last = t
+            out.flush()
+    except KeyboardInterrupt:
+        pass
+    if dec.errors:
+        sys.stderr.write('%d bytes fora de sincronismo descartados\n' % dec.errors)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])